@@ -901,6 +901,11 @@ class AbstractMatcher {
   {
     return num_ + txt_ - buf_;
   }
+  /// Set the position of the start of the input in the input character sequence, when the input continues a previous input, to call before matching.
+  inline void position(size_t n) ///< new position
+  {
+    num_ = n;
+  }
   /// Returns the exclusive position of the last character of the match in the input character sequence, a constant-time operation.
   inline size_t last() const
     /// @returns position in the input character sequence
@@ -1394,14 +1399,19 @@ class AbstractMatcher {
       return false;
 #if WITH_SPAN
     (void)lineno();
-    cno_ = 0;
     if (bol_ + Const::BOLSZ - buf_ < txt_ - bol_)
     {
-      // this line is very long, so shift all the way to the match instead of to the begin of the last line
+      // this line is very long, so shift all the way to the match instead of to the begin of the last line, count columns up to the match to continue counting columns from there
       DBGLOG("Line in buffer is too long to shift, moving bol position to text match position");
       (void)columno();
       bol_ = txt_;
     }
+    else if (cpb_ < bol_)
+    {
+      // column counting restarts at the begin of the line
+      cpb_ = bol_;
+      cno_ = 0;
+    }
     size_t gap = bol_ - buf_;
     if (gap > 0)
     {
@@ -1414,6 +1424,7 @@ class AbstractMatcher {
       txt_ -= gap;
       bol_ -= gap;
       lpb_ -= gap;
+      cpb_ -= gap;
       num_ += gap;
       std::memmove(buf_, buf_ + gap, end_);
     }
@@ -1442,10 +1453,10 @@ class AbstractMatcher {
 #endif
       txt_ = newbuf + (txt_ - buf_);
       lpb_ = newbuf + (lpb_ - buf_);
+      cpb_ = newbuf + (cpb_ - buf_);
       buf_ = newbuf;
     }
     bol_ = buf_;
-    cpb_ = buf_;
 #else
     size_t gap = txt_ - buf_;
     if (max_ - end_ + gap >= need)
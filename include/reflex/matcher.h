@@ -102,7 +102,9 @@ class Matcher : public PatternMatcher<reflex::Pattern> {
     :
       PatternMatcher<reflex::Pattern>(matcher),
       ded_(matcher.ded_),
-      tab_(matcher.tab_)
+      tab_(matcher.tab_),
+      pmn_(0),
+      pmb_(0)
   {
     DBGLOG("Matcher::Matcher(matcher)");
   }
@@ -112,6 +114,8 @@ class Matcher : public PatternMatcher<reflex::Pattern> {
     PatternMatcher<reflex::Pattern>::operator=(matcher);
     ded_ = matcher.ded_;
     tab_ = matcher.tab_;
+    pmn_ = 0;
+    pmb_ = 0;
     return *this;
   }
   /// Polymorphic cloning.
@@ -126,6 +130,8 @@ class Matcher : public PatternMatcher<reflex::Pattern> {
     PatternMatcher<reflex::Pattern>::reset(opt);
     ded_ = 0;
     tab_.resize(0);
+    pmn_ = 0;
+    pmb_ = 0;
   }
   /// Returns captured text as a std::pair<const char*,size_t> with string pointer (non-0-terminated) and length.
   virtual std::pair<const char*,size_t> operator[](size_t n) const
@@ -445,6 +451,8 @@ class Matcher : public PatternMatcher<reflex::Pattern> {
   FSM               fsm_;      ///< local state for FSM code
   bool              mrk_;      ///< indent \i or dedent \j in pattern found: should check and update indent stops
   bool              anc_;      ///< match is anchored, advance slowly to retry when searching
+  size_t            pmn_;      ///< number of positions predicted to match by advance(), to measure the predict-match density
+  size_t            pmb_;      ///< number of bytes advanced by advance() to the positions predicted to match
 };
 
 } // namespace reflex
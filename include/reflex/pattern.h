@@ -43,8 +43,10 @@
 #include <reflex/input.h>
 #include <reflex/ranges.h>
 #include <reflex/setop.h>
+#include <algorithm>
 #include <cctype>
 #include <cstring>
+#include <exception>
 #include <iostream>
 #include <string>
 #include <list>
@@ -62,6 +64,11 @@
 // ugrep 3.7.0b: use a DFA as a tree to bypass DFA construction step when possible
 #define WITH_TREE_DFA
 
+// max size in bytes of the dense byte-class DFA transition table to fit in L2 cache, 0 disables the dense DFA
+#ifndef REFLEX_DENSE_MAX
+#define REFLEX_DENSE_MAX (256*1024)
+#endif
+
 #if (defined(__WIN32__) || defined(_WIN32) || defined(WIN32) || defined(_WIN64) || defined(__BORLANDC__)) && !defined(__CYGWIN__) && !defined(__MINGW32__) && !defined(__MINGW64__)
 # pragma warning( disable : 4290 )
 #endif
@@ -88,6 +95,9 @@ class Pattern {
     static const Index  LONG = 0xFFFE;     ///< LONG marker for 64 bit opcodes, must be HALT-1
     static const Index  HALT = 0xFFFF;     ///< HALT marker for GOTO opcodes, must be 16 bit max
     static const Hash   HASH = 0x1000;     ///< size of the predict match array
+    static const Index  DCODE = 0x80000000; ///< dense DFA state info flag: state is executed with opcodes at index
+    static const Index  DHALT = 0x40000000; ///< dense DFA state info flag: state halts without transitions
+    static const Index  DMIN = 6;          ///< option d minimizes a DFA with edges on DMIN or more characters per state on average
   };
   /// Construct an unset pattern.
   Pattern()
@@ -181,6 +191,9 @@ class Pattern {
     opc_ = NULL;
     nop_ = 0;
     fsm_ = NULL;
+    dtb_.clear();
+    dsi_.clear();
+    dnc_ = 0;
   }
   /// Assign a (new) pattern.
   Pattern& assign(
@@ -243,10 +256,12 @@ class Pattern {
     acc_ = pattern.acc_;
     vno_ = pattern.vno_;
     eno_ = pattern.eno_;
+    mno_ = pattern.mno_;
     pms_ = pattern.pms_;
     vms_ = pattern.vms_;
     ems_ = pattern.ems_;
     wms_ = pattern.wms_;
+    mms_ = pattern.mms_;
     if (pattern.nop_ > 0 && pattern.opc_ != NULL)
     {
       nop_ = pattern.nop_;
@@ -254,6 +269,10 @@ class Pattern {
       for (size_t i = 0; i < nop_; ++i)
         code[i] = pattern.opc_[i];
       opc_ = code;
+      dtb_ = pattern.dtb_;
+      dsi_ = pattern.dsi_;
+      dnc_ = pattern.dnc_;
+      memcpy(dcl_, pattern.dcl_, sizeof(dcl_));
     }
     else
     {
@@ -315,6 +334,12 @@ class Pattern {
   {
     return nop_ > 0 ? eno_ : 0;
   }
+  /// Get the number of finite state machine nodes (vertices) after DFA minimization with option d.
+  size_t minimized_nodes() const
+    /// @returns number of nodes or 0 when the DFA was not minimized
+  {
+    return nop_ > 0 ? mno_ : 0;
+  }
   /// Get the code size in number of words.
   size_t words() const
     /// @returns number of words or 0 when no code was generated by this pattern
@@ -351,6 +376,12 @@ class Pattern {
   {
     return wms_;
   }
+  /// Get elapsed DFA minimization time with option d.
+  float minimizing_time() const
+    /// @returns time in ms
+  {
+    return mno_ > 0 ? mms_ : 0.0f;
+  }
   /// Get elapsed time of indexing hash finite state automaton construction for the optional HFA.
   float hashing_time() const
     /// @returns time in ms
@@ -436,7 +467,11 @@ class Pattern {
   typedef uint8_t                 Lazy;
   typedef uint16_t                Iter;
   typedef uint16_t                Lookahead;
+#ifdef WITH_VECTOR
+  typedef std::vector<Lookahead>  Lookaheads; // sorted, use la_add() to add
+#else
   typedef std::set<Lookahead>     Lookaheads;
+#endif
   typedef uint32_t                Location;
   typedef ORanges<Location>       Locations;
   typedef std::map<int,Locations> Map;
@@ -545,6 +580,11 @@ class Pattern {
 #else
   inline static void pos_insert(Positions& s1, const Positions& s2) { s1.insert(s2.begin(), s2.end()); }
   inline static void pos_add(Positions& s, const Position& e) { s.insert(e); }
+#endif
+#ifdef WITH_VECTOR
+  inline static void la_add(Lookaheads& s, Lookahead e) { Lookaheads::iterator i = std::lower_bound(s.begin(), s.end(), e); if (i == s.end() || *i != e) s.insert(i, e); }
+#else
+  inline static void la_add(Lookaheads& s, Lookahead e) { s.insert(e); }
 #endif
   inline static void lazy_insert(Lazyset& s1, const Lazyset& s2) { s1.insert(s1.end(), s2.begin(), s2.end()); }
   inline static void lazy_add(Lazyset& s, const Lazy& e) { s.insert(s.end(), e); }
@@ -805,12 +845,14 @@ class Pattern {
   };
   /// Global modifier modes, syntax flags, and compiler options.
   struct Option {
-    Option() : b(), h(), e(), f(), i(), m(), n(), o(), p(), q(), r(), s(), w(), x(), z() { }
+    Option() : b(), d(), h(), e(), f(), i(), j(), m(), n(), o(), p(), q(), r(), s(), w(), x(), z() { }
     bool                     b; ///< disable escapes in bracket lists
+    bool                     d; ///< minimize the DFA when its edges span Const::DMIN or more characters per state on average
     bool                     h; ///< construct indexing hash finite state automaton
     Char                     e; ///< escape character, or > 255 for none, a backslash by default
     std::vector<std::string> f; ///< output the patterns and/or DFA to files(s)
     bool                     i; ///< case insensitive mode, also `(?i:X)`
+    size_t                   j; ///< number of threads to construct the DFA, serial when 0 or 1
     bool                     m; ///< multi-line mode, also `(?m:X)`
     std::string              n; ///< pattern name (for use in generated code)
     bool                     o; ///< generate optimized FSM code for option f
@@ -926,6 +968,21 @@ class Pattern {
       const Mods  modifiers,
       const Map&  lookahead,
       Moves&      moves) const;
+  void compile_batch(
+      const std::vector<DFA::State*>& batch,
+      std::vector<Moves>&             moves,
+      Follow&                         followpos,
+      const Mods                      modifiers,
+      const Map&                      lookahead) const;
+  void compile_worker(
+      const std::vector<DFA::State*>&  batch,
+      std::vector<Moves>&              moves,
+      std::vector<std::exception_ptr>& errors,
+      size_t                           first,
+      size_t                           step,
+      Follow&                          followpos,
+      const Mods                       modifiers,
+      const Map&                       lookahead) const;
   void transition(
       Moves&           moves,
       Chars&           chars,
@@ -939,8 +996,12 @@ class Pattern {
       Chars& chars) const;
   void flip(Chars& chars) const;
   void assemble(DFA::State *start);
+  void minimize_dfa(DFA::State *start);
   void compact_dfa(DFA::State *start);
   void encode_dfa(DFA::State *start);
+  void dense_dfa(const DFA::State *start);
+  void dense_code();
+  void dense_dfa(const std::vector<Index>& first);
   void gencode_dfa(const DFA::State *start) const;
   void check_dfa_closure(
       const DFA::State *state,
@@ -1002,6 +1063,10 @@ class Pattern {
       return at(loc + 1);
     return '\0';
   }
+  bool is_anchor_at(Location loc) const
+  {
+    return at(loc) == '^' || at(loc) == '$' || escapes_at(loc, "AzBb<>") != '\0';
+  }
   static inline bool is_modified(
       Mod        mod,
       const Mods modifiers,
@@ -1170,18 +1235,24 @@ class Pattern {
   size_t                vno_; ///< number of finite state machine vertices |V|
   size_t                eno_; ///< number of finite state machine edges |E|
   size_t                hno_; ///< number of indexing hash tables (HFA edges)
+  size_t                mno_; ///< number of finite state machine vertices |V| after DFA minimization
   const Opcode         *opc_; ///< points to the table with compiled finite state machine opcodes
   Index                 nop_; ///< number of opcodes generated
   FSM                   fsm_; ///< function pointer to FSM code
+  std::vector<uint16_t> dtb_; ///< dense DFA transition table dtb_[state * dnc_ + dcl_[c]] with target states or Const::HALT
+  std::vector<Index>    dsi_; ///< dense DFA state info: accept with Const::DHALT flag, or Const::DCODE flag with opcode index
+  size_t                dnc_; ///< number of dense DFA byte classes, dense DFA is used when dnc_ > 0
+  uint8_t               dcl_[256]; ///< dense DFA byte classes
   size_t                len_; ///< length of chr_[], less or equal to 255
   size_t                min_; ///< patterns after the prefix are at least this long but no more than 8
   size_t                pin_; ///< number of needles
   char                  chr_[256];         ///< pattern prefix string or character needles for needle-based search
   Pred                  bit_[256];         ///< bitap array
   Pred                  pmh_[Const::HASH]; ///< predict-match hash array
-  Pred                  pma_[Const::HASH]; ///< predict-match array
+  Pred                  pma_[Const::HASH + 3]; ///< predict-match array, padded with 3 bytes read by 32 bit gathers
   uint16_t              lcp_; ///< primary least common character position in the pattern or 0xffff
   uint16_t              lcs_; ///< secondary least common character position in the pattern or 0xffff
+  uint8_t               fld_[2]; ///< 0x20 to match a case-insensitive letter needle chr_[0] and chr_[1] when pin_ == 1
   size_t                bmd_; ///< Boyer-Moore jump distance on mismatch, B-M is enabled when bmd_ > 0
   uint8_t               bms_[256]; ///< Boyer-Moore skip array
   float                 pms_; ///< ms elapsed time to parse regex
@@ -1189,8 +1260,10 @@ class Pattern {
   float                 ems_; ///< ms elapsed time to compile DFA edges
   float                 wms_; ///< ms elapsed time to assemble code words
   float                 hms_; ///< ms elapsed time to construct the indexing hash finite state automaton HFA
+  float                 mms_; ///< ms elapsed time to minimize the DFA
   size_t                npy_; ///< entropy derived from the bitap array bit_[]
   bool                  one_; ///< true if matching one string stored in chr_[] without meta/anchors
+  bool                  bow_; ///< true if all matches begin at a word boundary \< checked after the match with BWB
 };
 
 } // namespace reflex
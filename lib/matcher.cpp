@@ -124,6 +124,79 @@ redo:
     const Pattern::Opcode *pc = pat_->opc_;
     Pattern::Index back = Pattern::Const::IMAX; // where to jump back to
     size_t bpos = 0; // backtrack position in the input
+    if (pat_->dnc_ > 0)
+    {
+      // dense DFA table lookups per byte class until a state requires opcodes for anchors, lookaheads or redo
+      const uint16_t *table = pat_->dtb_.data();
+      const Pattern::Index *infos = pat_->dsi_.data();
+      const uint8_t *classes = pat_->dcl_;
+      size_t width = pat_->dnc_;
+      Pattern::Index state = 0;
+      while (true)
+      {
+        Pattern::Index info = infos[state];
+        if ((info & Pattern::Const::DCODE))
+        {
+          pc = pat_->opc_ + (info & ~Pattern::Const::DCODE);
+          DBGLOG("Dense: code[%zu]", pc - pat_->opc_);
+          break;
+        }
+        if ((info & ~Pattern::Const::DHALT) > 0)
+        {
+          cap_ = info & ~Pattern::Const::DHALT;
+          cur_ = pos_;
+          DBGLOG("Dense take: cap = %zu", cap_);
+        }
+        if ((info & Pattern::Const::DHALT) || c1 == EOF)
+          goto halt;
+        if (pos_ < end_)
+        {
+          // block mode: scan the buffered input without get() until a state requires attention or the block ends
+          const char *s = buf_ + pos_;
+          const char *e = buf_ + end_;
+          do
+          {
+            c1 = static_cast<unsigned char>(*s++);
+            state = table[state * width + classes[c1]];
+            if (state == Pattern::Const::HALT)
+            {
+              pos_ = s - buf_;
+              goto halt;
+            }
+            if (infos[state] != 0)
+              break;
+            if (state == 0 && cap_ == 0 && method == Const::FIND)
+            {
+              // loop back to start state w/o full match: advance to avoid backtracking
+              size_t pos = s - buf_;
+              if (pos > cur_)
+                while (++cur_ < pos && (pat_->bit_[static_cast<uint8_t>(buf_[cur_])] & 1))
+                  continue;
+            }
+          } while (s < e);
+          pos_ = s - buf_;
+          DBGLOG("Dense block: c1 = %d (0x%x) at pos %zu", c1, c1, pos_ - 1);
+          continue;
+        }
+        c1 = get();
+        DBGLOG("Dense get: c1 = %d (0x%x) at pos %zu", c1, c1, pos_ - 1);
+        if (c1 == EOF)
+          goto halt;
+        state = table[state * width + classes[c1]];
+        if (state == Pattern::Const::HALT)
+          goto halt;
+        if (state == 0)
+        {
+          // loop back to start state w/o full match: advance to avoid backtracking
+          if (cap_ == 0 && pos_ > cur_ && method == Const::FIND)
+          {
+            // use bit_[] to check each char in buf_[cur_+1..pos_-1] if it is a starting char, if not then increase cur_
+            while (++cur_ < pos_ && (pat_->bit_[static_cast<uint8_t>(buf_[cur_])] & 1))
+              continue;
+          }
+        }
+      }
+    }
     while (true)
     {
       Pattern::Index jump;
@@ -496,6 +569,8 @@ unrolled:
       }
       pc = pat_->opc_ + jump;
     }
+halt:
+    DBGLOG("Halt: cap = %zu", cap_);
   }
 #if !defined(WITH_NO_INDENT)
   if (mrk_ && cap_ != Const::REDO)
@@ -583,15 +658,20 @@ unrolled:
         }
         if (pos_ > cur_) // if we didn't fail on META alone
         {
-          if (
+          bool found;
+          // skip needle and string hits after a word character when all matches begin at a word boundary
+          do
+          {
+            found =
 #if defined(COMPILE_AVX512BW)
-              simd_advance_avx512bw()
+              simd_advance_avx512bw();
 #elif defined(COMPILE_AVX2)
-              simd_advance_avx2()
+              simd_advance_avx2();
 #else
-              advance()
+              advance();
 #endif
-              )
+          } while (found && pat_->bow_ && isword(got_));
+          if (found)
           {
             if (!pat_->one_)
               goto scan;
@@ -734,14 +814,16 @@ bool Matcher::advance()
 #if defined(COMPILE_AVX512BW) || defined(COMPILE_AVX2)
       __m256i vlcp = _mm256_set1_epi8(chr[0]);
       __m256i vlcs = _mm256_set1_epi8(chr[1]);
+      __m256i vfldlcp = _mm256_set1_epi8(pat_->fld_[0]);
+      __m256i vfldlcs = _mm256_set1_epi8(pat_->fld_[1]);
       while (true)
       {
         const char *s = buf_ + loc + lcp;
         const char *e = buf_ + end_ + lcp - min + 1;
         while (s <= e - 32)
         {
-          __m256i vstrlcp = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s));
-          __m256i vstrlcs = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + lcs - lcp));
+          __m256i vstrlcp = _mm256_or_si256(vfldlcp, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s)));
+          __m256i vstrlcs = _mm256_or_si256(vfldlcs, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + lcs - lcp)));
           __m256i veqlcp = _mm256_cmpeq_epi8(vlcp, vstrlcp);
           __m256i veqlcs = _mm256_cmpeq_epi8(vlcs, vstrlcs);
           uint32_t mask = _mm256_movemask_epi8(_mm256_and_si256(veqlcp, veqlcs));
@@ -777,14 +859,16 @@ bool Matcher::advance()
 #elif defined(HAVE_AVX512BW) || defined(HAVE_AVX2) || defined(HAVE_SSE2)
       __m128i vlcp = _mm_set1_epi8(chr[0]);
       __m128i vlcs = _mm_set1_epi8(chr[1]);
+      __m128i vfldlcp = _mm_set1_epi8(pat_->fld_[0]);
+      __m128i vfldlcs = _mm_set1_epi8(pat_->fld_[1]);
       while (true)
       {
         const char *s = buf_ + loc + lcp;
         const char *e = buf_ + end_ + lcp - min + 1;
         while (s <= e - 16)
         {
-          __m128i vstrlcp = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s));
-          __m128i vstrlcs = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + lcs - lcp));
+          __m128i vstrlcp = _mm_or_si128(vfldlcp, _mm_loadu_si128(reinterpret_cast<const __m128i*>(s)));
+          __m128i vstrlcs = _mm_or_si128(vfldlcs, _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + lcs - lcp)));
           __m128i veqlcp = _mm_cmpeq_epi8(vlcp, vstrlcp);
           __m128i veqlcs = _mm_cmpeq_epi8(vlcs, vstrlcs);
           uint32_t mask = _mm_movemask_epi8(_mm_and_si128(veqlcp, veqlcs));
@@ -820,14 +904,16 @@ bool Matcher::advance()
 #elif defined(HAVE_NEON)
       uint8x16_t vlcp = vdupq_n_u8(chr[0]);
       uint8x16_t vlcs = vdupq_n_u8(chr[1]);
+      uint8x16_t vfldlcp = vdupq_n_u8(pat_->fld_[0]);
+      uint8x16_t vfldlcs = vdupq_n_u8(pat_->fld_[1]);
       while (true)
       {
         const char *s = buf_ + loc + lcp;
         const char *e = buf_ + end_ + lcp - min + 1;
         while (s <= e - 16)
         {
-          uint8x16_t vstrlcp = vld1q_u8(reinterpret_cast<const uint8_t*>(s));
-          uint8x16_t vstrlcs = vld1q_u8(reinterpret_cast<const uint8_t*>(s + lcs - lcp));
+          uint8x16_t vstrlcp = vorrq_u8(vfldlcp, vld1q_u8(reinterpret_cast<const uint8_t*>(s)));
+          uint8x16_t vstrlcs = vorrq_u8(vfldlcs, vld1q_u8(reinterpret_cast<const uint8_t*>(s + lcs - lcp)));
           uint8x16_t vmasklcp8 = vceqq_u8(vlcp, vstrlcp);
           uint8x16_t vmasklcs8 = vceqq_u8(vlcs, vstrlcs);
           uint64x2_t vmask64 = vreinterpretq_u64_u8(vandq_u8(vmasklcp8, vmasklcs8));
@@ -2818,6 +2904,51 @@ bool Matcher::advance()
       const char *s = buf_ + loc;
       const char *e = buf_ + end_ - 6;
       bool f = true;
+#if defined(COMPILE_AVX512BW) || defined(COMPILE_AVX2)
+      // predict matches at 8 positions at once with gathers after checking 4 positions, but only when matches were
+      // predicted at least 16 bytes apart on average, gathers do not pay off when matches are predicted densely
+      const char *t = s;
+      if (pmb_ >= 16 * pmn_ &&
+          s < e - 4 &&
+          Pattern::predict_match(pma, s) &&
+          Pattern::predict_match(pma, ++s) &&
+          Pattern::predict_match(pma, ++s) &&
+          Pattern::predict_match(pma, ++s))
+      {
+        // 32 bit gathers at pma[HASH-1] read 3 bytes of the padding of pma_[]
+        static_assert(sizeof(pat_->pma_) >= Pattern::Const::HASH + 3, "pma_[] is padded for 32 bit gathers");
+        const int *base = reinterpret_cast<const int*>(pma);
+        __m256i vhash = _mm256_set1_epi32(Pattern::Const::HASH - 1);
+        __m256i vff = _mm256_set1_epi32(0xff);
+        ++s;
+        while (s <= e - 10)
+        {
+          __m128i vstr = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s));
+          __m256i vb0 = _mm256_cvtepu8_epi32(vstr);
+          __m256i vb1 = _mm256_cvtepu8_epi32(_mm_srli_si128(vstr, 1));
+          __m256i vb2 = _mm256_cvtepu8_epi32(_mm_srli_si128(vstr, 2));
+          __m256i vb3 = _mm256_cvtepu8_epi32(_mm_srli_si128(vstr, 3));
+          // the hashes h1, h2, h3 of Pattern::predict_match(pma, s) at the 8 positions
+          __m256i vh1 = _mm256_and_si256(_mm256_xor_si256(_mm256_slli_epi32(vb0, 3), vb1), vhash);
+          __m256i vh2 = _mm256_and_si256(_mm256_xor_si256(_mm256_slli_epi32(vh1, 3), vb2), vhash);
+          __m256i vh3 = _mm256_and_si256(_mm256_xor_si256(_mm256_slli_epi32(vh2, 3), vb3), vhash);
+          __m256i va0 = _mm256_and_si256(_mm256_i32gather_epi32(base, vb0, 1), _mm256_set1_epi32(0xc0));
+          __m256i va1 = _mm256_and_si256(_mm256_i32gather_epi32(base, vh1, 1), _mm256_set1_epi32(0x30));
+          __m256i va2 = _mm256_and_si256(_mm256_i32gather_epi32(base, vh2, 1), _mm256_set1_epi32(0x0c));
+          __m256i va3 = _mm256_and_si256(_mm256_i32gather_epi32(base, vh3, 1), _mm256_set1_epi32(0x03));
+          __m256i vp = _mm256_or_si256(_mm256_or_si256(va0, va1), _mm256_or_si256(va2, va3));
+          __m256i vm = _mm256_or_si256(_mm256_srli_epi32(_mm256_or_si256(_mm256_srli_epi32(_mm256_or_si256(_mm256_srli_epi32(vp, 2), vp), 2), vp), 1), vp);
+          uint32_t mask = ~_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(vm, vff), vff))) & 0xff;
+          if (mask != 0)
+          {
+            // Pattern::predict_match(pma, s) predicts a match at this position
+            s += ctz(mask);
+            break;
+          }
+          s += 8;
+        }
+      }
+#endif
       while (s < e &&
           (f = (Pattern::predict_match(pma, s) &&
                 Pattern::predict_match(pma, ++s) &&
@@ -2826,6 +2957,15 @@ bool Matcher::advance()
       {
         ++s;
       }
+#if defined(COMPILE_AVX512BW) || defined(COMPILE_AVX2)
+      // measure the predict-match density, halve the counts to adapt to the input
+      if (++pmn_ >= 4096)
+      {
+        pmn_ >>= 1;
+        pmb_ >>= 1;
+      }
+      pmb_ += s - t;
+#endif
       loc = s - buf_;
       if (!f)
       {
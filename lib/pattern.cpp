@@ -41,6 +41,8 @@
 #include <cstdlib>
 #include <cerrno>
 #include <cmath>
+#include <system_error>
+#include <thread>
 
 /// DFA compaction: -1 == reverse order edge compression (best); 1 == edge compression; 0 == no edge compression.
 /** Edge compression reorders edges to produce fewer tests when executed in the compacted order.
@@ -105,6 +107,64 @@ static void print_char(FILE *file, int c, bool h = false)
     ::fprintf(file, "%u", c);
 }
 
+// count the trailing zero bits of a nonzero 64 bit word, ctzl() in simd.h is only defined with SSE2/AVX
+static inline size_t trailing_zeros(uint64_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<size_t>(__builtin_ctzll(x));
+#else
+  size_t n = 0;
+  if ((x & 0xffffffff) == 0)
+  {
+    x >>= 32;
+    n += 32;
+  }
+  if ((x & 0xffff) == 0)
+  {
+    x >>= 16;
+    n += 16;
+  }
+  if ((x & 0xff) == 0)
+  {
+    x >>= 8;
+    n += 8;
+  }
+  while ((x & 1) == 0)
+  {
+    x >>= 1;
+    ++n;
+  }
+  return n;
+#endif
+}
+
+// insert the runs of consecutive hashes marked in bits[] into the hashes, one range insertion per run, and clear bits[]
+static void insert_hashes(ORanges<Pattern::Hash>& hashes, uint64_t *bits)
+{
+  size_t lo = 0;
+  bool run = false;
+  for (size_t k = 0; k < Pattern::Const::HASH / 64; ++k)
+  {
+    uint64_t word = bits[k];
+    bits[k] = 0;
+    size_t i = 0;
+    while (i < 64)
+    {
+      uint64_t rest = (run ? ~word : word) >> i;
+      if (rest == 0)
+        break;
+      i += trailing_zeros(rest);
+      if (run)
+        hashes.insert(static_cast<Pattern::Hash>(lo), static_cast<Pattern::Hash>(64 * k + i - 1));
+      else
+        lo = 64 * k + i;
+      run = !run;
+    }
+  }
+  if (run)
+    hashes.insert(static_cast<Pattern::Hash>(lo), static_cast<Pattern::Hash>(Pattern::Const::HASH - 1));
+}
+
 static const char *posix_class[] = {
   "ASCII",
   "Space",
@@ -167,29 +227,38 @@ void Pattern::init(const char *options, const uint8_t *pred)
 {
   init_options(options);
   nop_ = 0;
+  dnc_ = 0;
   len_ = 0;
   min_ = 0;
   pin_ = 0;
   lcp_ = 0;
   lcs_ = 0;
+  fld_[0] = 0;
+  fld_[1] = 0;
   bmd_ = 0;
   npy_ = 0;
   one_ = false;
+  bow_ = false;
   vno_ = 0;
   eno_ = 0;
   hno_ = 0;
+  mno_ = 0;
   pms_ = 0.0;
   vms_ = 0.0;
   ems_ = 0.0;
   wms_ = 0.0;
   hms_ = 0.0;
+  mms_ = 0.0;
   if (opc_ != NULL || fsm_ != NULL )
   {
+    // construct the dense DFA of a precompiled opcode table
+    dense_code();
     if (pred != NULL)
     {
       len_ = pred[0];
       min_ = pred[1] & 0x0f;
       one_ = pred[1] & 0x10;
+      bow_ = pred[1] & 0x20;
       memcpy(chr_, pred + 2, len_);
       size_t n = len_ + 2;
       if (len_ == 0)
@@ -207,6 +276,7 @@ void Pattern::init(const char *options, const uint8_t *pred)
       {
         for (size_t i = 0; i < Const::HASH; ++i)
           pma_[i] = ~pred[i + n];
+        std::memset(pma_ + Const::HASH, 0xFF, sizeof(pma_) - Const::HASH);
       }
     }
   }
@@ -251,11 +321,17 @@ void Pattern::init(const char *options, const uint8_t *pred)
       start = dfa_.state(tfa_.root(), startpos);
       // compile the NFA into a DFA
       compile(start, followpos, modifiers, lookahead);
+      // minimize the DFA, not needed for a tree DFA of strings that is already minimal
+      if (opt_.d)
+        minimize_dfa(start);
     }
 #else
     DFA::State *start = dfa_.state(tfa_.tree, startpos);
     // compile the NFA into a DFA
     compile(start, followpos, modifiers, lookahead);
+    // minimize the DFA
+    if (opt_.d)
+      minimize_dfa(start);
 #endif
     // assemble DFA opcode tables or direct code
     assemble(start);
@@ -314,6 +390,7 @@ void Pattern::init(const char *options, const uint8_t *pred)
     uint16_t freqsum = 0;
     uint8_t freqlcp = 255; // max
     uint8_t freqlcs = 255; // max
+    Pred fold = 0; // positions with a case-insensitive ASCII letter
     size_t min = (min_ == 0 ? 1 : min_);
     for (uint16_t k = 0; k < min; ++k)
     {
@@ -321,18 +398,30 @@ void Pattern::init(const char *options, const uint8_t *pred)
       uint16_t n = 0;
       uint16_t sum = 0;
       uint8_t max = 0;
+      uint16_t lo = 256;
       // at position k count the matching characters and find the max character frequency
       for (uint16_t i = 0; i < 256; ++i)
       {
         if ((bit_[i] & mask) == 0)
         {
           ++n;
+          if (lo == 256)
+            lo = i;
           uint8_t freq = frequency(static_cast<uint8_t>(i));
           sum += freq;
           if (freq > max)
             max = freq;
         }
       }
+#if defined(HAVE_AVX512BW) || defined(HAVE_AVX2) || defined(HAVE_SSE2) || defined(HAVE_NEON)
+      // a case-insensitive ASCII letter is one needle to search with the 0x20 bit set in the input
+      if (n == 2 && lo >= 'A' && lo <= 'Z' && (bit_[lo | 0x20] & mask) == 0)
+      {
+        n = 1;
+        max = static_cast<uint8_t>(sum > 255 ? 255 : sum);
+        fold |= mask;
+      }
+#endif
       if (n <= pinmax)
       {
         // pick the fewest and rarest (least frequently occurring) needles to search
@@ -357,8 +446,8 @@ void Pattern::init(const char *options, const uint8_t *pred)
         }
       }
     }
-    // one position to pin: make lcp and lcs equal (compared and optimized later)
-    if (min == 1 || ((freqsum <= freqlcp || nlcs == 65535) && freqsum <= freqmax1))
+    // one position to pin: make lcp and lcs equal (compared and optimized later), but pin a case-insensitive letter needle too
+    if (min == 1 || ((freqsum <= freqlcp || nlcs == 65535) && freqsum <= freqmax1 && !(nlcs == 1 && (fold & (1 << lcs_)) != 0)))
     {
       nlcs = nlcp;
       lcs_ = lcp_;
@@ -375,11 +464,18 @@ void Pattern::init(const char *options, const uint8_t *pred)
       uint16_t j = 0, k = n;
       Pred masklcp = 1 << lcp_;
       Pred masklcs = 1 << lcs_;
+      // one needle per position: store the lower case letter of a case-insensitive needle to match with fld_[]
+      if (n == 1)
+      {
+        fld_[0] = (fold & masklcp) != 0 ? 0x20 : 0;
+        fld_[1] = (fold & masklcs) != 0 ? 0x20 : 0;
+      }
       for (uint16_t i = 0; i < 256; ++i)
       {
-        if ((bit_[i] & masklcp) == 0)
+        bool upper = n == 1 && i >= 'A' && i <= 'Z';
+        if ((bit_[i] & masklcp) == 0 && !(upper && fld_[0] != 0))
           chr_[j++] = static_cast<uint8_t>(i);
-        if ((bit_[i] & masklcs) == 0)
+        if ((bit_[i] & masklcs) == 0 && !(upper && fld_[1] != 0))
           chr_[k++] = static_cast<uint8_t>(i);
       }
       // fill up the rest of the character tables with duplicates if necessary
@@ -456,8 +552,10 @@ void Pattern::init(const char *options, const uint8_t *pred)
 void Pattern::init_options(const char *options)
 {
   opt_.b = false;
+  opt_.d = false;
   opt_.h = false;
   opt_.i = false;
+  opt_.j = 0;
   opt_.m = false;
   opt_.o = false;
   opt_.p = false;
@@ -476,6 +574,9 @@ void Pattern::init_options(const char *options)
         case 'b':
           opt_.b = true;
           break;
+        case 'd':
+          opt_.d = true;
+          break;
         case 'e':
           opt_.e = (*(s += (s[1] == '=') + 1) == ';' || *s == '\0' ? 256 : *s++);
           --s;
@@ -486,6 +587,12 @@ void Pattern::init_options(const char *options)
         case 'i':
           opt_.i = true;
           break;
+        case 'j':
+          s += (s[1] == '=');
+          opt_.j = 0;
+          while (std::isdigit(static_cast<unsigned char>(s[1])))
+            opt_.j = 10 * opt_.j + (*++s - '0');
+          break;
         case 'm':
           opt_.m = true;
           break;
@@ -1581,19 +1688,51 @@ void Pattern::compile(
     table[hash_pos(start)] = start;
   // last added state
   DFA::State *last_state = start;
+  // expand batches of pending states with threads, but not when compile_transition() updates followpos of lazy or negated
+  // positions or trims followpos of anchors with trim_anchors()
+  size_t threads = opt_.w ? 1 : opt_.j;
+  for (Positions::const_iterator p = start->begin(); p != start->end() && threads > 1; ++p)
+    if (p->lazy() || p->negate() || (!p->accept() && is_anchor_at(p->loc())))
+      threads = 1;
+  for (Follow::const_iterator i = followpos.begin(); i != followpos.end() && threads > 1; ++i)
+    for (Positions::const_iterator p = i->second.begin(); p != i->second.end() && threads > 1; ++p)
+      if (p->lazy() || p->negate() || (!p->accept() && is_anchor_at(p->loc())))
+        threads = 1;
+  std::vector<DFA::State*> batch;
+  std::vector<Moves> batch_moves;
+  size_t batch_next = 0;
   for (DFA::State *state = start; state; state = state->next)
   {
     Moves moves;
     timer_start(et);
-    // use the tree DFA accept state, if present
-    if (state->tnode != NULL && state->tnode->accept > 0)
-      state->accept = state->tnode->accept;
-    compile_transition(
-        state,
-        followpos,
-        modifiers,
-        lookahead,
-        moves);
+    if (threads > 1 && batch_next >= batch.size())
+    {
+      // batch the pending states, then the states are added in the same order as the serial construction
+      batch.clear();
+      batch_next = 0;
+      for (DFA::State *next = state; next != NULL && batch.size() < 4096; next = next->next)
+        batch.push_back(next);
+      if (batch.size() < 4 * threads)
+        batch.clear();
+      else
+        compile_batch(batch, batch_moves, followpos, modifiers, lookahead);
+    }
+    if (batch_next < batch.size())
+    {
+      moves.swap(batch_moves[batch_next++]);
+    }
+    else
+    {
+      // use the tree DFA accept state, if present
+      if (state->tnode != NULL && state->tnode->accept > 0)
+        state->accept = state->tnode->accept;
+      compile_transition(
+          state,
+          followpos,
+          modifiers,
+          lookahead,
+          moves);
+    }
     if (state->tnode != NULL)
     {
 #ifdef WITH_TREE_DFA
@@ -2283,6 +2422,72 @@ void Pattern::trim_lazy(Positions *pos) const
 #endif
 }
 
+void Pattern::compile_batch(
+    const std::vector<DFA::State*>& batch,
+    std::vector<Moves>&             moves,
+    Follow&                         followpos,
+    const Mods                      modifiers,
+    const Map&                      lookahead) const
+{
+  DBGLOG("BEGIN compile_batch(%zu)", batch.size());
+  size_t threads = std::min(opt_.j, batch.size());
+  std::vector<std::exception_ptr> errors(batch.size());
+  std::vector<std::thread> workers;
+  moves.clear();
+  moves.resize(batch.size());
+  workers.reserve(threads - 1);
+  try
+  {
+    for (size_t i = 1; i < threads; ++i)
+      workers.push_back(std::thread(&Pattern::compile_worker, this, std::cref(batch), std::ref(moves), std::ref(errors), i, threads, std::ref(followpos), modifiers, std::cref(lookahead)));
+  }
+  catch (const std::system_error&)
+  {
+    // could not create more threads, continue with the workers we have
+    threads = workers.size() + 1;
+  }
+  compile_worker(batch, moves, errors, 0, threads, followpos, modifiers, lookahead);
+  for (std::vector<std::thread>::iterator i = workers.begin(); i != workers.end(); ++i)
+    i->join();
+  // rethrow the error of the first state in the batch, same as the serial construction
+  for (std::vector<std::exception_ptr>::const_iterator i = errors.begin(); i != errors.end(); ++i)
+    if (*i)
+      std::rethrow_exception(*i);
+}
+
+void Pattern::compile_worker(
+    const std::vector<DFA::State*>&  batch,
+    std::vector<Moves>&              moves,
+    std::vector<std::exception_ptr>& errors,
+    size_t                           first,
+    size_t                           step,
+    Follow&                          followpos,
+    const Mods                       modifiers,
+    const Map&                       lookahead) const
+{
+  for (size_t i = first; i < batch.size(); i += step)
+  {
+    DFA::State *state = batch[i];
+    try
+    {
+      // use the tree DFA accept state, if present
+      if (state->tnode != NULL && state->tnode->accept > 0)
+        state->accept = state->tnode->accept;
+      compile_transition(
+          state,
+          followpos,
+          modifiers,
+          lookahead,
+          moves[i]);
+    }
+    catch (...)
+    {
+      errors[i] = std::current_exception();
+      return;
+    }
+  }
+}
+
 void Pattern::compile_transition(
     DFA::State *state,
     Follow&     followpos,
@@ -2325,7 +2530,7 @@ void Pattern::compile_transition(
             Lookahead l = n + static_cast<Lookahead>(std::distance(i->second.begin(), j));
             if (l < n)
               error(regex_error::exceeds_limits, loc);
-            state->heads.insert(l);
+            la_add(state->heads, l);
           }
           Lookahead k = n;
           n += static_cast<Lookahead>(i->second.size());
@@ -2349,7 +2554,7 @@ void Pattern::compile_transition(
               Lookahead l = n + static_cast<Lookahead>(std::distance(i->second.begin(), j));
               if (l < n)
                 error(regex_error::exceeds_limits, loc);
-              state->tails.insert(l);
+              la_add(state->tails, l);
             }
             Lookahead k = n;
             n += static_cast<Lookahead>(i->second.size());
@@ -2735,6 +2940,7 @@ void Pattern::assemble(DFA::State *start)
   predict_match_dfa(start);
   compact_dfa(start);
   encode_dfa(start);
+  dense_dfa(start);
   wms_ = timer_elapsed(t);
   if (!opt_.f.empty())
   {
@@ -2746,6 +2952,188 @@ void Pattern::assemble(DFA::State *start)
   DBGLOG("END assemble()");
 }
 
+/// Order DFA states by the hash of their signature, then by their signature, to partition states into blocks.
+struct SignatureOrder {
+  SignatureOrder(
+      const std::vector<Pattern::Index>& pool,
+      const std::vector<Pattern::Index>& offset,
+      const std::vector<Pattern::Index>& hash)
+    :
+      pool(pool),
+      offset(offset),
+      hash(hash)
+  { }
+  bool less(Pattern::Index a, Pattern::Index b) const
+  {
+    if (hash[a] != hash[b])
+      return hash[a] < hash[b];
+    return std::lexicographical_compare(pool.begin() + offset[a], pool.begin() + offset[a + 1], pool.begin() + offset[b], pool.begin() + offset[b + 1]);
+  }
+  bool operator()(Pattern::Index a, Pattern::Index b) const
+  {
+    return less(a, b);
+  }
+  const std::vector<Pattern::Index>& pool;   ///< signatures of all states
+  const std::vector<Pattern::Index>& offset; ///< signature of state k is pool[offset[k]..offset[k+1]-1]
+  const std::vector<Pattern::Index>& hash;   ///< hash of the signature of each state
+};
+
+void Pattern::minimize_dfa(DFA::State *start)
+{
+  DBGLOG("BEGIN minimize_dfa()");
+  timer_type t;
+  timer_start(t);
+  // number the states, the state index is reassigned later by encode_dfa()
+  std::vector<DFA::State*> states;
+  for (DFA::State *state = start; state; state = state->next)
+  {
+    state->index = static_cast<Index>(states.size());
+    states.push_back(state);
+  }
+  Index n = static_cast<Index>(states.size());
+  // minimizing pays off when the edges of the states span many characters to compile and assemble, such as Unicode
+  // character classes, but a DFA with few characters per state such as (a|b)*a(a|b){8} is not reduced and takes up to
+  // 30% longer to construct, measured with option d: (a|b)*a(a|b){10} 5.3ms->7.2ms, \w+_index 106ms->78ms
+  size_t edges = 0;
+  for (Index k = 0; k < n; ++k)
+    for (DFA::State::Edges::const_iterator i = states[k]->edges.begin(); i != states[k]->edges.end(); ++i)
+      edges += i->second.first - i->first + 1;
+  if (edges < static_cast<size_t>(Const::DMIN) * n)
+  {
+    DBGLOG("END minimize_dfa() skipped with %zu edge characters", edges);
+    return;
+  }
+  // states of the tree DFA of strings without positions are in blocks of their own, because strings have distinct
+  // accepts, the initial blocks partition the other states by accept, redo, heads and tails
+  std::vector<Index> block(n);
+  std::vector<Index> refine;
+  std::map<std::vector<Index>,Index> initial;
+  std::vector<Index> key;
+  Index fixed = 0;
+  for (Index k = 0; k < n; ++k)
+  {
+    const DFA::State *state = states[k];
+    if (state->tnode != NULL && state->empty())
+    {
+      block[k] = fixed++;
+      continue;
+    }
+    key.clear();
+    key.push_back(state->accept);
+    key.push_back(state->redo);
+    key.push_back(static_cast<Index>(state->heads.size()));
+    key.insert(key.end(), state->heads.begin(), state->heads.end());
+    key.insert(key.end(), state->tails.begin(), state->tails.end());
+    block[k] = initial.insert(std::pair<std::vector<Index>,Index>(key, static_cast<Index>(initial.size()))).first->second;
+    refine.push_back(k);
+  }
+  for (std::vector<Index>::const_iterator k = refine.begin(); k != refine.end(); ++k)
+    block[*k] += fixed;
+  Index m = static_cast<Index>(refine.size());
+  Index blocks = fixed + static_cast<Index>(initial.size());
+  // Moore's partition refinement: split blocks until all states in a block have edges on the same chars to states
+  // in the same blocks, such that equivalent states assemble to the same opcodes
+  std::vector<Index> remain;
+  std::vector<Index> group;
+  std::vector<Index> pool;
+  std::vector<Index> offset(m + 1);
+  std::vector<Index> hash(m);
+  std::vector<Index> order(m);
+  SignatureOrder signature_order(pool, offset, hash);
+  while (m > 0)
+  {
+    pool.clear();
+    for (Index j = 0; j < m; ++j)
+    {
+      const DFA::State *state = states[refine[j]];
+      offset[j] = static_cast<Index>(pool.size());
+      pool.push_back(block[refine[j]]);
+      for (DFA::State::Edges::const_iterator i = state->edges.begin(); i != state->edges.end(); ++i)
+      {
+        if (i->second.second == NULL)
+          continue;
+        Index lo = i->first;
+        Index hi = i->second.first;
+        Index to = block[i->second.second->index];
+        // normalize edges by merging adjacent char ranges that go to the same block
+        if (pool.size() > offset[j] + 1 && pool[pool.size() - 2] + 1 == lo && pool.back() == to)
+        {
+          pool[pool.size() - 2] = hi;
+        }
+        else
+        {
+          pool.push_back(lo);
+          pool.push_back(hi);
+          pool.push_back(to);
+        }
+      }
+      Index h = 2166136261U;
+      for (std::vector<Index>::const_iterator i = pool.begin() + offset[j]; i != pool.end(); ++i)
+        h = (h ^ *i) * 16777619U;
+      hash[j] = h;
+      order[j] = j;
+    }
+    offset[m] = static_cast<Index>(pool.size());
+    std::sort(order.begin(), order.begin() + m, signature_order);
+    // states that end up in a block of their own cannot be split further and are no longer refined
+    remain.clear();
+    group.clear();
+    Index groups = 0;
+    for (Index j = 0; j < m; )
+    {
+      Index e = j + 1;
+      while (e < m && !signature_order.less(order[j], order[e]))
+        ++e;
+      if (e - j == 1)
+      {
+        block[refine[order[j]]] = fixed++;
+      }
+      else
+      {
+        for (Index i = j; i < e; ++i)
+        {
+          remain.push_back(refine[order[i]]);
+          group.push_back(groups);
+        }
+        ++groups;
+      }
+      j = e;
+    }
+    for (size_t i = 0; i < remain.size(); ++i)
+      block[remain[i]] = fixed + group[i];
+    refine.swap(remain);
+    m = static_cast<Index>(refine.size());
+    if (fixed + groups == blocks)
+      break;
+    blocks = fixed + groups;
+  }
+  mno_ = blocks;
+  if (blocks < n)
+  {
+    // the first state of a block, i.e. the start state for its block, represents the block
+    std::vector<DFA::State*> represent(blocks, NULL);
+    for (Index k = 0; k < n; ++k)
+      if (represent[block[k]] == NULL)
+        represent[block[k]] = states[k];
+    DFA::State *last = NULL;
+    for (Index k = 0; k < n; ++k)
+    {
+      DFA::State *state = states[k];
+      if (represent[block[k]] != state)
+        continue;
+      for (DFA::State::Edges::iterator i = state->edges.begin(); i != state->edges.end(); ++i)
+        if (i->second.second != NULL)
+          i->second.second = represent[block[i->second.second->index]];
+      if (last != NULL)
+        last->next = state;
+      last = state;
+    }
+    last->next = NULL;
+  }
+  mms_ = timer_elapsed(t);
+  DBGLOG("END minimize_dfa()");
+}
+
 void Pattern::compact_dfa(DFA::State *start)
 {
 #if WITH_COMPACT_DFA == -1
@@ -3047,6 +3435,138 @@ void Pattern::encode_dfa(DFA::State *start)
   }
 }
 
+void Pattern::dense_dfa(const DFA::State *start)
+{
+  dtb_.clear();
+  dsi_.clear();
+  dnc_ = 0;
+  // no dense DFA when disabled or when GOTO LONG opcodes are used, the table would not fit in L2 anyway
+  if (REFLEX_DENSE_MAX == 0 || nop_ == 0 || nop_ > Const::LONG)
+    return;
+  // the opcode index of each DFA state, followed by the end of the opcodes
+  std::vector<Index> first;
+  for (const DFA::State *state = start; state; state = state->next)
+    first.push_back(state->index);
+  first.push_back(nop_);
+  dense_dfa(first);
+}
+
+void Pattern::dense_code()
+{
+  dtb_.clear();
+  dsi_.clear();
+  dnc_ = 0;
+  if (REFLEX_DENSE_MAX == 0 || opc_ == NULL)
+    return;
+  // the states of an opcode table are stored in order, each state is a GOTO target except the start state at index 0
+  // and the GOTOs of a state end with the GOTO (or HALT) on the range of chars starting at 0, see encode_dfa()
+  std::set<Index> states;
+  std::vector<Index> pending(1, 0);
+  Index end = 0;
+  states.insert(0);
+  while (!pending.empty())
+  {
+    Index pc = pending.back();
+    pending.pop_back();
+    while (is_opcode_take(opc_[pc]) || is_opcode_redo(opc_[pc]) || is_opcode_tail(opc_[pc]) || is_opcode_head(opc_[pc]))
+      ++pc;
+    while (true)
+    {
+      Opcode opcode = opc_[pc++];
+      Index target = index_of(opcode);
+      // no dense DFA when GOTO LONG opcodes are used
+      if (target == Const::LONG || pc > Const::LONG)
+        return;
+      if (target != Const::HALT && states.insert(target).second)
+        pending.push_back(target);
+      if (!is_opcode_meta(opcode) && lo_of(opcode) == 0)
+        break;
+    }
+    if (pc > end)
+      end = pc;
+  }
+  std::vector<Index> first(states.begin(), states.end());
+  first.push_back(end);
+  dense_dfa(first);
+}
+
+void Pattern::dense_dfa(const std::vector<Index>& first)
+{
+  // map the opcode index of each DFA state to its dense state number
+  Index states = static_cast<Index>(first.size() - 1);
+  std::vector<Index> state_of(first.back(), Const::IMAX);
+  for (Index state = 0; state < states; ++state)
+    state_of[first[state]] = state;
+  dsi_.resize(states);
+  bool split[256] = { false };
+  // the first pass splits bytes into classes of bytes with the same transitions, the second pass fills the table
+  for (int pass = 0; pass < 2; ++pass)
+  {
+    for (Index state = 0; state < states; ++state)
+    {
+      Index pc = first[state];
+      Index end = first[state + 1];
+      Index info = 0;
+      if (pc < end && is_opcode_take(opc_[pc]))
+        info = long_index_of(opc_[pc++]);
+      if (pc >= end || !is_opcode_goto(opc_[pc]))
+      {
+        // REDO, TAIL, HEAD and meta opcodes for anchors and lookaheads are executed with opcodes
+        dsi_[state] = Const::DCODE | first[state];
+        continue;
+      }
+      if (opc_[pc] == opcode_halt())
+      {
+        dsi_[state] = info | Const::DHALT;
+        continue;
+      }
+      dsi_[state] = info;
+      // the first GOTO opcode with a range that includes a byte is taken, as in Matcher::match()
+      uint16_t row[256];
+      bool set[256] = { false };
+      for (; pc < end; ++pc)
+      {
+        Opcode opcode = opc_[pc];
+        Index target = index_of(opcode);
+        uint16_t next = static_cast<uint16_t>(target == Const::HALT ? Const::HALT : state_of[target]);
+        for (Char c = lo_of(opcode); c <= hi_of(opcode); ++c)
+        {
+          if (!set[c])
+          {
+            set[c] = true;
+            row[c] = next;
+          }
+        }
+      }
+      if (pass == 0)
+      {
+        for (Char c = 1; c < 256; ++c)
+          split[c] = split[c] || row[c] != row[c - 1];
+      }
+      else
+      {
+        for (Char c = 0; c < 256; ++c)
+          dtb_[state * dnc_ + dcl_[c]] = row[c];
+      }
+    }
+    if (pass == 0)
+    {
+      // no dense DFA when the start state requires opcodes or when the table does not fit
+      dcl_[0] = 0;
+      for (Char c = 1; c < 256; ++c)
+        dcl_[c] = static_cast<uint8_t>(dcl_[c - 1] + split[c]);
+      dnc_ = dcl_[255] + 1;
+      if ((dsi_[0] & Const::DCODE) || states * dnc_ * sizeof(uint16_t) > REFLEX_DENSE_MAX)
+      {
+        dsi_.clear();
+        dnc_ = 0;
+        return;
+      }
+      dtb_.assign(states * dnc_, Const::HALT);
+    }
+  }
+}
+
 void Pattern::gencode_dfa(const DFA::State *start) const
 {
   for (std::vector<std::string>::const_iterator i = opt_.f.begin(); i != opt_.f.end(); ++i)
@@ -3868,7 +4388,35 @@ void Pattern::predict_match_dfa(const DFA::State *start)
     }
 #endif
   }
-  DBGLOG("min = %zu len = %zu", min_, len_);
+  // all matches begin at a word boundary when no accepting state is reachable without passing a \< BWB edge, an edge
+  // of \b spans BWB..EWB and also matches at the end of a word
+  bow_ = false;
+  if (start->accept == 0 && !start->redo)
+  {
+    std::set<const DFA::State*> visited;
+    std::vector<const DFA::State*> stack;
+    visited.insert(start);
+    stack.push_back(start);
+    bow_ = true;
+    while (bow_ && !stack.empty())
+    {
+      const DFA::State *from = stack.back();
+      stack.pop_back();
+      for (DFA::State::Edges::const_iterator t = from->edges.begin(); t != from->edges.end(); ++t)
+      {
+        const DFA::State *next = t->second.second;
+        if ((t->first == META_BWB && t->second.first == META_BWB) || next == NULL || !visited.insert(next).second)
+          continue;
+        if (next->accept > 0 || next->redo)
+        {
+          bow_ = false;
+          break;
+        }
+        stack.push_back(next);
+      }
+    }
+  }
+  DBGLOG("min = %zu len = %zu bow = %d", min_, len_, bow_);
   DBGLOG("END Pattern::predict_match_dfa()");
 }
 
@@ -3932,6 +4480,8 @@ void Pattern::gen_predict_match_start(const DFA::State *state, std::map<const DF
 
 void Pattern::gen_predict_match_transitions(size_t level, const DFA::State *state, const ORanges<Hash>& previous, std::map<const DFA::State*,ORanges<Hash> >& hashes)
 {
+  // next hashes are marked in bits[] first, then inserted as ranges, which is much faster than inserting each hash
+  uint64_t bits[Const::HASH / 64] = { 0 };
   for (DFA::State::Edges::const_iterator edge = state->edges.begin(); edge != state->edges.end(); ++edge)
   {
     Char lo = edge->first;
@@ -3987,10 +4537,11 @@ void Pattern::gen_predict_match_transitions(size_t level, const DFA::State *stat
               Hash h = hash(prev, static_cast<uint8_t>(ch));
               pmh_[h] &= pmh_mask;
               pma_[h] &= pma_mask;
-              next_hashes->insert(h);
+              bits[h >> 6] |= 1ULL << (h & 63);
             }
           }
         }
+        insert_hashes(*next_hashes, bits);
       }
       else
       {
@@ -4028,10 +4579,11 @@ void Pattern::gen_predict_match_transitions(size_t level, const DFA::State *stat
             {
               Hash h = hash(prev, static_cast<uint8_t>(ch));
               pmh_[h] &= pmh_mask;
-              next_hashes->insert(h);
+              bits[h >> 6] |= 1ULL << (h & 63);
             }
           }
         }
+        insert_hashes(*next_hashes, bits);
       }
       else
       {
@@ -4232,7 +4784,7 @@ bool Pattern::match_hfa_transitions(size_t level, const HFA::Hashes& hashes, con
 void Pattern::write_predictor(FILE *file) const
 {
   ::fprintf(file, "const reflex::Pattern::Pred reflex_pred_%s[%zu] = {", opt_.n.empty() ? "FSM" : opt_.n.c_str(), 2 + len_ + (len_ == 0) * 256 + Const::HASH);
-  ::fprintf(file, "\n  %3hhu,%3hhu,", static_cast<uint8_t>(len_), (static_cast<uint8_t>(min_ | (one_ << 4))));
+  ::fprintf(file, "\n  %3hhu,%3hhu,", static_cast<uint8_t>(len_), (static_cast<uint8_t>(min_ | (one_ << 4) | (bow_ << 5))));
   for (size_t i = 0; i < len_; ++i)
     ::fprintf(file, "%s%3hhu,", ((i + 2) & 0xF) ? "" : "\n  ", static_cast<uint8_t>(chr_[i]));
   if (len_ == 0)
@@ -86,6 +86,7 @@ extern bool flag_files;
 extern bool flag_files_with_matches;
 extern bool flag_files_without_match;
 extern bool flag_fixed_strings;
+extern bool flag_follow;
 extern bool flag_glob_ignore_case;
 extern bool flag_grep; // internal flag
 extern bool flag_hex;
@@ -144,6 +145,7 @@ extern Action flag_directories_action; // internal flag
 extern size_t flag_after_context;
 extern size_t flag_before_context;
 extern size_t flag_delay;
+extern size_t flag_device_jobs;
 extern size_t flag_exclude_iglob_size; // internal flag
 extern size_t flag_exclude_iglob_dir_size; // internal flag
 extern size_t flag_fuzzy;
@@ -157,6 +159,7 @@ extern size_t flag_max_count;
 extern size_t flag_max_depth;
 extern size_t flag_max_files;
 extern size_t flag_max_line;
+extern size_t flag_max_memory;
 extern size_t flag_max_mmap;
 extern size_t flag_min_count;
 extern size_t flag_min_depth;
@@ -167,8 +170,10 @@ extern size_t flag_not_magic;
 extern size_t flag_tabs;
 extern size_t flag_width;
 extern size_t flag_zmax;
+extern const char *flag_affinity;
 extern const char *flag_apply_color; // internal flag
 extern const char *flag_binary_files;
+extern const char *flag_checkpoint;
 extern const char *flag_color;
 extern const char *flag_colors;
 extern const char *flag_config;
@@ -192,6 +197,7 @@ extern const char *flag_separator;
 extern const char *flag_separator_dash; // internal flag
 extern const char *flag_separator_plus; // internal flag
 extern const char *flag_separator_bar; // internal flag
+extern const char *flag_snapshot;
 extern const char *flag_sort;
 extern const char *flag_stats;
 extern const char *flag_tag;
@@ -0,0 +1,341 @@
+/******************************************************************************\
+* Copyright (c) 2019, Robert van Engelen, Genivia Inc. All rights reserved.    *
+*                                                                              *
+* Redistribution and use in source and binary forms, with or without           *
+* modification, are permitted provided that the following conditions are met:  *
+*                                                                              *
+*   (1) Redistributions of source code must retain the above copyright notice, *
+*       this list of conditions and the following disclaimer.                  *
+*                                                                              *
+*   (2) Redistributions in binary form must reproduce the above copyright      *
+*       notice, this list of conditions and the following disclaimer in the    *
+*       documentation and/or other materials provided with the distribution.   *
+*                                                                              *
+*   (3) The name of the author may not be used to endorse or promote products  *
+*       derived from this software without specific prior written permission.  *
+*                                                                              *
+* THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR IMPLIED *
+* WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF         *
+* MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO   *
+* EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,       *
+* SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, *
+* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;  *
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,     *
+* WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR      *
+* OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF       *
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                                   *
+\******************************************************************************/
+
+/**
+@file      mkpacks.cpp
+@brief     precompile the bundled pattern files to embed them in ugrep
+@author    Robert van Engelen - engelen@genivia.com
+@copyright (c) 2019-2023, Robert van Engelen, Genivia Inc. All rights reserved.
+@copyright (c) BSD-3 License - see LICENSE.txt
+*/
+
+// Usage: mkpacks [--verify] FILE.cpp PATTERNFILE ...
+//
+// Writes the DFA opcode tables and predict match data of the PATTERNFILEs to
+// FILE.cpp with a packs[] table of struct Pack (pack.hpp) to look them up by
+// regex.  The regex is constructed in the same way as ugrep -f PATTERNFILE
+// constructs it with the default options, which makes a pack applicable only
+// when ugrep's regex and conversion flags are exactly the same.
+//
+// The generated src/packs.cpp is distributed with ugrep, run "make packs" in
+// src/ to regenerate it.  With --verify, FILE.cpp is not written but compared
+// to the packs generated from the PATTERNFILEs, which fails when FILE.cpp is
+// out of date with the pattern files or with the DFA opcodes of the library.
+// "make test" runs "make check-packs" in src/ to verify src/packs.cpp.
+
+#include "pack.hpp"
+#include <reflex/matcher.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+// pattern files with DFAs of at least this many edges are precompiled, smaller DFAs are quickly constructed at run time
+#ifndef PACK_MIN_EDGES
+#define PACK_MIN_EDGES 100000
+#endif
+
+// the regex conversion flags of ugrep without -G, -U, -Y and --free-space
+static const reflex::convert_flag_type convert_flags = reflex::convert_flag::notnewline | reflex::convert_flag::unicode;
+
+// read the non-empty lines of a pattern file to construct a |-concatenated regex like ugrep -f FILE, returns false if no patterns
+static bool read_patterns(const char *filename, std::string& regex)
+{
+  FILE *file = fopen(filename, "r");
+
+  if (file == NULL)
+    return false;
+
+  reflex::BufferedInput input(file);
+  std::string line;
+  int ch;
+
+  regex.clear();
+
+  while (true)
+  {
+    line.erase();
+
+    while ((ch = input.get()) != EOF && ch != '\n')
+      line.push_back(ch);
+
+    if (!line.empty() && line.back() == '\r')
+      line.pop_back();
+
+    if (ch == EOF && line.empty())
+      break;
+
+    if (!line.empty())
+      regex.append(line).push_back('|');
+  }
+
+  fclose(file);
+
+  if (regex.empty())
+    return false;
+
+  // pop the ending '|' and prepend the (?m) multiline mode like ugrep
+  regex.pop_back();
+  regex.insert(0, "(?m)");
+
+  return true;
+}
+
+// remove the opcode comments written by the Pattern f= option to reduce the size of the distributed FILE.cpp
+static bool strip_comments(const char *filename)
+{
+  FILE *file = fopen(filename, "r");
+
+  if (file == NULL)
+    return false;
+
+  std::string text;
+  char buf[4096];
+  size_t len;
+
+  while ((len = fread(buf, 1, sizeof(buf), file)) > 0)
+    text.append(buf, len);
+
+  fclose(file);
+
+  file = fopen(filename, "w");
+
+  if (file == NULL)
+    return false;
+
+  size_t pos = 0;
+
+  while (pos < text.size())
+  {
+    size_t end = text.find('\n', pos);
+
+    if (end == std::string::npos)
+      end = text.size();
+
+    std::string line(text, pos, end - pos);
+
+    // opcode lines are indented hex words followed by an optional comma and a // comment
+    if (line.compare(0, 4, "  0x") == 0)
+    {
+      size_t comment = line.find(" //");
+
+      if (comment != std::string::npos)
+        line.erase(comment);
+    }
+
+    fputs(line.c_str(), file);
+
+    if (end < text.size())
+      fputc('\n', file);
+
+    pos = end + 1;
+  }
+
+  return !ferror(file) && fclose(file) == 0;
+}
+
+// true if the two files have the same contents
+static bool same_files(const char *filename1, const char *filename2)
+{
+  FILE *file1 = fopen(filename1, "rb");
+
+  if (file1 == NULL)
+    return false;
+
+  FILE *file2 = fopen(filename2, "rb");
+
+  if (file2 == NULL)
+  {
+    fclose(file1);
+    return false;
+  }
+
+  bool same = true;
+  char buf1[4096];
+  char buf2[4096];
+  size_t len1;
+  size_t len2;
+
+  do
+  {
+    len1 = fread(buf1, 1, sizeof(buf1), file1);
+    len2 = fread(buf2, 1, sizeof(buf2), file2);
+    same = len1 == len2 && memcmp(buf1, buf2, len1) == 0;
+  } while (same && len1 > 0);
+
+  fclose(file1);
+  fclose(file2);
+
+  return same;
+}
+
+// write a string as a C string literal
+static void write_string(FILE *file, const std::string& string)
+{
+  fputc('"', file);
+
+  for (std::string::const_iterator i = string.begin(); i != string.end(); ++i)
+  {
+    unsigned char c = static_cast<unsigned char>(*i);
+
+    // escape quotes, backslashes and the ? of ?? to prevent trigraphs
+    if (c == '"' || c == '\\' || (c == '?' && i != string.begin() && *(i - 1) == '?'))
+      fprintf(file, "\\%c", c);
+    else if (c < 0x20 || c >= 0x7f)
+      fprintf(file, "\\%03o", c);
+    else
+      fputc(c, file);
+  }
+
+  fputc('"', file);
+}
+
+int main(int argc, char **argv)
+{
+  // --verify: generate the packs in mkpacks-verify.cpp to compare to FILE.cpp, the Pattern f= option writes .cpp files only
+  bool verify = argc > 1 && strcmp(argv[1], "--verify") == 0;
+
+  if (verify)
+  {
+    --argc;
+    ++argv;
+  }
+
+  if (argc < 2)
+  {
+    fprintf(stderr, "Usage: mkpacks [--verify] FILE.cpp PATTERNFILE ...\n");
+    exit(EXIT_FAILURE);
+  }
+
+  const char *outfile = verify ? "mkpacks-verify.cpp" : argv[1];
+  FILE *file = fopen(outfile, "w");
+
+  if (file == NULL)
+  {
+    perror(outfile);
+    exit(EXIT_FAILURE);
+  }
+
+  fprintf(file, "// precompiled pattern files generated by mkpacks, do not edit, run \"make packs\" in src/ to regenerate\n\n#include \"pack.hpp\"\n\n");
+  fclose(file);
+
+  // the regex and multiline flag of each pack, identical pattern files are packed once
+  std::vector<std::pair<std::string,bool> > packed;
+  std::set<std::string> regexs;
+
+  for (int i = 2; i < argc; ++i)
+  {
+    const char *filename = argv[i];
+    size_t len = strlen(filename);
+
+    // skip README.md files
+    if (len >= 3 && strcmp(filename + len - 3, ".md") == 0)
+      continue;
+
+    std::string regex;
+
+    if (!read_patterns(filename, regex) || !regexs.insert(regex).second)
+      continue;
+
+    try
+    {
+      bool multiline = false;
+      std::string converted(reflex::Matcher::convert(regex, convert_flags, &multiline));
+      reflex::Pattern pattern(converted, "dr");
+
+      if (pattern.edges() < PACK_MIN_EDGES)
+        continue;
+
+      // recompile to append the opcode table and predict match data to the output file
+      std::string options("dr;p;f=+");
+      options.append(outfile).append(";n=pack").append(std::to_string(packed.size()));
+      pattern.assign(converted, options);
+
+      packed.push_back(std::pair<std::string,bool>(regex, multiline));
+
+      if (!verify)
+        printf("mkpacks: precompiled %s (%zu opcode words)\n", filename, pattern.words());
+    }
+
+    catch (const reflex::regex_error&)
+    {
+      // skip pattern files that ugrep rejects without -P
+    }
+  }
+
+  if (!strip_comments(outfile))
+  {
+    perror(outfile);
+    exit(EXIT_FAILURE);
+  }
+
+  file = fopen(outfile, "a");
+
+  if (file == NULL)
+  {
+    perror(outfile);
+    exit(EXIT_FAILURE);
+  }
+
+  fprintf(file, "const Pack packs[] = {\n");
+
+  for (size_t i = 0; i < packed.size(); ++i)
+  {
+    fprintf(file, "  { ");
+    write_string(file, packed[i].first);
+    fprintf(file, ", %d, %s, reflex_code_pack%zu, reflex_pred_pack%zu },\n", convert_flags, packed[i].second ? "true" : "false", i, i);
+  }
+
+  fprintf(file, "  { NULL, 0, false, NULL, NULL }\n};\n");
+
+  if (ferror(file) || fclose(file) != 0)
+  {
+    perror(outfile);
+    exit(EXIT_FAILURE);
+  }
+
+  if (verify)
+  {
+    bool same = same_files(outfile, argv[1]);
+
+    remove(outfile);
+
+    if (!same)
+    {
+      fprintf(stderr, "mkpacks: %s is out of date, run \"make packs\" in src/ to regenerate\n", argv[1]);
+      exit(EXIT_FAILURE);
+    }
+
+    printf("mkpacks: %s is up to date\n", argv[1]);
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -71,7 +71,10 @@ class MMap {
   {
 #if defined(HAVE_MMAP) && MAX_MMAP_SIZE > 0
     if (mmap_base != NULL)
+    {
       munmap(mmap_base, mmap_size);
+      Static::free_memory(mmap_size);
+    }
 #endif
   }
 
@@ -104,13 +107,27 @@ class MMap {
     {
       // allocate fixed mmap region to reuse
       mmap_size = (flag_max_mmap + 0xfff) & ~0xfffUL;
+
+      // --max-memory: read the file instead when the mmap region exceeds the memory budget
+      if (Static::over_memory(mmap_size))
+      {
+        mmap_size = 0;
+        size = 0;
+        return false;
+      }
+
       mmap_base = mmap(NULL, mmap_size, PROT_READ, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
 
       // files are sequentially read
       if (mmap_base == MAP_FAILED)
         mmap_base = NULL;
       else
+      {
         madvise(mmap_base, mmap_size, MADV_SEQUENTIAL);
+
+        // --max-memory: count the mmap region
+        Static::use_memory(mmap_size);
+      }
     }
 
     if (mmap_base != NULL)
@@ -121,6 +138,8 @@ class MMap {
       // mmap OK?
       if (mmap_base != MAP_FAILED)
         return true;
+
+      Static::free_memory(mmap_size);
     }
 
     // not OK
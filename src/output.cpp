@@ -223,6 +223,10 @@ void Output::header(const char *pathname, const std::string& partname, bool& hea
        flag_byte_offset))
     dump.done();
 
+  // -Q: mark the rows of the header and the line with the file, line and column of the match
+  if (channel != NULL)
+    mark(pathname, partname, lineno, matcher != NULL ? matcher->columno() + 1 : 0, matcher != NULL ? matcher->size() : 0);
+
   // get column number when we need it
   size_t columno = flag_column_number && matcher != NULL ? matcher->columno() + 1 : 1;
 
@@ -426,6 +430,9 @@ void Output::header(const char *pathname, const std::string& partname)
     // acquire lock on output and to access global Tree::path and Tree::depth
     acquire();
 
+    // -Q: the tree spacing rows do not belong to a file
+    mark();
+
     int up = 0;
 
     while (!Tree::path.empty() && Tree::path.compare(0, Tree::path.size(), pathname, Tree::path.size()) != 0)
@@ -465,6 +472,10 @@ void Output::header(const char *pathname, const std::string& partname)
 
     while ((sep = strchr(pathname + Tree::path.size(), PATHSEPCHR)) != NULL)
     {
+      // -Q: mark the row with the directory
+      if (channel != NULL)
+        mark(std::string(pathname, sep - pathname + 1).c_str(), std::string());
+
       if (nul)
         chr('\0');
 
@@ -488,6 +499,9 @@ void Output::header(const char *pathname, const std::string& partname)
       ++Tree::depth;
     }
 
+    // -Q: mark the row with the file
+    mark(pathname, partname);
+
     if (nul)
       chr('\0');
 
@@ -521,6 +535,9 @@ void Output::header(const char *pathname, const std::string& partname)
   }
   else
   {
+    // -Q: mark the row with the file
+    mark(pathname, partname);
+
     if (nul)
       chr('\0');
 
@@ -568,6 +585,9 @@ void Output::binary_file_matches(const char *pathname, const std::string& partna
   if ((mode_ & BINARY) != 0)
     return;
 
+  // -Q: mark the row with the file
+  mark(pathname, partname);
+
   str(color_off);
   str("Binary file ", 12);
   str(color_fn);
@@ -2052,8 +2072,7 @@ bool Output::flush_truncated_lines(const char *data, size_t size)
     {
       // write data with newline
       size_t num = scan - data + 1;
-      size_t nwritten = fwrite(data, 1, num, file);
-      if (nwritten < num)
+      if (!write(data, num))
         return true;
 
       data += num;
@@ -2065,8 +2084,7 @@ bool Output::flush_truncated_lines(const char *data, size_t size)
     {
       // write data
       size_t num = scan - data;
-      size_t nwritten = fwrite(data, 1, num, file);
-      if (nwritten < num)
+      if (!write(data, num))
         return true;
 
       data += num;
@@ -2083,15 +2101,13 @@ bool Output::flush_truncated_lines(const char *data, size_t size)
       {
         // write data up to but not including ANSI ESC
         size_t len = esc - data;
-        size_t nwritten = fwrite(data, 1, len, file);
-        if (nwritten < len)
+        if (!write(data, len))
           return true;
       }
       else
       {
         // write data
-        size_t nwritten = fwrite(data, 1, num, file);
-        if (nwritten < num)
+        if (!write(data, num))
           return true;
       }
 
@@ -2100,15 +2116,15 @@ bool Output::flush_truncated_lines(const char *data, size_t size)
 
       // disable CSI when line was truncated
       if (flag_apply_color)
-        if (fwrite("\033[m", 1, 3, file) < 3)
+        if (!write("\033[m", 3))
           return true;
 
       // write newline
 #ifdef OS_WIN
-      if (fwrite("\r\n", 1, 2, file) < 2)
+      if (!write("\r\n", 2))
         return true;
 #else
-      if (fwrite("\n", 1, 1, file) < 1)
+      if (!write("\n", 1))
         return true;
 #endif
 
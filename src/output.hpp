@@ -42,6 +42,7 @@
 #include <reflex/matcher.h>
 #include <reflex/fuzzymatcher.h>
 #include <list>
+#include <map>
 #include <mutex>
 #include <condition_variable>
 #include <cstdint>
@@ -51,6 +52,223 @@
 # define MAX_HEX_COLUMNS 64
 #endif
 
+// max number of rows queued in the -Q query TUI channel before the search blocks, must be a power of two
+#ifndef CHANNEL_SIZE
+# define CHANNEL_SIZE 4096
+#endif
+
+// -Q: the file, line and column of the match of a row of output, sent with the row to the query TUI
+struct Record {
+
+  Record()
+    :
+      lineno(0),
+      columno(0),
+      span(0)
+  { }
+
+  // clear the record, the row does not belong to a file
+  void clear()
+  {
+    pathname.clear();
+    partname.clear();
+    lineno = 0;
+    columno = 0;
+    span = 0;
+  }
+
+  std::string pathname; // pathname of the file or directory, empty when the row does not belong to a file
+  std::string partname; // -z: archive part name, empty when none
+  size_t      lineno;   // line number of the row, 0 when none
+  size_t      columno;  // column number of the match, 0 when none
+  size_t      span;     // byte length of the match, 0 when none
+
+};
+
+// -Q: channel of output rows and their records sent by the search engine to the query TUI, replaces a pipe and its
+// parsing, lock-free unless the producer must wait for the consumer to make space in the ring or the consumer waits for rows
+// the producers are serialized by the Output::Sync lock, the consumer is the query TUI thread
+struct Channel {
+
+  Channel()
+    :
+      head(0),
+      tail(0),
+      closed(true),
+      done(true),
+      waiting(false),
+      reading(false)
+  { }
+
+  // open the channel to start sending rows, not thread safe, the previous producer must have finished
+  void open()
+  {
+    head = 0;
+    tail = 0;
+    row.clear();
+    record.clear();
+    closed = false;
+    done = false;
+  }
+
+  // consumer: close the channel to stop the producer, rows in transit are dropped
+  void close()
+  {
+    closed = true;
+
+    // wake up the producer waiting for the consumer
+    std::unique_lock<std::mutex> lock(mutex);
+    space.notify_one();
+  }
+
+  // producer: send data, each complete line is sent as a row without its \n, returns false when the consumer closed the channel
+  bool send(const char *data, size_t size)
+  {
+    const char *end = data + size;
+
+    while (data < end)
+    {
+      const char *nl = static_cast<const char*>(memchr(data, '\n', end - data));
+
+      if (nl == NULL)
+      {
+        row.append(data, end - data);
+        break;
+      }
+
+      row.append(data, nl - data);
+
+      if (!push())
+        return false;
+
+      data = nl + 1;
+    }
+
+    return !closed;
+  }
+
+  // producer: mark the row under construction and the rows that follow with the record, the record is moved
+  void mark(Record& record)
+  {
+    this->record = std::move(record);
+  }
+
+  // producer: send the last row when incomplete, then finish
+  void finish()
+  {
+    if (!row.empty())
+      push();
+
+    done = true;
+
+    // wake up the consumer waiting for rows
+    if (reading)
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      ready.notify_one();
+    }
+  }
+
+  // consumer: receive the next row and its record by swapping them in, returns false when no row is available (yet)
+  bool receive(std::string& text, Record& record)
+  {
+    size_t h = head.load(std::memory_order_relaxed);
+
+    if (h == tail.load(std::memory_order_acquire))
+      return false;
+
+    text.swap(ring[h & (CHANNEL_SIZE - 1)]);
+    std::swap(record, records[h & (CHANNEL_SIZE - 1)]);
+    head.store(h + 1);
+
+    // wake up the producer when it waits for space in the ring
+    if (waiting)
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      space.notify_one();
+    }
+
+    return true;
+  }
+
+  // consumer: wait until a row is available to receive or the producer finished
+  void wait()
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+
+    reading = true;
+
+    while (!done && head.load() == tail.load())
+      ready.wait(lock);
+
+    reading = false;
+  }
+
+  // consumer: true when the producer finished and all rows are received
+  bool eof() const
+  {
+    return done.load(std::memory_order_acquire) && head.load(std::memory_order_relaxed) == tail.load(std::memory_order_acquire);
+  }
+
+ protected:
+
+  // producer: push the row to the ring, wait when the ring is full, returns false when the consumer closed the channel
+  bool push()
+  {
+    size_t t = tail.load(std::memory_order_relaxed);
+
+    // wait for the consumer to make space when the ring is full, like a blocking pipe
+    if (t - head.load(std::memory_order_acquire) >= CHANNEL_SIZE)
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+
+      waiting = true;
+
+      while (!closed && t - head.load() >= CHANNEL_SIZE)
+        space.wait(lock);
+
+      waiting = false;
+
+      if (closed)
+        return false;
+    }
+
+    ring[t & (CHANNEL_SIZE - 1)].swap(row);
+    row.clear();
+    records[t & (CHANNEL_SIZE - 1)] = record;
+    tail.store(t + 1);
+
+    // wake up the consumer when it waits for rows
+    if (reading)
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      ready.notify_one();
+    }
+
+    return true;
+  }
+
+  std::string             ring[CHANNEL_SIZE];    // ring of rows
+  Record                  records[CHANNEL_SIZE]; // ring of the records of the rows
+  std::atomic_size_t      head;                  // index of the next row to receive, modified by the consumer
+  std::atomic_size_t      tail;                  // index of the next row to send, modified by the producer
+  std::atomic_bool        closed;                // closed by the consumer
+  std::atomic_bool        done;                  // producer finished
+  std::atomic_bool        waiting;               // producer waits for space in the ring
+  std::atomic_bool        reading;               // consumer waits for rows
+  std::mutex              mutex;                 // mutex to wait for space in the ring or for rows
+  std::condition_variable space;                 // cv for the producer to wait for space in the ring
+  std::condition_variable ready;                 // cv for the consumer to wait for rows
+  std::string             row;                   // the producer's row under construction
+  Record                  record;                // the producer's record of the row under construction
+
+};
+
+// max total size of --sort ordered output deferred in memory by threads waiting for their turn, before output is spilled to a temporary file
+#ifndef MAX_DEFERRED_OUTPUT
+# define MAX_DEFERRED_OUTPUT 67108864
+#endif
+
 // output buffering and synchronization
 class Output {
 
@@ -70,11 +288,57 @@ class Output {
 
  public:
 
+  // -Q: records marked at byte offsets of the output, to send with the rows of output to the query TUI
+  typedef std::vector< std::pair<size_t,Record> > Marks;
+
+  // ORDERED: a run of output data and its -Q records marked at byte offsets of the run
+  struct Run {
+
+    // append the run, the data and records are moved
+    void append(Run& run)
+    {
+      if (data.empty() && marks.empty())
+      {
+        data.swap(run.data);
+        marks.swap(run.marks);
+      }
+      else
+      {
+        for (Marks::iterator mark = run.marks.begin(); mark != run.marks.end(); ++mark)
+          marks.emplace_back(data.size() + mark->first, std::move(mark->second));
+        data.append(run.data);
+      }
+    }
+
+    std::string data;  // output data
+    Marks       marks; // -Q: records marked at byte offsets of the data
+
+  };
+
   // sync state to synchronize output produced by multiple threads, UNORDERED or ORDERED by slot number
   struct Sync {
 
     enum class Mode { UNORDERED, ORDERED };
 
+    // ORDERED: offsets and sizes of output data spilled to the spill file
+    typedef std::vector< std::pair<uint64_t,size_t> > Extents;
+
+    // ORDERED: output deferred by a slot, the run in memory is followed by the extents spilled to the spill file
+    struct Deferred {
+
+      Deferred()
+        :
+          run(),
+          spilled(),
+          size(0)
+      { }
+
+      Run     run;     // output data kept in memory and the -Q records marked at byte offsets of all of the slot's output
+      Extents spilled; // output data spilled to the spill file after the data kept in memory
+      size_t  size;    // total size of the slot's output data in memory and spilled
+
+    };
+
     Sync(Mode mode)
       :
         mode(mode),
@@ -83,9 +347,19 @@ class Output {
         next(0),
         last(0),
         bits_mutex(),
-        completed()
+        completed(),
+        deferred(),
+        deferred_size(0),
+        spill(NULL),
+        spill_end(0)
     { }
 
+    ~Sync()
+    {
+      if (spill != NULL)
+        fclose(spill);
+    }
+
     // acquire output access
     void acquire(std::unique_lock<std::mutex> *lock, size_t slot)
     {
@@ -142,8 +416,50 @@ class Output {
       }
     }
 
-    // release output access in ORDERED mode, otherwise do nothing
-    void finish(std::unique_lock<std::mutex> *lock, size_t slot)
+    // ORDERED: defer the output run of a slot when it is not its turn yet, the run is moved, the run is spilled to a temporary
+    // file when too much output is deferred in memory, returns false when it is its turn or when the run cannot be spilled
+    bool defer(size_t slot, Run& run)
+    {
+      std::unique_lock<std::mutex> lock_bits(bits_mutex);
+
+      if (slot == last || last == STOP)
+        return false;
+
+      size_t size = run.data.size();
+      Deferred& slot_deferred = deferred[slot];
+
+      if (slot_deferred.spilled.empty() && deferred_size + size <= MAX_DEFERRED_OUTPUT && !Static::over_memory(size))
+      {
+        slot_deferred.run.append(run);
+        deferred_size += size;
+        Static::use_memory(size);
+      }
+      else if (spill_run(slot_deferred, run))
+      {
+        run.data.clear();
+      }
+      else
+      {
+        if (slot_deferred.size == 0)
+          deferred.erase(slot);
+        return false;
+      }
+
+      slot_deferred.size += size;
+
+      return true;
+    }
+
+    // ORDERED: take the deferred output run of a slot, if any, to output it, returns false when spilled output cannot be read
+    bool undefer(size_t slot, Run& run)
+    {
+      std::unique_lock<std::mutex> lock_bits(bits_mutex);
+
+      return take(slot, run);
+    }
+
+    // release output access in ORDERED mode, otherwise do nothing, the output of completed slots that were deferred is written to out
+    void finish(std::unique_lock<std::mutex> *lock, size_t slot, Output& out)
     {
       switch (mode)
       {
@@ -167,19 +483,34 @@ class Output {
             if (!lock->owns_lock())
               lock->lock();
 
+            // our own deferred output, when we did not flush it after our turn came
+            Run run;
+            bool taken = take(slot, run);
+
+            // threads that ran ahead of us completed their slots and may have deferred their output
             do
             {
               ++last;
               completed.rshift();
+              if (completed[0])
+                taken = take(last, run) && taken;
             } while (completed[0]);
 
+            lock_bits.unlock();
+
+            // write the deferred output in slot order while holding the lock, the thread of slot last waits for the lock
+            if (taken)
+              out.output(run);
+            else
+              out.cancel();
+
             lock->unlock();
 
             turn.notify_all();
           }
           else
           {
-            // threads without output may run ahead but must mark off their completion
+            // threads without output or with deferred output may run ahead but must mark off their completion
             completed.insert(slot - last);
           }
           break;
@@ -203,6 +534,12 @@ class Output {
 
           last = STOP;
 
+          // drop the deferred output
+          deferred.clear();
+          Static::free_memory(deferred_size);
+          deferred_size = 0;
+          spill_end = 0;
+
           lock_bits.unlock();
 
           turn.notify_all();
@@ -217,13 +554,83 @@ class Output {
       return last == STOP;
     }
 
-    Mode                         mode;       // UNORDERED or ORDERED (--sort by slot) mode
-    std::mutex                   mutex;      // mutex to synchronize output
-    std::condition_variable      turn;       // ORDERED: cv for threads to take turns by checking if last slot is their slot
-    size_t                       next;       // ORDERED: next slot assigned to thread
-    std::atomic_size_t           last;       // ORDERED: slot for threads to wait for their turn to output, or STOP to cancel
-    std::mutex                   bits_mutex; // ORDERED: mutex to synchronize bitset access and when setting last = STOP
-    reflex::Bits                 completed;  // ORDERED: bitset of completed slots marked by release() by threads that don't acquire() output
+    // ORDERED: append the deferred output of a slot to run, bits_mutex must be locked, returns false when spilled output cannot be read
+    bool take(size_t slot, Run& run)
+    {
+      std::map<size_t,Deferred>::iterator slot_deferred = deferred.find(slot);
+
+      if (slot_deferred == deferred.end())
+        return true;
+
+      bool ok = true;
+      size_t size = slot_deferred->second.run.data.size();
+
+      deferred_size -= size;
+      Static::free_memory(size);
+      run.append(slot_deferred->second.run);
+
+      // read the spilled output back, it follows the output kept in memory
+      for (Extents::const_iterator extent = slot_deferred->second.spilled.begin(); extent != slot_deferred->second.spilled.end() && ok; ++extent)
+      {
+        size_t offset = run.data.size();
+        run.data.resize(offset + extent->second);
+        ok = seek(spill, extent->first) && fread(&run.data[offset], 1, extent->second, spill) == extent->second;
+      }
+
+      deferred.erase(slot_deferred);
+
+      // reuse the spill file from the start when all of its output was taken
+      if (deferred.empty())
+        spill_end = 0;
+
+      return ok;
+    }
+
+    // ORDERED: spill the data of a run to the temporary spill file, the -Q records are kept in memory, bits_mutex must be locked
+    bool spill_run(Deferred& slot_deferred, Run& run)
+    {
+      if (spill == NULL && (spill = tmpfile()) == NULL)
+        return false;
+
+      if (!seek(spill, spill_end) || fwrite(run.data.c_str(), 1, run.data.size(), spill) != run.data.size())
+        return false;
+
+      for (Marks::iterator mark = run.marks.begin(); mark != run.marks.end(); ++mark)
+        slot_deferred.run.marks.emplace_back(slot_deferred.size + mark->first, std::move(mark->second));
+      run.marks.clear();
+
+      // extend the last extent when it ends where this one starts
+      if (!slot_deferred.spilled.empty() && slot_deferred.spilled.back().first + slot_deferred.spilled.back().second == spill_end)
+        slot_deferred.spilled.back().second += run.data.size();
+      else
+        slot_deferred.spilled.emplace_back(spill_end, run.data.size());
+
+      spill_end += run.data.size();
+
+      return true;
+    }
+
+    // seek to an offset in the spill file
+    static bool seek(FILE *file, uint64_t offset)
+    {
+#ifdef OS_WIN
+      return _fseeki64(file, static_cast<__int64>(offset), SEEK_SET) == 0;
+#else
+      return fseeko(file, static_cast<off_t>(offset), SEEK_SET) == 0;
+#endif
+    }
+
+    Mode                         mode;          // UNORDERED or ORDERED (--sort by slot) mode
+    std::mutex                   mutex;         // mutex to synchronize output
+    std::condition_variable      turn;          // ORDERED: cv for threads to take turns by checking if last slot is their slot
+    size_t                       next;          // ORDERED: next slot assigned to thread
+    std::atomic_size_t           last;          // ORDERED: slot for threads to wait for their turn to output, or STOP to cancel
+    std::mutex                   bits_mutex;    // ORDERED: mutex to synchronize bitset access and when setting last = STOP
+    reflex::Bits                 completed;     // ORDERED: bitset of completed slots marked by release() by threads that don't acquire() output
+    std::map<size_t,Deferred>    deferred;      // ORDERED: output deferred by threads that ran ahead, by slot
+    size_t                       deferred_size; // ORDERED: total size of the deferred output kept in memory
+    FILE                        *spill;         // ORDERED: temporary file with deferred output spilled when too much is kept in memory
+    uint64_t                     spill_end;     // ORDERED: end of the spilled output in the spill file
 
   };
 
@@ -312,16 +719,19 @@ class Output {
   Output(FILE *file)
     :
       file(file),
+      channel(file == NULL ? Static::channel : NULL),
       eof(false),
       sync(NULL),
       dump(*this),
       lock_(NULL),
       slot_(0),
+      defer_(false),
       lineno_(0),
       mode_(flag_line_buffered ? FLUSH : 0),
       cols_(0),
       ansi_(ANSI::NA),
-      skip_(false)
+      skip_(false),
+      marks_()
   {
     grow();
   }
@@ -332,6 +742,7 @@ class Output {
     flush();
     if (lock_ != NULL)
       delete lock_;
+    Static::free_memory(buffers_.size() * SIZE);
   }
 
   // output a character c
@@ -615,6 +1026,10 @@ class Output {
   void begin(size_t slot)
   {
     slot_ = slot;
+
+    // ORDERED: defer output when it is not our turn yet, instead of waiting for our turn, unless --width truncates lines as we go
+    // or --max-files counts files found in order
+    defer_ = sync != NULL && sync->mode == Sync::Mode::ORDERED && flag_width == 0 && flag_max_files == 0;
   }
 
   // acquire output synchronization lock
@@ -631,28 +1046,32 @@ class Output {
     {
       if (!eof)
       {
+        // ORDERED: if it is not our turn yet, then defer the output to continue searching
+        if (defer_ && !lock_->owns_lock() && defer())
+        {
+          buf_ = buffers_.begin();
+          cur_ = buf_->data;
+          marks_.clear();
+          return;
+        }
+
         // if multi-threaded and lock is not owned already, then lock on master's mutex
         acquire();
 
-        // flush the buffers container to the designated output file, pipe, or stream
+        // ORDERED: output our deferred output first, when it became our turn
+        if (defer_)
+          undefer();
+
+        // flush the buffers container to the designated output file, pipe, stream, or -Q channel
+        Marks::iterator mark = marks_.begin();
+        size_t offset = 0;
+
         for (Buffers::iterator i = buffers_.begin(); i != buf_; ++i)
         {
-          if (flag_width == 0)
+          if (!write(i->data, SIZE, marks_, mark, offset))
           {
-            size_t nwritten = fwrite(i->data, 1, SIZE, file);
-            if (nwritten < SIZE)
-            {
-              cancel();
-              break;
-            }
-          }
-          else
-          {
-            if (flush_truncated_lines(i->data, SIZE))
-            {
-              cancel();
-              break;
-            }
+            cancel();
+            break;
           }
         }
 
@@ -660,31 +1079,61 @@ class Output {
         {
           size_t num = cur_ - buf_->data;
 
-          if (num > 0)
-          {
-            if (flag_width == 0)
-            {
-              size_t nwritten = fwrite(buf_->data, 1, num, file);
-              if (nwritten < num)
-                cancel();
-            }
-            else
-            {
-              if (flush_truncated_lines(buf_->data, num))
-                cancel();
-            }
-          }
+          if (num > 0 && !write(buf_->data, num, marks_, mark, offset))
+            cancel();
 
-          if (!eof && fflush(file) != 0)
+          if (!eof && channel == NULL && fflush(file) != 0)
             cancel();
         }
       }
 
       buf_ = buffers_.begin();
       cur_ = buf_->data;
+      marks_.clear();
     }
   }
 
+  // write data to the output file or -Q channel, returns false on failure
+  bool write(const char *data, size_t size)
+  {
+    if (channel != NULL)
+      return channel->send(data, size);
+
+    return fwrite(data, 1, size, file) == size;
+  }
+
+  // write data at the offset in the output as lines truncated to --width, -Q: send the records marked at offsets in the data, returns false on failure
+  bool write(const char *data, size_t size, Marks& marks, Marks::iterator& mark, size_t& offset)
+  {
+    while (mark != marks.end() && mark->first <= offset + size)
+    {
+      size_t num = mark->first - offset;
+
+      if (num > 0 && !write_lines(data, num))
+        return false;
+
+      data += num;
+      size -= num;
+      offset += num;
+
+      channel->mark(mark->second);
+      ++mark;
+    }
+
+    offset += size;
+
+    return size == 0 || write_lines(data, size);
+  }
+
+  // write data as lines truncated to --width, returns false on failure
+  bool write_lines(const char *data, size_t size)
+  {
+    if (flag_width == 0)
+      return write(data, size);
+
+    return !flush_truncated_lines(data, size);
+  }
+
   // flush a block of data as truncated lines limited to --width columns
   bool flush_truncated_lines(const char *data, size_t size);
 
@@ -693,6 +1142,30 @@ class Output {
   {
     buf_ = buffers_.begin();
     cur_ = buf_->data;
+    marks_.clear();
+  }
+
+  // -Q: mark the next row of output and the rows that follow with the record of the file, line and column of the match
+  void mark(const char *pathname, const std::string& partname, size_t lineno = 0, size_t columno = 0, size_t span = 0)
+  {
+    if (channel == NULL)
+      return;
+
+    marks_.emplace_back(buffered(), Record());
+
+    Record& record = marks_.back().second;
+    record.pathname.assign(pathname);
+    record.partname.assign(partname);
+    record.lineno = lineno;
+    record.columno = columno;
+    record.span = span;
+  }
+
+  // -Q: mark the next row of output and the rows that follow as not belonging to a file
+  void mark()
+  {
+    if (channel != NULL)
+      marks_.emplace_back(buffered(), Record());
   }
 
   // flush output and release sync slot, if one was assigned with sync_on()
@@ -713,7 +1186,9 @@ class Output {
   void end()
   {
     if (sync != NULL)
-      sync->finish(lock_, slot_);
+      sync->finish(lock_, slot_, *this);
+
+    defer_ = false;
   }
 
   // cancel output
@@ -773,13 +1248,20 @@ class Output {
     {
       flush();
     }
+    else if (++buf_ != buffers_.end())
+    {
+      cur_ = buf_->data;
+    }
+    else if ((mode_ & HOLD) == 0 && Static::over_memory(SIZE))
+    {
+      // --max-memory: wait to flush the buffers instead of allocating a new buffer that exceeds the memory budget
+      --buf_;
+      flush();
+    }
     else
     {
-      // allocate a new buffer if no next buffer was allocated before
-      if (++buf_ == buffers_.end())
-        grow();
-      else
-        cur_ = buf_->data;
+      // allocate a new buffer, held output is always buffered
+      grow();
     }
   }
 
@@ -788,6 +1270,60 @@ class Output {
   {
     buf_ = buffers_.emplace(buffers_.end());
     cur_ = buf_->data;
+    Static::use_memory(SIZE);
+  }
+
+  // the size of the buffered output
+  size_t buffered()
+  {
+    size_t size = cur_ - buf_->data;
+
+    for (Buffers::iterator i = buffers_.begin(); i != buf_; ++i)
+      size += SIZE;
+
+    return size;
+  }
+
+  // ORDERED: defer the buffered output to the sync object when it is not our turn yet, returns false when it is our turn
+  bool defer()
+  {
+    Run run;
+
+    for (Buffers::iterator i = buffers_.begin(); i != buf_; ++i)
+      run.data.append(i->data, SIZE);
+    run.data.append(buf_->data, cur_ - buf_->data);
+    run.marks.swap(marks_);
+
+    if (sync->defer(slot_, run))
+      return true;
+
+    marks_.swap(run.marks);
+
+    return false;
+  }
+
+  // ORDERED: write our deferred output, if any, lock must be owned
+  void undefer()
+  {
+    Run run;
+
+    if (sync->undefer(slot_, run))
+      output(run);
+    else
+      cancel();
+  }
+
+  // ORDERED: write a deferred output run, lock must be owned
+  void output(Run& run)
+  {
+    if (!run.data.empty() && !eof)
+    {
+      Marks::iterator mark = run.marks.begin();
+      size_t offset = 0;
+
+      if (!write(run.data.c_str(), run.data.size(), run.marks, mark, offset) || (channel == NULL && fflush(file) != 0))
+        cancel();
+    }
   }
 
   // get a group capture's string pointer and size specified by %[ARG] as arg, if any
@@ -795,15 +1331,17 @@ class Output {
 
  public:
 
-  FILE            *file; // output stream
-  std::atomic_bool eof;  // the other end closed or has an error
-  Sync            *sync; // synchronization object
-  Dump             dump; // hex dump state
+  FILE            *file;    // output stream
+  Channel         *channel; // -Q: output channel to the query TUI when file is NULL
+  std::atomic_bool eof;     // the other end closed or has an error
+  Sync            *sync;    // synchronization object
+  Dump             dump;    // hex dump state
 
  protected:
 
   std::unique_lock<std::mutex> *lock_;    // synchronization lock
   size_t                        slot_;    // current slot to take turns
+  bool                          defer_;   // ORDERED: defer output when it is not our turn yet
   size_t                        lineno_;  // last line number matched, when --format field %u (unique) is used
   Buffers                       buffers_; // buffers container
   Buffers::iterator             buf_;     // current buffer in the container
@@ -812,6 +1350,7 @@ class Output {
   size_t                        cols_;    // number of columns output so far, if --width
   ANSI                          ansi_;    // ANSI escape sequence
   bool                          skip_;    // skip until next newline in buffers, if --width
+  Marks                         marks_;   // -Q: records marked at byte offsets of the buffered output
 
 };
 
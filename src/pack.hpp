@@ -0,0 +1,66 @@
+/******************************************************************************\
+* Copyright (c) 2019, Robert van Engelen, Genivia Inc. All rights reserved.    *
+*                                                                              *
+* Redistribution and use in source and binary forms, with or without           *
+* modification, are permitted provided that the following conditions are met:  *
+*                                                                              *
+*   (1) Redistributions of source code must retain the above copyright notice, *
+*       this list of conditions and the following disclaimer.                  *
+*                                                                              *
+*   (2) Redistributions in binary form must reproduce the above copyright      *
+*       notice, this list of conditions and the following disclaimer in the    *
+*       documentation and/or other materials provided with the distribution.   *
+*                                                                              *
+*   (3) The name of the author may not be used to endorse or promote products  *
+*       derived from this software without specific prior written permission.  *
+*                                                                              *
+* THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR IMPLIED *
+* WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF         *
+* MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO   *
+* EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,       *
+* SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, *
+* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;  *
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,     *
+* WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR      *
+* OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF       *
+* ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                                   *
+\******************************************************************************/
+
+/**
+@file      pack.hpp
+@brief     precompiled patterns of the bundled pattern files
+@author    Robert van Engelen - engelen@genivia.com
+@copyright (c) 2019-2023, Robert van Engelen, Genivia Inc. All rights reserved.
+@copyright (c) BSD-3 License - see LICENSE.txt
+*/
+
+#ifndef PACK_HPP
+#define PACK_HPP
+
+#include <reflex/convert.h>
+#include <reflex/pattern.h>
+#include <string>
+
+// a pattern file in patterns/ compiled ahead of time by mkpacks, the pattern is used when the regex and flags match
+struct Pack {
+  const char                    *regex;         // the (?m)-prefixed regex of the -f FILE patterns, before conversion
+  reflex::convert_flag_type      convert_flags; // the reflex::convert flags of the regex
+  bool                           multiline;     // the regex matches newlines, as returned by reflex::convert
+  const reflex::Pattern::Opcode *code;          // the DFA opcode table of the converted regex
+  const reflex::Pattern::Pred   *pred;          // the predict match data of the converted regex
+};
+
+// the precompiled patterns generated by mkpacks, ending with a NULL regex
+extern const Pack packs[];
+
+// return the precompiled pattern of a regex converted with the specified flags or NULL if none
+inline const Pack *find_pack(const std::string& regex, reflex::convert_flag_type convert_flags)
+{
+  for (const Pack *pack = packs; pack->regex != NULL; ++pack)
+    if (pack->convert_flags == convert_flags && regex.compare(pack->regex) == 0)
+      return pack;
+
+  return NULL;
+}
+
+#endif
@@ -0,0 +1,57423 @@
+// precompiled pattern files generated by mkpacks, do not edit, run "make packs" in src/ to regenerate
+
+#include "pack.hpp"
+
+#ifndef REFLEX_CODE_DECL
+#include <reflex/pattern.h>
+#define REFLEX_CODE_DECL const reflex::Pattern::Opcode
+#endif
+
+REFLEX_CODE_DECL reflex_code_pack0[18615] =
+{
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x7B7B0062,
+  0x617A008E,
+  0x5F5F008E,
+  0x415A008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x303A008E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x2626008E,
+  0x2020002D,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x0909002D,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x7B7B0062,
+  0x77770365,
+  0x74740338,
+  0x7373030B,
+  0x727202DE,
+  0x696902B1,
+  0x66660284,
+  0x65650257,
+  0x6363022A,
+  0x617A008E,
+  0x5F5F008E,
+  0x415A008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x303A008E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x2626008E,
+  0x2020002D,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x0909002D,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x617A008E,
+  0x5F5F008E,
+  0x415A008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x303A008E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x2626008E,
+  0x20200392,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x09090392,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x617A008E,
+  0x5F5F008E,
+  0x415A008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x303A008E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x2626008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xBABA008E,
+  0xB5B5008E,
+  0xAAAA008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8BF008E,
+  0x98B6008E,
+  0x8096008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BF008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAEAE008E,
+  0xACAC008E,
+  0xA0A4008E,
+  0x8691008E,
+  0x8081008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF008E,
+  0xBABD008E,
+  0xB6B7008E,
+  0xB0B4008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA3BF008E,
+  0x8EA1008E,
+  0x8C8C008E,
+  0x888A008E,
+  0x8686008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB7BF008E,
+  0x80B5008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8ABF008E,
+  0x8081008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1BF008E,
+  0x80AF008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF008E,
+  0x9999008E,
+  0x8096008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8088008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFB2008E,
+  0x90AA008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1BF008E,
+  0xAEAF008E,
+  0xA0A9008E,
+  0x808A008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF008E,
+  0xAEBC008E,
+  0xA5A6008E,
+  0x9595008E,
+  0x8093008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x92AF008E,
+  0x9090008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8DBF008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1B1008E,
+  0x80A5008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABA008E,
+  0xB4B5008E,
+  0x80AA008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBE0520,
+  0xBDBD0519,
+  0xBCBC0512,
+  0xBBBB0509,
+  0xBABA04FC,
+  0xB9B904F5,
+  0xB8B804EE,
+  0xB7B704E7,
+  0xB6B604DE,
+  0xB5B504D4,
+  0xB4B404CB,
+  0xB3B304C2,
+  0xB2B204B6,
+  0xB1B104AD,
+  0xB0B004A3,
+  0xAFAF049C,
+  0xAEAE048D,
+  0xADAD0484,
+  0xACAC0478,
+  0xABAB046F,
+  0xAAAA0463,
+  0xA9A9045A,
+  0xA8A8044E,
+  0xA7A70444,
+  0xA6A60437,
+  0xA5A5042E,
+  0xA4A40427,
+  0xA3A30421,
+  0xA2A20419,
+  0xA1A10411,
+  0xA0A00408,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF065E,
+  0xBEBE0656,
+  0xBDBD064A,
+  0xBCBC0642,
+  0xB8BB00CA,
+  0xB4B600CA,
+  0xB3B30639,
+  0xB2B20631,
+  0xB1B1062A,
+  0xB0B00624,
+  0xAFAF061E,
+  0xAEAE0617,
+  0xADAD0610,
+  0xACAC060A,
+  0xAAAA0602,
+  0xA9A905FC,
+  0xA8A805F5,
+  0xA7A705EE,
+  0xA6A605E7,
+  0xA5A505E0,
+  0xA4A405DA,
+  0xA3A305D4,
+  0xA2A205CB,
+  0xA1A105C5,
+  0xA0A005BE,
+  0x9F9F05B6,
+  0x9E9E05B0,
+  0x9D9D05A8,
+  0x9C9C05A1,
+  0x9B9B059A,
+  0x9A9A0593,
+  0x9999058C,
+  0x90900586,
+  0x8F8F057F,
+  0x8E8E0578,
+  0x8D8D0572,
+  0x8C8C056A,
+  0x8B8B0561,
+  0x8A8A0557,
+  0x8989054C,
+  0x849800CA,
+  0x83830542,
+  0x82820539,
+  0x8181052D,
+  0x80800526,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8B806C7,
+  0xB7B706BE,
+  0xB6B606B4,
+  0xB5B506AD,
+  0xB4B406A4,
+  0xB3B3069C,
+  0xB0B200CA,
+  0x86860696,
+  0x8585068F,
+  0x8484067F,
+  0x82820679,
+  0x81810670,
+  0x8080066A,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90BF00CA,
+  0x878706F2,
+  0x868606EB,
+  0x858500CA,
+  0x848406E4,
+  0x838306DD,
+  0x828206D5,
+  0x81810586,
+  0x808006CD,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8BF00CA,
+  0x80B600CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BF00CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFAF079C,
+  0xADAD0794,
+  0xACAC0789,
+  0xABAB077F,
+  0xAAAA0776,
+  0xA9A9076B,
+  0xA8A80765,
+  0xA7A7075D,
+  0xA6A60757,
+  0xA5A50750,
+  0xA4A40749,
+  0xA3A30740,
+  0xA2A2073A,
+  0xA1A105B0,
+  0xA0A00731,
+  0x9F9F0727,
+  0x9E9E0720,
+  0x9C9C0719,
+  0x9B9B061E,
+  0x9A9A0712,
+  0x9999070B,
+  0x98980704,
+  0x939306FE,
+  0x929206F8,
+  0x80BF00CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9F9F07AA,
+  0x9E9E07A3,
+  0x809D00CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF0821,
+  0xBEBE081B,
+  0xBDBD0814,
+  0xBCBC080C,
+  0xBBBB0806,
+  0xB9B907FE,
+  0xB8B807F8,
+  0xB7B707F1,
+  0xB6B607EA,
+  0xB5B507E4,
+  0xB4B407DE,
+  0xAFAF07D8,
+  0xAEAE07D2,
+  0xADAD07CA,
+  0xACAC07BE,
+  0xABAB07B8,
+  0xA9A907B1,
+  0xA4BA00CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1B1091C,
+  0xAFAF0915,
+  0xAEAE090E,
+  0xACAC0907,
+  0xABAB08FF,
+  0xAAAA08F8,
+  0xA0B001C9,
+  0x9F9F08F2,
+  0x9E9E08E2,
+  0x9D9D08D0,
+  0x9B9B08C4,
+  0x9A9A08BE,
+  0x989808B5,
+  0x979701C9,
+  0x969608A3,
+  0x9494089C,
+  0x93930895,
+  0x9292088A,
+  0x91910859,
+  0x9090082A,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x627A008E,
+  0x61610923,
+  0x5F5F008E,
+  0x415A008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x303A008E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x2626008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x6C6C0950,
+  0x617A008E,
+  0x5F5F008E,
+  0x415A008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x303A008E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x2626008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x6F6F097D,
+  0x617A008E,
+  0x5F5F008E,
+  0x415A008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x303A008E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x2626008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x666609AA,
+  0x617A008E,
+  0x5F5F008E,
+  0x415A008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x303A008E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x2626008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x656509D7,
+  0x617A008E,
+  0x5F5F008E,
+  0x415A008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x303A008E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x2626008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x77770A04,
+  0x617A008E,
+  0x5F5F008E,
+  0x415A008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x303A008E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x2626008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x68680A31,
+  0x617A008E,
+  0x5F5F008E,
+  0x415A008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x303A008E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x2626008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x68680A5E,
+  0x617A008E,
+  0x5F5F008E,
+  0x415A008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x303A008E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x2626008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x77770365,
+  0x74740338,
+  0x7373030B,
+  0x727202DE,
+  0x696902B1,
+  0x66660284,
+  0x65650257,
+  0x6363022A,
+  0x617A008E,
+  0x5F5F008E,
+  0x415A008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x303A008E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x2626008E,
+  0x20200392,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x09090392,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x77770BD4,
+  0x74740BA5,
+  0x73730B76,
+  0x72720B47,
+  0x69690B18,
+  0x66660AE9,
+  0x65650ABA,
+  0x63630A8B,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3A3A008E,
+  0x30390D6E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x2626008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0x77770DC6,
+  0x74740DC0,
+  0x73730DBA,
+  0x72720DB4,
+  0x69690DAE,
+  0x66660DA8,
+  0x65650DA2,
+  0x63630D9C,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA8A8008E,
+  0xA4A4008E,
+  0x9A9A008E,
+  0x8095008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0xA0AA008E,
+  0x8098008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF008E,
+  0x898E008E,
+  0x8087008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8089008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBD008E,
+  0x84B9008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1BF008E,
+  0xA6AF008E,
+  0x98A1008E,
+  0x9090008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBD008E,
+  0xB6B9008E,
+  0xB2B2008E,
+  0xAAB0008E,
+  0x93A8008E,
+  0x8F90008E,
+  0x858C008E,
+  0x8080008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBC008E,
+  0xA6B1008E,
+  0x9FA1008E,
+  0x9C9D008E,
+  0x8E8E008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8B9008E,
+  0xB5B6008E,
+  0xB2B3008E,
+  0xAAB0008E,
+  0x93A8008E,
+  0x8F90008E,
+  0x858A008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2B4008E,
+  0xA6AF008E,
+  0x9E9E008E,
+  0x999C008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBD008E,
+  0xB5B9008E,
+  0xB2B3008E,
+  0xAAB0008E,
+  0x93A8008E,
+  0x8F91008E,
+  0x858D008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB9B9008E,
+  0xA6AF008E,
+  0xA0A1008E,
+  0x9090008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBD008E,
+  0xB5B9008E,
+  0xB2B3008E,
+  0xAAB0008E,
+  0x93A8008E,
+  0x8F90008E,
+  0x858C008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1B1008E,
+  0xA6AF008E,
+  0x9FA1008E,
+  0x9C9D008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAEB9008E,
+  0xA8AA008E,
+  0xA3A4008E,
+  0x9E9F008E,
+  0x9C9C008E,
+  0x999A008E,
+  0x9295008E,
+  0x8E90008E,
+  0x858A008E,
+  0x8383008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA6AF008E,
+  0x9090008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBD008E,
+  0xAAB9008E,
+  0x92A8008E,
+  0x8E90008E,
+  0x858C008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA6AF008E,
+  0xA0A1008E,
+  0x9D9D008E,
+  0x989A008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBD008E,
+  0xB5B9008E,
+  0xAAB3008E,
+  0x92A8008E,
+  0x8E90008E,
+  0x858C008E,
+  0x8080008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1B2008E,
+  0xA6AF008E,
+  0xA0A1008E,
+  0x9D9E008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBD008E,
+  0x92BA008E,
+  0x8E90008E,
+  0x848C008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABF008E,
+  0xA6AF008E,
+  0x9FA1008E,
+  0x9496008E,
+  0x8E8E008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBD008E,
+  0xB3BB008E,
+  0x9AB1008E,
+  0x8596008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA6AF008E,
+  0x8086008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2B3008E,
+  0x81B0008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9099008E,
+  0x8086008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBD008E,
+  0xB2B3008E,
+  0xA7B0008E,
+  0xA5A5008E,
+  0x8CA3008E,
+  0x868A008E,
+  0x8484008E,
+  0x8182008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9C9F008E,
+  0x9099008E,
+  0x8686008E,
+  0x8084008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0A9008E,
+  0x8080008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x89AC008E,
+  0x8087008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x888C008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF008E,
+  0x80AA008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB5BF008E,
+  0xAEB0008E,
+  0xA5A6008E,
+  0xA1A1008E,
+  0x9A9D008E,
+  0x9095008E,
+  0x8089008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF008E,
+  0x9099008E,
+  0x8E8E008E,
+  0x8081008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBF008E,
+  0x90BA008E,
+  0x8D8D008E,
+  0x8787008E,
+  0x8085008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF008E,
+  0x9A9D008E,
+  0x9898008E,
+  0x9096008E,
+  0x8A8D008E,
+  0x8088008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8BE008E,
+  0xB2B5008E,
+  0x90B0008E,
+  0x8A8D008E,
+  0x8088008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x98BF008E,
+  0x8896008E,
+  0x8285008E,
+  0x8080008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x98BF008E,
+  0x9295008E,
+  0x8090008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x809A008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF008E,
+  0x808F008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8BD008E,
+  0x80B5008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x81BF008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFBF008E,
+  0x80AC008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF008E,
+  0x819A008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1B8008E,
+  0x80AA008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9FB1008E,
+  0x8091008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAEB0008E,
+  0xA0AC008E,
+  0x8091008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80B3008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0A9008E,
+  0x9C9C008E,
+  0x9797008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF008E,
+  0x9099008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80B8008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0xAAAA008E,
+  0x87A8008E,
+  0x8084008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80B5008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x809E008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B4008E,
+  0x86AD008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0x80AB008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9099008E,
+  0x8089008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF008E,
+  0x8096008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8094008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA7A7008E,
+  0x9099008E,
+  0x8089008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x85B3008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9099008E,
+  0x858C008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAEBF008E,
+  0x83A0008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80A5008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80A3008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8DBD008E,
+  0x8089008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBF008E,
+  0x90BA008E,
+  0x8088008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABA008E,
+  0xB5B6008E,
+  0xAEB3008E,
+  0xA9AC008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF008E,
+  0x989D008E,
+  0x8095008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9FBD008E,
+  0x9D9D008E,
+  0x9B9B008E,
+  0x9999008E,
+  0x9097008E,
+  0x888D008E,
+  0x8085008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBE008E,
+  0xB6BC008E,
+  0x80B4008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB6BC008E,
+  0xB2B4008E,
+  0xA0AC008E,
+  0x969B008E,
+  0x9093008E,
+  0x868C008E,
+  0x8284008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF008E,
+  0xB1B1008E,
+  0x9494008E,
+  0x8080008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x909C008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBF008E,
+  0xAFB9008E,
+  0xAAAD008E,
+  0xA8A8008E,
+  0xA6A6008E,
+  0xA4A4008E,
+  0x999D008E,
+  0x9595008E,
+  0x8A93008E,
+  0x8787008E,
+  0x8282008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8E8E008E,
+  0x8589008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8384008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2B3008E,
+  0xABAE008E,
+  0x80A4008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0xADAD008E,
+  0xA7A7008E,
+  0x80A5008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFAF008E,
+  0x80A7008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8BE008E,
+  0xB0B6008E,
+  0xA8AE008E,
+  0xA0A6008E,
+  0x8096008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x989E008E,
+  0x9096008E,
+  0x888E008E,
+  0x8086008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFAF008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBC008E,
+  0xB1B5008E,
+  0x8586008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA1BF008E,
+  0x9D9F008E,
+  0x8096008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBF008E,
+  0x80BA008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1BF008E,
+  0x85AF008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF008E,
+  0x808E008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x808C008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90BD008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90AB008E,
+  0x808C008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF008E,
+  0x80AE008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF008E,
+  0x809D008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA2BF008E,
+  0x979F008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8BBF008E,
+  0x8088008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2BF008E,
+  0x9599008E,
+  0x9393008E,
+  0x9091008E,
+  0x808A008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8CA2008E,
+  0x878A008E,
+  0x8385008E,
+  0x8081008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x82B3008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBE008E,
+  0xBBBB008E,
+  0xB2B7008E,
+  0x9099008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0x80A5008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BC008E,
+  0x8086008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x84B2008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA6BE008E,
+  0xA0A4008E,
+  0x8F99008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80A8008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF008E,
+  0xBABA008E,
+  0xA0B6008E,
+  0x9099008E,
+  0x848B008E,
+  0x8082008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB9BD008E,
+  0xB5B6008E,
+  0xB1B1008E,
+  0x80AF008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2B4008E,
+  0xA0AA008E,
+  0x9B9D008E,
+  0x8282008E,
+  0x8080008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0xA8AE008E,
+  0xA0A6008E,
+  0x9196008E,
+  0x898E008E,
+  0x8186008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0x9CA9008E,
+  0x809A008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B9008E,
+  0x80A2008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0x80A3008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8BBB008E,
+  0x8086008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0x80AD008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8099008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBE008E,
+  0xB8BC008E,
+  0xAAB6008E,
+  0x9FA8008E,
+  0x9D9D008E,
+  0x9397008E,
+  0x8086008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x86BF008E,
+  0x8384008E,
+  0x8081008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80B1008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x93BF008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BD008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90BF008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x92BF008E,
+  0x808F008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BB008E,
+  0x8087008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB3B4008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB6BF008E,
+  0xB0B4008E,
+  0x8D8F008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BC008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF008E,
+  0xA1BA008E,
+  0x9099008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA6BF008E,
+  0x819A008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BE008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9A9C008E,
+  0x9297008E,
+  0x8A8F008E,
+  0x8287008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF0EBF,
+  0xBEBE0EB8,
+  0xBDBD0EB1,
+  0xBCBC0EA9,
+  0xBABA0EA2,
+  0xB4B40E9B,
+  0xB2B30E95,
+  0xB1B1010A,
+  0xB0B000CA,
+  0xAEAE0E8F,
+  0xADAD0E88,
+  0xACAC05D4,
+  0xABAB0E81,
+  0xAAAA0E7B,
+  0xA9A90E75,
+  0xA8A80E6C,
+  0xA6A60E65,
+  0xA4A40E5E,
+  0xA3A30E57,
+  0xA2A205DA,
+  0xA1A10E50,
+  0xA0A00E45,
+  0x9E9E0E3D,
+  0x9D9D0E36,
+  0x9C9C0E30,
+  0x989B00CA,
+  0x96960E24,
+  0x95950E1C,
+  0x94940E15,
+  0x93930E0E,
+  0x92920E06,
+  0x909100CA,
+  0x8F8F0DFF,
+  0x8E8E0712,
+  0x8D8D0DF7,
+  0x8C8C0DF0,
+  0x8B8B0DEA,
+  0x8A8A0DE3,
+  0x83830DDD,
+  0x828200CA,
+  0x81810DD6,
+  0x80800DCC,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBE0FDC,
+  0xBBBB0FD6,
+  0xB6B60FCE,
+  0xB5B50FC4,
+  0xB4B40FBC,
+  0xB2B20FB6,
+  0xB1B10FAE,
+  0xB0B00FA7,
+  0xABAB05C5,
+  0xAAAA0F9F,
+  0xA9A90F98,
+  0xA8A80F90,
+  0xA7A70F88,
+  0xA6A60F81,
+  0xA5A50F7A,
+  0xA4A40F6F,
+  0xA3A30F68,
+  0xA2A20117,
+  0xA0A00F62,
+  0x9D9D0F5C,
+  0x9C9C0F55,
+  0x9B9B0421,
+  0x9A9A0F4E,
+  0x99990F47,
+  0x98980F2D,
+  0x97970F41,
+  0x96960F3B,
+  0x93930F33,
+  0x92920F2D,
+  0x91910F25,
+  0x90900F1F,
+  0x8D8D0F18,
+  0x8C8C0478,
+  0x8B8B0F11,
+  0x8A8A0F06,
+  0x88880EFF,
+  0x87870EF7,
+  0x86860EF1,
+  0x85850EE8,
+  0x84840EE1,
+  0x83830EDA,
+  0x82820ED4,
+  0x81810ECC,
+  0x80800EC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF0FE8,
+  0xBEBE07E4,
+  0x95950FE2,
+  0x929400CA,
+  0x8E8E07B8,
+  0x808D00CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90900F3B,
+  0x808F00CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x99990F5C,
+  0x909800CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF1013,
+  0xBEBE100D,
+  0xBDBD1006,
+  0xBCBC00CA,
+  0xB9B900CA,
+  0xAEAE0FB6,
+  0xADAD0FFD,
+  0xACAC0F2D,
+  0xABAB0FF6,
+  0xAAAA081B,
+  0xA9A90FEE,
+  0xA8A805C5,
+  0xA0A700CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB4B4010A,
+  0xB3B31020,
+  0x9F9F101A,
+  0x80B200CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF1026,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2B21049,
+  0xB1B11042,
+  0xB0B000CA,
+  0x8B8B103C,
+  0x85851034,
+  0x8484102E,
+  0x808A00CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBC05DA,
+  0x9F9F10A7,
+  0x9E9E109F,
+  0x9D9D1097,
+  0x9C9C108F,
+  0x9B9B1086,
+  0x9A9A107F,
+  0x95951076,
+  0x9494106B,
+  0x93931064,
+  0x92921057,
+  0x91911050,
+  0x909900CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABA1107,
+  0xB9B910EF,
+  0xB8B810E1,
+  0xA5A510D9,
+  0xA3A310D3,
+  0xA0A400CA,
+  0x9F9F10CA,
+  0x8B8B10C3,
+  0x8A8A10BD,
+  0x858510B6,
+  0x848410AF,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFAF1111,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9B9B1117,
+  0x80BF00CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0A00712,
+  0x9C9C05C5,
+  0x80BF00CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABA111D,
+  0x80BF00CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFAF1124,
+  0x80AE00CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA8A8112A,
+  0xA0A700CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8D8D1130,
+  0x808C00CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x74741136,
+  0x617A008E,
+  0x5F5F008E,
+  0x415A008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x303A008E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x2626008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x73731163,
+  0x617A008E,
+  0x5F5F008E,
+  0x415A008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x303A008E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x2626008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x727209AA,
+  0x617A008E,
+  0x5F5F008E,
+  0x415A008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x303A008E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x2626008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0x08001190,
+  0xF0F012C8,
+  0xEFEF12B2,
+  0xEDED12AB,
+  0xEAEA128E,
+  0xE5EC1289,
+  0xE4E41283,
+  0xE3E31276,
+  0xE2E21265,
+  0xE1E11234,
+  0xE0E01211,
+  0xDFDF120A,
+  0xDEDE1204,
+  0xDDDD11FF,
+  0xDCDC11F9,
+  0xDBDB11F0,
+  0xD9D911E8,
+  0xD8D811E3,
+  0xD7D711DD,
+  0xD6D611D8,
+  0xD5D511D1,
+  0xD4D411CB,
+  0xD2D211C5,
+  0xD0DA11A0,
+  0xCFCF11BF,
+  0xCECE11B6,
+  0xCDCD11AE,
+  0xCBCB11A5,
+  0xC4CA11A0,
+  0xC3C31199,
+  0xC2C21192,
+  0x617A09AA,
+  0x5F5F09AA,
+  0x415A09AA,
+  0x3E3E09AA,
+  0x3C3C09AA,
+  0x303A09AA,
+  0x2C2C09AA,
+  0x2A2A09AA,
+  0x262609AA,
+  0x202012E0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x090912E0,
+  0x0008130E,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x74741312,
+  0x617A008E,
+  0x5F5F008E,
+  0x415A008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x303A008E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x2626008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x69690923,
+  0x617A008E,
+  0x5F5F008E,
+  0x415A008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x303A008E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x2626008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x7272133F,
+  0x617A008E,
+  0x5F5F008E,
+  0x415A008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x303A008E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x2626008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x6969136C,
+  0x617A008E,
+  0x5F5F008E,
+  0x415A008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x303A008E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x2626008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x627A0D6E,
+  0x616113A7,
+  0x5F5F0D6E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3A3A008E,
+  0x30390D6E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x28281399,
+  0x2626008E,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x6C6C140C,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3A3A008E,
+  0x30390D6E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x28281399,
+  0x2626008E,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x6F6F143B,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3A3A008E,
+  0x30390D6E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x28281399,
+  0x2626008E,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x6666146A,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3A3A008E,
+  0x30390D6E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x28281399,
+  0x2626008E,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x65651499,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3A3A008E,
+  0x30390D6E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x28281399,
+  0x2626008E,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x777714C8,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3A3A008E,
+  0x30390D6E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x28281399,
+  0x2626008E,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x686814F7,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3A3A008E,
+  0x30390D6E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x28281399,
+  0x2626008E,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x68681526,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3A3A008E,
+  0x30390D6E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x28281399,
+  0x2626008E,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xBABA0D6E,
+  0xB5B50D6E,
+  0xAAAA0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8BF0D6E,
+  0x98B60D6E,
+  0x80960D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BF0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAEAE0D6E,
+  0xACAC0D6E,
+  0xA0A40D6E,
+  0x86910D6E,
+  0x80810D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF0D6E,
+  0xBABD0D6E,
+  0xB6B70D6E,
+  0xB0B40D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA3BF0D6E,
+  0x8EA10D6E,
+  0x8C8C0D6E,
+  0x888A0D6E,
+  0x86860D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB7BF0D6E,
+  0x80B50D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8ABF0D6E,
+  0x80810D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1BF0D6E,
+  0x80AF0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF0D6E,
+  0x99990D6E,
+  0x80960D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80880D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFB20D6E,
+  0x90AA0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1BF0D6E,
+  0xAEAF0D6E,
+  0xA0A90D6E,
+  0x808A0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF0D6E,
+  0xAEBC0D6E,
+  0xA5A60D6E,
+  0x95950D6E,
+  0x80930D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x92AF0D6E,
+  0x90900D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8DBF0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1B10D6E,
+  0x80A50D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABA0D6E,
+  0xB4B50D6E,
+  0x80AA0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBE166D,
+  0xBDBD1666,
+  0xBCBC165F,
+  0xBBBB1656,
+  0xBABA1649,
+  0xB9B91642,
+  0xB8B8163B,
+  0xB7B71634,
+  0xB6B6162B,
+  0xB5B51621,
+  0xB4B41618,
+  0xB3B3160F,
+  0xB2B21603,
+  0xB1B115FA,
+  0xB0B015F0,
+  0xAFAF15E9,
+  0xAEAE15DA,
+  0xADAD15D1,
+  0xACAC15C5,
+  0xABAB15BC,
+  0xAAAA15B0,
+  0xA9A915A7,
+  0xA8A8159B,
+  0xA7A71591,
+  0xA6A61584,
+  0xA5A5157B,
+  0xA4A41574,
+  0xA3A3156E,
+  0xA2A21566,
+  0xA1A1155E,
+  0xA0A01555,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF17AB,
+  0xBEBE17A3,
+  0xBDBD1797,
+  0xBCBC178F,
+  0xB8BB0C13,
+  0xB4B60C13,
+  0xB3B31786,
+  0xB2B2177E,
+  0xB1B11777,
+  0xB0B01771,
+  0xAFAF176B,
+  0xAEAE1764,
+  0xADAD175D,
+  0xACAC1757,
+  0xAAAA174F,
+  0xA9A91749,
+  0xA8A81742,
+  0xA7A7173B,
+  0xA6A61734,
+  0xA5A5172D,
+  0xA4A41727,
+  0xA3A31721,
+  0xA2A21718,
+  0xA1A11712,
+  0xA0A0170B,
+  0x9F9F1703,
+  0x9E9E16FD,
+  0x9D9D16F5,
+  0x9C9C16EE,
+  0x9B9B16E7,
+  0x9A9A16E0,
+  0x999916D9,
+  0x909016D3,
+  0x8F8F16CC,
+  0x8E8E16C5,
+  0x8D8D16BF,
+  0x8C8C16B7,
+  0x8B8B16AE,
+  0x8A8A16A4,
+  0x89891699,
+  0x84980C13,
+  0x8383168F,
+  0x82821686,
+  0x8181167A,
+  0x80801673,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8B81814,
+  0xB7B7180B,
+  0xB6B61801,
+  0xB5B517FA,
+  0xB4B417F1,
+  0xB3B317E9,
+  0xB0B20C13,
+  0x868617E3,
+  0x858517DC,
+  0x848417CC,
+  0x828217C6,
+  0x818117BD,
+  0x808017B7,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90BF0C13,
+  0x8787183F,
+  0x86861838,
+  0x85850C13,
+  0x84841831,
+  0x8383182A,
+  0x82821822,
+  0x818116D3,
+  0x8080181A,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8BF0C13,
+  0x80B60C13,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BF0C13,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFAF18E9,
+  0xADAD18E1,
+  0xACAC18D6,
+  0xABAB18CC,
+  0xAAAA18C3,
+  0xA9A918B8,
+  0xA8A818B2,
+  0xA7A718AA,
+  0xA6A618A4,
+  0xA5A5189D,
+  0xA4A41896,
+  0xA3A3188D,
+  0xA2A21887,
+  0xA1A116FD,
+  0xA0A0187E,
+  0x9F9F1874,
+  0x9E9E186D,
+  0x9C9C1866,
+  0x9B9B176B,
+  0x9A9A185F,
+  0x99991858,
+  0x98981851,
+  0x9393184B,
+  0x92921845,
+  0x80BF0C13,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9F9F18F7,
+  0x9E9E18F0,
+  0x809D0C13,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF196E,
+  0xBEBE1968,
+  0xBDBD1961,
+  0xBCBC1959,
+  0xBBBB1953,
+  0xB9B9194B,
+  0xB8B81945,
+  0xB7B7193E,
+  0xB6B61937,
+  0xB5B51931,
+  0xB4B4192B,
+  0xAFAF1925,
+  0xAEAE191F,
+  0xADAD1917,
+  0xACAC190B,
+  0xABAB1905,
+  0xA9A918FE,
+  0xA4BA0C13,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1B11A69,
+  0xAFAF1A62,
+  0xAEAE1A5B,
+  0xACAC1A54,
+  0xABAB1A4C,
+  0xAAAA1A45,
+  0xA0B00D12,
+  0x9F9F1A3F,
+  0x9E9E1A2F,
+  0x9D9D1A1D,
+  0x9B9B1A11,
+  0x9A9A1A0B,
+  0x98981A02,
+  0x97970D12,
+  0x969619F0,
+  0x949419E9,
+  0x939319E2,
+  0x929219D7,
+  0x919119A6,
+  0x90901977,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3A3A008E,
+  0x30390D6E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x28281399,
+  0x2626008E,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0x61611A70,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x6C6C1A76,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x6F6F1A7C,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x6666130E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x65651A82,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x77771A88,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x68681A8E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x68681A94,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF008E,
+  0xBCBD008E,
+  0xA8BA008E,
+  0x8DA6008E,
+  0x808B008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x909D008E,
+  0x808D008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BA008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF008E,
+  0x809C008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8090008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xADBF008E,
+  0x809F008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90B5008E,
+  0x8289008E,
+  0x8080008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x888F008E,
+  0x8083008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0xA0A9008E,
+  0x809D008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x98BB008E,
+  0x8093008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0x80A7008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBF008E,
+  0xB0BA008E,
+  0x80A3008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBC008E,
+  0xB3B9008E,
+  0xA3B1008E,
+  0x97A1008E,
+  0x9495008E,
+  0x8C92008E,
+  0x808A008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80B6008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0A7008E,
+  0x8095008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2BA008E,
+  0x87B0008E,
+  0x8085008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF008E,
+  0xBCBC008E,
+  0xB7B8008E,
+  0x8AB5008E,
+  0x8888008E,
+  0x8085008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0B6008E,
+  0x8095008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB4B5008E,
+  0xA0B2008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0B9008E,
+  0x8095008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF008E,
+  0x80B7008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x99B5008E,
+  0x9597008E,
+  0x9093008E,
+  0x8080008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BC008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x809C008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x89A4008E,
+  0x8087008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0B2008E,
+  0x8095008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8091008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80B2008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B9008E,
+  0x80A3008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B1008E,
+  0x80A9008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0xA7A7008E,
+  0x809C008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0x8085008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0x8081008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0B6008E,
+  0x8084008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x83B7008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB5B5008E,
+  0xB1B2008E,
+  0xA6AF008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x83AF008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B9008E,
+  0x90A8008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB6BF008E,
+  0x83A6008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB6B6008E,
+  0x90B2008E,
+  0x8787008E,
+  0x8484008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x83B2008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9C9C008E,
+  0x909A008E,
+  0x8184008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x93AB008E,
+  0x8091008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0x9FA8008E,
+  0x8F9D008E,
+  0x8A8D008E,
+  0x8888008E,
+  0x8086008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B9008E,
+  0x809E008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9DA1008E,
+  0x9090008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80B4008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9FA1008E,
+  0x9099008E,
+  0x878A008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80AF008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9099008E,
+  0x8787008E,
+  0x8485008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80AE008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x989B008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9099008E,
+  0x8484008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8B8008E,
+  0x80AA008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B9008E,
+  0x809A008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8086008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80AB008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF008E,
+  0x80A9008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF008E,
+  0x98AF008E,
+  0x9596008E,
+  0x8C93008E,
+  0x8989008E,
+  0x8086008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9099008E,
+  0x8181008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAABF008E,
+  0xA0A7008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA3A3008E,
+  0xA1A1008E,
+  0x8090008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABA008E,
+  0x8BB2008E,
+  0x8080008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9CBF008E,
+  0x9090008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0x9D9D008E,
+  0x8089008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8AAE008E,
+  0x8088008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2BF008E,
+  0x9099008E,
+  0x8080008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x808F008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8BB0008E,
+  0x8889008E,
+  0x8086008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAABF008E,
+  0xA7A8008E,
+  0xA0A5008E,
+  0x9099008E,
+  0x8686008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0A9008E,
+  0x9898008E,
+  0x8089008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0B2008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B0008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8083008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80B0008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0xA0A9008E,
+  0x809E008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90AD008E,
+  0x8089008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBF008E,
+  0xA3B7008E,
+  0x9099008E,
+  0x8083008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9090008E,
+  0x808A008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x939F008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA3A3008E,
+  0xA0A1008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80B7008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8095008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBE008E,
+  0xB5BB008E,
+  0xB0B3008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80A2008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0xA4A7008E,
+  0x9092008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BB008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BC008E,
+  0x80AA008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9099008E,
+  0x8088008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x96BF008E,
+  0x8094008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBF008E,
+  0xBBBB008E,
+  0xAEB9008E,
+  0xA9AC008E,
+  0xA5A6008E,
+  0xA2A2008E,
+  0x9E9F008E,
+  0x809C008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x85BF008E,
+  0x8083008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBE008E,
+  0x9EB9008E,
+  0x969C008E,
+  0x8D94008E,
+  0x878A008E,
+  0x8085008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x92BF008E,
+  0x8A90008E,
+  0x8686008E,
+  0x8084008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA8BF008E,
+  0x80A5008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBF008E,
+  0x9CBA008E,
+  0x829A008E,
+  0x8080008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB6BF008E,
+  0x96B4008E,
+  0x8094008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0x90AE008E,
+  0x808E008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAABF008E,
+  0x8AA8008E,
+  0x8088008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8EBF008E,
+  0x848B008E,
+  0x8082008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB7BD008E,
+  0x80AC008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8E8E008E,
+  0x8089008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90AD008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B9008E,
+  0x80AB008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BE008E,
+  0xADAE008E,
+  0xA8AB008E,
+  0xA0A6008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8084008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9099008E,
+  0x8B8B008E,
+  0x8083008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBB008E,
+  0xB9B9008E,
+  0xB4B7008E,
+  0xA9B2008E,
+  0xA7A7008E,
+  0xA4A4008E,
+  0xA1A2008E,
+  0x859F008E,
+  0x8083008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBE008E,
+  0xB9BC008E,
+  0xB4B7008E,
+  0xACB2008E,
+  0xA7AA008E,
+  0xA4A4008E,
+  0xA1A2008E,
+  0x9F9F008E,
+  0x9D9D008E,
+  0x9B9B008E,
+  0x9999008E,
+  0x9797008E,
+  0x9494008E,
+  0x9192008E,
+  0x8D8F008E,
+  0x8B8B008E,
+  0x8989008E,
+  0x8787008E,
+  0x8282008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xABBB008E,
+  0xA5A9008E,
+  0xA1A3008E,
+  0x8B9B008E,
+  0x8089008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B9008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x809F008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0x80A1008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80A0008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x809D008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x808A008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x63631A9A,
+  0x617A008E,
+  0x5F5F008E,
+  0x415A008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x303A008E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x2626008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x656509AA,
+  0x617A008E,
+  0x5F5F008E,
+  0x415A008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x303A008E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x2626008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0x07001AC7,
+  0x00FFFFFF,
+  0x08001190,
+  0xBABA09AA,
+  0xB5B509AA,
+  0xAAAA09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8BF09AA,
+  0x98B609AA,
+  0x809609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BF09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAEAE09AA,
+  0xACAC09AA,
+  0xA0A409AA,
+  0x869109AA,
+  0x808109AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF09AA,
+  0xBABD09AA,
+  0xB6B709AA,
+  0xB0B409AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA3BF09AA,
+  0x8EA109AA,
+  0x8C8C09AA,
+  0x888A09AA,
+  0x868609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB7BF09AA,
+  0x80B509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8ABF09AA,
+  0x808109AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1BF09AA,
+  0x80AF09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF09AA,
+  0x999909AA,
+  0x809609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x808809AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFB209AA,
+  0x90AA09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1BF09AA,
+  0xAEAF09AA,
+  0xA0A909AA,
+  0x808A09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF09AA,
+  0xAEBC09AA,
+  0xA5A609AA,
+  0x959509AA,
+  0x809309AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x92AF09AA,
+  0x909009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8DBF09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1B109AA,
+  0x80A509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABA09AA,
+  0xB4B509AA,
+  0x80AA09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBE1BC3,
+  0xBDBD1BBD,
+  0xBCBC1BB7,
+  0xBBBB1BAF,
+  0xBABA1BA3,
+  0xB9B91B9D,
+  0xB8B81B97,
+  0xB7B71B91,
+  0xB6B61B89,
+  0xB5B51B80,
+  0xB4B41B78,
+  0xB3B31B70,
+  0xB2B21B65,
+  0xB1B11B5D,
+  0xB0B01B54,
+  0xAFAF1B4E,
+  0xAEAE1B40,
+  0xADAD1B38,
+  0xACAC1B2D,
+  0xABAB1B25,
+  0xAAAA1B1A,
+  0xA9A91B12,
+  0xA8A81B07,
+  0xA7A71AFE,
+  0xA6A61AF2,
+  0xA5A51AEA,
+  0xA4A41AE4,
+  0xA3A31ADF,
+  0xA2A21AD8,
+  0xA1A11AD1,
+  0xA0A01AC9,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF1CD7,
+  0xBEBE1CD0,
+  0xBDBD1CC5,
+  0xBCBC1CBE,
+  0xB8BB11A0,
+  0xB4B611A0,
+  0xB3B31CB6,
+  0xB2B21CAF,
+  0xB1B11CA9,
+  0xB0B01CA4,
+  0xAFAF1C9F,
+  0xAEAE1C99,
+  0xADAD1C93,
+  0xACAC1C8E,
+  0xAAAA1C87,
+  0xA9A91C82,
+  0xA8A81C7C,
+  0xA7A71C76,
+  0xA6A61C70,
+  0xA5A51C6A,
+  0xA4A41C65,
+  0xA3A31C60,
+  0xA2A21C58,
+  0xA1A11C53,
+  0xA0A01C4D,
+  0x9F9F1C46,
+  0x9E9E1C41,
+  0x9D9D1C3A,
+  0x9C9C1C34,
+  0x9B9B1C2E,
+  0x9A9A1C28,
+  0x99991C22,
+  0x90901C1D,
+  0x8F8F1C17,
+  0x8E8E1C11,
+  0x8D8D1C0C,
+  0x8C8C1C05,
+  0x8B8B1BFD,
+  0x8A8A1BF4,
+  0x89891BEA,
+  0x849811A0,
+  0x83831BE1,
+  0x82821BD9,
+  0x81811BCE,
+  0x80801BC8,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8B81D34,
+  0xB7B71D2C,
+  0xB6B61D23,
+  0xB5B51D1D,
+  0xB4B41D15,
+  0xB3B31D0E,
+  0xB0B211A0,
+  0x86861D09,
+  0x85851D03,
+  0x84841CF4,
+  0x82821CEF,
+  0x81811CE7,
+  0x80801CE2,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90BF11A0,
+  0x87871D59,
+  0x86861D53,
+  0x858511A0,
+  0x84841D4D,
+  0x83831D47,
+  0x82821D40,
+  0x81811C1D,
+  0x80801D39,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8BF11A0,
+  0x80B611A0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BF11A0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFAF1DED,
+  0xADAD1DE6,
+  0xACAC1DDC,
+  0xABAB1DD3,
+  0xAAAA1DCB,
+  0xA9A91DC1,
+  0xA8A81DBC,
+  0xA7A71DB5,
+  0xA6A61DB0,
+  0xA5A51DAA,
+  0xA4A41DA4,
+  0xA3A31D9C,
+  0xA2A21D97,
+  0xA1A11C41,
+  0xA0A01D8F,
+  0x9F9F1D86,
+  0x9E9E1D80,
+  0x9C9C1D7A,
+  0x9B9B1C9F,
+  0x9A9A1D74,
+  0x99991D6E,
+  0x98981D68,
+  0x93931D63,
+  0x92921D5E,
+  0x80BF11A0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9F9F1DF9,
+  0x9E9E1DF3,
+  0x809D11A0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF1E5F,
+  0xBEBE1E5A,
+  0xBDBD1E54,
+  0xBCBC1E4D,
+  0xBBBB1E48,
+  0xB9B91E41,
+  0xB8B81E3C,
+  0xB7B71E36,
+  0xB6B61E30,
+  0xB5B51E2B,
+  0xB4B41E26,
+  0xAFAF1E21,
+  0xAEAE1E1C,
+  0xADAD1E15,
+  0xACAC1E0A,
+  0xABAB1E05,
+  0xA9A91DFF,
+  0xA4BA11A0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1B11F48,
+  0xAFAF1F42,
+  0xAEAE1F3C,
+  0xACAC1F36,
+  0xABAB1F2F,
+  0xAAAA1F29,
+  0xA0B01289,
+  0x9F9F1F24,
+  0x9E9E1F15,
+  0x9D9D1F04,
+  0x9B9B1EF9,
+  0x9A9A1EF4,
+  0x98981EEC,
+  0x97971289,
+  0x96961EDB,
+  0x94941ED5,
+  0x93931ECF,
+  0x92921EC5,
+  0x91911E95,
+  0x90901E67,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xF0F02084,
+  0xEFEF206E,
+  0xEDED2067,
+  0xEAEA204A,
+  0xE5EC2045,
+  0xE4E4203F,
+  0xE3E32032,
+  0xE2E22021,
+  0xE1E11FF0,
+  0xE0E01FCD,
+  0xDFDF1FC6,
+  0xDEDE1FC0,
+  0xDDDD1FBB,
+  0xDCDC1FB5,
+  0xDBDB1FAC,
+  0xD9D91FA4,
+  0xD8D81F9F,
+  0xD7D71F99,
+  0xD6D61F94,
+  0xD5D51F8D,
+  0xD4D41F87,
+  0xD2D21F81,
+  0xD0DA1F5C,
+  0xCFCF1F7B,
+  0xCECE1F72,
+  0xCDCD1F6A,
+  0xCBCB1F61,
+  0xC4CA1F5C,
+  0xC3C31F55,
+  0xC2C21F4E,
+  0x617A146A,
+  0x5F5F146A,
+  0x415A146A,
+  0x3E3E09AA,
+  0x3C3C09AA,
+  0x3A3A09AA,
+  0x3039146A,
+  0x2C2C09AA,
+  0x2A2A09AA,
+  0x262609AA,
+  0x202012E0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x090912E0,
+  0x0008130E,
+  0x08001190,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x7575209C,
+  0x617A008E,
+  0x5F5F008E,
+  0x415A008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x303A008E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x2626008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x6F6F20C9,
+  0x617A008E,
+  0x5F5F008E,
+  0x415A008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x303A008E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x2626008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x6C6C1163,
+  0x617A008E,
+  0x5F5F008E,
+  0x415A008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x303A008E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x2626008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF4F4214B,
+  0xF1F32145,
+  0xF0F0213F,
+  0xEDED2139,
+  0xE1EF2133,
+  0xE0E0212D,
+  0xC2DF2127,
+  0x80FF0225,
+  0x292920F6,
+  0x20202151,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x09092151,
+  0x00081399,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x74742167,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3A3A008E,
+  0x30390D6E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x28281399,
+  0x2626008E,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x77770BD4,
+  0x74740BA5,
+  0x73730B76,
+  0x72720B47,
+  0x69690B18,
+  0x66660AE9,
+  0x65650ABA,
+  0x63630A8B,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3A3A008E,
+  0x30390D6E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x28281399,
+  0x2626008E,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x73732196,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3A3A008E,
+  0x30390D6E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x28281399,
+  0x2626008E,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x7272146A,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3A3A008E,
+  0x30390D6E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x28281399,
+  0x2626008E,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0x08001190,
+  0xF0F02084,
+  0xEFEF206E,
+  0xEDED2067,
+  0xEAEA204A,
+  0xE5EC2045,
+  0xE4E4203F,
+  0xE3E32032,
+  0xE2E22021,
+  0xE1E11FF0,
+  0xE0E01FCD,
+  0xDFDF1FC6,
+  0xDEDE1FC0,
+  0xDDDD1FBB,
+  0xDCDC1FB5,
+  0xDBDB1FAC,
+  0xD9D91FA4,
+  0xD8D81F9F,
+  0xD7D71F99,
+  0xD6D61F94,
+  0xD5D51F8D,
+  0xD4D41F87,
+  0xD2D21F81,
+  0xD0DA1F5C,
+  0xCFCF1F7B,
+  0xCECE1F72,
+  0xCDCD1F6A,
+  0xCBCB1F61,
+  0xC4CA1F5C,
+  0xC3C31F55,
+  0xC2C21F4E,
+  0x617A146A,
+  0x5F5F146A,
+  0x415A146A,
+  0x3E3E09AA,
+  0x3C3C09AA,
+  0x3A3A09AA,
+  0x3039146A,
+  0x2C2C09AA,
+  0x2A2A09AA,
+  0x282821C5,
+  0x262609AA,
+  0x2020146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0909146A,
+  0x0008130E,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x747421D2,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3A3A008E,
+  0x30390D6E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x28281399,
+  0x2626008E,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x696913A7,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3A3A008E,
+  0x30390D6E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x28281399,
+  0x2626008E,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x72722201,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3A3A008E,
+  0x30390D6E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x28281399,
+  0x2626008E,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x69692230,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3A3A008E,
+  0x30390D6E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x28281399,
+  0x2626008E,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xA8A80D6E,
+  0xA4A40D6E,
+  0x9A9A0D6E,
+  0x80950D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0xA0AA0D6E,
+  0x80980D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF0D6E,
+  0x898E0D6E,
+  0x80870D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80890D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBD0D6E,
+  0x84B90D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1BF0D6E,
+  0xA6AF0D6E,
+  0x98A10D6E,
+  0x90900D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBD0D6E,
+  0xB6B90D6E,
+  0xB2B20D6E,
+  0xAAB00D6E,
+  0x93A80D6E,
+  0x8F900D6E,
+  0x858C0D6E,
+  0x80800D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBC0D6E,
+  0xA6B10D6E,
+  0x9FA10D6E,
+  0x9C9D0D6E,
+  0x8E8E0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8B90D6E,
+  0xB5B60D6E,
+  0xB2B30D6E,
+  0xAAB00D6E,
+  0x93A80D6E,
+  0x8F900D6E,
+  0x858A0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2B40D6E,
+  0xA6AF0D6E,
+  0x9E9E0D6E,
+  0x999C0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBD0D6E,
+  0xB5B90D6E,
+  0xB2B30D6E,
+  0xAAB00D6E,
+  0x93A80D6E,
+  0x8F910D6E,
+  0x858D0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB9B90D6E,
+  0xA6AF0D6E,
+  0xA0A10D6E,
+  0x90900D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBD0D6E,
+  0xB5B90D6E,
+  0xB2B30D6E,
+  0xAAB00D6E,
+  0x93A80D6E,
+  0x8F900D6E,
+  0x858C0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1B10D6E,
+  0xA6AF0D6E,
+  0x9FA10D6E,
+  0x9C9D0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAEB90D6E,
+  0xA8AA0D6E,
+  0xA3A40D6E,
+  0x9E9F0D6E,
+  0x9C9C0D6E,
+  0x999A0D6E,
+  0x92950D6E,
+  0x8E900D6E,
+  0x858A0D6E,
+  0x83830D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA6AF0D6E,
+  0x90900D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBD0D6E,
+  0xAAB90D6E,
+  0x92A80D6E,
+  0x8E900D6E,
+  0x858C0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA6AF0D6E,
+  0xA0A10D6E,
+  0x9D9D0D6E,
+  0x989A0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBD0D6E,
+  0xB5B90D6E,
+  0xAAB30D6E,
+  0x92A80D6E,
+  0x8E900D6E,
+  0x858C0D6E,
+  0x80800D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1B20D6E,
+  0xA6AF0D6E,
+  0xA0A10D6E,
+  0x9D9E0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBD0D6E,
+  0x92BA0D6E,
+  0x8E900D6E,
+  0x848C0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABF0D6E,
+  0xA6AF0D6E,
+  0x9FA10D6E,
+  0x94960D6E,
+  0x8E8E0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBD0D6E,
+  0xB3BB0D6E,
+  0x9AB10D6E,
+  0x85960D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA6AF0D6E,
+  0x80860D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2B30D6E,
+  0x81B00D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90990D6E,
+  0x80860D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBD0D6E,
+  0xB2B30D6E,
+  0xA7B00D6E,
+  0xA5A50D6E,
+  0x8CA30D6E,
+  0x868A0D6E,
+  0x84840D6E,
+  0x81820D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9C9F0D6E,
+  0x90990D6E,
+  0x86860D6E,
+  0x80840D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0A90D6E,
+  0x80800D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x89AC0D6E,
+  0x80870D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x888C0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF0D6E,
+  0x80AA0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB5BF0D6E,
+  0xAEB00D6E,
+  0xA5A60D6E,
+  0xA1A10D6E,
+  0x9A9D0D6E,
+  0x90950D6E,
+  0x80890D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF0D6E,
+  0x90990D6E,
+  0x8E8E0D6E,
+  0x80810D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBF0D6E,
+  0x90BA0D6E,
+  0x8D8D0D6E,
+  0x87870D6E,
+  0x80850D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF0D6E,
+  0x9A9D0D6E,
+  0x98980D6E,
+  0x90960D6E,
+  0x8A8D0D6E,
+  0x80880D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8BE0D6E,
+  0xB2B50D6E,
+  0x90B00D6E,
+  0x8A8D0D6E,
+  0x80880D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x98BF0D6E,
+  0x88960D6E,
+  0x82850D6E,
+  0x80800D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x98BF0D6E,
+  0x92950D6E,
+  0x80900D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x809A0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF0D6E,
+  0x808F0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8BD0D6E,
+  0x80B50D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x81BF0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFBF0D6E,
+  0x80AC0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF0D6E,
+  0x819A0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1B80D6E,
+  0x80AA0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9FB10D6E,
+  0x80910D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAEB00D6E,
+  0xA0AC0D6E,
+  0x80910D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80B30D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0A90D6E,
+  0x9C9C0D6E,
+  0x97970D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF0D6E,
+  0x90990D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80B80D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0xAAAA0D6E,
+  0x87A80D6E,
+  0x80840D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80B50D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x809E0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B40D6E,
+  0x86AD0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0x80AB0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90990D6E,
+  0x80890D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF0D6E,
+  0x80960D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80940D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA7A70D6E,
+  0x90990D6E,
+  0x80890D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x85B30D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90990D6E,
+  0x858C0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAEBF0D6E,
+  0x83A00D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80A50D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80A30D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8DBD0D6E,
+  0x80890D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBF0D6E,
+  0x90BA0D6E,
+  0x80880D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABA0D6E,
+  0xB5B60D6E,
+  0xAEB30D6E,
+  0xA9AC0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF0D6E,
+  0x989D0D6E,
+  0x80950D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9FBD0D6E,
+  0x9D9D0D6E,
+  0x9B9B0D6E,
+  0x99990D6E,
+  0x90970D6E,
+  0x888D0D6E,
+  0x80850D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBE0D6E,
+  0xB6BC0D6E,
+  0x80B40D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB6BC0D6E,
+  0xB2B40D6E,
+  0xA0AC0D6E,
+  0x969B0D6E,
+  0x90930D6E,
+  0x868C0D6E,
+  0x82840D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF0D6E,
+  0xB1B10D6E,
+  0x94940D6E,
+  0x80800D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x909C0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBF0D6E,
+  0xAFB90D6E,
+  0xAAAD0D6E,
+  0xA8A80D6E,
+  0xA6A60D6E,
+  0xA4A40D6E,
+  0x999D0D6E,
+  0x95950D6E,
+  0x8A930D6E,
+  0x87870D6E,
+  0x82820D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8E8E0D6E,
+  0x85890D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x83840D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2B30D6E,
+  0xABAE0D6E,
+  0x80A40D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0xADAD0D6E,
+  0xA7A70D6E,
+  0x80A50D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFAF0D6E,
+  0x80A70D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8BE0D6E,
+  0xB0B60D6E,
+  0xA8AE0D6E,
+  0xA0A60D6E,
+  0x80960D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x989E0D6E,
+  0x90960D6E,
+  0x888E0D6E,
+  0x80860D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFAF0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBC0D6E,
+  0xB1B50D6E,
+  0x85860D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA1BF0D6E,
+  0x9D9F0D6E,
+  0x80960D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBF0D6E,
+  0x80BA0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1BF0D6E,
+  0x85AF0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF0D6E,
+  0x808E0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x808C0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90BD0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90AB0D6E,
+  0x808C0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF0D6E,
+  0x80AE0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF0D6E,
+  0x809D0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA2BF0D6E,
+  0x979F0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8BBF0D6E,
+  0x80880D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2BF0D6E,
+  0x95990D6E,
+  0x93930D6E,
+  0x90910D6E,
+  0x808A0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8CA20D6E,
+  0x878A0D6E,
+  0x83850D6E,
+  0x80810D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x82B30D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBE0D6E,
+  0xBBBB0D6E,
+  0xB2B70D6E,
+  0x90990D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0x80A50D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BC0D6E,
+  0x80860D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x84B20D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA6BE0D6E,
+  0xA0A40D6E,
+  0x8F990D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80A80D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF0D6E,
+  0xBABA0D6E,
+  0xA0B60D6E,
+  0x90990D6E,
+  0x848B0D6E,
+  0x80820D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB9BD0D6E,
+  0xB5B60D6E,
+  0xB1B10D6E,
+  0x80AF0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2B40D6E,
+  0xA0AA0D6E,
+  0x9B9D0D6E,
+  0x82820D6E,
+  0x80800D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0xA8AE0D6E,
+  0xA0A60D6E,
+  0x91960D6E,
+  0x898E0D6E,
+  0x81860D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0x9CA90D6E,
+  0x809A0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B90D6E,
+  0x80A20D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0x80A30D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8BBB0D6E,
+  0x80860D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0x80AD0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80990D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBE0D6E,
+  0xB8BC0D6E,
+  0xAAB60D6E,
+  0x9FA80D6E,
+  0x9D9D0D6E,
+  0x93970D6E,
+  0x80860D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x86BF0D6E,
+  0x83840D6E,
+  0x80810D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80B10D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x93BF0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BD0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90BF0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x92BF0D6E,
+  0x808F0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BB0D6E,
+  0x80870D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB3B40D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB6BF0D6E,
+  0xB0B40D6E,
+  0x8D8F0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BC0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF0D6E,
+  0xA1BA0D6E,
+  0x90990D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA6BF0D6E,
+  0x819A0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BE0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9A9C0D6E,
+  0x92970D6E,
+  0x8A8F0D6E,
+  0x82870D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF2352,
+  0xBEBE234B,
+  0xBDBD2344,
+  0xBCBC233C,
+  0xBABA2335,
+  0xB4B4232E,
+  0xB2B32328,
+  0xB1B10C53,
+  0xB0B00C13,
+  0xAEAE2322,
+  0xADAD231B,
+  0xACAC1721,
+  0xABAB2314,
+  0xAAAA230E,
+  0xA9A92308,
+  0xA8A822FF,
+  0xA6A622F8,
+  0xA4A422F1,
+  0xA3A322EA,
+  0xA2A21727,
+  0xA1A122E3,
+  0xA0A022D8,
+  0x9E9E22D0,
+  0x9D9D22C9,
+  0x9C9C22C3,
+  0x989B0C13,
+  0x969622B7,
+  0x959522AF,
+  0x949422A8,
+  0x939322A1,
+  0x92922299,
+  0x90910C13,
+  0x8F8F2292,
+  0x8E8E185F,
+  0x8D8D228A,
+  0x8C8C2283,
+  0x8B8B227D,
+  0x8A8A2276,
+  0x83832270,
+  0x82820C13,
+  0x81812269,
+  0x8080225F,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBE246F,
+  0xBBBB2469,
+  0xB6B62461,
+  0xB5B52457,
+  0xB4B4244F,
+  0xB2B22449,
+  0xB1B12441,
+  0xB0B0243A,
+  0xABAB1712,
+  0xAAAA2432,
+  0xA9A9242B,
+  0xA8A82423,
+  0xA7A7241B,
+  0xA6A62414,
+  0xA5A5240D,
+  0xA4A42402,
+  0xA3A323FB,
+  0xA2A20C60,
+  0xA0A023F5,
+  0x9D9D23EF,
+  0x9C9C23E8,
+  0x9B9B156E,
+  0x9A9A23E1,
+  0x999923DA,
+  0x989823C0,
+  0x979723D4,
+  0x969623CE,
+  0x939323C6,
+  0x929223C0,
+  0x919123B8,
+  0x909023B2,
+  0x8D8D23AB,
+  0x8C8C15C5,
+  0x8B8B23A4,
+  0x8A8A2399,
+  0x88882392,
+  0x8787238A,
+  0x86862384,
+  0x8585237B,
+  0x84842374,
+  0x8383236D,
+  0x82822367,
+  0x8181235F,
+  0x80802359,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF247B,
+  0xBEBE1931,
+  0x95952475,
+  0x92940C13,
+  0x8E8E1905,
+  0x808D0C13,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x909023CE,
+  0x808F0C13,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x999923EF,
+  0x90980C13,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF24A6,
+  0xBEBE24A0,
+  0xBDBD2499,
+  0xBCBC0C13,
+  0xB9B90C13,
+  0xAEAE2449,
+  0xADAD2490,
+  0xACAC23C0,
+  0xABAB2489,
+  0xAAAA1968,
+  0xA9A92481,
+  0xA8A81712,
+  0xA0A70C13,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB4B40C53,
+  0xB3B324B3,
+  0x9F9F24AD,
+  0x80B20C13,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF24B9,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2B224DC,
+  0xB1B124D5,
+  0xB0B00C13,
+  0x8B8B24CF,
+  0x858524C7,
+  0x848424C1,
+  0x808A0C13,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBC1727,
+  0x9F9F253A,
+  0x9E9E2532,
+  0x9D9D252A,
+  0x9C9C2522,
+  0x9B9B2519,
+  0x9A9A2512,
+  0x95952509,
+  0x949424FE,
+  0x939324F7,
+  0x929224EA,
+  0x919124E3,
+  0x90990C13,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABA259A,
+  0xB9B92582,
+  0xB8B82574,
+  0xA5A5256C,
+  0xA3A32566,
+  0xA0A40C13,
+  0x9F9F255D,
+  0x8B8B2556,
+  0x8A8A2550,
+  0x85852549,
+  0x84842542,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFAF25A4,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9B9B25AA,
+  0x80BF0C13,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0A0185F,
+  0x9C9C1712,
+  0x80BF0C13,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABA25B0,
+  0x80BF0C13,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFAF25B7,
+  0x80AE0C13,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA8A825BD,
+  0xA0A70C13,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8D8D25C3,
+  0x808C0C13,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x747425C9,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x737325CF,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x7272130E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x747425D5,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x69691A70,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x727225DB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x696925E1,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x686809AA,
+  0x617A008E,
+  0x5F5F008E,
+  0x415A008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x303A008E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x2626008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xFD000000,
+  0x00FFFFFF,
+  0x08001190,
+  0xA8A809AA,
+  0xA4A409AA,
+  0x9A9A09AA,
+  0x809509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0xA0AA09AA,
+  0x809809AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF09AA,
+  0x898E09AA,
+  0x808709AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x808909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBD09AA,
+  0x84B909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1BF09AA,
+  0xA6AF09AA,
+  0x98A109AA,
+  0x909009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBD09AA,
+  0xB6B909AA,
+  0xB2B209AA,
+  0xAAB009AA,
+  0x93A809AA,
+  0x8F9009AA,
+  0x858C09AA,
+  0x808009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBC09AA,
+  0xA6B109AA,
+  0x9FA109AA,
+  0x9C9D09AA,
+  0x8E8E09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8B909AA,
+  0xB5B609AA,
+  0xB2B309AA,
+  0xAAB009AA,
+  0x93A809AA,
+  0x8F9009AA,
+  0x858A09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2B409AA,
+  0xA6AF09AA,
+  0x9E9E09AA,
+  0x999C09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBD09AA,
+  0xB5B909AA,
+  0xB2B309AA,
+  0xAAB009AA,
+  0x93A809AA,
+  0x8F9109AA,
+  0x858D09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB9B909AA,
+  0xA6AF09AA,
+  0xA0A109AA,
+  0x909009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBD09AA,
+  0xB5B909AA,
+  0xB2B309AA,
+  0xAAB009AA,
+  0x93A809AA,
+  0x8F9009AA,
+  0x858C09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1B109AA,
+  0xA6AF09AA,
+  0x9FA109AA,
+  0x9C9D09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAEB909AA,
+  0xA8AA09AA,
+  0xA3A409AA,
+  0x9E9F09AA,
+  0x9C9C09AA,
+  0x999A09AA,
+  0x929509AA,
+  0x8E9009AA,
+  0x858A09AA,
+  0x838309AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA6AF09AA,
+  0x909009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBD09AA,
+  0xAAB909AA,
+  0x92A809AA,
+  0x8E9009AA,
+  0x858C09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA6AF09AA,
+  0xA0A109AA,
+  0x9D9D09AA,
+  0x989A09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBD09AA,
+  0xB5B909AA,
+  0xAAB309AA,
+  0x92A809AA,
+  0x8E9009AA,
+  0x858C09AA,
+  0x808009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1B209AA,
+  0xA6AF09AA,
+  0xA0A109AA,
+  0x9D9E09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBD09AA,
+  0x92BA09AA,
+  0x8E9009AA,
+  0x848C09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABF09AA,
+  0xA6AF09AA,
+  0x9FA109AA,
+  0x949609AA,
+  0x8E8E09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBD09AA,
+  0xB3BB09AA,
+  0x9AB109AA,
+  0x859609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA6AF09AA,
+  0x808609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2B309AA,
+  0x81B009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x909909AA,
+  0x808609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBD09AA,
+  0xB2B309AA,
+  0xA7B009AA,
+  0xA5A509AA,
+  0x8CA309AA,
+  0x868A09AA,
+  0x848409AA,
+  0x818209AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9C9F09AA,
+  0x909909AA,
+  0x868609AA,
+  0x808409AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0A909AA,
+  0x808009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x89AC09AA,
+  0x808709AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x888C09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF09AA,
+  0x80AA09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB5BF09AA,
+  0xAEB009AA,
+  0xA5A609AA,
+  0xA1A109AA,
+  0x9A9D09AA,
+  0x909509AA,
+  0x808909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF09AA,
+  0x909909AA,
+  0x8E8E09AA,
+  0x808109AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBF09AA,
+  0x90BA09AA,
+  0x8D8D09AA,
+  0x878709AA,
+  0x808509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF09AA,
+  0x9A9D09AA,
+  0x989809AA,
+  0x909609AA,
+  0x8A8D09AA,
+  0x808809AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8BE09AA,
+  0xB2B509AA,
+  0x90B009AA,
+  0x8A8D09AA,
+  0x808809AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x98BF09AA,
+  0x889609AA,
+  0x828509AA,
+  0x808009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x98BF09AA,
+  0x929509AA,
+  0x809009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x809A09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF09AA,
+  0x808F09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8BD09AA,
+  0x80B509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x81BF09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFBF09AA,
+  0x80AC09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF09AA,
+  0x819A09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1B809AA,
+  0x80AA09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9FB109AA,
+  0x809109AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAEB009AA,
+  0xA0AC09AA,
+  0x809109AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80B309AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0A909AA,
+  0x9C9C09AA,
+  0x979709AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF09AA,
+  0x909909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80B809AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0xAAAA09AA,
+  0x87A809AA,
+  0x808409AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80B509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x809E09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B409AA,
+  0x86AD09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0x80AB09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x909909AA,
+  0x808909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF09AA,
+  0x809609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x809409AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA7A709AA,
+  0x909909AA,
+  0x808909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x85B309AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x909909AA,
+  0x858C09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAEBF09AA,
+  0x83A009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80A509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80A309AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8DBD09AA,
+  0x808909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBF09AA,
+  0x90BA09AA,
+  0x808809AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABA09AA,
+  0xB5B609AA,
+  0xAEB309AA,
+  0xA9AC09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF09AA,
+  0x989D09AA,
+  0x809509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9FBD09AA,
+  0x9D9D09AA,
+  0x9B9B09AA,
+  0x999909AA,
+  0x909709AA,
+  0x888D09AA,
+  0x808509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBE09AA,
+  0xB6BC09AA,
+  0x80B409AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB6BC09AA,
+  0xB2B409AA,
+  0xA0AC09AA,
+  0x969B09AA,
+  0x909309AA,
+  0x868C09AA,
+  0x828409AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF09AA,
+  0xB1B109AA,
+  0x949409AA,
+  0x808009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x909C09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBF09AA,
+  0xAFB909AA,
+  0xAAAD09AA,
+  0xA8A809AA,
+  0xA6A609AA,
+  0xA4A409AA,
+  0x999D09AA,
+  0x959509AA,
+  0x8A9309AA,
+  0x878709AA,
+  0x828209AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8E8E09AA,
+  0x858909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x838409AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2B309AA,
+  0xABAE09AA,
+  0x80A409AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0xADAD09AA,
+  0xA7A709AA,
+  0x80A509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFAF09AA,
+  0x80A709AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8BE09AA,
+  0xB0B609AA,
+  0xA8AE09AA,
+  0xA0A609AA,
+  0x809609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x989E09AA,
+  0x909609AA,
+  0x888E09AA,
+  0x808609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFAF09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBC09AA,
+  0xB1B509AA,
+  0x858609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA1BF09AA,
+  0x9D9F09AA,
+  0x809609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBF09AA,
+  0x80BA09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1BF09AA,
+  0x85AF09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF09AA,
+  0x808E09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x808C09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90BD09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90AB09AA,
+  0x808C09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF09AA,
+  0x80AE09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF09AA,
+  0x809D09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA2BF09AA,
+  0x979F09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8BBF09AA,
+  0x808809AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2BF09AA,
+  0x959909AA,
+  0x939309AA,
+  0x909109AA,
+  0x808A09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8CA209AA,
+  0x878A09AA,
+  0x838509AA,
+  0x808109AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x82B309AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBE09AA,
+  0xBBBB09AA,
+  0xB2B709AA,
+  0x909909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0x80A509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BC09AA,
+  0x808609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x84B209AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA6BE09AA,
+  0xA0A409AA,
+  0x8F9909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80A809AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF09AA,
+  0xBABA09AA,
+  0xA0B609AA,
+  0x909909AA,
+  0x848B09AA,
+  0x808209AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB9BD09AA,
+  0xB5B609AA,
+  0xB1B109AA,
+  0x80AF09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2B409AA,
+  0xA0AA09AA,
+  0x9B9D09AA,
+  0x828209AA,
+  0x808009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0xA8AE09AA,
+  0xA0A609AA,
+  0x919609AA,
+  0x898E09AA,
+  0x818609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0x9CA909AA,
+  0x809A09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B909AA,
+  0x80A209AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0x80A309AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8BBB09AA,
+  0x808609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0x80AD09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x809909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBE09AA,
+  0xB8BC09AA,
+  0xAAB609AA,
+  0x9FA809AA,
+  0x9D9D09AA,
+  0x939709AA,
+  0x808609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x86BF09AA,
+  0x838409AA,
+  0x808109AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80B109AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x93BF09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BD09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90BF09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x92BF09AA,
+  0x808F09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BB09AA,
+  0x808709AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB3B409AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB6BF09AA,
+  0xB0B409AA,
+  0x8D8F09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BC09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF09AA,
+  0xA1BA09AA,
+  0x909909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA6BF09AA,
+  0x819A09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BE09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9A9C09AA,
+  0x929709AA,
+  0x8A8F09AA,
+  0x828709AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF26B9,
+  0xBEBE26B3,
+  0xBDBD26AD,
+  0xBCBC26A6,
+  0xBABA26A0,
+  0xB4B4269A,
+  0xB2B32695,
+  0xB1B111D8,
+  0xB0B011A0,
+  0xAEAE2690,
+  0xADAD268A,
+  0xACAC1C60,
+  0xABAB2684,
+  0xAAAA267F,
+  0xA9A9267A,
+  0xA8A82672,
+  0xA6A6266C,
+  0xA4A42666,
+  0xA3A32660,
+  0xA2A21C65,
+  0xA1A1265A,
+  0xA0A02650,
+  0x9E9E2649,
+  0x9D9D2643,
+  0x9C9C263E,
+  0x989B11A0,
+  0x96962633,
+  0x9595262C,
+  0x94942626,
+  0x93932620,
+  0x92922619,
+  0x909111A0,
+  0x8F8F2613,
+  0x8E8E1D74,
+  0x8D8D260C,
+  0x8C8C2606,
+  0x8B8B2601,
+  0x8A8A25FB,
+  0x838325F6,
+  0x828211A0,
+  0x818125F0,
+  0x808025E7,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBE27AF,
+  0xBBBB27AA,
+  0xB6B627A3,
+  0xB5B5279A,
+  0xB4B42793,
+  0xB2B2278E,
+  0xB1B12787,
+  0xB0B02781,
+  0xABAB1C53,
+  0xAAAA277A,
+  0xA9A92774,
+  0xA8A8276D,
+  0xA7A72766,
+  0xA6A62760,
+  0xA5A5275A,
+  0xA4A42750,
+  0xA3A3274A,
+  0xA2A211E3,
+  0xA0A02745,
+  0x9D9D2740,
+  0x9C9C273A,
+  0x9B9B1ADF,
+  0x9A9A2734,
+  0x9999272E,
+  0x98982718,
+  0x97972729,
+  0x96962724,
+  0x9393271D,
+  0x92922718,
+  0x91912711,
+  0x9090270C,
+  0x8D8D2706,
+  0x8C8C1B2D,
+  0x8B8B2700,
+  0x8A8A26F6,
+  0x888826F0,
+  0x878726E9,
+  0x868626E4,
+  0x858526DC,
+  0x848426D6,
+  0x838326D0,
+  0x828226CB,
+  0x818126C4,
+  0x808026BF,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF27B9,
+  0xBEBE1E2B,
+  0x959527B4,
+  0x929411A0,
+  0x8E8E1E05,
+  0x808D11A0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90902724,
+  0x808F11A0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x99992740,
+  0x909811A0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF27DE,
+  0xBEBE27D9,
+  0xBDBD27D3,
+  0xBCBC11A0,
+  0xB9B911A0,
+  0xAEAE278E,
+  0xADAD27CB,
+  0xACAC2718,
+  0xABAB27C5,
+  0xAAAA1E5A,
+  0xA9A927BE,
+  0xA8A81C53,
+  0xA0A711A0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB4B411D8,
+  0xB3B327E9,
+  0x9F9F27E4,
+  0x80B211A0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF27EE,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2B2280C,
+  0xB1B12806,
+  0xB0B011A0,
+  0x8B8B2801,
+  0x858527FA,
+  0x848427F5,
+  0x808A11A0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBC1C65,
+  0x9F9F285F,
+  0x9E9E2858,
+  0x9D9D2851,
+  0x9C9C284A,
+  0x9B9B2842,
+  0x9A9A283C,
+  0x95952834,
+  0x9494282A,
+  0x93932824,
+  0x92922818,
+  0x91912812,
+  0x909911A0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABA28B5,
+  0xB9B9289E,
+  0xB8B82891,
+  0xA5A5288A,
+  0xA3A32885,
+  0xA0A411A0,
+  0x9F9F287D,
+  0x8B8B2877,
+  0x8A8A2872,
+  0x8585286C,
+  0x84842866,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFAF28BE,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9B9B28C3,
+  0x80BF11A0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0A01D74,
+  0x9C9C1C53,
+  0x80BF11A0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABA28C8,
+  0x80BF11A0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFAF28CE,
+  0x80AE11A0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA8A828D3,
+  0xA0A711A0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8D8D28D8,
+  0x808C11A0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABA146A,
+  0xB5B5146A,
+  0xAAAA146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8BF146A,
+  0x98B6146A,
+  0x8096146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BF146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAEAE146A,
+  0xACAC146A,
+  0xA0A4146A,
+  0x8691146A,
+  0x8081146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF146A,
+  0xBABD146A,
+  0xB6B7146A,
+  0xB0B4146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA3BF146A,
+  0x8EA1146A,
+  0x8C8C146A,
+  0x888A146A,
+  0x8686146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB7BF146A,
+  0x80B5146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8ABF146A,
+  0x8081146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1BF146A,
+  0x80AF146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF146A,
+  0x9999146A,
+  0x8096146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8088146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFB2146A,
+  0x90AA146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1BF146A,
+  0xAEAF146A,
+  0xA0A9146A,
+  0x808A146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF146A,
+  0xAEBC146A,
+  0xA5A6146A,
+  0x9595146A,
+  0x8093146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x92AF146A,
+  0x9090146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8DBF146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1B1146A,
+  0x80A5146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABA146A,
+  0xB4B5146A,
+  0x80AA146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBE29D7,
+  0xBDBD29D1,
+  0xBCBC29CB,
+  0xBBBB29C3,
+  0xBABA29B7,
+  0xB9B929B1,
+  0xB8B829AB,
+  0xB7B729A5,
+  0xB6B6299D,
+  0xB5B52994,
+  0xB4B4298C,
+  0xB3B32984,
+  0xB2B22979,
+  0xB1B12971,
+  0xB0B02968,
+  0xAFAF2962,
+  0xAEAE2954,
+  0xADAD294C,
+  0xACAC2941,
+  0xABAB2939,
+  0xAAAA292E,
+  0xA9A92926,
+  0xA8A8291B,
+  0xA7A72912,
+  0xA6A62906,
+  0xA5A528FE,
+  0xA4A428F8,
+  0xA3A328F3,
+  0xA2A228EC,
+  0xA1A128E5,
+  0xA0A028DD,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF2AEB,
+  0xBEBE2AE4,
+  0xBDBD2AD9,
+  0xBCBC2AD2,
+  0xB8BB1F5C,
+  0xB4B61F5C,
+  0xB3B32ACA,
+  0xB2B22AC3,
+  0xB1B12ABD,
+  0xB0B02AB8,
+  0xAFAF2AB3,
+  0xAEAE2AAD,
+  0xADAD2AA7,
+  0xACAC2AA2,
+  0xAAAA2A9B,
+  0xA9A92A96,
+  0xA8A82A90,
+  0xA7A72A8A,
+  0xA6A62A84,
+  0xA5A52A7E,
+  0xA4A42A79,
+  0xA3A32A74,
+  0xA2A22A6C,
+  0xA1A12A67,
+  0xA0A02A61,
+  0x9F9F2A5A,
+  0x9E9E2A55,
+  0x9D9D2A4E,
+  0x9C9C2A48,
+  0x9B9B2A42,
+  0x9A9A2A3C,
+  0x99992A36,
+  0x90902A31,
+  0x8F8F2A2B,
+  0x8E8E2A25,
+  0x8D8D2A20,
+  0x8C8C2A19,
+  0x8B8B2A11,
+  0x8A8A2A08,
+  0x898929FE,
+  0x84981F5C,
+  0x838329F5,
+  0x828229ED,
+  0x818129E2,
+  0x808029DC,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8B82B48,
+  0xB7B72B40,
+  0xB6B62B37,
+  0xB5B52B31,
+  0xB4B42B29,
+  0xB3B32B22,
+  0xB0B21F5C,
+  0x86862B1D,
+  0x85852B17,
+  0x84842B08,
+  0x82822B03,
+  0x81812AFB,
+  0x80802AF6,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90BF1F5C,
+  0x87872B6D,
+  0x86862B67,
+  0x85851F5C,
+  0x84842B61,
+  0x83832B5B,
+  0x82822B54,
+  0x81812A31,
+  0x80802B4D,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8BF1F5C,
+  0x80B61F5C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BF1F5C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFAF2C01,
+  0xADAD2BFA,
+  0xACAC2BF0,
+  0xABAB2BE7,
+  0xAAAA2BDF,
+  0xA9A92BD5,
+  0xA8A82BD0,
+  0xA7A72BC9,
+  0xA6A62BC4,
+  0xA5A52BBE,
+  0xA4A42BB8,
+  0xA3A32BB0,
+  0xA2A22BAB,
+  0xA1A12A55,
+  0xA0A02BA3,
+  0x9F9F2B9A,
+  0x9E9E2B94,
+  0x9C9C2B8E,
+  0x9B9B2AB3,
+  0x9A9A2B88,
+  0x99992B82,
+  0x98982B7C,
+  0x93932B77,
+  0x92922B72,
+  0x80BF1F5C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9F9F2C0D,
+  0x9E9E2C07,
+  0x809D1F5C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF2C73,
+  0xBEBE2C6E,
+  0xBDBD2C68,
+  0xBCBC2C61,
+  0xBBBB2C5C,
+  0xB9B92C55,
+  0xB8B82C50,
+  0xB7B72C4A,
+  0xB6B62C44,
+  0xB5B52C3F,
+  0xB4B42C3A,
+  0xAFAF2C35,
+  0xAEAE2C30,
+  0xADAD2C29,
+  0xACAC2C1E,
+  0xABAB2C19,
+  0xA9A92C13,
+  0xA4BA1F5C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1B12D5C,
+  0xAFAF2D56,
+  0xAEAE2D50,
+  0xACAC2D4A,
+  0xABAB2D43,
+  0xAAAA2D3D,
+  0xA0B02045,
+  0x9F9F2D38,
+  0x9E9E2D29,
+  0x9D9D2D18,
+  0x9B9B2D0D,
+  0x9A9A2D08,
+  0x98982D00,
+  0x97972045,
+  0x96962CEF,
+  0x94942CE9,
+  0x93932CE3,
+  0x92922CD9,
+  0x91912CA9,
+  0x90902C7B,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x72722D62,
+  0x617A008E,
+  0x5F5F008E,
+  0x415A008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x303A008E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x2626008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x777709AA,
+  0x617A008E,
+  0x5F5F008E,
+  0x415A008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x303A008E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x2626008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0x08002D95,
+  0xF4F42F81,
+  0xF1F32F7B,
+  0xF0F02F61,
+  0xEFEF2F4A,
+  0xEEEE2F44,
+  0xEDED2F3D,
+  0xEAEA2F20,
+  0xE4E42F1A,
+  0xE3E32F0D,
+  0xE2E22EFA,
+  0xE1E12EC9,
+  0xE0E02EA4,
+  0xDFDF2E9C,
+  0xDEDE2E95,
+  0xDDDD2E8F,
+  0xDCDC2E87,
+  0xDBDB2E7E,
+  0xD9D92E76,
+  0xD8D82E70,
+  0xD7D72E68,
+  0xD6D62E62,
+  0xD5D52E5B,
+  0xD4D42E55,
+  0xD2D22E4F,
+  0xCFCF2E49,
+  0xCECE2E3F,
+  0xCDCD2E36,
+  0xCCCC2E30,
+  0xCBCB2E26,
+  0xC3C32E1F,
+  0xC2C22E16,
+  0x80FF0225,
+  0x7B7B2D8F,
+  0x74742DE5,
+  0x6F6F2DDF,
+  0x6E6E2DD9,
+  0x66662DD3,
+  0x63632DCD,
+  0x617A0225,
+  0x5F5F0225,
+  0x415A0225,
+  0x3A3A2D8F,
+  0x303B0225,
+  0x20202D97,
+  0x0B7F2DEB,
+  0x0AFFFFFF,
+  0x09092D97,
+  0x00082DEB,
+  0x80BF1399,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF2127,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BF2127,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x809F2127,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90BF2133,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BF2133,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x808F2133,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xF4F4214B,
+  0xF1F32145,
+  0xF0F0213F,
+  0xEDED2139,
+  0xE1EF2133,
+  0xE0E0212D,
+  0xC2DF2127,
+  0x80FF0225,
+  0x77772FF0,
+  0x74742FE1,
+  0x73732FD2,
+  0x72722FC3,
+  0x69692FB4,
+  0x66662FA5,
+  0x65652F96,
+  0x63632F87,
+  0x292920F6,
+  0x20202151,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x09092151,
+  0x00081399,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x63632FFF,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3A3A008E,
+  0x30390D6E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x28281399,
+  0x2626008E,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x6565146A,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3A3A008E,
+  0x30390D6E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x28281399,
+  0x2626008E,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0x08001190,
+  0xF4F4307D,
+  0xF1F33078,
+  0xF0F03073,
+  0xEDED306E,
+  0xE1EF3069,
+  0xE0E03064,
+  0xC2DF305F,
+  0x80FF130E,
+  0x2929302E,
+  0x0B7F21C5,
+  0x0AFFFFFF,
+  0x000921C5,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x75753082,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3A3A008E,
+  0x30390D6E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x28281399,
+  0x2626008E,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x6F6F30B1,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3A3A008E,
+  0x30390D6E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x28281399,
+  0x2626008E,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x6C6C2196,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3A3A008E,
+  0x30390D6E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x28281399,
+  0x2626008E,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xBFBF0D6E,
+  0xBCBD0D6E,
+  0xA8BA0D6E,
+  0x8DA60D6E,
+  0x808B0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x909D0D6E,
+  0x808D0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BA0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF0D6E,
+  0x809C0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80900D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xADBF0D6E,
+  0x809F0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90B50D6E,
+  0x82890D6E,
+  0x80800D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x888F0D6E,
+  0x80830D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0xA0A90D6E,
+  0x809D0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x98BB0D6E,
+  0x80930D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0x80A70D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBF0D6E,
+  0xB0BA0D6E,
+  0x80A30D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBC0D6E,
+  0xB3B90D6E,
+  0xA3B10D6E,
+  0x97A10D6E,
+  0x94950D6E,
+  0x8C920D6E,
+  0x808A0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80B60D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0A70D6E,
+  0x80950D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2BA0D6E,
+  0x87B00D6E,
+  0x80850D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF0D6E,
+  0xBCBC0D6E,
+  0xB7B80D6E,
+  0x8AB50D6E,
+  0x88880D6E,
+  0x80850D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0B60D6E,
+  0x80950D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB4B50D6E,
+  0xA0B20D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0B90D6E,
+  0x80950D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF0D6E,
+  0x80B70D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x99B50D6E,
+  0x95970D6E,
+  0x90930D6E,
+  0x80800D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BC0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x809C0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x89A40D6E,
+  0x80870D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0B20D6E,
+  0x80950D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80910D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80B20D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B90D6E,
+  0x80A30D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B10D6E,
+  0x80A90D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0xA7A70D6E,
+  0x809C0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0x80850D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0x80810D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0B60D6E,
+  0x80840D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x83B70D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB5B50D6E,
+  0xB1B20D6E,
+  0xA6AF0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x83AF0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B90D6E,
+  0x90A80D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB6BF0D6E,
+  0x83A60D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB6B60D6E,
+  0x90B20D6E,
+  0x87870D6E,
+  0x84840D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x83B20D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9C9C0D6E,
+  0x909A0D6E,
+  0x81840D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x93AB0D6E,
+  0x80910D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0x9FA80D6E,
+  0x8F9D0D6E,
+  0x8A8D0D6E,
+  0x88880D6E,
+  0x80860D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B90D6E,
+  0x809E0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9DA10D6E,
+  0x90900D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80B40D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9FA10D6E,
+  0x90990D6E,
+  0x878A0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80AF0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90990D6E,
+  0x87870D6E,
+  0x84850D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80AE0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x989B0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90990D6E,
+  0x84840D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8B80D6E,
+  0x80AA0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B90D6E,
+  0x809A0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80860D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80AB0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF0D6E,
+  0x80A90D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF0D6E,
+  0x98AF0D6E,
+  0x95960D6E,
+  0x8C930D6E,
+  0x89890D6E,
+  0x80860D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90990D6E,
+  0x81810D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAABF0D6E,
+  0xA0A70D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA3A30D6E,
+  0xA1A10D6E,
+  0x80900D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABA0D6E,
+  0x8BB20D6E,
+  0x80800D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9CBF0D6E,
+  0x90900D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0x9D9D0D6E,
+  0x80890D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8AAE0D6E,
+  0x80880D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2BF0D6E,
+  0x90990D6E,
+  0x80800D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x808F0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8BB00D6E,
+  0x88890D6E,
+  0x80860D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAABF0D6E,
+  0xA7A80D6E,
+  0xA0A50D6E,
+  0x90990D6E,
+  0x86860D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0A90D6E,
+  0x98980D6E,
+  0x80890D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0B20D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B00D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80830D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80B00D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0xA0A90D6E,
+  0x809E0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90AD0D6E,
+  0x80890D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBF0D6E,
+  0xA3B70D6E,
+  0x90990D6E,
+  0x80830D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90900D6E,
+  0x808A0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x939F0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA3A30D6E,
+  0xA0A10D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80B70D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80950D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBE0D6E,
+  0xB5BB0D6E,
+  0xB0B30D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80A20D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0xA4A70D6E,
+  0x90920D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BB0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BC0D6E,
+  0x80AA0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90990D6E,
+  0x80880D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x96BF0D6E,
+  0x80940D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBF0D6E,
+  0xBBBB0D6E,
+  0xAEB90D6E,
+  0xA9AC0D6E,
+  0xA5A60D6E,
+  0xA2A20D6E,
+  0x9E9F0D6E,
+  0x809C0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x85BF0D6E,
+  0x80830D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBE0D6E,
+  0x9EB90D6E,
+  0x969C0D6E,
+  0x8D940D6E,
+  0x878A0D6E,
+  0x80850D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x92BF0D6E,
+  0x8A900D6E,
+  0x86860D6E,
+  0x80840D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA8BF0D6E,
+  0x80A50D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBF0D6E,
+  0x9CBA0D6E,
+  0x829A0D6E,
+  0x80800D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB6BF0D6E,
+  0x96B40D6E,
+  0x80940D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0x90AE0D6E,
+  0x808E0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAABF0D6E,
+  0x8AA80D6E,
+  0x80880D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8EBF0D6E,
+  0x848B0D6E,
+  0x80820D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB7BD0D6E,
+  0x80AC0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8E8E0D6E,
+  0x80890D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90AD0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B90D6E,
+  0x80AB0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BE0D6E,
+  0xADAE0D6E,
+  0xA8AB0D6E,
+  0xA0A60D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80840D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90990D6E,
+  0x8B8B0D6E,
+  0x80830D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBB0D6E,
+  0xB9B90D6E,
+  0xB4B70D6E,
+  0xA9B20D6E,
+  0xA7A70D6E,
+  0xA4A40D6E,
+  0xA1A20D6E,
+  0x859F0D6E,
+  0x80830D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBE0D6E,
+  0xB9BC0D6E,
+  0xB4B70D6E,
+  0xACB20D6E,
+  0xA7AA0D6E,
+  0xA4A40D6E,
+  0xA1A20D6E,
+  0x9F9F0D6E,
+  0x9D9D0D6E,
+  0x9B9B0D6E,
+  0x99990D6E,
+  0x97970D6E,
+  0x94940D6E,
+  0x91920D6E,
+  0x8D8F0D6E,
+  0x8B8B0D6E,
+  0x89890D6E,
+  0x87870D6E,
+  0x82820D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xABBB0D6E,
+  0xA5A90D6E,
+  0xA1A30D6E,
+  0x8B9B0D6E,
+  0x80890D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B90D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x809F0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0x80A10D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80A00D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x809D0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x808A0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x636330E0,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x6565130E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x757530E6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x6F6F30EC,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x6C6C25CF,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x08001190,
+  0xBFBF09AA,
+  0xBCBD09AA,
+  0xA8BA09AA,
+  0x8DA609AA,
+  0x808B09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x909D09AA,
+  0x808D09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BA09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF09AA,
+  0x809C09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x809009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xADBF09AA,
+  0x809F09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90B509AA,
+  0x828909AA,
+  0x808009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x888F09AA,
+  0x808309AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0xA0A909AA,
+  0x809D09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x98BB09AA,
+  0x809309AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0x80A709AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBF09AA,
+  0xB0BA09AA,
+  0x80A309AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBC09AA,
+  0xB3B909AA,
+  0xA3B109AA,
+  0x97A109AA,
+  0x949509AA,
+  0x8C9209AA,
+  0x808A09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80B609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0A709AA,
+  0x809509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2BA09AA,
+  0x87B009AA,
+  0x808509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF09AA,
+  0xBCBC09AA,
+  0xB7B809AA,
+  0x8AB509AA,
+  0x888809AA,
+  0x808509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0B609AA,
+  0x809509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB4B509AA,
+  0xA0B209AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0B909AA,
+  0x809509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF09AA,
+  0x80B709AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x99B509AA,
+  0x959709AA,
+  0x909309AA,
+  0x808009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BC09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x809C09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x89A409AA,
+  0x808709AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0B209AA,
+  0x809509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x809109AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80B209AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B909AA,
+  0x80A309AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B109AA,
+  0x80A909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0xA7A709AA,
+  0x809C09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0x808509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0x808109AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0B609AA,
+  0x808409AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x83B709AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB5B509AA,
+  0xB1B209AA,
+  0xA6AF09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x83AF09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B909AA,
+  0x90A809AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB6BF09AA,
+  0x83A609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB6B609AA,
+  0x90B209AA,
+  0x878709AA,
+  0x848409AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x83B209AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9C9C09AA,
+  0x909A09AA,
+  0x818409AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x93AB09AA,
+  0x809109AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0x9FA809AA,
+  0x8F9D09AA,
+  0x8A8D09AA,
+  0x888809AA,
+  0x808609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B909AA,
+  0x809E09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9DA109AA,
+  0x909009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80B409AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9FA109AA,
+  0x909909AA,
+  0x878A09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80AF09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x909909AA,
+  0x878709AA,
+  0x848509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80AE09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x989B09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x909909AA,
+  0x848409AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8B809AA,
+  0x80AA09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B909AA,
+  0x809A09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x808609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80AB09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF09AA,
+  0x80A909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF09AA,
+  0x98AF09AA,
+  0x959609AA,
+  0x8C9309AA,
+  0x898909AA,
+  0x808609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x909909AA,
+  0x818109AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAABF09AA,
+  0xA0A709AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA3A309AA,
+  0xA1A109AA,
+  0x809009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABA09AA,
+  0x8BB209AA,
+  0x808009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9CBF09AA,
+  0x909009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0x9D9D09AA,
+  0x808909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8AAE09AA,
+  0x808809AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2BF09AA,
+  0x909909AA,
+  0x808009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x808F09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8BB009AA,
+  0x888909AA,
+  0x808609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAABF09AA,
+  0xA7A809AA,
+  0xA0A509AA,
+  0x909909AA,
+  0x868609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0A909AA,
+  0x989809AA,
+  0x808909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0B209AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x808309AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80B009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0xA0A909AA,
+  0x809E09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90AD09AA,
+  0x808909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBF09AA,
+  0xA3B709AA,
+  0x909909AA,
+  0x808309AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x909009AA,
+  0x808A09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x939F09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA3A309AA,
+  0xA0A109AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80B709AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x809509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBE09AA,
+  0xB5BB09AA,
+  0xB0B309AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80A209AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0xA4A709AA,
+  0x909209AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BB09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BC09AA,
+  0x80AA09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x909909AA,
+  0x808809AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x96BF09AA,
+  0x809409AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBF09AA,
+  0xBBBB09AA,
+  0xAEB909AA,
+  0xA9AC09AA,
+  0xA5A609AA,
+  0xA2A209AA,
+  0x9E9F09AA,
+  0x809C09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x85BF09AA,
+  0x808309AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBE09AA,
+  0x9EB909AA,
+  0x969C09AA,
+  0x8D9409AA,
+  0x878A09AA,
+  0x808509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x92BF09AA,
+  0x8A9009AA,
+  0x868609AA,
+  0x808409AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA8BF09AA,
+  0x80A509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBF09AA,
+  0x9CBA09AA,
+  0x829A09AA,
+  0x808009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB6BF09AA,
+  0x96B409AA,
+  0x809409AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0x90AE09AA,
+  0x808E09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAABF09AA,
+  0x8AA809AA,
+  0x808809AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8EBF09AA,
+  0x848B09AA,
+  0x808209AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB7BD09AA,
+  0x80AC09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8E8E09AA,
+  0x808909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90AD09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B909AA,
+  0x80AB09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BE09AA,
+  0xADAE09AA,
+  0xA8AB09AA,
+  0xA0A609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x808409AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x909909AA,
+  0x8B8B09AA,
+  0x808309AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBB09AA,
+  0xB9B909AA,
+  0xB4B709AA,
+  0xA9B209AA,
+  0xA7A709AA,
+  0xA4A409AA,
+  0xA1A209AA,
+  0x859F09AA,
+  0x808309AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBE09AA,
+  0xB9BC09AA,
+  0xB4B709AA,
+  0xACB209AA,
+  0xA7AA09AA,
+  0xA4A409AA,
+  0xA1A209AA,
+  0x9F9F09AA,
+  0x9D9D09AA,
+  0x9B9B09AA,
+  0x999909AA,
+  0x979709AA,
+  0x949409AA,
+  0x919209AA,
+  0x8D8F09AA,
+  0x8B8B09AA,
+  0x898909AA,
+  0x878709AA,
+  0x828209AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xABBB09AA,
+  0xA5A909AA,
+  0xA1A309AA,
+  0x8B9B09AA,
+  0x808909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x809F09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0x80A109AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80A009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x809D09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x808A09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA8A8146A,
+  0xA4A4146A,
+  0x9A9A146A,
+  0x8095146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0xA0AA146A,
+  0x8098146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF146A,
+  0x898E146A,
+  0x8087146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8089146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBD146A,
+  0x84B9146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1BF146A,
+  0xA6AF146A,
+  0x98A1146A,
+  0x9090146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBD146A,
+  0xB6B9146A,
+  0xB2B2146A,
+  0xAAB0146A,
+  0x93A8146A,
+  0x8F90146A,
+  0x858C146A,
+  0x8080146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBC146A,
+  0xA6B1146A,
+  0x9FA1146A,
+  0x9C9D146A,
+  0x8E8E146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8B9146A,
+  0xB5B6146A,
+  0xB2B3146A,
+  0xAAB0146A,
+  0x93A8146A,
+  0x8F90146A,
+  0x858A146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2B4146A,
+  0xA6AF146A,
+  0x9E9E146A,
+  0x999C146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBD146A,
+  0xB5B9146A,
+  0xB2B3146A,
+  0xAAB0146A,
+  0x93A8146A,
+  0x8F91146A,
+  0x858D146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB9B9146A,
+  0xA6AF146A,
+  0xA0A1146A,
+  0x9090146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBD146A,
+  0xB5B9146A,
+  0xB2B3146A,
+  0xAAB0146A,
+  0x93A8146A,
+  0x8F90146A,
+  0x858C146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1B1146A,
+  0xA6AF146A,
+  0x9FA1146A,
+  0x9C9D146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAEB9146A,
+  0xA8AA146A,
+  0xA3A4146A,
+  0x9E9F146A,
+  0x9C9C146A,
+  0x999A146A,
+  0x9295146A,
+  0x8E90146A,
+  0x858A146A,
+  0x8383146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA6AF146A,
+  0x9090146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBD146A,
+  0xAAB9146A,
+  0x92A8146A,
+  0x8E90146A,
+  0x858C146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA6AF146A,
+  0xA0A1146A,
+  0x9D9D146A,
+  0x989A146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBD146A,
+  0xB5B9146A,
+  0xAAB3146A,
+  0x92A8146A,
+  0x8E90146A,
+  0x858C146A,
+  0x8080146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1B2146A,
+  0xA6AF146A,
+  0xA0A1146A,
+  0x9D9E146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBD146A,
+  0x92BA146A,
+  0x8E90146A,
+  0x848C146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABF146A,
+  0xA6AF146A,
+  0x9FA1146A,
+  0x9496146A,
+  0x8E8E146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBD146A,
+  0xB3BB146A,
+  0x9AB1146A,
+  0x8596146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA6AF146A,
+  0x8086146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2B3146A,
+  0x81B0146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9099146A,
+  0x8086146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBD146A,
+  0xB2B3146A,
+  0xA7B0146A,
+  0xA5A5146A,
+  0x8CA3146A,
+  0x868A146A,
+  0x8484146A,
+  0x8182146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9C9F146A,
+  0x9099146A,
+  0x8686146A,
+  0x8084146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0A9146A,
+  0x8080146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x89AC146A,
+  0x8087146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x888C146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF146A,
+  0x80AA146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB5BF146A,
+  0xAEB0146A,
+  0xA5A6146A,
+  0xA1A1146A,
+  0x9A9D146A,
+  0x9095146A,
+  0x8089146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF146A,
+  0x9099146A,
+  0x8E8E146A,
+  0x8081146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBF146A,
+  0x90BA146A,
+  0x8D8D146A,
+  0x8787146A,
+  0x8085146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF146A,
+  0x9A9D146A,
+  0x9898146A,
+  0x9096146A,
+  0x8A8D146A,
+  0x8088146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8BE146A,
+  0xB2B5146A,
+  0x90B0146A,
+  0x8A8D146A,
+  0x8088146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x98BF146A,
+  0x8896146A,
+  0x8285146A,
+  0x8080146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x98BF146A,
+  0x9295146A,
+  0x8090146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x809A146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF146A,
+  0x808F146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8BD146A,
+  0x80B5146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x81BF146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFBF146A,
+  0x80AC146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF146A,
+  0x819A146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1B8146A,
+  0x80AA146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9FB1146A,
+  0x8091146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAEB0146A,
+  0xA0AC146A,
+  0x8091146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80B3146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0A9146A,
+  0x9C9C146A,
+  0x9797146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF146A,
+  0x9099146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80B8146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0xAAAA146A,
+  0x87A8146A,
+  0x8084146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80B5146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x809E146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B4146A,
+  0x86AD146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0x80AB146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9099146A,
+  0x8089146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF146A,
+  0x8096146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8094146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA7A7146A,
+  0x9099146A,
+  0x8089146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x85B3146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9099146A,
+  0x858C146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAEBF146A,
+  0x83A0146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80A5146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80A3146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8DBD146A,
+  0x8089146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBF146A,
+  0x90BA146A,
+  0x8088146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABA146A,
+  0xB5B6146A,
+  0xAEB3146A,
+  0xA9AC146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF146A,
+  0x989D146A,
+  0x8095146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9FBD146A,
+  0x9D9D146A,
+  0x9B9B146A,
+  0x9999146A,
+  0x9097146A,
+  0x888D146A,
+  0x8085146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBE146A,
+  0xB6BC146A,
+  0x80B4146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB6BC146A,
+  0xB2B4146A,
+  0xA0AC146A,
+  0x969B146A,
+  0x9093146A,
+  0x868C146A,
+  0x8284146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF146A,
+  0xB1B1146A,
+  0x9494146A,
+  0x8080146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x909C146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBF146A,
+  0xAFB9146A,
+  0xAAAD146A,
+  0xA8A8146A,
+  0xA6A6146A,
+  0xA4A4146A,
+  0x999D146A,
+  0x9595146A,
+  0x8A93146A,
+  0x8787146A,
+  0x8282146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8E8E146A,
+  0x8589146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8384146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2B3146A,
+  0xABAE146A,
+  0x80A4146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0xADAD146A,
+  0xA7A7146A,
+  0x80A5146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFAF146A,
+  0x80A7146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8BE146A,
+  0xB0B6146A,
+  0xA8AE146A,
+  0xA0A6146A,
+  0x8096146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x989E146A,
+  0x9096146A,
+  0x888E146A,
+  0x8086146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFAF146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBC146A,
+  0xB1B5146A,
+  0x8586146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA1BF146A,
+  0x9D9F146A,
+  0x8096146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBF146A,
+  0x80BA146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1BF146A,
+  0x85AF146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF146A,
+  0x808E146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x808C146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90BD146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90AB146A,
+  0x808C146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF146A,
+  0x80AE146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF146A,
+  0x809D146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA2BF146A,
+  0x979F146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8BBF146A,
+  0x8088146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2BF146A,
+  0x9599146A,
+  0x9393146A,
+  0x9091146A,
+  0x808A146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8CA2146A,
+  0x878A146A,
+  0x8385146A,
+  0x8081146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x82B3146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBE146A,
+  0xBBBB146A,
+  0xB2B7146A,
+  0x9099146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0x80A5146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BC146A,
+  0x8086146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x84B2146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA6BE146A,
+  0xA0A4146A,
+  0x8F99146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80A8146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF146A,
+  0xBABA146A,
+  0xA0B6146A,
+  0x9099146A,
+  0x848B146A,
+  0x8082146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB9BD146A,
+  0xB5B6146A,
+  0xB1B1146A,
+  0x80AF146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2B4146A,
+  0xA0AA146A,
+  0x9B9D146A,
+  0x8282146A,
+  0x8080146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0xA8AE146A,
+  0xA0A6146A,
+  0x9196146A,
+  0x898E146A,
+  0x8186146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0x9CA9146A,
+  0x809A146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B9146A,
+  0x80A2146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0x80A3146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8BBB146A,
+  0x8086146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0x80AD146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8099146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBE146A,
+  0xB8BC146A,
+  0xAAB6146A,
+  0x9FA8146A,
+  0x9D9D146A,
+  0x9397146A,
+  0x8086146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x86BF146A,
+  0x8384146A,
+  0x8081146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80B1146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x93BF146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BD146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90BF146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x92BF146A,
+  0x808F146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BB146A,
+  0x8087146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB3B4146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB6BF146A,
+  0xB0B4146A,
+  0x8D8F146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BC146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF146A,
+  0xA1BA146A,
+  0x9099146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA6BF146A,
+  0x819A146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BE146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9A9C146A,
+  0x9297146A,
+  0x8A8F146A,
+  0x8287146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF31C4,
+  0xBEBE31BE,
+  0xBDBD31B8,
+  0xBCBC31B1,
+  0xBABA31AB,
+  0xB4B431A5,
+  0xB2B331A0,
+  0xB1B11F94,
+  0xB0B01F5C,
+  0xAEAE319B,
+  0xADAD3195,
+  0xACAC2A74,
+  0xABAB318F,
+  0xAAAA318A,
+  0xA9A93185,
+  0xA8A8317D,
+  0xA6A63177,
+  0xA4A43171,
+  0xA3A3316B,
+  0xA2A22A79,
+  0xA1A13165,
+  0xA0A0315B,
+  0x9E9E3154,
+  0x9D9D314E,
+  0x9C9C3149,
+  0x989B1F5C,
+  0x9696313E,
+  0x95953137,
+  0x94943131,
+  0x9393312B,
+  0x92923124,
+  0x90911F5C,
+  0x8F8F311E,
+  0x8E8E2B88,
+  0x8D8D3117,
+  0x8C8C3111,
+  0x8B8B310C,
+  0x8A8A3106,
+  0x83833101,
+  0x82821F5C,
+  0x818130FB,
+  0x808030F2,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBE32BA,
+  0xBBBB32B5,
+  0xB6B632AE,
+  0xB5B532A5,
+  0xB4B4329E,
+  0xB2B23299,
+  0xB1B13292,
+  0xB0B0328C,
+  0xABAB2A67,
+  0xAAAA3285,
+  0xA9A9327F,
+  0xA8A83278,
+  0xA7A73271,
+  0xA6A6326B,
+  0xA5A53265,
+  0xA4A4325B,
+  0xA3A33255,
+  0xA2A21F9F,
+  0xA0A03250,
+  0x9D9D324B,
+  0x9C9C3245,
+  0x9B9B28F3,
+  0x9A9A323F,
+  0x99993239,
+  0x98983223,
+  0x97973234,
+  0x9696322F,
+  0x93933228,
+  0x92923223,
+  0x9191321C,
+  0x90903217,
+  0x8D8D3211,
+  0x8C8C2941,
+  0x8B8B320B,
+  0x8A8A3201,
+  0x888831FB,
+  0x878731F4,
+  0x868631EF,
+  0x858531E7,
+  0x848431E1,
+  0x838331DB,
+  0x828231D6,
+  0x818131CF,
+  0x808031CA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF32C4,
+  0xBEBE2C3F,
+  0x959532BF,
+  0x92941F5C,
+  0x8E8E2C19,
+  0x808D1F5C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9090322F,
+  0x808F1F5C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9999324B,
+  0x90981F5C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF32E9,
+  0xBEBE32E4,
+  0xBDBD32DE,
+  0xBCBC1F5C,
+  0xB9B91F5C,
+  0xAEAE3299,
+  0xADAD32D6,
+  0xACAC3223,
+  0xABAB32D0,
+  0xAAAA2C6E,
+  0xA9A932C9,
+  0xA8A82A67,
+  0xA0A71F5C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB4B41F94,
+  0xB3B332F4,
+  0x9F9F32EF,
+  0x80B21F5C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF32F9,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2B23317,
+  0xB1B13311,
+  0xB0B01F5C,
+  0x8B8B330C,
+  0x85853305,
+  0x84843300,
+  0x808A1F5C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBC2A79,
+  0x9F9F336A,
+  0x9E9E3363,
+  0x9D9D335C,
+  0x9C9C3355,
+  0x9B9B334D,
+  0x9A9A3347,
+  0x9595333F,
+  0x94943335,
+  0x9393332F,
+  0x92923323,
+  0x9191331D,
+  0x90991F5C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABA33C0,
+  0xB9B933A9,
+  0xB8B8339C,
+  0xA5A53395,
+  0xA3A33390,
+  0xA0A41F5C,
+  0x9F9F3388,
+  0x8B8B3382,
+  0x8A8A337D,
+  0x85853377,
+  0x84843371,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFAF33C9,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9B9B33CE,
+  0x80BF1F5C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0A02B88,
+  0x9C9C2A67,
+  0x80BF1F5C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABA33D3,
+  0x80BF1F5C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFAF33D9,
+  0x80AE1F5C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA8A833DE,
+  0xA0A71F5C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8D8D33E3,
+  0x808C1F5C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x6E6E09AA,
+  0x617A008E,
+  0x5F5F008E,
+  0x415A008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x303A008E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x2626008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0x08002D95,
+  0x202033E8,
+  0x0BFF2D8F,
+  0x0AFFFFFF,
+  0x090933E8,
+  0x00082D8F,
+  0x070033F6,
+  0x00FFFFFF,
+  0x08002D95,
+  0xF4F42F81,
+  0xF1F32F7B,
+  0xF0F02F61,
+  0xEFEF2F4A,
+  0xEEEE2F44,
+  0xEDED2F3D,
+  0xEAEA2F20,
+  0xE4E42F1A,
+  0xE3E32F0D,
+  0xE2E22EFA,
+  0xE1E12EC9,
+  0xE0E02EA4,
+  0xDFDF2E9C,
+  0xDEDE2E95,
+  0xDDDD2E8F,
+  0xDCDC2E87,
+  0xDBDB2E7E,
+  0xD9D92E76,
+  0xD8D82E70,
+  0xD7D72E68,
+  0xD6D62E62,
+  0xD5D52E5B,
+  0xD4D42E55,
+  0xD2D22E4F,
+  0xCFCF2E49,
+  0xCECE2E3F,
+  0xCDCD2E36,
+  0xCCCC2E30,
+  0xCBCB2E26,
+  0xC3C32E1F,
+  0xC2C22E16,
+  0x80FF0225,
+  0x7B7B2D8F,
+  0x77770DC6,
+  0x74743406,
+  0x73730DBA,
+  0x72720DB4,
+  0x6F6F2DDF,
+  0x6E6E2DD9,
+  0x69690DAE,
+  0x666633FF,
+  0x65650DA2,
+  0x636333F8,
+  0x617A0225,
+  0x5F5F0225,
+  0x415A0225,
+  0x3A3A2D8F,
+  0x303B0225,
+  0x20202D97,
+  0x0B7F2DEB,
+  0x0AFFFFFF,
+  0x09092D97,
+  0x00082DEB,
+  0x6F6F340C,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x69693412,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x6F6F3418,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x7676341E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x68683424,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x08002D95,
+  0xF4F42F81,
+  0xF1F32F7B,
+  0xF0F02F61,
+  0xEFEF2F4A,
+  0xEEEE2F44,
+  0xEDED2F3D,
+  0xEAEA2F20,
+  0xE4E42F1A,
+  0xE3E32F0D,
+  0xE2E22EFA,
+  0xE1E12EC9,
+  0xE0E02EA4,
+  0xDFDF2E9C,
+  0xDEDE2E95,
+  0xDDDD2E8F,
+  0xDCDC2E87,
+  0xDBDB2E7E,
+  0xD9D92E76,
+  0xD8D82E70,
+  0xD7D72E68,
+  0xD6D62E62,
+  0xD5D52E5B,
+  0xD4D42E55,
+  0xD2D22E4F,
+  0xCFCF2E49,
+  0xCECE2E3F,
+  0xCDCD2E36,
+  0xCCCC2E30,
+  0xCBCB2E26,
+  0xC3C32E1F,
+  0xC2C22E16,
+  0x80FF0225,
+  0x617B0225,
+  0x5F5F0225,
+  0x415A0225,
+  0x3B3B0225,
+  0x30390225,
+  0x2020342A,
+  0x0B7F2DEB,
+  0x0AFFFFFF,
+  0x0909342A,
+  0x00082DEB,
+  0xBBBF2DEB,
+  0xB6B92DEB,
+  0xABB42DEB,
+  0x80A92DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB7B72DEB,
+  0x97972DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFBF2DEB,
+  0xADAD2DEB,
+  0xA5AB2DEB,
+  0x929F2DEB,
+  0x82852DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBE2DEB,
+  0xB8B92DEB,
+  0xB5B52DEB,
+  0x80AF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA2A22DEB,
+  0x8D8D2DEB,
+  0x8B8B2DEB,
+  0x87872DEB,
+  0x80852DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB6B62DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x82892DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B02DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9A9F2DEB,
+  0x97982DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x89BF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB3BF2DEB,
+  0xABAE2DEB,
+  0x808F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x809F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B02DEB,
+  0xAAAD2DEB,
+  0x8B9F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBE2DEB,
+  0xA7AD2DEB,
+  0x96A42DEB,
+  0x94942DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF2DEB,
+  0x91912DEB,
+  0x808F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x808C2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2BF2DEB,
+  0xA6B02DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBF2DEB,
+  0xB6B92DEB,
+  0xABB32DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF2E30,
+  0xBEBE3584,
+  0xBDBD357D,
+  0xBCBC3576,
+  0xBBBB356D,
+  0xBABA355F,
+  0xB9B93558,
+  0xB8B83550,
+  0xB7B73549,
+  0xB6B6353F,
+  0xB5B53535,
+  0xB4B4352B,
+  0xB3B33521,
+  0xB2B23515,
+  0xB1B1350B,
+  0xB0B03500,
+  0xAFAF34F8,
+  0xAEAE34E8,
+  0xADAD34DE,
+  0xACAC34D1,
+  0xABAB34C7,
+  0xAAAA34BA,
+  0xA9A934B0,
+  0xA8A834A3,
+  0xA7A73498,
+  0xA6A6348B,
+  0xA5A53482,
+  0xA4A4347A,
+  0xA3A33474,
+  0xA2A2346D,
+  0xA1A13466,
+  0xA0A0345D,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF36BA,
+  0xBEBE36B2,
+  0xBDBD36A6,
+  0xBCBC369F,
+  0xB7B72E30,
+  0xB3B33695,
+  0xB2B2368E,
+  0xB1B13687,
+  0xB0B03681,
+  0xAFAF367B,
+  0xAEAE3674,
+  0xADAD366C,
+  0xACAC3665,
+  0xABAB2E30,
+  0xAAAA365D,
+  0xA9A93657,
+  0xA8A83651,
+  0xA7A7364A,
+  0xA6A63644,
+  0xA5A5363C,
+  0xA4A43636,
+  0xA3A33630,
+  0xA2A23628,
+  0xA1A13622,
+  0xA0A0361B,
+  0x9F9F3612,
+  0x9E9E360C,
+  0x9D9D3604,
+  0x9C9C35FD,
+  0x9B9B35F6,
+  0x9A9A35EF,
+  0x999935E9,
+  0x909035E3,
+  0x8F8F35DC,
+  0x8E8E35D6,
+  0x8D8D35D0,
+  0x8C8C35C9,
+  0x8B8B35C1,
+  0x8A8A35B7,
+  0x898935AD,
+  0x838335A4,
+  0x8282359C,
+  0x81813591,
+  0x8080358B,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB9BF2E30,
+  0xB8B83725,
+  0xB7B7371C,
+  0xB6B63712,
+  0xB5B5370B,
+  0xB4B43703,
+  0xB3B336FB,
+  0x868636F4,
+  0x858536EC,
+  0x848436DC,
+  0x83AF2E30,
+  0x828236D5,
+  0x818136CD,
+  0x808036C7,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x888F2E30,
+  0x8787374F,
+  0x86863749,
+  0x84843742,
+  0x8383373C,
+  0x82823735,
+  0x818135E3,
+  0x8080372C,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB7B72E30,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFAF37F7,
+  0xADAD37F0,
+  0xACAC37E5,
+  0xABAB37DB,
+  0xAAAA37D2,
+  0xA9A937C8,
+  0xA8A837C2,
+  0xA7A737B9,
+  0xA6A637B2,
+  0xA5A537AB,
+  0xA4A437A5,
+  0xA3A3379B,
+  0xA2A23794,
+  0xA1A1360C,
+  0xA0A0378B,
+  0x9F9F3782,
+  0x9E9E377C,
+  0x9C9C3775,
+  0x9B9B367B,
+  0x9A9A376F,
+  0x99993769,
+  0x98983762,
+  0x9393375B,
+  0x92923755,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9F9F3804,
+  0x9E9E37FE,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BF2E30,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF3879,
+  0xBEBE3873,
+  0xBDBD386C,
+  0xBCBC3864,
+  0xBBBB385E,
+  0xB9B93856,
+  0xB8B8384F,
+  0xB7B73848,
+  0xB6B63842,
+  0xB5B5383C,
+  0xB4B43836,
+  0xAFAF3830,
+  0xAEAE382A,
+  0xADAD3823,
+  0xACAC3817,
+  0xABAB3811,
+  0xA9A9380B,
+  0x80A32E30,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2BF2F44,
+  0xB1B13979,
+  0xAFAF3971,
+  0xAEAE396A,
+  0xACAC3964,
+  0xABAB395D,
+  0xAAAA3957,
+  0x9F9F3950,
+  0x9E9E393F,
+  0x9D9D392C,
+  0x9B9B3920,
+  0x9A9A3919,
+  0x999C2F44,
+  0x98983910,
+  0x969638FE,
+  0x95952F44,
+  0x949438F6,
+  0x939338EF,
+  0x929238E4,
+  0x919138B2,
+  0x90903883,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BF2F44,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x808F2F44,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xF4F4214B,
+  0xF1F32145,
+  0xF0F0213F,
+  0xEDED2139,
+  0xE1EF2133,
+  0xE0E0212D,
+  0xC2DF2127,
+  0x80FF0225,
+  0x61613980,
+  0x292920F6,
+  0x20202151,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x09092151,
+  0x00081399,
+  0xF4F4214B,
+  0xF1F32145,
+  0xF0F0213F,
+  0xEDED2139,
+  0xE1EF2133,
+  0xE0E0212D,
+  0xC2DF2127,
+  0x80FF0225,
+  0x6C6C398F,
+  0x292920F6,
+  0x20202151,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x09092151,
+  0x00081399,
+  0xF4F4214B,
+  0xF1F32145,
+  0xF0F0213F,
+  0xEDED2139,
+  0xE1EF2133,
+  0xE0E0212D,
+  0xC2DF2127,
+  0x80FF0225,
+  0x6F6F399E,
+  0x292920F6,
+  0x20202151,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x09092151,
+  0x00081399,
+  0xF4F4214B,
+  0xF1F32145,
+  0xF0F0213F,
+  0xEDED2139,
+  0xE1EF2133,
+  0xE0E0212D,
+  0xC2DF2127,
+  0x80FF0225,
+  0x666621C5,
+  0x292920F6,
+  0x20202151,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x09092151,
+  0x00081399,
+  0xF4F4214B,
+  0xF1F32145,
+  0xF0F0213F,
+  0xEDED2139,
+  0xE1EF2133,
+  0xE0E0212D,
+  0xC2DF2127,
+  0x80FF0225,
+  0x656539AD,
+  0x292920F6,
+  0x20202151,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x09092151,
+  0x00081399,
+  0xF4F4214B,
+  0xF1F32145,
+  0xF0F0213F,
+  0xEDED2139,
+  0xE1EF2133,
+  0xE0E0212D,
+  0xC2DF2127,
+  0x80FF0225,
+  0x777739BC,
+  0x292920F6,
+  0x20202151,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x09092151,
+  0x00081399,
+  0xF4F4214B,
+  0xF1F32145,
+  0xF0F0213F,
+  0xEDED2139,
+  0xE1EF2133,
+  0xE0E0212D,
+  0xC2DF2127,
+  0x80FF0225,
+  0x686839CB,
+  0x292920F6,
+  0x20202151,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x09092151,
+  0x00081399,
+  0xF4F4214B,
+  0xF1F32145,
+  0xF0F0213F,
+  0xEDED2139,
+  0xE1EF2133,
+  0xE0E0212D,
+  0xC2DF2127,
+  0x80FF0225,
+  0x686839DA,
+  0x292920F6,
+  0x20202151,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x09092151,
+  0x00081399,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x6868146A,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3A3A008E,
+  0x30390D6E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x28281399,
+  0x2626008E,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0x080039ED,
+  0xF4F43B7E,
+  0xF1F33B79,
+  0xF0F03B60,
+  0xEFEF3B4A,
+  0xEEEE3B45,
+  0xEDED3B3F,
+  0xEAEA3B23,
+  0xE4E43B1E,
+  0xE3E33B12,
+  0xE2E23B00,
+  0xE1E13AD0,
+  0xE0E03AAC,
+  0xDFDF3AA5,
+  0xDEDE3A9F,
+  0xDDDD3A9A,
+  0xDCDC3A93,
+  0xDBDB3A8B,
+  0xD9D93A84,
+  0xD8D83A7F,
+  0xD7D73A78,
+  0xD6D63A73,
+  0xD5D53A6D,
+  0xD4D43A68,
+  0xD2D23A63,
+  0xCFCF3A5E,
+  0xCECE3A55,
+  0xCDCD3A4D,
+  0xCCCC3A48,
+  0xCBCB3A3F,
+  0xC3C33A39,
+  0xC2C23A31,
+  0x80FF130E,
+  0x7B7B39E9,
+  0x74743A03,
+  0x6F6F39FE,
+  0x6E6E39F9,
+  0x666639F4,
+  0x636339EF,
+  0x617A130E,
+  0x5F5F130E,
+  0x415A130E,
+  0x3A3A39E9,
+  0x303B130E,
+  0x2020302E,
+  0x0B7F3A08,
+  0x0AFFFFFF,
+  0x0909302E,
+  0x00083A08,
+  0x08001190,
+  0x80BF21C5,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF305F,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BF305F,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x809F305F,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90BF3069,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BF3069,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x808F3069,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x72723B83,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3A3A008E,
+  0x30390D6E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x28281399,
+  0x2626008E,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x7777146A,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3A3A008E,
+  0x30390D6E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x28281399,
+  0x2626008E,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0x6868130E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x72723BB2,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x7777130E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x08001190,
+  0xBFBF146A,
+  0xBCBD146A,
+  0xA8BA146A,
+  0x8DA6146A,
+  0x808B146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x909D146A,
+  0x808D146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BA146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF146A,
+  0x809C146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8090146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xADBF146A,
+  0x809F146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90B5146A,
+  0x8289146A,
+  0x8080146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x888F146A,
+  0x8083146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0xA0A9146A,
+  0x809D146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x98BB146A,
+  0x8093146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0x80A7146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBF146A,
+  0xB0BA146A,
+  0x80A3146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBC146A,
+  0xB3B9146A,
+  0xA3B1146A,
+  0x97A1146A,
+  0x9495146A,
+  0x8C92146A,
+  0x808A146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80B6146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0A7146A,
+  0x8095146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2BA146A,
+  0x87B0146A,
+  0x8085146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF146A,
+  0xBCBC146A,
+  0xB7B8146A,
+  0x8AB5146A,
+  0x8888146A,
+  0x8085146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0B6146A,
+  0x8095146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB4B5146A,
+  0xA0B2146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0B9146A,
+  0x8095146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF146A,
+  0x80B7146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x99B5146A,
+  0x9597146A,
+  0x9093146A,
+  0x8080146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BC146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x809C146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x89A4146A,
+  0x8087146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0B2146A,
+  0x8095146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8091146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80B2146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B9146A,
+  0x80A3146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B1146A,
+  0x80A9146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0xA7A7146A,
+  0x809C146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0x8085146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0x8081146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0B6146A,
+  0x8084146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x83B7146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB5B5146A,
+  0xB1B2146A,
+  0xA6AF146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x83AF146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B9146A,
+  0x90A8146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB6BF146A,
+  0x83A6146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB6B6146A,
+  0x90B2146A,
+  0x8787146A,
+  0x8484146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x83B2146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9C9C146A,
+  0x909A146A,
+  0x8184146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x93AB146A,
+  0x8091146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0x9FA8146A,
+  0x8F9D146A,
+  0x8A8D146A,
+  0x8888146A,
+  0x8086146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B9146A,
+  0x809E146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9DA1146A,
+  0x9090146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80B4146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9FA1146A,
+  0x9099146A,
+  0x878A146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80AF146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9099146A,
+  0x8787146A,
+  0x8485146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80AE146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x989B146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9099146A,
+  0x8484146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8B8146A,
+  0x80AA146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B9146A,
+  0x809A146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8086146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80AB146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF146A,
+  0x80A9146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF146A,
+  0x98AF146A,
+  0x9596146A,
+  0x8C93146A,
+  0x8989146A,
+  0x8086146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9099146A,
+  0x8181146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAABF146A,
+  0xA0A7146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA3A3146A,
+  0xA1A1146A,
+  0x8090146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABA146A,
+  0x8BB2146A,
+  0x8080146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9CBF146A,
+  0x9090146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0x9D9D146A,
+  0x8089146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8AAE146A,
+  0x8088146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2BF146A,
+  0x9099146A,
+  0x8080146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x808F146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8BB0146A,
+  0x8889146A,
+  0x8086146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAABF146A,
+  0xA7A8146A,
+  0xA0A5146A,
+  0x9099146A,
+  0x8686146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0A9146A,
+  0x9898146A,
+  0x8089146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0B2146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B0146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8083146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80B0146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0xA0A9146A,
+  0x809E146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90AD146A,
+  0x8089146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBF146A,
+  0xA3B7146A,
+  0x9099146A,
+  0x8083146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9090146A,
+  0x808A146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x939F146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA3A3146A,
+  0xA0A1146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80B7146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8095146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBE146A,
+  0xB5BB146A,
+  0xB0B3146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80A2146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0xA4A7146A,
+  0x9092146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BB146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BC146A,
+  0x80AA146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9099146A,
+  0x8088146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x96BF146A,
+  0x8094146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBF146A,
+  0xBBBB146A,
+  0xAEB9146A,
+  0xA9AC146A,
+  0xA5A6146A,
+  0xA2A2146A,
+  0x9E9F146A,
+  0x809C146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x85BF146A,
+  0x8083146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBE146A,
+  0x9EB9146A,
+  0x969C146A,
+  0x8D94146A,
+  0x878A146A,
+  0x8085146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x92BF146A,
+  0x8A90146A,
+  0x8686146A,
+  0x8084146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA8BF146A,
+  0x80A5146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBF146A,
+  0x9CBA146A,
+  0x829A146A,
+  0x8080146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB6BF146A,
+  0x96B4146A,
+  0x8094146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0x90AE146A,
+  0x808E146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAABF146A,
+  0x8AA8146A,
+  0x8088146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8EBF146A,
+  0x848B146A,
+  0x8082146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB7BD146A,
+  0x80AC146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8E8E146A,
+  0x8089146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90AD146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B9146A,
+  0x80AB146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BE146A,
+  0xADAE146A,
+  0xA8AB146A,
+  0xA0A6146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8084146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9099146A,
+  0x8B8B146A,
+  0x8083146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBB146A,
+  0xB9B9146A,
+  0xB4B7146A,
+  0xA9B2146A,
+  0xA7A7146A,
+  0xA4A4146A,
+  0xA1A2146A,
+  0x859F146A,
+  0x8083146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBE146A,
+  0xB9BC146A,
+  0xB4B7146A,
+  0xACB2146A,
+  0xA7AA146A,
+  0xA4A4146A,
+  0xA1A2146A,
+  0x9F9F146A,
+  0x9D9D146A,
+  0x9B9B146A,
+  0x9999146A,
+  0x9797146A,
+  0x9494146A,
+  0x9192146A,
+  0x8D8F146A,
+  0x8B8B146A,
+  0x8989146A,
+  0x8787146A,
+  0x8282146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xABBB146A,
+  0xA5A9146A,
+  0xA1A3146A,
+  0x8B9B146A,
+  0x8089146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B9146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x809F146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0x80A1146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80A0146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x809D146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x808A146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08002D95,
+  0x77773BE9,
+  0x74743BE2,
+  0x73733BDB,
+  0x72723BD4,
+  0x69693BCD,
+  0x66663BC6,
+  0x65653BBF,
+  0x63633BB8,
+  0x202033E8,
+  0x0BFF2D8F,
+  0x0AFFFFFF,
+  0x090933E8,
+  0x00082D8F,
+  0xFE000001,
+  0x00FFFFFF,
+  0x6F6F340C,
+  0x61611A70,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x6F6F1A7C,
+  0x69693412,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x68683BF0,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x6E6E3BF6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x6E6E3BFC,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x65653C02,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x65653C08,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x72723C0E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x08002D95,
+  0xF4F42F81,
+  0xF1F32F7B,
+  0xF0F02F61,
+  0xEFEF2F4A,
+  0xEEEE2F44,
+  0xEDED2F3D,
+  0xEAEA2F20,
+  0xE4E42F1A,
+  0xE3E32F0D,
+  0xE2E22EFA,
+  0xE1E12EC9,
+  0xE0E02EA4,
+  0xDFDF2E9C,
+  0xDEDE2E95,
+  0xDDDD2E8F,
+  0xDCDC2E87,
+  0xDBDB2E7E,
+  0xD9D92E76,
+  0xD8D82E70,
+  0xD7D72E68,
+  0xD6D62E62,
+  0xD5D52E5B,
+  0xD4D42E55,
+  0xD2D22E4F,
+  0xCFCF2E49,
+  0xCECE2E3F,
+  0xCDCD2E36,
+  0xCCCC2E30,
+  0xCBCB2E26,
+  0xC3C32E1F,
+  0xC2C22E16,
+  0x80FF0225,
+  0x77770DC6,
+  0x74740DC0,
+  0x73730DBA,
+  0x72720DB4,
+  0x69690DAE,
+  0x66660DA8,
+  0x65650DA2,
+  0x63630D9C,
+  0x617B0225,
+  0x5F5F0225,
+  0x415A0225,
+  0x3B3B0225,
+  0x30390225,
+  0x2020342A,
+  0x0B7F2DEB,
+  0x0AFFFFFF,
+  0x0909342A,
+  0x00082DEB,
+  0xA9BF2DEB,
+  0xA5A72DEB,
+  0x9BA32DEB,
+  0x96992DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xABAF2DEB,
+  0x999F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8F9F2DEB,
+  0x88882DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8ABF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF2DEB,
+  0xBABC2DEB,
+  0x80832DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B02DEB,
+  0xA2A52DEB,
+  0x91972DEB,
+  0x808F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF2DEB,
+  0xBABC2DEB,
+  0xB3B52DEB,
+  0xB1B12DEB,
+  0xA9A92DEB,
+  0x91922DEB,
+  0x8D8E2DEB,
+  0x81842DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBF2DEB,
+  0xB2BB2DEB,
+  0xA2A52DEB,
+  0x9E9E2DEB,
+  0x8F9B2DEB,
+  0x808D2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABF2DEB,
+  0xB7B72DEB,
+  0xB4B42DEB,
+  0xB1B12DEB,
+  0xA9A92DEB,
+  0x91922DEB,
+  0x8B8E2DEB,
+  0x80842DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB5BF2DEB,
+  0xB0B12DEB,
+  0x9FA52DEB,
+  0x9D9D2DEB,
+  0x80982DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF2DEB,
+  0xBABC2DEB,
+  0xB4B42DEB,
+  0xB1B12DEB,
+  0xA9A92DEB,
+  0x92922DEB,
+  0x8E8E2DEB,
+  0x80842DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABF2DEB,
+  0xB0B82DEB,
+  0xA2A52DEB,
+  0x919F2DEB,
+  0x808F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF2DEB,
+  0xBABC2DEB,
+  0xB4B42DEB,
+  0xB1B12DEB,
+  0xA9A92DEB,
+  0x91922DEB,
+  0x8D8E2DEB,
+  0x80842DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2BF2DEB,
+  0xB0B02DEB,
+  0xA2A52DEB,
+  0x9E9E2DEB,
+  0x809B2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABF2DEB,
+  0xABAD2DEB,
+  0xA5A72DEB,
+  0xA0A22DEB,
+  0x9D9D2DEB,
+  0x9B9B2DEB,
+  0x96982DEB,
+  0x91912DEB,
+  0x8B8D2DEB,
+  0x84842DEB,
+  0x80822DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF2DEB,
+  0x91A52DEB,
+  0x808F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF2DEB,
+  0xBABC2DEB,
+  0xA9A92DEB,
+  0x91912DEB,
+  0x8D8D2DEB,
+  0x80842DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF2DEB,
+  0xA2A52DEB,
+  0x9E9F2DEB,
+  0x9B9C2DEB,
+  0x80972DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF2DEB,
+  0xBABC2DEB,
+  0xB4B42DEB,
+  0xA9A92DEB,
+  0x91912DEB,
+  0x8D8D2DEB,
+  0x81842DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB3BF2DEB,
+  0xB0B02DEB,
+  0xA2A52DEB,
+  0x9F9F2DEB,
+  0x809C2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF2DEB,
+  0xBBBC2DEB,
+  0x91912DEB,
+  0x8D8D2DEB,
+  0x80832DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B92DEB,
+  0xA2A52DEB,
+  0x979E2DEB,
+  0x8F932DEB,
+  0x808D2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF2DEB,
+  0xBCBC2DEB,
+  0xB2B22DEB,
+  0x97992DEB,
+  0x80842DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF2DEB,
+  0x87A52DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB4BF2DEB,
+  0xB1B12DEB,
+  0x80802DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9ABF2DEB,
+  0x878F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF2DEB,
+  0xB4BC2DEB,
+  0xB1B12DEB,
+  0xA6A62DEB,
+  0xA4A42DEB,
+  0x8B8B2DEB,
+  0x85852DEB,
+  0x83832DEB,
+  0x80802DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF2DEB,
+  0x9A9B2DEB,
+  0x878F2DEB,
+  0x85852DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAABF2DEB,
+  0x819F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xADBF2DEB,
+  0x88882DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8DBF2DEB,
+  0x80872DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xABBE2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1B42DEB,
+  0xA7AD2DEB,
+  0xA2A42DEB,
+  0x9EA02DEB,
+  0x96992DEB,
+  0x8A8F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9A9F2DEB,
+  0x8F8F2DEB,
+  0x828D2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBB2DEB,
+  0x8E8F2DEB,
+  0x888C2DEB,
+  0x86862DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9E9F2DEB,
+  0x99992DEB,
+  0x97972DEB,
+  0x8E8F2DEB,
+  0x89892DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF2DEB,
+  0xB6B72DEB,
+  0xB1B12DEB,
+  0x8E8F2DEB,
+  0x89892DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x97972DEB,
+  0x86872DEB,
+  0x81812DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x96972DEB,
+  0x91912DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9BBF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x909F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF2DEB,
+  0xB6B72DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80802DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xADAE2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9B9F2DEB,
+  0x80802DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB9BF2DEB,
+  0xABB02DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2BF2DEB,
+  0x929E2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1BF2DEB,
+  0xADAD2DEB,
+  0x929F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB4BF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAABF2DEB,
+  0x9D9F2DEB,
+  0x989B2DEB,
+  0x80962DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9A9F2DEB,
+  0x808F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB9BF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xABAF2DEB,
+  0xA9A92DEB,
+  0x85862DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB6BF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9FBF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB5BF2DEB,
+  0xAEAF2DEB,
+  0x80852DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xACAF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9ABF2DEB,
+  0x8A8F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x979F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x95BF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA8BF2DEB,
+  0x9AA62DEB,
+  0x8A8F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB4BF2DEB,
+  0x80842DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9ABF2DEB,
+  0x8D8F2DEB,
+  0x80842DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA1AD2DEB,
+  0x80822DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA6BF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA4BF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF2DEB,
+  0x8A8C2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBC2DEB,
+  0x898F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBF2DEB,
+  0xB7B92DEB,
+  0xB4B42DEB,
+  0xADAD2DEB,
+  0x80A82DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9E9F2DEB,
+  0x96972DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF2DEB,
+  0x9E9E2DEB,
+  0x9C9C2DEB,
+  0x9A9A2DEB,
+  0x98982DEB,
+  0x8E8F2DEB,
+  0x86872DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF2DEB,
+  0xBDBD2DEB,
+  0xB5B52DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBF2DEB,
+  0xB5B52DEB,
+  0xADB12DEB,
+  0x9C9F2DEB,
+  0x94952DEB,
+  0x8D8F2DEB,
+  0x85852DEB,
+  0x80812DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BE2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2BE2DEB,
+  0x95B02DEB,
+  0x81932DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9DBF2DEB,
+  0x808F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABB2DEB,
+  0xAEAE2DEB,
+  0xA9A92DEB,
+  0xA7A72DEB,
+  0xA5A52DEB,
+  0x9EA32DEB,
+  0x96982DEB,
+  0x94942DEB,
+  0x88892DEB,
+  0x83862DEB,
+  0x80812DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8FBF2DEB,
+  0x8A8D2DEB,
+  0x80842DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x85BF2DEB,
+  0x80822DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB4BF2DEB,
+  0xAFB12DEB,
+  0xA5AA2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAEAF2DEB,
+  0xA8AC2DEB,
+  0xA6A62DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF2DEB,
+  0xA8AE2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF2DEB,
+  0xB7B72DEB,
+  0xAFAF2DEB,
+  0xA7A72DEB,
+  0x979F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9FBF2DEB,
+  0x97972DEB,
+  0x8F8F2DEB,
+  0x87872DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF2DEB,
+  0x80AE2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBF2DEB,
+  0xB6BA2DEB,
+  0x87B02DEB,
+  0x80842DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0A02DEB,
+  0x979C2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBB2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B02DEB,
+  0x80842DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8F9F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80AF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8DBF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF2DEB,
+  0x808F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xACBF2DEB,
+  0x8D8F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFBE2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9E9F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0A12DEB,
+  0x80962DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x898A2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9AB12DEB,
+  0x94942DEB,
+  0x92922DEB,
+  0x8B8F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA3BF2DEB,
+  0x8B8B2DEB,
+  0x86862DEB,
+  0x82822DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB4BF2DEB,
+  0x80812DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF2DEB,
+  0xBCBC2DEB,
+  0xB8BA2DEB,
+  0x9AB12DEB,
+  0x808F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA6AF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBF2DEB,
+  0x879F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB3BF2DEB,
+  0x80832DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF2DEB,
+  0xA5A52DEB,
+  0x9A9F2DEB,
+  0x808E2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA9BF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBD2DEB,
+  0xB7B92DEB,
+  0x9A9F2DEB,
+  0x8C8F2DEB,
+  0x83832DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF2DEB,
+  0xB7B82DEB,
+  0xB2B42DEB,
+  0xB0B02DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB5BF2DEB,
+  0xABB12DEB,
+  0x9E9F2DEB,
+  0x839A2DEB,
+  0x81812DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFAF2DEB,
+  0xA7A72DEB,
+  0x979F2DEB,
+  0x8F902DEB,
+  0x87882DEB,
+  0x80802DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAAAF2DEB,
+  0x9B9B2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABF2DEB,
+  0xA3AF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA4AF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBF2DEB,
+  0x878A2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAEAF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9ABF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF2DEB,
+  0xBDBD2DEB,
+  0xB7B72DEB,
+  0xA9A92DEB,
+  0x9E9E2DEB,
+  0x989C2DEB,
+  0x87922DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x85852DEB,
+  0x82822DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2BF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80922DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x808F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90912DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBF2DEB,
+  0x88AF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB5BF2DEB,
+  0x80B22DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB5B52DEB,
+  0x90AF2DEB,
+  0x808C2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBE2DEB,
+  0x9AA02DEB,
+  0x808F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9BA52DEB,
+  0x80802DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9DBF2DEB,
+  0x98992DEB,
+  0x90912DEB,
+  0x88892DEB,
+  0x80812DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF3CFE,
+  0xBEBE3CF8,
+  0xBDBD3CF2,
+  0xBCBC3CEB,
+  0xBABA3CE4,
+  0xB5BB2E30,
+  0xB4B43CDD,
+  0xB2B33CD7,
+  0xB1B12E62,
+  0xAEAE3CD1,
+  0xADAD3CCA,
+  0xACAC3630,
+  0xABAB3CC3,
+  0xAAAA3CBD,
+  0xA9A93CB6,
+  0xA8A83CAD,
+  0xA6A63CA7,
+  0xA4A43CA0,
+  0xA3A33C98,
+  0xA2A23636,
+  0xA1A13C91,
+  0xA0A03C87,
+  0x9FAF2E30,
+  0x9E9E3C7F,
+  0x9D9D3C78,
+  0x9C9C3C72,
+  0x97972E30,
+  0x96963C66,
+  0x95953C5F,
+  0x94943C59,
+  0x93933C52,
+  0x92923C4B,
+  0x8F8F3C44,
+  0x8E8E376F,
+  0x8D8D3C3C,
+  0x8C8C3C36,
+  0x8B8B3C30,
+  0x8A8A3C2A,
+  0x84892E30,
+  0x83833C24,
+  0x81813C1D,
+  0x80803C14,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBE3E24,
+  0xBBBB3E1D,
+  0xB6B63E15,
+  0xB5B53E0B,
+  0xB4B43E03,
+  0xB2B23DFD,
+  0xB1B13DF6,
+  0xB0B03DEF,
+  0xABAB3622,
+  0xAAAA3DE8,
+  0xA9A93DE1,
+  0xA8A83DD9,
+  0xA7A73DD1,
+  0xA6A63DCA,
+  0xA5A53DC2,
+  0xA4A43DB8,
+  0xA3A33DB2,
+  0xA2A22E70,
+  0xA0A03DAC,
+  0x9D9D3DA6,
+  0x9C9C3D9F,
+  0x9B9B3474,
+  0x9A9A3D98,
+  0x99993D90,
+  0x98983D74,
+  0x97973D89,
+  0x96963D83,
+  0x93933D7A,
+  0x92923D74,
+  0x91913D6B,
+  0x90903D65,
+  0x8D8D3D5D,
+  0x8C8C34D1,
+  0x8B8B3D56,
+  0x8A8A3D4C,
+  0x89BF2E30,
+  0x88883D45,
+  0x87873D3C,
+  0x86863D35,
+  0x85853D2B,
+  0x84843D24,
+  0x83833D1C,
+  0x82823D15,
+  0x81813D0C,
+  0x80803D05,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF3E31,
+  0xBEBE383C,
+  0x96BD2E30,
+  0x95953E2B,
+  0x8F912E30,
+  0x8E8E3811,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x91BF2E30,
+  0x90903D83,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9ABF2E30,
+  0x99993DA6,
+  0x808F2E30,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF3E5B,
+  0xBEBE3E54,
+  0xBDBD3E4D,
+  0xBABB2E30,
+  0xAFB82E30,
+  0xAEAE3DFD,
+  0xADAD3E45,
+  0xACAC3D74,
+  0xABAB3E3E,
+  0xAAAA3873,
+  0xA9A93E37,
+  0xA8A83622,
+  0x809F2E30,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB5BF2E30,
+  0xB4B42E62,
+  0xB3B33E69,
+  0x9F9F3E63,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF3E6F,
+  0x80BE2E30,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB3BF2E30,
+  0xB2B23E93,
+  0xB1B13E8C,
+  0x8CAF2E30,
+  0x8B8B3E86,
+  0x85853E7E,
+  0x84843E78,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBC3636,
+  0xA0BF2E30,
+  0x9F9F3EE8,
+  0x9E9E3EE1,
+  0x9D9D3EDA,
+  0x9C9C3ED3,
+  0x9B9B3ECB,
+  0x9A9A3EC5,
+  0x95953EBD,
+  0x94943EB2,
+  0x93933EAC,
+  0x92923EA0,
+  0x91913E9A,
+  0x808F2E30,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABA3F4A,
+  0xB9B93F31,
+  0xB8B83F23,
+  0xA6BF2E30,
+  0xA5A53F1B,
+  0xA3A33F15,
+  0x9F9F3F0B,
+  0x8B8B3F04,
+  0x8A8A3EFD,
+  0x85853EF6,
+  0x84843EEF,
+  0x809E2E30,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFAF3F54,
+  0x80BF2E30,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9B9B3F5B,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0A0376F,
+  0x9C9C3622,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABA3F61,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF2E30,
+  0xAFAF3F67,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA9BF2E30,
+  0xA8A83F6D,
+  0x809F2E30,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8EBF2E30,
+  0x8D8D3F73,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xF4F4214B,
+  0xF1F32145,
+  0xF0F0213F,
+  0xEDED2139,
+  0xE1EF2133,
+  0xE0E0212D,
+  0xC2DF2127,
+  0x80FF0225,
+  0x74743F79,
+  0x292920F6,
+  0x20202151,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x09092151,
+  0x00081399,
+  0xF4F4214B,
+  0xF1F32145,
+  0xF0F0213F,
+  0xEDED2139,
+  0xE1EF2133,
+  0xE0E0212D,
+  0xC2DF2127,
+  0x80FF0225,
+  0x73733F88,
+  0x292920F6,
+  0x20202151,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x09092151,
+  0x00081399,
+  0xF4F4214B,
+  0xF1F32145,
+  0xF0F0213F,
+  0xEDED2139,
+  0xE1EF2133,
+  0xE0E0212D,
+  0xC2DF2127,
+  0x80FF0225,
+  0x727221C5,
+  0x292920F6,
+  0x20202151,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x09092151,
+  0x00081399,
+  0xF4F4214B,
+  0xF1F32145,
+  0xF0F0213F,
+  0xEDED2139,
+  0xE1EF2133,
+  0xE0E0212D,
+  0xC2DF2127,
+  0x80FF0225,
+  0x74743F97,
+  0x292920F6,
+  0x20202151,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x09092151,
+  0x00081399,
+  0xF4F4214B,
+  0xF1F32145,
+  0xF0F0213F,
+  0xEDED2139,
+  0xE1EF2133,
+  0xE0E0212D,
+  0xC2DF2127,
+  0x80FF0225,
+  0x69693980,
+  0x292920F6,
+  0x20202151,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x09092151,
+  0x00081399,
+  0xF4F4214B,
+  0xF1F32145,
+  0xF0F0213F,
+  0xEDED2139,
+  0xE1EF2133,
+  0xE0E0212D,
+  0xC2DF2127,
+  0x80FF0225,
+  0x72723FA6,
+  0x292920F6,
+  0x20202151,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x09092151,
+  0x00081399,
+  0xF4F4214B,
+  0xF1F32145,
+  0xF0F0213F,
+  0xEDED2139,
+  0xE1EF2133,
+  0xE0E0212D,
+  0xC2DF2127,
+  0x80FF0225,
+  0x69693FB5,
+  0x292920F6,
+  0x20202151,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x09092151,
+  0x00081399,
+  0x080039ED,
+  0x0BFF39E9,
+  0x0AFFFFFF,
+  0x000939E9,
+  0x07003FC4,
+  0x00FFFFFF,
+  0x08001190,
+  0x6F6F3FC6,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x69693FCB,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x6F6F3FD0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x76763FD5,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x68683FDA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x080039ED,
+  0xF4F43B7E,
+  0xF1F33B79,
+  0xF0F03B60,
+  0xEFEF3B4A,
+  0xEEEE3B45,
+  0xEDED3B3F,
+  0xEAEA3B23,
+  0xE4E43B1E,
+  0xE3E33B12,
+  0xE2E23B00,
+  0xE1E13AD0,
+  0xE0E03AAC,
+  0xDFDF3AA5,
+  0xDEDE3A9F,
+  0xDDDD3A9A,
+  0xDCDC3A93,
+  0xDBDB3A8B,
+  0xD9D93A84,
+  0xD8D83A7F,
+  0xD7D73A78,
+  0xD6D63A73,
+  0xD5D53A6D,
+  0xD4D43A68,
+  0xD2D23A63,
+  0xCFCF3A5E,
+  0xCECE3A55,
+  0xCDCD3A4D,
+  0xCCCC3A48,
+  0xCBCB3A3F,
+  0xC3C33A39,
+  0xC2C23A31,
+  0x80FF130E,
+  0x617B130E,
+  0x5F5F130E,
+  0x415A130E,
+  0x3B3B130E,
+  0x3039130E,
+  0x0B7F3A08,
+  0x0AFFFFFF,
+  0x00093A08,
+  0x08001190,
+  0xBBBF3A08,
+  0xB6B93A08,
+  0xABB43A08,
+  0x80A93A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB7B73A08,
+  0x97973A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFBF3A08,
+  0xADAD3A08,
+  0xA5AB3A08,
+  0x929F3A08,
+  0x82853A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBE3A08,
+  0xB8B93A08,
+  0xB5B53A08,
+  0x80AF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA2A23A08,
+  0x8D8D3A08,
+  0x8B8B3A08,
+  0x87873A08,
+  0x80853A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB6B63A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x82893A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B03A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9A9F3A08,
+  0x97983A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x89BF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB3BF3A08,
+  0xABAE3A08,
+  0x808F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x809F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B03A08,
+  0xAAAD3A08,
+  0x8B9F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBE3A08,
+  0xA7AD3A08,
+  0x96A43A08,
+  0x94943A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF3A08,
+  0x91913A08,
+  0x808F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x808C3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2BF3A08,
+  0xA6B03A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBF3A08,
+  0xB6B93A08,
+  0xABB33A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF3A48,
+  0xBEBE40E8,
+  0xBDBD40E2,
+  0xBCBC40DC,
+  0xBBBB40D4,
+  0xBABA40C7,
+  0xB9B940C1,
+  0xB8B840BA,
+  0xB7B740B4,
+  0xB6B640AB,
+  0xB5B540A2,
+  0xB4B44099,
+  0xB3B34090,
+  0xB2B24085,
+  0xB1B1407C,
+  0xB0B04072,
+  0xAFAF406B,
+  0xAEAE405C,
+  0xADAD4053,
+  0xACAC4047,
+  0xABAB403E,
+  0xAAAA4032,
+  0xA9A94029,
+  0xA8A8401D,
+  0xA7A74013,
+  0xA6A64007,
+  0xA5A53FFF,
+  0xA4A43FF8,
+  0xA3A33FF3,
+  0xA2A23FED,
+  0xA1A13FE7,
+  0xA0A03FDF,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF41F4,
+  0xBEBE41ED,
+  0xBDBD41E2,
+  0xBCBC41DC,
+  0xB7B73A48,
+  0xB3B341D3,
+  0xB2B241CD,
+  0xB1B141C7,
+  0xB0B041C2,
+  0xAFAF41BD,
+  0xAEAE41B7,
+  0xADAD41B0,
+  0xACAC41AA,
+  0xABAB3A48,
+  0xAAAA41A3,
+  0xA9A9419E,
+  0xA8A84199,
+  0xA7A74193,
+  0xA6A6418E,
+  0xA5A54187,
+  0xA4A44182,
+  0xA3A3417D,
+  0xA2A24176,
+  0xA1A14171,
+  0xA0A0416B,
+  0x9F9F4163,
+  0x9E9E415E,
+  0x9D9D4157,
+  0x9C9C4151,
+  0x9B9B414B,
+  0x9A9A4145,
+  0x99994140,
+  0x9090413B,
+  0x8F8F4135,
+  0x8E8E4130,
+  0x8D8D412B,
+  0x8C8C4125,
+  0x8B8B411E,
+  0x8A8A4115,
+  0x8989410C,
+  0x83834104,
+  0x828240FD,
+  0x818140F3,
+  0x808040EE,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB9BF3A48,
+  0xB8B84253,
+  0xB7B7424B,
+  0xB6B64242,
+  0xB5B5423C,
+  0xB4B44235,
+  0xB3B3422E,
+  0x86864228,
+  0x85854221,
+  0x84844212,
+  0x83AF3A48,
+  0x8282420C,
+  0x81814205,
+  0x80804200,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x888F3A48,
+  0x87874277,
+  0x86864272,
+  0x8484426C,
+  0x83834267,
+  0x82824261,
+  0x8181413B,
+  0x80804259,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB7B73A48,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFAF4309,
+  0xADAD4303,
+  0xACAC42F9,
+  0xABAB42F0,
+  0xAAAA42E8,
+  0xA9A942DF,
+  0xA8A842DA,
+  0xA7A742D2,
+  0xA6A642CC,
+  0xA5A542C6,
+  0xA4A442C1,
+  0xA3A342B8,
+  0xA2A242B2,
+  0xA1A1415E,
+  0xA0A042AA,
+  0x9F9F42A2,
+  0x9E9E429D,
+  0x9C9C4297,
+  0x9B9B41BD,
+  0x9A9A4292,
+  0x9999428D,
+  0x98984287,
+  0x93934281,
+  0x9292427C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9F9F4314,
+  0x9E9E430F,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BF3A48,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF4378,
+  0xBEBE4373,
+  0xBDBD436D,
+  0xBCBC4366,
+  0xBBBB4361,
+  0xB9B9435A,
+  0xB8B84354,
+  0xB7B7434E,
+  0xB6B64349,
+  0xB5B54344,
+  0xB4B4433F,
+  0xAFAF433A,
+  0xAEAE4335,
+  0xADAD432F,
+  0xACAC4324,
+  0xABAB431F,
+  0xA9A9431A,
+  0x80A33A48,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2BF3B45,
+  0xB1B14466,
+  0xAFAF445F,
+  0xAEAE4459,
+  0xACAC4454,
+  0xABAB444E,
+  0xAAAA4449,
+  0x9F9F4443,
+  0x9E9E4433,
+  0x9D9D4421,
+  0x9B9B4416,
+  0x9A9A4410,
+  0x999C3B45,
+  0x98984408,
+  0x969643F7,
+  0x95953B45,
+  0x949443F0,
+  0x939343EA,
+  0x929243E0,
+  0x919143AF,
+  0x90904381,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BF3B45,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x808F3B45,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x6E6E146A,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3A3A008E,
+  0x30390D6E,
+  0x2C2C008E,
+  0x2A2A008E,
+  0x28281399,
+  0x2626008E,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0x6E6E130E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x08002D95,
+  0x6161446C,
+  0x202033E8,
+  0x0BFF2D8F,
+  0x0AFFFFFF,
+  0x090933E8,
+  0x00082D8F,
+  0x08002D95,
+  0x6C6C4473,
+  0x202033E8,
+  0x0BFF2D8F,
+  0x0AFFFFFF,
+  0x090933E8,
+  0x00082D8F,
+  0x08002D95,
+  0x6F6F447A,
+  0x202033E8,
+  0x0BFF2D8F,
+  0x0AFFFFFF,
+  0x090933E8,
+  0x00082D8F,
+  0x08002D95,
+  0x666639E9,
+  0x202033E8,
+  0x0BFF2D8F,
+  0x0AFFFFFF,
+  0x090933E8,
+  0x00082D8F,
+  0x08002D95,
+  0x65654481,
+  0x202033E8,
+  0x0BFF2D8F,
+  0x0AFFFFFF,
+  0x090933E8,
+  0x00082D8F,
+  0x08002D95,
+  0x77774488,
+  0x202033E8,
+  0x0BFF2D8F,
+  0x0AFFFFFF,
+  0x090933E8,
+  0x00082D8F,
+  0x08002D95,
+  0x6868448F,
+  0x202033E8,
+  0x0BFF2D8F,
+  0x0AFFFFFF,
+  0x090933E8,
+  0x00082D8F,
+  0x08002D95,
+  0x68684496,
+  0x202033E8,
+  0x0BFF2D8F,
+  0x0AFFFFFF,
+  0x090933E8,
+  0x00082D8F,
+  0x7272449D,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x737344A3,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x616144A9,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x787844AF,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x727244B5,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x6F6F44BB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBE2DEB,
+  0xBBBB2DEB,
+  0xA7A72DEB,
+  0x8C8C2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9EBF2DEB,
+  0x8E8F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9D9F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x91BF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0AC2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB6BF2DEB,
+  0x8A8F2DEB,
+  0x81812DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90BF2DEB,
+  0x84872DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAAAF2DEB,
+  0x9E9F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBF2DEB,
+  0x94972DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA8AF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBB2DEB,
+  0xA4AF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBF2DEB,
+  0xBABA2DEB,
+  0xB2B22DEB,
+  0xA2A22DEB,
+  0x96962DEB,
+  0x93932DEB,
+  0x8B8B2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB7BF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA8BF2DEB,
+  0x969F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBF2DEB,
+  0xB1B12DEB,
+  0x86862DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBE2DEB,
+  0xB9BB2DEB,
+  0xB6B62DEB,
+  0x89892DEB,
+  0x86872DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB7BF2DEB,
+  0x969F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB6BF2DEB,
+  0xB3B32DEB,
+  0x809F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABF2DEB,
+  0x969F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8BD2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB6BF2DEB,
+  0x98982DEB,
+  0x94942DEB,
+  0x818F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBF2DEB,
+  0x809F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9DBF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA5BF2DEB,
+  0x88882DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB3BF2DEB,
+  0x969F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x92BF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB3BF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABF2DEB,
+  0xA4AF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2BF2DEB,
+  0xAAAF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA8AF2DEB,
+  0x9DA62DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x86AF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x82AF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB7BF2DEB,
+  0x859F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8BF2DEB,
+  0x80822DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB6BF2DEB,
+  0xB3B42DEB,
+  0xB0B02DEB,
+  0x80A52DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF2DEB,
+  0x80822DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABF2DEB,
+  0xA9AF2DEB,
+  0x808F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA7B52DEB,
+  0x80822DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB7BF2DEB,
+  0xB3B52DEB,
+  0x888F2DEB,
+  0x85862DEB,
+  0x80832DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB3BF2DEB,
+  0x80822DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9DBF2DEB,
+  0x9B9B2DEB,
+  0x858F2DEB,
+  0x80802DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xACBF2DEB,
+  0x92922DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA9AF2DEB,
+  0x9E9E2DEB,
+  0x8E8E2DEB,
+  0x89892DEB,
+  0x87872DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABF2DEB,
+  0x9FAF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA2BF2DEB,
+  0x919C2DEB,
+  0x808F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB5BF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA2BF2DEB,
+  0x9A9E2DEB,
+  0x8B8F2DEB,
+  0x80862DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9ABF2DEB,
+  0x888F2DEB,
+  0x86862DEB,
+  0x80832DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFBF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9CBF2DEB,
+  0x80972DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9ABF2DEB,
+  0x858F2DEB,
+  0x80832DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB9BF2DEB,
+  0xABB72DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABF2DEB,
+  0x9BAF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x87BF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xACBF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAABE2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BE2DEB,
+  0x97972DEB,
+  0x94942DEB,
+  0x8A8B2DEB,
+  0x87882DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9ABF2DEB,
+  0x828F2DEB,
+  0x80802DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA8A92DEB,
+  0x809F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA4BF2DEB,
+  0xA2A22DEB,
+  0x91A02DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBF2DEB,
+  0xB3B92DEB,
+  0x818A2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x919B2DEB,
+  0x808F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9EAF2DEB,
+  0x8A9C2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFBF2DEB,
+  0x89892DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9AB12DEB,
+  0x818F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90BF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1BF2DEB,
+  0x8A8A2DEB,
+  0x87872DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA9A92DEB,
+  0xA6A62DEB,
+  0x9A9F2DEB,
+  0x878F2DEB,
+  0x80852DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAABF2DEB,
+  0x999F2DEB,
+  0x8A972DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB3BF2DEB,
+  0x809F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1BF2DEB,
+  0x80AF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x84BF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1BF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAAAF2DEB,
+  0x9F9F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAEBF2DEB,
+  0x8A8F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8BC2DEB,
+  0x9AA22DEB,
+  0x848F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x91BF2DEB,
+  0x8B8F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF2DEB,
+  0x80922DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA4BF2DEB,
+  0xA2A22DEB,
+  0x809F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8BF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x96BF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF2DEB,
+  0xBCBC2DEB,
+  0xB4B42DEB,
+  0x80AF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA3BF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA8AF2DEB,
+  0x93A32DEB,
+  0x808F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBF2DEB,
+  0xABAF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9ABF2DEB,
+  0x898F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x95952DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBC2DEB,
+  0xBABA2DEB,
+  0xADAD2DEB,
+  0xA7A82DEB,
+  0xA3A42DEB,
+  0xA0A12DEB,
+  0x9D9D2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x84842DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF2DEB,
+  0xBABA2DEB,
+  0x9D9D2DEB,
+  0x95952DEB,
+  0x8B8C2DEB,
+  0x86862DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x91912DEB,
+  0x87892DEB,
+  0x85852DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA6A72DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBB2DEB,
+  0x9B9B2DEB,
+  0x81812DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB5B52DEB,
+  0x95952DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFAF2DEB,
+  0x8F8F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA9A92DEB,
+  0x89892DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8C8D2DEB,
+  0x83832DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF2DEB,
+  0xADB62DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8FBF2DEB,
+  0x8A8D2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAEBF2DEB,
+  0x808F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABF2DEB,
+  0xACAF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF2DEB,
+  0xAFAF2DEB,
+  0xACAC2DEB,
+  0xA7A72DEB,
+  0x809F2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x85BF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9ABF2DEB,
+  0x8C8F2DEB,
+  0x848A2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBF2DEB,
+  0xBABA2DEB,
+  0xB8B82DEB,
+  0xB3B32DEB,
+  0xA8A82DEB,
+  0xA5A62DEB,
+  0xA3A32DEB,
+  0xA0A02DEB,
+  0x84842DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF2DEB,
+  0xBDBD2DEB,
+  0xB8B82DEB,
+  0xB3B32DEB,
+  0xABAB2DEB,
+  0xA5A62DEB,
+  0xA3A32DEB,
+  0xA0A02DEB,
+  0x9E9E2DEB,
+  0x9C9C2DEB,
+  0x9A9A2DEB,
+  0x98982DEB,
+  0x95962DEB,
+  0x93932DEB,
+  0x90902DEB,
+  0x8C8C2DEB,
+  0x8A8A2DEB,
+  0x88882DEB,
+  0x83862DEB,
+  0x80812DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBF2DEB,
+  0xAAAA2DEB,
+  0xA4A42DEB,
+  0x9CA02DEB,
+  0x8A8A2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABF2DEB,
+  0x80AF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA2AF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA1BF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9EBF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8BBF2DEB,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xF4F4214B,
+  0xF1F32145,
+  0xF0F0213F,
+  0xEDED2139,
+  0xE1EF2133,
+  0xE0E0212D,
+  0xC2DF2127,
+  0x80FF0225,
+  0x636344C1,
+  0x292920F6,
+  0x20202151,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x09092151,
+  0x00081399,
+  0xF4F4214B,
+  0xF1F32145,
+  0xF0F0213F,
+  0xEDED2139,
+  0xE1EF2133,
+  0xE0E0212D,
+  0xC2DF2127,
+  0x80FF0225,
+  0x656521C5,
+  0x292920F6,
+  0x20202151,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x09092151,
+  0x00081399,
+  0xF4F4214B,
+  0xF1F32145,
+  0xF0F0213F,
+  0xEDED2139,
+  0xE1EF2133,
+  0xE0E0212D,
+  0xC2DF2127,
+  0x80FF0225,
+  0x757544D0,
+  0x292920F6,
+  0x20202151,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x09092151,
+  0x00081399,
+  0xF4F4214B,
+  0xF1F32145,
+  0xF0F0213F,
+  0xEDED2139,
+  0xE1EF2133,
+  0xE0E0212D,
+  0xC2DF2127,
+  0x80FF0225,
+  0x6F6F44DF,
+  0x292920F6,
+  0x20202151,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x09092151,
+  0x00081399,
+  0xF4F4214B,
+  0xF1F32145,
+  0xF0F0213F,
+  0xEDED2139,
+  0xE1EF2133,
+  0xE0E0212D,
+  0xC2DF2127,
+  0x80FF0225,
+  0x6C6C3F88,
+  0x292920F6,
+  0x20202151,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x09092151,
+  0x00081399,
+  0xFD000000,
+  0x00FFFFFF,
+  0x08001190,
+  0x6E6E44EE,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x6E6E44F3,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x656544F8,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x656544FD,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x72724502,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA9BF3A08,
+  0xA5A73A08,
+  0x9BA33A08,
+  0x96993A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xABAF3A08,
+  0x999F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8F9F3A08,
+  0x88883A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8ABF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF3A08,
+  0xBABC3A08,
+  0x80833A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B03A08,
+  0xA2A53A08,
+  0x91973A08,
+  0x808F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF3A08,
+  0xBABC3A08,
+  0xB3B53A08,
+  0xB1B13A08,
+  0xA9A93A08,
+  0x91923A08,
+  0x8D8E3A08,
+  0x81843A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBF3A08,
+  0xB2BB3A08,
+  0xA2A53A08,
+  0x9E9E3A08,
+  0x8F9B3A08,
+  0x808D3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABF3A08,
+  0xB7B73A08,
+  0xB4B43A08,
+  0xB1B13A08,
+  0xA9A93A08,
+  0x91923A08,
+  0x8B8E3A08,
+  0x80843A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB5BF3A08,
+  0xB0B13A08,
+  0x9FA53A08,
+  0x9D9D3A08,
+  0x80983A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF3A08,
+  0xBABC3A08,
+  0xB4B43A08,
+  0xB1B13A08,
+  0xA9A93A08,
+  0x92923A08,
+  0x8E8E3A08,
+  0x80843A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABF3A08,
+  0xB0B83A08,
+  0xA2A53A08,
+  0x919F3A08,
+  0x808F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF3A08,
+  0xBABC3A08,
+  0xB4B43A08,
+  0xB1B13A08,
+  0xA9A93A08,
+  0x91923A08,
+  0x8D8E3A08,
+  0x80843A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2BF3A08,
+  0xB0B03A08,
+  0xA2A53A08,
+  0x9E9E3A08,
+  0x809B3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABF3A08,
+  0xABAD3A08,
+  0xA5A73A08,
+  0xA0A23A08,
+  0x9D9D3A08,
+  0x9B9B3A08,
+  0x96983A08,
+  0x91913A08,
+  0x8B8D3A08,
+  0x84843A08,
+  0x80823A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF3A08,
+  0x91A53A08,
+  0x808F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF3A08,
+  0xBABC3A08,
+  0xA9A93A08,
+  0x91913A08,
+  0x8D8D3A08,
+  0x80843A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF3A08,
+  0xA2A53A08,
+  0x9E9F3A08,
+  0x9B9C3A08,
+  0x80973A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF3A08,
+  0xBABC3A08,
+  0xB4B43A08,
+  0xA9A93A08,
+  0x91913A08,
+  0x8D8D3A08,
+  0x81843A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB3BF3A08,
+  0xB0B03A08,
+  0xA2A53A08,
+  0x9F9F3A08,
+  0x809C3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF3A08,
+  0xBBBC3A08,
+  0x91913A08,
+  0x8D8D3A08,
+  0x80833A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B93A08,
+  0xA2A53A08,
+  0x979E3A08,
+  0x8F933A08,
+  0x808D3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF3A08,
+  0xBCBC3A08,
+  0xB2B23A08,
+  0x97993A08,
+  0x80843A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF3A08,
+  0x87A53A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB4BF3A08,
+  0xB1B13A08,
+  0x80803A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9ABF3A08,
+  0x878F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF3A08,
+  0xB4BC3A08,
+  0xB1B13A08,
+  0xA6A63A08,
+  0xA4A43A08,
+  0x8B8B3A08,
+  0x85853A08,
+  0x83833A08,
+  0x80803A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF3A08,
+  0x9A9B3A08,
+  0x878F3A08,
+  0x85853A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAABF3A08,
+  0x819F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xADBF3A08,
+  0x88883A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8DBF3A08,
+  0x80873A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xABBE3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1B43A08,
+  0xA7AD3A08,
+  0xA2A43A08,
+  0x9EA03A08,
+  0x96993A08,
+  0x8A8F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9A9F3A08,
+  0x8F8F3A08,
+  0x828D3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBB3A08,
+  0x8E8F3A08,
+  0x888C3A08,
+  0x86863A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9E9F3A08,
+  0x99993A08,
+  0x97973A08,
+  0x8E8F3A08,
+  0x89893A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF3A08,
+  0xB6B73A08,
+  0xB1B13A08,
+  0x8E8F3A08,
+  0x89893A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x97973A08,
+  0x86873A08,
+  0x81813A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x96973A08,
+  0x91913A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9BBF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x909F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF3A08,
+  0xB6B73A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80803A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xADAE3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9B9F3A08,
+  0x80803A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB9BF3A08,
+  0xABB03A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2BF3A08,
+  0x929E3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1BF3A08,
+  0xADAD3A08,
+  0x929F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB4BF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAABF3A08,
+  0x9D9F3A08,
+  0x989B3A08,
+  0x80963A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9A9F3A08,
+  0x808F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB9BF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xABAF3A08,
+  0xA9A93A08,
+  0x85863A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB6BF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9FBF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB5BF3A08,
+  0xAEAF3A08,
+  0x80853A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xACAF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9ABF3A08,
+  0x8A8F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x979F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x95BF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA8BF3A08,
+  0x9AA63A08,
+  0x8A8F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB4BF3A08,
+  0x80843A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9ABF3A08,
+  0x8D8F3A08,
+  0x80843A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA1AD3A08,
+  0x80823A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA6BF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA4BF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF3A08,
+  0x8A8C3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBC3A08,
+  0x898F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBF3A08,
+  0xB7B93A08,
+  0xB4B43A08,
+  0xADAD3A08,
+  0x80A83A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9E9F3A08,
+  0x96973A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF3A08,
+  0x9E9E3A08,
+  0x9C9C3A08,
+  0x9A9A3A08,
+  0x98983A08,
+  0x8E8F3A08,
+  0x86873A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF3A08,
+  0xBDBD3A08,
+  0xB5B53A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBF3A08,
+  0xB5B53A08,
+  0xADB13A08,
+  0x9C9F3A08,
+  0x94953A08,
+  0x8D8F3A08,
+  0x85853A08,
+  0x80813A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BE3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2BE3A08,
+  0x95B03A08,
+  0x81933A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9DBF3A08,
+  0x808F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABB3A08,
+  0xAEAE3A08,
+  0xA9A93A08,
+  0xA7A73A08,
+  0xA5A53A08,
+  0x9EA33A08,
+  0x96983A08,
+  0x94943A08,
+  0x88893A08,
+  0x83863A08,
+  0x80813A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8FBF3A08,
+  0x8A8D3A08,
+  0x80843A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x85BF3A08,
+  0x80823A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB4BF3A08,
+  0xAFB13A08,
+  0xA5AA3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAEAF3A08,
+  0xA8AC3A08,
+  0xA6A63A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF3A08,
+  0xA8AE3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF3A08,
+  0xB7B73A08,
+  0xAFAF3A08,
+  0xA7A73A08,
+  0x979F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9FBF3A08,
+  0x97973A08,
+  0x8F8F3A08,
+  0x87873A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF3A08,
+  0x80AE3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBF3A08,
+  0xB6BA3A08,
+  0x87B03A08,
+  0x80843A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0A03A08,
+  0x979C3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBB3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B03A08,
+  0x80843A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8F9F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80AF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8DBF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF3A08,
+  0x808F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xACBF3A08,
+  0x8D8F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFBE3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9E9F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0A13A08,
+  0x80963A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x898A3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9AB13A08,
+  0x94943A08,
+  0x92923A08,
+  0x8B8F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA3BF3A08,
+  0x8B8B3A08,
+  0x86863A08,
+  0x82823A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB4BF3A08,
+  0x80813A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF3A08,
+  0xBCBC3A08,
+  0xB8BA3A08,
+  0x9AB13A08,
+  0x808F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA6AF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBF3A08,
+  0x879F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB3BF3A08,
+  0x80833A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF3A08,
+  0xA5A53A08,
+  0x9A9F3A08,
+  0x808E3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA9BF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBD3A08,
+  0xB7B93A08,
+  0x9A9F3A08,
+  0x8C8F3A08,
+  0x83833A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF3A08,
+  0xB7B83A08,
+  0xB2B43A08,
+  0xB0B03A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB5BF3A08,
+  0xABB13A08,
+  0x9E9F3A08,
+  0x839A3A08,
+  0x81813A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFAF3A08,
+  0xA7A73A08,
+  0x979F3A08,
+  0x8F903A08,
+  0x87883A08,
+  0x80803A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAAAF3A08,
+  0x9B9B3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABF3A08,
+  0xA3AF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA4AF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBF3A08,
+  0x878A3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAEAF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9ABF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF3A08,
+  0xBDBD3A08,
+  0xB7B73A08,
+  0xA9A93A08,
+  0x9E9E3A08,
+  0x989C3A08,
+  0x87923A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x85853A08,
+  0x82823A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2BF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80923A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x808F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90913A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBF3A08,
+  0x88AF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB5BF3A08,
+  0x80B23A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB5B53A08,
+  0x90AF3A08,
+  0x808C3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBE3A08,
+  0x9AA03A08,
+  0x808F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9BA53A08,
+  0x80803A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9DBF3A08,
+  0x98993A08,
+  0x90913A08,
+  0x88893A08,
+  0x80813A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF45D0,
+  0xBEBE45CB,
+  0xBDBD45C6,
+  0xBCBC45C0,
+  0xBABA45BA,
+  0xB5BB3A48,
+  0xB4B445B4,
+  0xB2B345AF,
+  0xB1B13A73,
+  0xAEAE45AA,
+  0xADAD45A4,
+  0xACAC417D,
+  0xABAB459E,
+  0xAAAA4599,
+  0xA9A94593,
+  0xA8A8458B,
+  0xA6A64586,
+  0xA4A44580,
+  0xA3A34579,
+  0xA2A24182,
+  0xA1A14573,
+  0xA0A0456A,
+  0x9FAF3A48,
+  0x9E9E4563,
+  0x9D9D455D,
+  0x9C9C4558,
+  0x97973A48,
+  0x9696454D,
+  0x95954547,
+  0x94944542,
+  0x9393453C,
+  0x92924536,
+  0x8F8F4530,
+  0x8E8E4292,
+  0x8D8D4529,
+  0x8C8C4524,
+  0x8B8B451F,
+  0x8A8A451A,
+  0x84893A48,
+  0x83834515,
+  0x8181450F,
+  0x80804507,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBE46CF,
+  0xBBBB46C9,
+  0xB6B646C2,
+  0xB5B546B9,
+  0xB4B446B2,
+  0xB2B246AD,
+  0xB1B146A7,
+  0xB0B046A1,
+  0xABAB4171,
+  0xAAAA469B,
+  0xA9A94695,
+  0xA8A8468E,
+  0xA7A74687,
+  0xA6A64681,
+  0xA5A5467A,
+  0xA4A44671,
+  0xA3A3466C,
+  0xA2A23A7F,
+  0xA0A04667,
+  0x9D9D4662,
+  0x9C9C465C,
+  0x9B9B3FF3,
+  0x9A9A4656,
+  0x9999464F,
+  0x98984637,
+  0x97974649,
+  0x96964644,
+  0x9393463C,
+  0x92924637,
+  0x9191462F,
+  0x9090462A,
+  0x8D8D4623,
+  0x8C8C4047,
+  0x8B8B461D,
+  0x8A8A4614,
+  0x89BF3A48,
+  0x8888460E,
+  0x87874606,
+  0x86864600,
+  0x858545F7,
+  0x848445F1,
+  0x838345EA,
+  0x828245E4,
+  0x818145DC,
+  0x808045D6,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF46DA,
+  0xBEBE4344,
+  0x96BD3A48,
+  0x959546D5,
+  0x8F913A48,
+  0x8E8E431F,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x91BF3A48,
+  0x90904644,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9ABF3A48,
+  0x99994662,
+  0x808F3A48,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF46FE,
+  0xBEBE46F8,
+  0xBDBD46F2,
+  0xBABB3A48,
+  0xAFB83A48,
+  0xAEAE46AD,
+  0xADAD46EB,
+  0xACAC4637,
+  0xABAB46E5,
+  0xAAAA4373,
+  0xA9A946DF,
+  0xA8A84171,
+  0x809F3A48,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB5BF3A48,
+  0xB4B43A73,
+  0xB3B3470A,
+  0x9F9F4705,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF470F,
+  0x80BE3A48,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB3BF3A48,
+  0xB2B2472E,
+  0xB1B14728,
+  0x8CAF3A48,
+  0x8B8B4723,
+  0x8585471C,
+  0x84844717,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBC4182,
+  0xA0BF3A48,
+  0x9F9F4778,
+  0x9E9E4772,
+  0x9D9D476C,
+  0x9C9C4766,
+  0x9B9B475F,
+  0x9A9A475A,
+  0x95954753,
+  0x94944749,
+  0x93934744,
+  0x92924739,
+  0x91914734,
+  0x808F3A48,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABA47D0,
+  0xB9B947B8,
+  0xB8B847AB,
+  0xA6BF3A48,
+  0xA5A547A4,
+  0xA3A3479F,
+  0x9F9F4796,
+  0x8B8B4790,
+  0x8A8A478A,
+  0x85854784,
+  0x8484477E,
+  0x809E3A48,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFAF47D9,
+  0x80BF3A48,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9B9B47DF,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0A04292,
+  0x9C9C4171,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABA47E4,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF3A48,
+  0xAFAF47E9,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA9BF3A48,
+  0xA8A847EE,
+  0x809F3A48,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8EBF3A48,
+  0x8D8D47F3,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08002D95,
+  0x747447F8,
+  0x202033E8,
+  0x0BFF2D8F,
+  0x0AFFFFFF,
+  0x090933E8,
+  0x00082D8F,
+  0x08002D95,
+  0x737347FF,
+  0x202033E8,
+  0x0BFF2D8F,
+  0x0AFFFFFF,
+  0x090933E8,
+  0x00082D8F,
+  0x08002D95,
+  0x727239E9,
+  0x202033E8,
+  0x0BFF2D8F,
+  0x0AFFFFFF,
+  0x090933E8,
+  0x00082D8F,
+  0x08002D95,
+  0x74744806,
+  0x202033E8,
+  0x0BFF2D8F,
+  0x0AFFFFFF,
+  0x090933E8,
+  0x00082D8F,
+  0x08002D95,
+  0x6969446C,
+  0x202033E8,
+  0x0BFF2D8F,
+  0x0AFFFFFF,
+  0x090933E8,
+  0x00082D8F,
+  0x08002D95,
+  0x7272480D,
+  0x202033E8,
+  0x0BFF2D8F,
+  0x0AFFFFFF,
+  0x090933E8,
+  0x00082D8F,
+  0x08002D95,
+  0x69694814,
+  0x202033E8,
+  0x0BFF2D8F,
+  0x0AFFFFFF,
+  0x090933E8,
+  0x00082D8F,
+  0x6F6F481B,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x747420F6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x6C6C20F6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x63634821,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x72724827,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x7777482D,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xF4F4214B,
+  0xF1F32145,
+  0xF0F0213F,
+  0xEDED2139,
+  0xE1EF2133,
+  0xE0E0212D,
+  0xC2DF2127,
+  0x80FF0225,
+  0x686821C5,
+  0x292920F6,
+  0x20202151,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x09092151,
+  0x00081399,
+  0xF4F4214B,
+  0xF1F32145,
+  0xF0F0213F,
+  0xEDED2139,
+  0xE1EF2133,
+  0xE0E0212D,
+  0xC2DF2127,
+  0x80FF0225,
+  0x72724833,
+  0x292920F6,
+  0x20202151,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x09092151,
+  0x00081399,
+  0xF4F4214B,
+  0xF1F32145,
+  0xF0F0213F,
+  0xEDED2139,
+  0xE1EF2133,
+  0xE0E0212D,
+  0xC2DF2127,
+  0x80FF0225,
+  0x777721C5,
+  0x292920F6,
+  0x20202151,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x09092151,
+  0x00081399,
+  0x08001190,
+  0x73734842,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x61614847,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x7878484C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x72724851,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x6F6F4856,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBE3A08,
+  0xBBBB3A08,
+  0xA7A73A08,
+  0x8C8C3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9EBF3A08,
+  0x8E8F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9D9F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x91BF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0AC3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB6BF3A08,
+  0x8A8F3A08,
+  0x81813A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90BF3A08,
+  0x84873A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAAAF3A08,
+  0x9E9F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBF3A08,
+  0x94973A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA8AF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBB3A08,
+  0xA4AF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBF3A08,
+  0xBABA3A08,
+  0xB2B23A08,
+  0xA2A23A08,
+  0x96963A08,
+  0x93933A08,
+  0x8B8B3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB7BF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA8BF3A08,
+  0x969F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBF3A08,
+  0xB1B13A08,
+  0x86863A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBE3A08,
+  0xB9BB3A08,
+  0xB6B63A08,
+  0x89893A08,
+  0x86873A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB7BF3A08,
+  0x969F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB6BF3A08,
+  0xB3B33A08,
+  0x809F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABF3A08,
+  0x969F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8BD3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB6BF3A08,
+  0x98983A08,
+  0x94943A08,
+  0x818F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBF3A08,
+  0x809F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9DBF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA5BF3A08,
+  0x88883A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB3BF3A08,
+  0x969F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x92BF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB3BF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABF3A08,
+  0xA4AF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2BF3A08,
+  0xAAAF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA8AF3A08,
+  0x9DA63A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x86AF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x82AF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB7BF3A08,
+  0x859F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8BF3A08,
+  0x80823A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB6BF3A08,
+  0xB3B43A08,
+  0xB0B03A08,
+  0x80A53A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF3A08,
+  0x80823A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABF3A08,
+  0xA9AF3A08,
+  0x808F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA7B53A08,
+  0x80823A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB7BF3A08,
+  0xB3B53A08,
+  0x888F3A08,
+  0x85863A08,
+  0x80833A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB3BF3A08,
+  0x80823A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9DBF3A08,
+  0x9B9B3A08,
+  0x858F3A08,
+  0x80803A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xACBF3A08,
+  0x92923A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA9AF3A08,
+  0x9E9E3A08,
+  0x8E8E3A08,
+  0x89893A08,
+  0x87873A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABF3A08,
+  0x9FAF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA2BF3A08,
+  0x919C3A08,
+  0x808F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB5BF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA2BF3A08,
+  0x9A9E3A08,
+  0x8B8F3A08,
+  0x80863A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9ABF3A08,
+  0x888F3A08,
+  0x86863A08,
+  0x80833A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFBF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9CBF3A08,
+  0x80973A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9ABF3A08,
+  0x858F3A08,
+  0x80833A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB9BF3A08,
+  0xABB73A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABF3A08,
+  0x9BAF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x87BF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xACBF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAABE3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BE3A08,
+  0x97973A08,
+  0x94943A08,
+  0x8A8B3A08,
+  0x87883A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9ABF3A08,
+  0x828F3A08,
+  0x80803A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA8A93A08,
+  0x809F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA4BF3A08,
+  0xA2A23A08,
+  0x91A03A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBF3A08,
+  0xB3B93A08,
+  0x818A3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x919B3A08,
+  0x808F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9EAF3A08,
+  0x8A9C3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFBF3A08,
+  0x89893A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9AB13A08,
+  0x818F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90BF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1BF3A08,
+  0x8A8A3A08,
+  0x87873A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA9A93A08,
+  0xA6A63A08,
+  0x9A9F3A08,
+  0x878F3A08,
+  0x80853A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAABF3A08,
+  0x999F3A08,
+  0x8A973A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB3BF3A08,
+  0x809F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1BF3A08,
+  0x80AF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x84BF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1BF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAAAF3A08,
+  0x9F9F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAEBF3A08,
+  0x8A8F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8BC3A08,
+  0x9AA23A08,
+  0x848F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x91BF3A08,
+  0x8B8F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF3A08,
+  0x80923A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA4BF3A08,
+  0xA2A23A08,
+  0x809F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8BF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x96BF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF3A08,
+  0xBCBC3A08,
+  0xB4B43A08,
+  0x80AF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA3BF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA8AF3A08,
+  0x93A33A08,
+  0x808F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBF3A08,
+  0xABAF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9ABF3A08,
+  0x898F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x95953A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBC3A08,
+  0xBABA3A08,
+  0xADAD3A08,
+  0xA7A83A08,
+  0xA3A43A08,
+  0xA0A13A08,
+  0x9D9D3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x84843A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF3A08,
+  0xBABA3A08,
+  0x9D9D3A08,
+  0x95953A08,
+  0x8B8C3A08,
+  0x86863A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x91913A08,
+  0x87893A08,
+  0x85853A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA6A73A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBB3A08,
+  0x9B9B3A08,
+  0x81813A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB5B53A08,
+  0x95953A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFAF3A08,
+  0x8F8F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA9A93A08,
+  0x89893A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8C8D3A08,
+  0x83833A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF3A08,
+  0xADB63A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8FBF3A08,
+  0x8A8D3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAEBF3A08,
+  0x808F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABF3A08,
+  0xACAF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF3A08,
+  0xAFAF3A08,
+  0xACAC3A08,
+  0xA7A73A08,
+  0x809F3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x85BF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9ABF3A08,
+  0x8C8F3A08,
+  0x848A3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBF3A08,
+  0xBABA3A08,
+  0xB8B83A08,
+  0xB3B33A08,
+  0xA8A83A08,
+  0xA5A63A08,
+  0xA3A33A08,
+  0xA0A03A08,
+  0x84843A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF3A08,
+  0xBDBD3A08,
+  0xB8B83A08,
+  0xB3B33A08,
+  0xABAB3A08,
+  0xA5A63A08,
+  0xA3A33A08,
+  0xA0A03A08,
+  0x9E9E3A08,
+  0x9C9C3A08,
+  0x9A9A3A08,
+  0x98983A08,
+  0x95963A08,
+  0x93933A08,
+  0x90903A08,
+  0x8C8C3A08,
+  0x8A8A3A08,
+  0x88883A08,
+  0x83863A08,
+  0x80813A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBF3A08,
+  0xAAAA3A08,
+  0xA4A43A08,
+  0x9CA03A08,
+  0x8A8A3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABF3A08,
+  0x80AF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA2AF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA1BF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9EBF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8BBF3A08,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08002D95,
+  0x6363485B,
+  0x202033E8,
+  0x0BFF2D8F,
+  0x0AFFFFFF,
+  0x090933E8,
+  0x00082D8F,
+  0x08002D95,
+  0x656539E9,
+  0x202033E8,
+  0x0BFF2D8F,
+  0x0AFFFFFF,
+  0x090933E8,
+  0x00082D8F,
+  0x08002D95,
+  0x75754862,
+  0x202033E8,
+  0x0BFF2D8F,
+  0x0AFFFFFF,
+  0x090933E8,
+  0x00082D8F,
+  0x08002D95,
+  0x6F6F4869,
+  0x202033E8,
+  0x0BFF2D8F,
+  0x0AFFFFFF,
+  0x090933E8,
+  0x00082D8F,
+  0x08002D95,
+  0x6C6C47FF,
+  0x202033E8,
+  0x0BFF2D8F,
+  0x0AFFFFFF,
+  0x090933E8,
+  0x00082D8F,
+  0x77774870,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x65654877,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x6969487D,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x28281399,
+  0x20204883,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x09094883,
+  0x00080225,
+  0xF4F4214B,
+  0xF1F32145,
+  0xF0F0213F,
+  0xEDED2139,
+  0xE1EF2133,
+  0xE0E0212D,
+  0xC2DF2127,
+  0x80FF0225,
+  0x6E6E21C5,
+  0x292920F6,
+  0x20202151,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x09092151,
+  0x00081399,
+  0x08001190,
+  0x7474302E,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x6C6C302E,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x63634891,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x72724896,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x77774870,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08002D95,
+  0x686839E9,
+  0x202033E8,
+  0x0BFF2D8F,
+  0x0AFFFFFF,
+  0x090933E8,
+  0x00082D8F,
+  0x08002D95,
+  0x7272489B,
+  0x202033E8,
+  0x0BFF2D8F,
+  0x0AFFFFFF,
+  0x090933E8,
+  0x00082D8F,
+  0x08002D95,
+  0x777739E9,
+  0x202033E8,
+  0x0BFF2D8F,
+  0x0AFFFFFF,
+  0x090933E8,
+  0x00082D8F,
+  0x08001190,
+  0x282821C5,
+  0x20204870,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x09094870,
+  0x0008130E,
+  0x707044A3,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x646448A2,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x77770DC6,
+  0x74740DC0,
+  0x73730DBA,
+  0x72720DB4,
+  0x69690DAE,
+  0x66660DA8,
+  0x65650DA2,
+  0x63630D9C,
+  0x28281399,
+  0x20204883,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x09094883,
+  0x00080225,
+  0x08001190,
+  0x656548A8,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x696948AD,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08002D95,
+  0x6E6E39E9,
+  0x202033E8,
+  0x0BFF2D8F,
+  0x0AFFFFFF,
+  0x090933E8,
+  0x00082D8F,
+  0x656520F6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x08001190,
+  0x70704842,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x646448B2,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x6565302E,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+};
+
+const reflex::Pattern::Pred reflex_pred_pack0[4354] = {
+    0,  3,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15,  0, 15, 15, 15, 15, 15,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+   87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 23, 87, 87, 87, 87, 87,
+   87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+   87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+   87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+   87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+   87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+   87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+   87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+   87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+   87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+   87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+   87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+   87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+   87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+   87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+   87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 31, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 15,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+};
+
+#ifndef REFLEX_CODE_DECL
+#include <reflex/pattern.h>
+#define REFLEX_CODE_DECL const reflex::Pattern::Opcode
+#endif
+
+REFLEX_CODE_DECL reflex_code_pack1[11958] =
+{
+  0xF0F00155,
+  0xEFEF0142,
+  0xEDED013E,
+  0xEAEA0124,
+  0xE5EC0122,
+  0xE4E4011F,
+  0xE3E30115,
+  0xE2E20107,
+  0xE1E100D9,
+  0xE0E000B9,
+  0xDFDF00B5,
+  0xDEDE00B2,
+  0xDDDD00B0,
+  0xDCDC00AD,
+  0xDBDB00A7,
+  0xD9D900A2,
+  0xD8D800A0,
+  0xD7D7009D,
+  0xD6D6009B,
+  0xD5D50097,
+  0xD4D40094,
+  0xD2D20091,
+  0xD0DA007B,
+  0xCFCF008E,
+  0xCECE0088,
+  0xCDCD0083,
+  0xCBCB007D,
+  0xC4CA007B,
+  0xC3C30077,
+  0xC2C20073,
+  0x617A004E,
+  0x5F5F004E,
+  0x415A004E,
+  0x303A004E,
+  0x20200025,
+  0x09090025,
+  0x00FFFFFF,
+  0xF0F00155,
+  0xEFEF0142,
+  0xEDED013E,
+  0xEAEA0124,
+  0xE5EC0122,
+  0xE4E4011F,
+  0xE3E30115,
+  0xE2E20107,
+  0xE1E100D9,
+  0xE0E000B9,
+  0xDFDF00B5,
+  0xDEDE00B2,
+  0xDDDD00B0,
+  0xDCDC00AD,
+  0xDBDB00A7,
+  0xD9D900A2,
+  0xD8D800A0,
+  0xD7D7009D,
+  0xD6D6009B,
+  0xD5D50097,
+  0xD4D40094,
+  0xD2D20091,
+  0xD0DA007B,
+  0xCFCF008E,
+  0xCECE0088,
+  0xCDCD0083,
+  0xCBCB007D,
+  0xC4CA007B,
+  0xC3C30077,
+  0xC2C20073,
+  0x747401DC,
+  0x727201B6,
+  0x69690190,
+  0x6565016A,
+  0x617A004E,
+  0x5F5F004E,
+  0x415A004E,
+  0x303A004E,
+  0x20200025,
+  0x09090025,
+  0x00FFFFFF,
+  0xF0F00155,
+  0xEFEF0142,
+  0xEDED013E,
+  0xEAEA0124,
+  0xE5EC0122,
+  0xE4E4011F,
+  0xE3E30115,
+  0xE2E20107,
+  0xE1E100D9,
+  0xE0E000B9,
+  0xDFDF00B5,
+  0xDEDE00B2,
+  0xDDDD00B0,
+  0xDCDC00AD,
+  0xDBDB00A7,
+  0xD9D900A2,
+  0xD8D800A0,
+  0xD7D7009D,
+  0xD6D6009B,
+  0xD5D50097,
+  0xD4D40094,
+  0xD2D20091,
+  0xD0DA007B,
+  0xCFCF008E,
+  0xCECE0088,
+  0xCDCD0083,
+  0xCBCB007D,
+  0xC4CA007B,
+  0xC3C30077,
+  0xC2C20073,
+  0x617A004E,
+  0x5F5F004E,
+  0x415A004E,
+  0x303A004E,
+  0x20200202,
+  0x09090202,
+  0x00FFFFFF,
+  0xBABA004E,
+  0xB5B5004E,
+  0xAAAA004E,
+  0x00FFFFFF,
+  0xB8BF004E,
+  0x98B6004E,
+  0x8096004E,
+  0x00FFFFFF,
+  0x80BF004E,
+  0x00FFFFFF,
+  0xAEAE004E,
+  0xACAC004E,
+  0xA0A4004E,
+  0x8691004E,
+  0x8081004E,
+  0x00FFFFFF,
+  0xBFBF004E,
+  0xBABD004E,
+  0xB6B7004E,
+  0xB0B4004E,
+  0x00FFFFFF,
+  0xA3BF004E,
+  0x8EA1004E,
+  0x8C8C004E,
+  0x888A004E,
+  0x8686004E,
+  0x00FFFFFF,
+  0xB7BF004E,
+  0x80B5004E,
+  0x00FFFFFF,
+  0x8ABF004E,
+  0x8081004E,
+  0x00FFFFFF,
+  0xB1BF004E,
+  0x80AF004E,
+  0x00FFFFFF,
+  0xA0BF004E,
+  0x9999004E,
+  0x8096004E,
+  0x00FFFFFF,
+  0x8088004E,
+  0x00FFFFFF,
+  0xAFB2004E,
+  0x90AA004E,
+  0x00FFFFFF,
+  0xA0BF004E,
+  0x00FFFFFF,
+  0xB1BF004E,
+  0xAEAF004E,
+  0xA0A9004E,
+  0x808A004E,
+  0x00FFFFFF,
+  0xBFBF004E,
+  0xAEBC004E,
+  0xA5A6004E,
+  0x9595004E,
+  0x8093004E,
+  0x00FFFFFF,
+  0x92AF004E,
+  0x9090004E,
+  0x00FFFFFF,
+  0x8DBF004E,
+  0x00FFFFFF,
+  0xB1B1004E,
+  0x80A5004E,
+  0x00FFFFFF,
+  0xBABA004E,
+  0xB4B5004E,
+  0x80AA004E,
+  0x00FFFFFF,
+  0xBEBE02C8,
+  0xBDBD02C5,
+  0xBCBC02C2,
+  0xBBBB02BD,
+  0xBABA02B4,
+  0xB9B902B1,
+  0xB8B802AE,
+  0xB7B702AB,
+  0xB6B602A6,
+  0xB5B502A0,
+  0xB4B4029B,
+  0xB3B30296,
+  0xB2B2028E,
+  0xB1B10289,
+  0xB0B00283,
+  0xAFAF0280,
+  0xAEAE0275,
+  0xADAD0270,
+  0xACAC0268,
+  0xABAB0263,
+  0xAAAA025B,
+  0xA9A90256,
+  0xA8A8024E,
+  0xA7A70248,
+  0xA6A6023F,
+  0xA5A5023A,
+  0xA4A40237,
+  0xA3A30235,
+  0xA2A20231,
+  0xA1A1022D,
+  0xA0A00228,
+  0x00FFFFFF,
+  0xBFBF035E,
+  0xBEBE035A,
+  0xBDBD0352,
+  0xBCBC034E,
+  0xB8BB007B,
+  0xB4B6007B,
+  0xB3B30349,
+  0xB2B20345,
+  0xB1B10342,
+  0xB0B00340,
+  0xAFAF033E,
+  0xAEAE033B,
+  0xADAD0338,
+  0xACAC0336,
+  0xAAAA0332,
+  0xA9A90330,
+  0xA8A8032D,
+  0xA7A7032A,
+  0xA6A60327,
+  0xA5A50324,
+  0xA4A40322,
+  0xA3A30320,
+  0xA2A2031B,
+  0xA1A10319,
+  0xA0A00316,
+  0x9F9F0312,
+  0x9E9E0310,
+  0x9D9D030C,
+  0x9C9C0309,
+  0x9B9B0306,
+  0x9A9A0303,
+  0x99990300,
+  0x909002FE,
+  0x8F8F02FB,
+  0x8E8E02F8,
+  0x8D8D02F6,
+  0x8C8C02F2,
+  0x8B8B02ED,
+  0x8A8A02E7,
+  0x898902E0,
+  0x8498007B,
+  0x838302DA,
+  0x828202D5,
+  0x818102CD,
+  0x808002CA,
+  0x00FFFFFF,
+  0xB8B80397,
+  0xB7B70392,
+  0xB6B6038C,
+  0xB5B50389,
+  0xB4B40384,
+  0xB3B30380,
+  0xB0B2007B,
+  0x8686037E,
+  0x8585037B,
+  0x8484036F,
+  0x8282036D,
+  0x81810368,
+  0x80800366,
+  0x00FFFFFF,
+  0x90BF007B,
+  0x878703AA,
+  0x868603A7,
+  0x8585007B,
+  0x848403A4,
+  0x838303A1,
+  0x8282039D,
+  0x818102FE,
+  0x80800399,
+  0x00FFFFFF,
+  0xB8BF007B,
+  0x80B6007B,
+  0x00FFFFFF,
+  0x80BF007B,
+  0x00FFFFFF,
+  0xAFAF03FC,
+  0xADAD03F8,
+  0xACAC03F1,
+  0xABAB03EB,
+  0xAAAA03E6,
+  0xA9A903DF,
+  0xA8A803DD,
+  0xA7A703D9,
+  0xA6A603D7,
+  0xA5A503D4,
+  0xA4A403D1,
+  0xA3A303CC,
+  0xA2A203CA,
+  0xA1A10310,
+  0xA0A003C5,
+  0x9F9F03BF,
+  0x9E9E03BC,
+  0x9C9C03B9,
+  0x9B9B033E,
+  0x9A9A03B6,
+  0x999903B3,
+  0x989803B0,
+  0x939303AE,
+  0x929203AC,
+  0x80BF007B,
+  0x00FFFFFF,
+  0x9F9F0402,
+  0x9E9E03FF,
+  0x809D007B,
+  0x00FFFFFF,
+  0xBFBF0435,
+  0xBEBE0433,
+  0xBDBD0430,
+  0xBCBC042C,
+  0xBBBB042A,
+  0xB9B90426,
+  0xB8B80424,
+  0xB7B70421,
+  0xB6B6041E,
+  0xB5B5041C,
+  0xB4B4041A,
+  0xAFAF0418,
+  0xAEAE0416,
+  0xADAD0412,
+  0xACAC040A,
+  0xABAB0408,
+  0xA9A90405,
+  0xA4BA007B,
+  0x00FFFFFF,
+  0xB1B104E8,
+  0xAFAF04E5,
+  0xAEAE04E2,
+  0xACAC04DF,
+  0xABAB04DB,
+  0xAAAA04D8,
+  0xA0B00122,
+  0x9F9F04D6,
+  0x9E9E04CA,
+  0x9D9D04BC,
+  0x9B9B04B4,
+  0x9A9A04B2,
+  0x989804AD,
+  0x97970122,
+  0x9696049F,
+  0x9494049C,
+  0x93930499,
+  0x92920492,
+  0x91910465,
+  0x9090043A,
+  0x00FFFFFF,
+  0xF0F00155,
+  0xEFEF0142,
+  0xEDED013E,
+  0xEAEA0124,
+  0xE5EC0122,
+  0xE4E4011F,
+  0xE3E30115,
+  0xE2E20107,
+  0xE1E100D9,
+  0xE0E000B9,
+  0xDFDF00B5,
+  0xDEDE00B2,
+  0xDDDD00B0,
+  0xDCDC00AD,
+  0xDBDB00A7,
+  0xD9D900A2,
+  0xD8D800A0,
+  0xD7D7009D,
+  0xD6D6009B,
+  0xD5D50097,
+  0xD4D40094,
+  0xD2D20091,
+  0xD0DA007B,
+  0xCFCF008E,
+  0xCECE0088,
+  0xCDCD0083,
+  0xCBCB007D,
+  0xC4CA007B,
+  0xC3C30077,
+  0xC2C20073,
+  0x6C6C04EB,
+  0x617A004E,
+  0x5F5F004E,
+  0x415A004E,
+  0x303A004E,
+  0x20200202,
+  0x09090202,
+  0x00FFFFFF,
+  0xF0F00155,
+  0xEFEF0142,
+  0xEDED013E,
+  0xEAEA0124,
+  0xE5EC0122,
+  0xE4E4011F,
+  0xE3E30115,
+  0xE2E20107,
+  0xE1E100D9,
+  0xE0E000B9,
+  0xDFDF00B5,
+  0xDEDE00B2,
+  0xDDDD00B0,
+  0xDCDC00AD,
+  0xDBDB00A7,
+  0xD9D900A2,
+  0xD8D800A0,
+  0xD7D7009D,
+  0xD6D6009B,
+  0xD5D50097,
+  0xD4D40094,
+  0xD2D20091,
+  0xD0DA007B,
+  0xCFCF008E,
+  0xCECE0088,
+  0xCDCD0083,
+  0xCBCB007D,
+  0xC4CA007B,
+  0xC3C30077,
+  0xC2C20073,
+  0x66660511,
+  0x617A004E,
+  0x5F5F004E,
+  0x415A004E,
+  0x303A004E,
+  0x20200202,
+  0x09090202,
+  0x00FFFFFF,
+  0xF0F00155,
+  0xEFEF0142,
+  0xEDED013E,
+  0xEAEA0124,
+  0xE5EC0122,
+  0xE4E4011F,
+  0xE3E30115,
+  0xE2E20107,
+  0xE1E100D9,
+  0xE0E000B9,
+  0xDFDF00B5,
+  0xDEDE00B2,
+  0xDDDD00B0,
+  0xDCDC00AD,
+  0xDBDB00A7,
+  0xD9D900A2,
+  0xD8D800A0,
+  0xD7D7009D,
+  0xD6D6009B,
+  0xD5D50097,
+  0xD4D40094,
+  0xD2D20091,
+  0xD0DA007B,
+  0xCFCF008E,
+  0xCECE0088,
+  0xCDCD0083,
+  0xCBCB007D,
+  0xC4CA007B,
+  0xC3C30077,
+  0xC2C20073,
+  0x65650536,
+  0x617A004E,
+  0x5F5F004E,
+  0x415A004E,
+  0x303A004E,
+  0x20200202,
+  0x09090202,
+  0x00FFFFFF,
+  0xF0F00155,
+  0xEFEF0142,
+  0xEDED013E,
+  0xEAEA0124,
+  0xE5EC0122,
+  0xE4E4011F,
+  0xE3E30115,
+  0xE2E20107,
+  0xE1E100D9,
+  0xE0E000B9,
+  0xDFDF00B5,
+  0xDEDE00B2,
+  0xDDDD00B0,
+  0xDCDC00AD,
+  0xDBDB00A7,
+  0xD9D900A2,
+  0xD8D800A0,
+  0xD7D7009D,
+  0xD6D6009B,
+  0xD5D50097,
+  0xD4D40094,
+  0xD2D20091,
+  0xD0DA007B,
+  0xCFCF008E,
+  0xCECE0088,
+  0xCDCD0083,
+  0xCBCB007D,
+  0xC4CA007B,
+  0xC3C30077,
+  0xC2C20073,
+  0x6868055C,
+  0x617A004E,
+  0x5F5F004E,
+  0x415A004E,
+  0x303A004E,
+  0x20200202,
+  0x09090202,
+  0x00FFFFFF,
+  0xF0F00664,
+  0xEFEF0651,
+  0xEDED064D,
+  0xEAEA0633,
+  0xE5EC0631,
+  0xE4E4062E,
+  0xE3E30624,
+  0xE2E20616,
+  0xE1E105E8,
+  0xE0E005C8,
+  0xDFDF05C4,
+  0xDEDE05C1,
+  0xDDDD05BF,
+  0xDCDC05BC,
+  0xDBDB05B6,
+  0xD9D905B1,
+  0xD8D805AF,
+  0xD7D705AC,
+  0xD6D605AA,
+  0xD5D505A6,
+  0xD4D405A3,
+  0xD2D205A0,
+  0xD0DA058A,
+  0xCFCF059D,
+  0xCECE0597,
+  0xCDCD0592,
+  0xCBCB058C,
+  0xC4CA058A,
+  0xC3C30586,
+  0xC2C20582,
+  0x617A0679,
+  0x5F5F0679,
+  0x415A0679,
+  0x3A3A004E,
+  0x30390679,
+  0x20200202,
+  0x09090202,
+  0x00FFFFFF,
+  0xA8A8004E,
+  0xA4A4004E,
+  0x9A9A004E,
+  0x8095004E,
+  0x00FFFFFF,
+  0xB0BF004E,
+  0xA0AA004E,
+  0x8098004E,
+  0x00FFFFFF,
+  0xA0BF004E,
+  0x898E004E,
+  0x8087004E,
+  0x00FFFFFF,
+  0x8089004E,
+  0x00FFFFFF,
+  0xBDBD004E,
+  0x84B9004E,
+  0x00FFFFFF,
+  0xB1BF004E,
+  0xA6AF004E,
+  0x98A1004E,
+  0x9090004E,
+  0x00FFFFFF,
+  0xBDBD004E,
+  0xB6B9004E,
+  0xB2B2004E,
+  0xAAB0004E,
+  0x93A8004E,
+  0x8F90004E,
+  0x858C004E,
+  0x8080004E,
+  0x00FFFFFF,
+  0xBCBC004E,
+  0xA6B1004E,
+  0x9FA1004E,
+  0x9C9D004E,
+  0x8E8E004E,
+  0x00FFFFFF,
+  0xB8B9004E,
+  0xB5B6004E,
+  0xB2B3004E,
+  0xAAB0004E,
+  0x93A8004E,
+  0x8F90004E,
+  0x858A004E,
+  0x00FFFFFF,
+  0xB2B4004E,
+  0xA6AF004E,
+  0x9E9E004E,
+  0x999C004E,
+  0x00FFFFFF,
+  0xBDBD004E,
+  0xB5B9004E,
+  0xB2B3004E,
+  0xAAB0004E,
+  0x93A8004E,
+  0x8F91004E,
+  0x858D004E,
+  0x00FFFFFF,
+  0xB9B9004E,
+  0xA6AF004E,
+  0xA0A1004E,
+  0x9090004E,
+  0x00FFFFFF,
+  0xBDBD004E,
+  0xB5B9004E,
+  0xB2B3004E,
+  0xAAB0004E,
+  0x93A8004E,
+  0x8F90004E,
+  0x858C004E,
+  0x00FFFFFF,
+  0xB1B1004E,
+  0xA6AF004E,
+  0x9FA1004E,
+  0x9C9D004E,
+  0x00FFFFFF,
+  0xAEB9004E,
+  0xA8AA004E,
+  0xA3A4004E,
+  0x9E9F004E,
+  0x9C9C004E,
+  0x999A004E,
+  0x9295004E,
+  0x8E90004E,
+  0x858A004E,
+  0x8383004E,
+  0x00FFFFFF,
+  0xA6AF004E,
+  0x9090004E,
+  0x00FFFFFF,
+  0xBDBD004E,
+  0xAAB9004E,
+  0x92A8004E,
+  0x8E90004E,
+  0x858C004E,
+  0x00FFFFFF,
+  0xA6AF004E,
+  0xA0A1004E,
+  0x9D9D004E,
+  0x989A004E,
+  0x00FFFFFF,
+  0xBDBD004E,
+  0xB5B9004E,
+  0xAAB3004E,
+  0x92A8004E,
+  0x8E90004E,
+  0x858C004E,
+  0x8080004E,
+  0x00FFFFFF,
+  0xB1B2004E,
+  0xA6AF004E,
+  0xA0A1004E,
+  0x9D9E004E,
+  0x00FFFFFF,
+  0xBDBD004E,
+  0x92BA004E,
+  0x8E90004E,
+  0x848C004E,
+  0x00FFFFFF,
+  0xBABF004E,
+  0xA6AF004E,
+  0x9FA1004E,
+  0x9496004E,
+  0x8E8E004E,
+  0x00FFFFFF,
+  0xBDBD004E,
+  0xB3BB004E,
+  0x9AB1004E,
+  0x8596004E,
+  0x00FFFFFF,
+  0xA6AF004E,
+  0x8086004E,
+  0x00FFFFFF,
+  0xB2B3004E,
+  0x81B0004E,
+  0x00FFFFFF,
+  0x9099004E,
+  0x8086004E,
+  0x00FFFFFF,
+  0xBDBD004E,
+  0xB2B3004E,
+  0xA7B0004E,
+  0xA5A5004E,
+  0x8CA3004E,
+  0x868A004E,
+  0x8484004E,
+  0x8182004E,
+  0x00FFFFFF,
+  0x9C9F004E,
+  0x9099004E,
+  0x8686004E,
+  0x8084004E,
+  0x00FFFFFF,
+  0xA0A9004E,
+  0x8080004E,
+  0x00FFFFFF,
+  0x89AC004E,
+  0x8087004E,
+  0x00FFFFFF,
+  0x888C004E,
+  0x00FFFFFF,
+  0xBFBF004E,
+  0x80AA004E,
+  0x00FFFFFF,
+  0xB5BF004E,
+  0xAEB0004E,
+  0xA5A6004E,
+  0xA1A1004E,
+  0x9A9D004E,
+  0x9095004E,
+  0x8089004E,
+  0x00FFFFFF,
+  0xA0BF004E,
+  0x9099004E,
+  0x8E8E004E,
+  0x8081004E,
+  0x00FFFFFF,
+  0xBCBF004E,
+  0x90BA004E,
+  0x8D8D004E,
+  0x8787004E,
+  0x8085004E,
+  0x00FFFFFF,
+  0xA0BF004E,
+  0x9A9D004E,
+  0x9898004E,
+  0x9096004E,
+  0x8A8D004E,
+  0x8088004E,
+  0x00FFFFFF,
+  0xB8BE004E,
+  0xB2B5004E,
+  0x90B0004E,
+  0x8A8D004E,
+  0x8088004E,
+  0x00FFFFFF,
+  0x98BF004E,
+  0x8896004E,
+  0x8285004E,
+  0x8080004E,
+  0x00FFFFFF,
+  0x98BF004E,
+  0x9295004E,
+  0x8090004E,
+  0x00FFFFFF,
+  0x809A004E,
+  0x00FFFFFF,
+  0xA0BF004E,
+  0x808F004E,
+  0x00FFFFFF,
+  0xB8BD004E,
+  0x80B5004E,
+  0x00FFFFFF,
+  0x81BF004E,
+  0x00FFFFFF,
+  0xAFBF004E,
+  0x80AC004E,
+  0x00FFFFFF,
+  0xA0BF004E,
+  0x819A004E,
+  0x00FFFFFF,
+  0xB1B8004E,
+  0x80AA004E,
+  0x00FFFFFF,
+  0x9FB1004E,
+  0x8091004E,
+  0x00FFFFFF,
+  0xAEB0004E,
+  0xA0AC004E,
+  0x8091004E,
+  0x00FFFFFF,
+  0x80B3004E,
+  0x00FFFFFF,
+  0xA0A9004E,
+  0x9C9C004E,
+  0x9797004E,
+  0x00FFFFFF,
+  0xA0BF004E,
+  0x9099004E,
+  0x00FFFFFF,
+  0x80B8004E,
+  0x00FFFFFF,
+  0xB0BF004E,
+  0xAAAA004E,
+  0x87A8004E,
+  0x8084004E,
+  0x00FFFFFF,
+  0x80B5004E,
+  0x00FFFFFF,
+  0x809E004E,
+  0x00FFFFFF,
+  0xB0B4004E,
+  0x86AD004E,
+  0x00FFFFFF,
+  0xB0BF004E,
+  0x80AB004E,
+  0x00FFFFFF,
+  0x9099004E,
+  0x8089004E,
+  0x00FFFFFF,
+  0xA0BF004E,
+  0x8096004E,
+  0x00FFFFFF,
+  0x8094004E,
+  0x00FFFFFF,
+  0xA7A7004E,
+  0x9099004E,
+  0x8089004E,
+  0x00FFFFFF,
+  0x85B3004E,
+  0x00FFFFFF,
+  0x9099004E,
+  0x858C004E,
+  0x00FFFFFF,
+  0xAEBF004E,
+  0x83A0004E,
+  0x00FFFFFF,
+  0x80A5004E,
+  0x00FFFFFF,
+  0x80A3004E,
+  0x00FFFFFF,
+  0x8DBD004E,
+  0x8089004E,
+  0x00FFFFFF,
+  0xBDBF004E,
+  0x90BA004E,
+  0x8088004E,
+  0x00FFFFFF,
+  0xBABA004E,
+  0xB5B6004E,
+  0xAEB3004E,
+  0xA9AC004E,
+  0x00FFFFFF,
+  0xA0BF004E,
+  0x989D004E,
+  0x8095004E,
+  0x00FFFFFF,
+  0x9FBD004E,
+  0x9D9D004E,
+  0x9B9B004E,
+  0x9999004E,
+  0x9097004E,
+  0x888D004E,
+  0x8085004E,
+  0x00FFFFFF,
+  0xBEBE004E,
+  0xB6BC004E,
+  0x80B4004E,
+  0x00FFFFFF,
+  0xB6BC004E,
+  0xB2B4004E,
+  0xA0AC004E,
+  0x969B004E,
+  0x9093004E,
+  0x868C004E,
+  0x8284004E,
+  0x00FFFFFF,
+  0xBFBF004E,
+  0x00FFFFFF,
+  0xBFBF004E,
+  0xB1B1004E,
+  0x9494004E,
+  0x8080004E,
+  0x00FFFFFF,
+  0x909C004E,
+  0x00FFFFFF,
+  0xBCBF004E,
+  0xAFB9004E,
+  0xAAAD004E,
+  0xA8A8004E,
+  0xA6A6004E,
+  0xA4A4004E,
+  0x999D004E,
+  0x9595004E,
+  0x8A93004E,
+  0x8787004E,
+  0x8282004E,
+  0x00FFFFFF,
+  0x8E8E004E,
+  0x8589004E,
+  0x00FFFFFF,
+  0x8384004E,
+  0x00FFFFFF,
+  0xB2B3004E,
+  0xABAE004E,
+  0x80A4004E,
+  0x00FFFFFF,
+  0xB0BF004E,
+  0xADAD004E,
+  0xA7A7004E,
+  0x80A5004E,
+  0x00FFFFFF,
+  0xAFAF004E,
+  0x80A7004E,
+  0x00FFFFFF,
+  0xB8BE004E,
+  0xB0B6004E,
+  0xA8AE004E,
+  0xA0A6004E,
+  0x8096004E,
+  0x00FFFFFF,
+  0x989E004E,
+  0x9096004E,
+  0x888E004E,
+  0x8086004E,
+  0x00FFFFFF,
+  0xAFAF004E,
+  0x00FFFFFF,
+  0xBBBC004E,
+  0xB1B5004E,
+  0x8586004E,
+  0x00FFFFFF,
+  0xA1BF004E,
+  0x9D9F004E,
+  0x8096004E,
+  0x00FFFFFF,
+  0xBCBF004E,
+  0x80BA004E,
+  0x00FFFFFF,
+  0xB1BF004E,
+  0x85AF004E,
+  0x00FFFFFF,
+  0xA0BF004E,
+  0x808E004E,
+  0x00FFFFFF,
+  0xB0BF004E,
+  0x00FFFFFF,
+  0x808C004E,
+  0x00FFFFFF,
+  0x90BD004E,
+  0x00FFFFFF,
+  0x90AB004E,
+  0x808C004E,
+  0x00FFFFFF,
+  0xBFBF004E,
+  0x80AE004E,
+  0x00FFFFFF,
+  0xA0BF004E,
+  0x809D004E,
+  0x00FFFFFF,
+  0xA2BF004E,
+  0x979F004E,
+  0x00FFFFFF,
+  0x8BBF004E,
+  0x8088004E,
+  0x00FFFFFF,
+  0xB2BF004E,
+  0x9599004E,
+  0x9393004E,
+  0x9091004E,
+  0x808A004E,
+  0x00FFFFFF,
+  0x8CA2004E,
+  0x878A004E,
+  0x8385004E,
+  0x8081004E,
+  0x00FFFFFF,
+  0x82B3004E,
+  0x00FFFFFF,
+  0xBDBE004E,
+  0xBBBB004E,
+  0xB2B7004E,
+  0x9099004E,
+  0x00FFFFFF,
+  0xB0BF004E,
+  0x80A5004E,
+  0x00FFFFFF,
+  0xA0BC004E,
+  0x8086004E,
+  0x00FFFFFF,
+  0x84B2004E,
+  0x00FFFFFF,
+  0xA6BE004E,
+  0xA0A4004E,
+  0x8F99004E,
+  0x00FFFFFF,
+  0x80A8004E,
+  0x00FFFFFF,
+  0xBEBF004E,
+  0xBABA004E,
+  0xA0B6004E,
+  0x9099004E,
+  0x848B004E,
+  0x8082004E,
+  0x00FFFFFF,
+  0xB9BD004E,
+  0xB5B6004E,
+  0xB1B1004E,
+  0x80AF004E,
+  0x00FFFFFF,
+  0xB2B4004E,
+  0xA0AA004E,
+  0x9B9D004E,
+  0x8282004E,
+  0x8080004E,
+  0x00FFFFFF,
+  0xB0BF004E,
+  0xA8AE004E,
+  0xA0A6004E,
+  0x9196004E,
+  0x898E004E,
+  0x8186004E,
+  0x00FFFFFF,
+  0xB0BF004E,
+  0x9CA9004E,
+  0x809A004E,
+  0x00FFFFFF,
+  0xB0B9004E,
+  0x80A2004E,
+  0x00FFFFFF,
+  0xB0BF004E,
+  0x80A3004E,
+  0x00FFFFFF,
+  0x8BBB004E,
+  0x8086004E,
+  0x00FFFFFF,
+  0xB0BF004E,
+  0x80AD004E,
+  0x00FFFFFF,
+  0x8099004E,
+  0x00FFFFFF,
+  0xBEBE004E,
+  0xB8BC004E,
+  0xAAB6004E,
+  0x9FA8004E,
+  0x9D9D004E,
+  0x9397004E,
+  0x8086004E,
+  0x00FFFFFF,
+  0x86BF004E,
+  0x8384004E,
+  0x8081004E,
+  0x00FFFFFF,
+  0x80B1004E,
+  0x00FFFFFF,
+  0x93BF004E,
+  0x00FFFFFF,
+  0x80BD004E,
+  0x00FFFFFF,
+  0x90BF004E,
+  0x00FFFFFF,
+  0x92BF004E,
+  0x808F004E,
+  0x00FFFFFF,
+  0xB0BB004E,
+  0x8087004E,
+  0x00FFFFFF,
+  0xB3B4004E,
+  0x00FFFFFF,
+  0xB6BF004E,
+  0xB0B4004E,
+  0x8D8F004E,
+  0x00FFFFFF,
+  0x80BC004E,
+  0x00FFFFFF,
+  0xBFBF004E,
+  0xA1BA004E,
+  0x9099004E,
+  0x00FFFFFF,
+  0xA6BF004E,
+  0x819A004E,
+  0x00FFFFFF,
+  0x80BE004E,
+  0x00FFFFFF,
+  0x9A9C004E,
+  0x9297004E,
+  0x8A8F004E,
+  0x8287004E,
+  0x00FFFFFF,
+  0xBFBF070F,
+  0xBEBE070C,
+  0xBDBD0709,
+  0xBCBC0705,
+  0xBABA0702,
+  0xB4B406FF,
+  0xB2B306FD,
+  0xB1B1009B,
+  0xB0B0007B,
+  0xAEAE06FB,
+  0xADAD06F8,
+  0xACAC0320,
+  0xABAB06F5,
+  0xAAAA06F3,
+  0xA9A906F1,
+  0xA8A806EC,
+  0xA6A606E9,
+  0xA4A406E6,
+  0xA3A306E3,
+  0xA2A20322,
+  0xA1A106E0,
+  0xA0A006D9,
+  0x9E9E06D5,
+  0x9D9D06D2,
+  0x9C9C06D0,
+  0x989B007B,
+  0x969606C8,
+  0x959506C4,
+  0x949406C1,
+  0x939306BE,
+  0x929206BA,
+  0x9091007B,
+  0x8F8F06B7,
+  0x8E8E03B6,
+  0x8D8D06B3,
+  0x8C8C06B0,
+  0x8B8B06AE,
+  0x8A8A06AB,
+  0x838306A9,
+  0x8282007B,
+  0x818106A6,
+  0x808006A0,
+  0x00FFFFFF,
+  0xBEBE0790,
+  0xBBBB078E,
+  0xB6B6078A,
+  0xB5B50784,
+  0xB4B40780,
+  0xB2B2077E,
+  0xB1B1077A,
+  0xB0B00777,
+  0xABAB0319,
+  0xAAAA0773,
+  0xA9A90770,
+  0xA8A8076C,
+  0xA7A70768,
+  0xA6A60765,
+  0xA5A50762,
+  0xA4A4075B,
+  0xA3A30758,
+  0xA2A200A0,
+  0xA0A00756,
+  0x9D9D0754,
+  0x9C9C0751,
+  0x9B9B0235,
+  0x9A9A074E,
+  0x9999074B,
+  0x98980741,
+  0x97970749,
+  0x96960747,
+  0x93930743,
+  0x92920741,
+  0x9191073D,
+  0x9090073B,
+  0x8D8D0738,
+  0x8C8C0268,
+  0x8B8B0735,
+  0x8A8A072E,
+  0x8888072B,
+  0x87870727,
+  0x86860725,
+  0x85850720,
+  0x8484071D,
+  0x8383071A,
+  0x82820718,
+  0x81810714,
+  0x80800712,
+  0x00FFFFFF,
+  0xBFBF0794,
+  0xBEBE041C,
+  0x95950792,
+  0x9294007B,
+  0x8E8E0408,
+  0x808D007B,
+  0x00FFFFFF,
+  0x90900747,
+  0x808F007B,
+  0x00FFFFFF,
+  0x99990754,
+  0x9098007B,
+  0x00FFFFFF,
+  0xBFBF07A7,
+  0xBEBE07A5,
+  0xBDBD07A2,
+  0xBCBC007B,
+  0xB9B9007B,
+  0xAEAE077E,
+  0xADAD079D,
+  0xACAC0741,
+  0xABAB079A,
+  0xAAAA0433,
+  0xA9A90796,
+  0xA8A80319,
+  0xA0A7007B,
+  0x00FFFFFF,
+  0xB4B4009B,
+  0xB3B307AC,
+  0x9F9F07AA,
+  0x80B2007B,
+  0x00FFFFFF,
+  0xBFBF07AE,
+  0x00FFFFFF,
+  0xB2B207BD,
+  0xB1B107BA,
+  0xB0B0007B,
+  0x8B8B07B8,
+  0x858507B4,
+  0x848407B2,
+  0x808A007B,
+  0x00FFFFFF,
+  0xBCBC0322,
+  0x9F9F07EF,
+  0x9E9E07EB,
+  0x9D9D07E7,
+  0x9C9C07E3,
+  0x9B9B07DE,
+  0x9A9A07DB,
+  0x959507D6,
+  0x949407CF,
+  0x939307CC,
+  0x929207C3,
+  0x919107C0,
+  0x9099007B,
+  0x00FFFFFF,
+  0xBABA0827,
+  0xB9B90813,
+  0xB8B80809,
+  0xA5A50805,
+  0xA3A30803,
+  0xA0A4007B,
+  0x9F9F07FE,
+  0x8B8B07FB,
+  0x8A8A07F9,
+  0x858507F6,
+  0x848407F3,
+  0x00FFFFFF,
+  0xAFAF082D,
+  0x00FFFFFF,
+  0x9B9B082F,
+  0x80BF007B,
+  0x00FFFFFF,
+  0xA0A003B6,
+  0x9C9C0319,
+  0x80BF007B,
+  0x00FFFFFF,
+  0xBABA0831,
+  0x80BF007B,
+  0x00FFFFFF,
+  0xAFAF0834,
+  0x80AE007B,
+  0x00FFFFFF,
+  0xA8A80836,
+  0xA0A7007B,
+  0x00FFFFFF,
+  0x8D8D0838,
+  0x808C007B,
+  0x00FFFFFF,
+  0xF0F00155,
+  0xEFEF0142,
+  0xEDED013E,
+  0xEAEA0124,
+  0xE5EC0122,
+  0xE4E4011F,
+  0xE3E30115,
+  0xE2E20107,
+  0xE1E100D9,
+  0xE0E000B9,
+  0xDFDF00B5,
+  0xDEDE00B2,
+  0xDDDD00B0,
+  0xDCDC00AD,
+  0xDBDB00A7,
+  0xD9D900A2,
+  0xD8D800A0,
+  0xD7D7009D,
+  0xD6D6009B,
+  0xD5D50097,
+  0xD4D40094,
+  0xD2D20091,
+  0xD0DA007B,
+  0xCFCF008E,
+  0xCECE0088,
+  0xCDCD0083,
+  0xCBCB007D,
+  0xC4CA007B,
+  0xC3C30077,
+  0xC2C20073,
+  0x7373083A,
+  0x617A004E,
+  0x5F5F004E,
+  0x415A004E,
+  0x303A004E,
+  0x20200202,
+  0x09090202,
+  0x00FFFFFF,
+  0xF0F00155,
+  0xEFEF0142,
+  0xEDED013E,
+  0xEAEA0124,
+  0xE5EC0122,
+  0xE4E4011F,
+  0xE3E30115,
+  0xE2E20107,
+  0xE1E100D9,
+  0xE0E000B9,
+  0xDFDF00B5,
+  0xDEDE00B2,
+  0xDDDD00B0,
+  0xDCDC00AD,
+  0xDBDB00A7,
+  0xD9D900A2,
+  0xD8D800A0,
+  0xD7D7009D,
+  0xD6D6009B,
+  0xD5D50097,
+  0xD4D40094,
+  0xD2D20091,
+  0xD0DA007B,
+  0xCFCF008E,
+  0xCECE0088,
+  0xCDCD0083,
+  0xCBCB007D,
+  0xC4CA007B,
+  0xC3C30077,
+  0xC2C20073,
+  0x617A004E,
+  0x5F5F004E,
+  0x415A004E,
+  0x303A004E,
+  0x20200860,
+  0x09090860,
+  0x00FFFFFF,
+  0xF0F00155,
+  0xEFEF0142,
+  0xEDED013E,
+  0xEAEA0124,
+  0xE5EC0122,
+  0xE4E4011F,
+  0xE3E30115,
+  0xE2E20107,
+  0xE1E100D9,
+  0xE0E000B9,
+  0xDFDF00B5,
+  0xDEDE00B2,
+  0xDDDD00B0,
+  0xDCDC00AD,
+  0xDBDB00A7,
+  0xD9D900A2,
+  0xD8D800A0,
+  0xD7D7009D,
+  0xD6D6009B,
+  0xD5D50097,
+  0xD4D40094,
+  0xD2D20091,
+  0xD0DA007B,
+  0xCFCF008E,
+  0xCECE0088,
+  0xCDCD0083,
+  0xCBCB007D,
+  0xC4CA007B,
+  0xC3C30077,
+  0xC2C20073,
+  0x74740889,
+  0x617A004E,
+  0x5F5F004E,
+  0x415A004E,
+  0x303A004E,
+  0x20200202,
+  0x09090202,
+  0x00FFFFFF,
+  0xF0F00155,
+  0xEFEF0142,
+  0xEDED013E,
+  0xEAEA0124,
+  0xE5EC0122,
+  0xE4E4011F,
+  0xE3E30115,
+  0xE2E20107,
+  0xE1E100D9,
+  0xE0E000B9,
+  0xDFDF00B5,
+  0xDEDE00B2,
+  0xDDDD00B0,
+  0xDCDC00AD,
+  0xDBDB00A7,
+  0xD9D900A2,
+  0xD8D800A0,
+  0xD7D7009D,
+  0xD6D6009B,
+  0xD5D50097,
+  0xD4D40094,
+  0xD2D20091,
+  0xD0DA007B,
+  0xCFCF008E,
+  0xCECE0088,
+  0xCDCD0083,
+  0xCBCB007D,
+  0xC4CA007B,
+  0xC3C30077,
+  0xC2C20073,
+  0x727208AF,
+  0x617A004E,
+  0x5F5F004E,
+  0x415A004E,
+  0x303A004E,
+  0x20200202,
+  0x09090202,
+  0x00FFFFFF,
+  0xBABA0679,
+  0xB5B50679,
+  0xAAAA0679,
+  0x00FFFFFF,
+  0xB8BF0679,
+  0x98B60679,
+  0x80960679,
+  0x00FFFFFF,
+  0x80BF0679,
+  0x00FFFFFF,
+  0xAEAE0679,
+  0xACAC0679,
+  0xA0A40679,
+  0x86910679,
+  0x80810679,
+  0x00FFFFFF,
+  0xBFBF0679,
+  0xBABD0679,
+  0xB6B70679,
+  0xB0B40679,
+  0x00FFFFFF,
+  0xA3BF0679,
+  0x8EA10679,
+  0x8C8C0679,
+  0x888A0679,
+  0x86860679,
+  0x00FFFFFF,
+  0xB7BF0679,
+  0x80B50679,
+  0x00FFFFFF,
+  0x8ABF0679,
+  0x80810679,
+  0x00FFFFFF,
+  0xB1BF0679,
+  0x80AF0679,
+  0x00FFFFFF,
+  0xA0BF0679,
+  0x99990679,
+  0x80960679,
+  0x00FFFFFF,
+  0x80880679,
+  0x00FFFFFF,
+  0xAFB20679,
+  0x90AA0679,
+  0x00FFFFFF,
+  0xA0BF0679,
+  0x00FFFFFF,
+  0xB1BF0679,
+  0xAEAF0679,
+  0xA0A90679,
+  0x808A0679,
+  0x00FFFFFF,
+  0xBFBF0679,
+  0xAEBC0679,
+  0xA5A60679,
+  0x95950679,
+  0x80930679,
+  0x00FFFFFF,
+  0x92AF0679,
+  0x90900679,
+  0x00FFFFFF,
+  0x8DBF0679,
+  0x00FFFFFF,
+  0xB1B10679,
+  0x80A50679,
+  0x00FFFFFF,
+  0xBABA0679,
+  0xB4B50679,
+  0x80AA0679,
+  0x00FFFFFF,
+  0xBEBE0975,
+  0xBDBD0972,
+  0xBCBC096F,
+  0xBBBB096A,
+  0xBABA0961,
+  0xB9B9095E,
+  0xB8B8095B,
+  0xB7B70958,
+  0xB6B60953,
+  0xB5B5094D,
+  0xB4B40948,
+  0xB3B30943,
+  0xB2B2093B,
+  0xB1B10936,
+  0xB0B00930,
+  0xAFAF092D,
+  0xAEAE0922,
+  0xADAD091D,
+  0xACAC0915,
+  0xABAB0910,
+  0xAAAA0908,
+  0xA9A90903,
+  0xA8A808FB,
+  0xA7A708F5,
+  0xA6A608EC,
+  0xA5A508E7,
+  0xA4A408E4,
+  0xA3A308E2,
+  0xA2A208DE,
+  0xA1A108DA,
+  0xA0A008D5,
+  0x00FFFFFF,
+  0xBFBF0A0B,
+  0xBEBE0A07,
+  0xBDBD09FF,
+  0xBCBC09FB,
+  0xB8BB058A,
+  0xB4B6058A,
+  0xB3B309F6,
+  0xB2B209F2,
+  0xB1B109EF,
+  0xB0B009ED,
+  0xAFAF09EB,
+  0xAEAE09E8,
+  0xADAD09E5,
+  0xACAC09E3,
+  0xAAAA09DF,
+  0xA9A909DD,
+  0xA8A809DA,
+  0xA7A709D7,
+  0xA6A609D4,
+  0xA5A509D1,
+  0xA4A409CF,
+  0xA3A309CD,
+  0xA2A209C8,
+  0xA1A109C6,
+  0xA0A009C3,
+  0x9F9F09BF,
+  0x9E9E09BD,
+  0x9D9D09B9,
+  0x9C9C09B6,
+  0x9B9B09B3,
+  0x9A9A09B0,
+  0x999909AD,
+  0x909009AB,
+  0x8F8F09A8,
+  0x8E8E09A5,
+  0x8D8D09A3,
+  0x8C8C099F,
+  0x8B8B099A,
+  0x8A8A0994,
+  0x8989098D,
+  0x8498058A,
+  0x83830987,
+  0x82820982,
+  0x8181097A,
+  0x80800977,
+  0x00FFFFFF,
+  0xB8B80A44,
+  0xB7B70A3F,
+  0xB6B60A39,
+  0xB5B50A36,
+  0xB4B40A31,
+  0xB3B30A2D,
+  0xB0B2058A,
+  0x86860A2B,
+  0x85850A28,
+  0x84840A1C,
+  0x82820A1A,
+  0x81810A15,
+  0x80800A13,
+  0x00FFFFFF,
+  0x90BF058A,
+  0x87870A57,
+  0x86860A54,
+  0x8585058A,
+  0x84840A51,
+  0x83830A4E,
+  0x82820A4A,
+  0x818109AB,
+  0x80800A46,
+  0x00FFFFFF,
+  0xB8BF058A,
+  0x80B6058A,
+  0x00FFFFFF,
+  0x80BF058A,
+  0x00FFFFFF,
+  0xAFAF0AA9,
+  0xADAD0AA5,
+  0xACAC0A9E,
+  0xABAB0A98,
+  0xAAAA0A93,
+  0xA9A90A8C,
+  0xA8A80A8A,
+  0xA7A70A86,
+  0xA6A60A84,
+  0xA5A50A81,
+  0xA4A40A7E,
+  0xA3A30A79,
+  0xA2A20A77,
+  0xA1A109BD,
+  0xA0A00A72,
+  0x9F9F0A6C,
+  0x9E9E0A69,
+  0x9C9C0A66,
+  0x9B9B09EB,
+  0x9A9A0A63,
+  0x99990A60,
+  0x98980A5D,
+  0x93930A5B,
+  0x92920A59,
+  0x80BF058A,
+  0x00FFFFFF,
+  0x9F9F0AAF,
+  0x9E9E0AAC,
+  0x809D058A,
+  0x00FFFFFF,
+  0xBFBF0AE2,
+  0xBEBE0AE0,
+  0xBDBD0ADD,
+  0xBCBC0AD9,
+  0xBBBB0AD7,
+  0xB9B90AD3,
+  0xB8B80AD1,
+  0xB7B70ACE,
+  0xB6B60ACB,
+  0xB5B50AC9,
+  0xB4B40AC7,
+  0xAFAF0AC5,
+  0xAEAE0AC3,
+  0xADAD0ABF,
+  0xACAC0AB7,
+  0xABAB0AB5,
+  0xA9A90AB2,
+  0xA4BA058A,
+  0x00FFFFFF,
+  0xB1B10B95,
+  0xAFAF0B92,
+  0xAEAE0B8F,
+  0xACAC0B8C,
+  0xABAB0B88,
+  0xAAAA0B85,
+  0xA0B00631,
+  0x9F9F0B83,
+  0x9E9E0B77,
+  0x9D9D0B69,
+  0x9B9B0B61,
+  0x9A9A0B5F,
+  0x98980B5A,
+  0x97970631,
+  0x96960B4C,
+  0x94940B49,
+  0x93930B46,
+  0x92920B3F,
+  0x91910B12,
+  0x90900AE7,
+  0x00FFFFFF,
+  0xF0F00664,
+  0xEFEF0651,
+  0xEDED064D,
+  0xEAEA0633,
+  0xE5EC0631,
+  0xE4E4062E,
+  0xE3E30624,
+  0xE2E20616,
+  0xE1E105E8,
+  0xE0E005C8,
+  0xDFDF05C4,
+  0xDEDE05C1,
+  0xDDDD05BF,
+  0xDCDC05BC,
+  0xDBDB05B6,
+  0xD9D905B1,
+  0xD8D805AF,
+  0xD7D705AC,
+  0xD6D605AA,
+  0xD5D505A6,
+  0xD4D405A3,
+  0xD2D205A0,
+  0xD0DA058A,
+  0xCFCF059D,
+  0xCECE0597,
+  0xCDCD0592,
+  0xCBCB058C,
+  0xC4CA058A,
+  0xC3C30586,
+  0xC2C20582,
+  0x617A0679,
+  0x5F5F0679,
+  0x415A0679,
+  0x3A3A004E,
+  0x30390679,
+  0x28280B98,
+  0x20200679,
+  0x09090679,
+  0x00FFFFFF,
+  0xBFBF004E,
+  0xBCBD004E,
+  0xA8BA004E,
+  0x8DA6004E,
+  0x808B004E,
+  0x00FFFFFF,
+  0x909D004E,
+  0x808D004E,
+  0x00FFFFFF,
+  0x80BA004E,
+  0x00FFFFFF,
+  0xA0BF004E,
+  0x809C004E,
+  0x00FFFFFF,
+  0x8090004E,
+  0x00FFFFFF,
+  0xADBF004E,
+  0x809F004E,
+  0x00FFFFFF,
+  0x90B5004E,
+  0x8289004E,
+  0x8080004E,
+  0x00FFFFFF,
+  0x888F004E,
+  0x8083004E,
+  0x00FFFFFF,
+  0xB0BF004E,
+  0xA0A9004E,
+  0x809D004E,
+  0x00FFFFFF,
+  0x98BB004E,
+  0x8093004E,
+  0x00FFFFFF,
+  0xB0BF004E,
+  0x80A7004E,
+  0x00FFFFFF,
+  0xBCBF004E,
+  0xB0BA004E,
+  0x80A3004E,
+  0x00FFFFFF,
+  0xBBBC004E,
+  0xB3B9004E,
+  0xA3B1004E,
+  0x97A1004E,
+  0x9495004E,
+  0x8C92004E,
+  0x808A004E,
+  0x00FFFFFF,
+  0x80B6004E,
+  0x00FFFFFF,
+  0xA0A7004E,
+  0x8095004E,
+  0x00FFFFFF,
+  0xB2BA004E,
+  0x87B0004E,
+  0x8085004E,
+  0x00FFFFFF,
+  0xBFBF004E,
+  0xBCBC004E,
+  0xB7B8004E,
+  0x8AB5004E,
+  0x8888004E,
+  0x8085004E,
+  0x00FFFFFF,
+  0xA0B6004E,
+  0x8095004E,
+  0x00FFFFFF,
+  0xB4B5004E,
+  0xA0B2004E,
+  0x00FFFFFF,
+  0xA0B9004E,
+  0x8095004E,
+  0x00FFFFFF,
+  0xBEBF004E,
+  0x80B7004E,
+  0x00FFFFFF,
+  0x99B5004E,
+  0x9597004E,
+  0x9093004E,
+  0x8080004E,
+  0x00FFFFFF,
+  0xA0BC004E,
+  0x00FFFFFF,
+  0x809C004E,
+  0x00FFFFFF,
+  0x89A4004E,
+  0x8087004E,
+  0x00FFFFFF,
+  0xA0B2004E,
+  0x8095004E,
+  0x00FFFFFF,
+  0x8091004E,
+  0x00FFFFFF,
+  0x80B2004E,
+  0x00FFFFFF,
+  0xB0B9004E,
+  0x80A3004E,
+  0x00FFFFFF,
+  0xB0B1004E,
+  0x80A9004E,
+  0x00FFFFFF,
+  0xB0BF004E,
+  0xA7A7004E,
+  0x809C004E,
+  0x00FFFFFF,
+  0xB0BF004E,
+  0x8085004E,
+  0x00FFFFFF,
+  0xB0BF004E,
+  0x8081004E,
+  0x00FFFFFF,
+  0xA0B6004E,
+  0x8084004E,
+  0x00FFFFFF,
+  0x83B7004E,
+  0x00FFFFFF,
+  0xB5B5004E,
+  0xB1B2004E,
+  0xA6AF004E,
+  0x00FFFFFF,
+  0x83AF004E,
+  0x00FFFFFF,
+  0xB0B9004E,
+  0x90A8004E,
+  0x00FFFFFF,
+  0xB6BF004E,
+  0x83A6004E,
+  0x00FFFFFF,
+  0xB6B6004E,
+  0x90B2004E,
+  0x8787004E,
+  0x8484004E,
+  0x00FFFFFF,
+  0x83B2004E,
+  0x00FFFFFF,
+  0x9C9C004E,
+  0x909A004E,
+  0x8184004E,
+  0x00FFFFFF,
+  0x93AB004E,
+  0x8091004E,
+  0x00FFFFFF,
+  0xB0BF004E,
+  0x9FA8004E,
+  0x8F9D004E,
+  0x8A8D004E,
+  0x8888004E,
+  0x8086004E,
+  0x00FFFFFF,
+  0xB0B9004E,
+  0x809E004E,
+  0x00FFFFFF,
+  0x9DA1004E,
+  0x9090004E,
+  0x00FFFFFF,
+  0x80B4004E,
+  0x00FFFFFF,
+  0x9FA1004E,
+  0x9099004E,
+  0x878A004E,
+  0x00FFFFFF,
+  0x80AF004E,
+  0x00FFFFFF,
+  0x9099004E,
+  0x8787004E,
+  0x8485004E,
+  0x00FFFFFF,
+  0x80AE004E,
+  0x00FFFFFF,
+  0x989B004E,
+  0x00FFFFFF,
+  0x9099004E,
+  0x8484004E,
+  0x00FFFFFF,
+  0xB8B8004E,
+  0x80AA004E,
+  0x00FFFFFF,
+  0xB0B9004E,
+  0x809A004E,
+  0x00FFFFFF,
+  0x8086004E,
+  0x00FFFFFF,
+  0x80AB004E,
+  0x00FFFFFF,
+  0xBFBF004E,
+  0x80A9004E,
+  0x00FFFFFF,
+  0xBFBF004E,
+  0x98AF004E,
+  0x9596004E,
+  0x8C93004E,
+  0x8989004E,
+  0x8086004E,
+  0x00FFFFFF,
+  0x9099004E,
+  0x8181004E,
+  0x00FFFFFF,
+  0xAABF004E,
+  0xA0A7004E,
+  0x00FFFFFF,
+  0xA3A3004E,
+  0xA1A1004E,
+  0x8090004E,
+  0x00FFFFFF,
+  0xBABA004E,
+  0x8BB2004E,
+  0x8080004E,
+  0x00FFFFFF,
+  0x9CBF004E,
+  0x9090004E,
+  0x00FFFFFF,
+  0xB0BF004E,
+  0x9D9D004E,
+  0x8089004E,
+  0x00FFFFFF,
+  0x8AAE004E,
+  0x8088004E,
+  0x00FFFFFF,
+  0xB2BF004E,
+  0x9099004E,
+  0x8080004E,
+  0x00FFFFFF,
+  0x808F004E,
+  0x00FFFFFF,
+  0x8BB0004E,
+  0x8889004E,
+  0x8086004E,
+  0x00FFFFFF,
+  0xAABF004E,
+  0xA7A8004E,
+  0xA0A5004E,
+  0x9099004E,
+  0x8686004E,
+  0x00FFFFFF,
+  0xA0A9004E,
+  0x9898004E,
+  0x8089004E,
+  0x00FFFFFF,
+  0xA0B2004E,
+  0x00FFFFFF,
+  0xB0B0004E,
+  0x00FFFFFF,
+  0x8083004E,
+  0x00FFFFFF,
+  0x80B0004E,
+  0x00FFFFFF,
+  0xB0BF004E,
+  0xA0A9004E,
+  0x809E004E,
+  0x00FFFFFF,
+  0x90AD004E,
+  0x8089004E,
+  0x00FFFFFF,
+  0xBDBF004E,
+  0xA3B7004E,
+  0x9099004E,
+  0x8083004E,
+  0x00FFFFFF,
+  0x9090004E,
+  0x808A004E,
+  0x00FFFFFF,
+  0x939F004E,
+  0x00FFFFFF,
+  0xA3A3004E,
+  0xA0A1004E,
+  0x00FFFFFF,
+  0x80B7004E,
+  0x00FFFFFF,
+  0x8095004E,
+  0x00FFFFFF,
+  0xBDBE004E,
+  0xB5BB004E,
+  0xB0B3004E,
+  0x00FFFFFF,
+  0x80A2004E,
+  0x00FFFFFF,
+  0xB0BF004E,
+  0xA4A7004E,
+  0x9092004E,
+  0x00FFFFFF,
+  0x80BB004E,
+  0x00FFFFFF,
+  0xB0BC004E,
+  0x80AA004E,
+  0x00FFFFFF,
+  0x9099004E,
+  0x8088004E,
+  0x00FFFFFF,
+  0x96BF004E,
+  0x8094004E,
+  0x00FFFFFF,
+  0xBDBF004E,
+  0xBBBB004E,
+  0xAEB9004E,
+  0xA9AC004E,
+  0xA5A6004E,
+  0xA2A2004E,
+  0x9E9F004E,
+  0x809C004E,
+  0x00FFFFFF,
+  0x85BF004E,
+  0x8083004E,
+  0x00FFFFFF,
+  0xBBBE004E,
+  0x9EB9004E,
+  0x969C004E,
+  0x8D94004E,
+  0x878A004E,
+  0x8085004E,
+  0x00FFFFFF,
+  0x92BF004E,
+  0x8A90004E,
+  0x8686004E,
+  0x8084004E,
+  0x00FFFFFF,
+  0xA8BF004E,
+  0x80A5004E,
+  0x00FFFFFF,
+  0xBCBF004E,
+  0x9CBA004E,
+  0x829A004E,
+  0x8080004E,
+  0x00FFFFFF,
+  0xB6BF004E,
+  0x96B4004E,
+  0x8094004E,
+  0x00FFFFFF,
+  0xB0BF004E,
+  0x90AE004E,
+  0x808E004E,
+  0x00FFFFFF,
+  0xAABF004E,
+  0x8AA8004E,
+  0x8088004E,
+  0x00FFFFFF,
+  0x8EBF004E,
+  0x848B004E,
+  0x8082004E,
+  0x00FFFFFF,
+  0xB7BD004E,
+  0x80AC004E,
+  0x00FFFFFF,
+  0x8E8E004E,
+  0x8089004E,
+  0x00FFFFFF,
+  0x90AD004E,
+  0x00FFFFFF,
+  0xB0B9004E,
+  0x80AB004E,
+  0x00FFFFFF,
+  0xB0BE004E,
+  0xADAE004E,
+  0xA8AB004E,
+  0xA0A6004E,
+  0x00FFFFFF,
+  0x8084004E,
+  0x00FFFFFF,
+  0x9099004E,
+  0x8B8B004E,
+  0x8083004E,
+  0x00FFFFFF,
+  0xBBBB004E,
+  0xB9B9004E,
+  0xB4B7004E,
+  0xA9B2004E,
+  0xA7A7004E,
+  0xA4A4004E,
+  0xA1A2004E,
+  0x859F004E,
+  0x8083004E,
+  0x00FFFFFF,
+  0xBEBE004E,
+  0xB9BC004E,
+  0xB4B7004E,
+  0xACB2004E,
+  0xA7AA004E,
+  0xA4A4004E,
+  0xA1A2004E,
+  0x9F9F004E,
+  0x9D9D004E,
+  0x9B9B004E,
+  0x9999004E,
+  0x9797004E,
+  0x9494004E,
+  0x9192004E,
+  0x8D8F004E,
+  0x8B8B004E,
+  0x8989004E,
+  0x8787004E,
+  0x8282004E,
+  0x00FFFFFF,
+  0xABBB004E,
+  0xA5A9004E,
+  0xA1A3004E,
+  0x8B9B004E,
+  0x8089004E,
+  0x00FFFFFF,
+  0xB0B9004E,
+  0x00FFFFFF,
+  0x809F004E,
+  0x00FFFFFF,
+  0xB0BF004E,
+  0x80A1004E,
+  0x00FFFFFF,
+  0x80A0004E,
+  0x00FFFFFF,
+  0x809D004E,
+  0x00FFFFFF,
+  0x808A004E,
+  0x00FFFFFF,
+  0xF0F00155,
+  0xEFEF0142,
+  0xEDED013E,
+  0xEAEA0124,
+  0xE5EC0122,
+  0xE4E4011F,
+  0xE3E30115,
+  0xE2E20107,
+  0xE1E100D9,
+  0xE0E000B9,
+  0xDFDF00B5,
+  0xDEDE00B2,
+  0xDDDD00B0,
+  0xDCDC00AD,
+  0xDBDB00A7,
+  0xD9D900A2,
+  0xD8D800A0,
+  0xD7D7009D,
+  0xD6D6009B,
+  0xD5D50097,
+  0xD4D40094,
+  0xD2D20091,
+  0xD0DA007B,
+  0xCFCF008E,
+  0xCECE0088,
+  0xCDCD0083,
+  0xCBCB007D,
+  0xC4CA007B,
+  0xC3C30077,
+  0xC2C20073,
+  0x65650511,
+  0x617A004E,
+  0x5F5F004E,
+  0x415A004E,
+  0x303A004E,
+  0x20200202,
+  0x09090202,
+  0x00FFFFFF,
+  0x08000BA3,
+  0xF0F00D03,
+  0xEFEF0CED,
+  0xEDED0CE6,
+  0xEAEA0CC9,
+  0xE5EC0CC4,
+  0xE4E40CBE,
+  0xE3E30CB1,
+  0xE2E20CA0,
+  0xE1E10C6F,
+  0xE0E00C4C,
+  0xDFDF0C45,
+  0xDEDE0C3F,
+  0xDDDD0C3A,
+  0xDCDC0C34,
+  0xDBDB0C2B,
+  0xD9D90C23,
+  0xD8D80C1E,
+  0xD7D70C18,
+  0xD6D60C13,
+  0xD5D50C0C,
+  0xD4D40C06,
+  0xD2D20C00,
+  0xD0DA0BDB,
+  0xCFCF0BFA,
+  0xCECE0BF1,
+  0xCDCD0BE9,
+  0xCBCB0BE0,
+  0xC4CA0BDB,
+  0xC3C30BD4,
+  0xC2C20BCD,
+  0x617A0D1B,
+  0x5F5F0D1B,
+  0x415A0D1B,
+  0x3A3A0BA5,
+  0x30390D1B,
+  0x20200860,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x09090860,
+  0x00080D45,
+  0xF0F00155,
+  0xEFEF0142,
+  0xEDED013E,
+  0xEAEA0124,
+  0xE5EC0122,
+  0xE4E4011F,
+  0xE3E30115,
+  0xE2E20107,
+  0xE1E100D9,
+  0xE0E000B9,
+  0xDFDF00B5,
+  0xDEDE00B2,
+  0xDDDD00B0,
+  0xDCDC00AD,
+  0xDBDB00A7,
+  0xD9D900A2,
+  0xD8D800A0,
+  0xD7D7009D,
+  0xD6D6009B,
+  0xD5D50097,
+  0xD4D40094,
+  0xD2D20091,
+  0xD0DA007B,
+  0xCFCF008E,
+  0xCECE0088,
+  0xCDCD0083,
+  0xCBCB007D,
+  0xC4CA007B,
+  0xC3C30077,
+  0xC2C20073,
+  0x75750D49,
+  0x617A004E,
+  0x5F5F004E,
+  0x415A004E,
+  0x303A004E,
+  0x20200202,
+  0x09090202,
+  0x00FFFFFF,
+  0xF0F00155,
+  0xEFEF0142,
+  0xEDED013E,
+  0xEAEA0124,
+  0xE5EC0122,
+  0xE4E4011F,
+  0xE3E30115,
+  0xE2E20107,
+  0xE1E100D9,
+  0xE0E000B9,
+  0xDFDF00B5,
+  0xDEDE00B2,
+  0xDDDD00B0,
+  0xDCDC00AD,
+  0xDBDB00A7,
+  0xD9D900A2,
+  0xD8D800A0,
+  0xD7D7009D,
+  0xD6D6009B,
+  0xD5D50097,
+  0xD4D40094,
+  0xD2D20091,
+  0xD0DA007B,
+  0xCFCF008E,
+  0xCECE0088,
+  0xCDCD0083,
+  0xCBCB007D,
+  0xC4CA007B,
+  0xC3C30077,
+  0xC2C20073,
+  0x6F6F0D6F,
+  0x617A004E,
+  0x5F5F004E,
+  0x415A004E,
+  0x303A004E,
+  0x20200202,
+  0x09090202,
+  0x00FFFFFF,
+  0xA8A80679,
+  0xA4A40679,
+  0x9A9A0679,
+  0x80950679,
+  0x00FFFFFF,
+  0xB0BF0679,
+  0xA0AA0679,
+  0x80980679,
+  0x00FFFFFF,
+  0xA0BF0679,
+  0x898E0679,
+  0x80870679,
+  0x00FFFFFF,
+  0x80890679,
+  0x00FFFFFF,
+  0xBDBD0679,
+  0x84B90679,
+  0x00FFFFFF,
+  0xB1BF0679,
+  0xA6AF0679,
+  0x98A10679,
+  0x90900679,
+  0x00FFFFFF,
+  0xBDBD0679,
+  0xB6B90679,
+  0xB2B20679,
+  0xAAB00679,
+  0x93A80679,
+  0x8F900679,
+  0x858C0679,
+  0x80800679,
+  0x00FFFFFF,
+  0xBCBC0679,
+  0xA6B10679,
+  0x9FA10679,
+  0x9C9D0679,
+  0x8E8E0679,
+  0x00FFFFFF,
+  0xB8B90679,
+  0xB5B60679,
+  0xB2B30679,
+  0xAAB00679,
+  0x93A80679,
+  0x8F900679,
+  0x858A0679,
+  0x00FFFFFF,
+  0xB2B40679,
+  0xA6AF0679,
+  0x9E9E0679,
+  0x999C0679,
+  0x00FFFFFF,
+  0xBDBD0679,
+  0xB5B90679,
+  0xB2B30679,
+  0xAAB00679,
+  0x93A80679,
+  0x8F910679,
+  0x858D0679,
+  0x00FFFFFF,
+  0xB9B90679,
+  0xA6AF0679,
+  0xA0A10679,
+  0x90900679,
+  0x00FFFFFF,
+  0xBDBD0679,
+  0xB5B90679,
+  0xB2B30679,
+  0xAAB00679,
+  0x93A80679,
+  0x8F900679,
+  0x858C0679,
+  0x00FFFFFF,
+  0xB1B10679,
+  0xA6AF0679,
+  0x9FA10679,
+  0x9C9D0679,
+  0x00FFFFFF,
+  0xAEB90679,
+  0xA8AA0679,
+  0xA3A40679,
+  0x9E9F0679,
+  0x9C9C0679,
+  0x999A0679,
+  0x92950679,
+  0x8E900679,
+  0x858A0679,
+  0x83830679,
+  0x00FFFFFF,
+  0xA6AF0679,
+  0x90900679,
+  0x00FFFFFF,
+  0xBDBD0679,
+  0xAAB90679,
+  0x92A80679,
+  0x8E900679,
+  0x858C0679,
+  0x00FFFFFF,
+  0xA6AF0679,
+  0xA0A10679,
+  0x9D9D0679,
+  0x989A0679,
+  0x00FFFFFF,
+  0xBDBD0679,
+  0xB5B90679,
+  0xAAB30679,
+  0x92A80679,
+  0x8E900679,
+  0x858C0679,
+  0x80800679,
+  0x00FFFFFF,
+  0xB1B20679,
+  0xA6AF0679,
+  0xA0A10679,
+  0x9D9E0679,
+  0x00FFFFFF,
+  0xBDBD0679,
+  0x92BA0679,
+  0x8E900679,
+  0x848C0679,
+  0x00FFFFFF,
+  0xBABF0679,
+  0xA6AF0679,
+  0x9FA10679,
+  0x94960679,
+  0x8E8E0679,
+  0x00FFFFFF,
+  0xBDBD0679,
+  0xB3BB0679,
+  0x9AB10679,
+  0x85960679,
+  0x00FFFFFF,
+  0xA6AF0679,
+  0x80860679,
+  0x00FFFFFF,
+  0xB2B30679,
+  0x81B00679,
+  0x00FFFFFF,
+  0x90990679,
+  0x80860679,
+  0x00FFFFFF,
+  0xBDBD0679,
+  0xB2B30679,
+  0xA7B00679,
+  0xA5A50679,
+  0x8CA30679,
+  0x868A0679,
+  0x84840679,
+  0x81820679,
+  0x00FFFFFF,
+  0x9C9F0679,
+  0x90990679,
+  0x86860679,
+  0x80840679,
+  0x00FFFFFF,
+  0xA0A90679,
+  0x80800679,
+  0x00FFFFFF,
+  0x89AC0679,
+  0x80870679,
+  0x00FFFFFF,
+  0x888C0679,
+  0x00FFFFFF,
+  0xBFBF0679,
+  0x80AA0679,
+  0x00FFFFFF,
+  0xB5BF0679,
+  0xAEB00679,
+  0xA5A60679,
+  0xA1A10679,
+  0x9A9D0679,
+  0x90950679,
+  0x80890679,
+  0x00FFFFFF,
+  0xA0BF0679,
+  0x90990679,
+  0x8E8E0679,
+  0x80810679,
+  0x00FFFFFF,
+  0xBCBF0679,
+  0x90BA0679,
+  0x8D8D0679,
+  0x87870679,
+  0x80850679,
+  0x00FFFFFF,
+  0xA0BF0679,
+  0x9A9D0679,
+  0x98980679,
+  0x90960679,
+  0x8A8D0679,
+  0x80880679,
+  0x00FFFFFF,
+  0xB8BE0679,
+  0xB2B50679,
+  0x90B00679,
+  0x8A8D0679,
+  0x80880679,
+  0x00FFFFFF,
+  0x98BF0679,
+  0x88960679,
+  0x82850679,
+  0x80800679,
+  0x00FFFFFF,
+  0x98BF0679,
+  0x92950679,
+  0x80900679,
+  0x00FFFFFF,
+  0x809A0679,
+  0x00FFFFFF,
+  0xA0BF0679,
+  0x808F0679,
+  0x00FFFFFF,
+  0xB8BD0679,
+  0x80B50679,
+  0x00FFFFFF,
+  0x81BF0679,
+  0x00FFFFFF,
+  0xAFBF0679,
+  0x80AC0679,
+  0x00FFFFFF,
+  0xA0BF0679,
+  0x819A0679,
+  0x00FFFFFF,
+  0xB1B80679,
+  0x80AA0679,
+  0x00FFFFFF,
+  0x9FB10679,
+  0x80910679,
+  0x00FFFFFF,
+  0xAEB00679,
+  0xA0AC0679,
+  0x80910679,
+  0x00FFFFFF,
+  0x80B30679,
+  0x00FFFFFF,
+  0xA0A90679,
+  0x9C9C0679,
+  0x97970679,
+  0x00FFFFFF,
+  0xA0BF0679,
+  0x90990679,
+  0x00FFFFFF,
+  0x80B80679,
+  0x00FFFFFF,
+  0xB0BF0679,
+  0xAAAA0679,
+  0x87A80679,
+  0x80840679,
+  0x00FFFFFF,
+  0x80B50679,
+  0x00FFFFFF,
+  0x809E0679,
+  0x00FFFFFF,
+  0xB0B40679,
+  0x86AD0679,
+  0x00FFFFFF,
+  0xB0BF0679,
+  0x80AB0679,
+  0x00FFFFFF,
+  0x90990679,
+  0x80890679,
+  0x00FFFFFF,
+  0xA0BF0679,
+  0x80960679,
+  0x00FFFFFF,
+  0x80940679,
+  0x00FFFFFF,
+  0xA7A70679,
+  0x90990679,
+  0x80890679,
+  0x00FFFFFF,
+  0x85B30679,
+  0x00FFFFFF,
+  0x90990679,
+  0x858C0679,
+  0x00FFFFFF,
+  0xAEBF0679,
+  0x83A00679,
+  0x00FFFFFF,
+  0x80A50679,
+  0x00FFFFFF,
+  0x80A30679,
+  0x00FFFFFF,
+  0x8DBD0679,
+  0x80890679,
+  0x00FFFFFF,
+  0xBDBF0679,
+  0x90BA0679,
+  0x80880679,
+  0x00FFFFFF,
+  0xBABA0679,
+  0xB5B60679,
+  0xAEB30679,
+  0xA9AC0679,
+  0x00FFFFFF,
+  0xA0BF0679,
+  0x989D0679,
+  0x80950679,
+  0x00FFFFFF,
+  0x9FBD0679,
+  0x9D9D0679,
+  0x9B9B0679,
+  0x99990679,
+  0x90970679,
+  0x888D0679,
+  0x80850679,
+  0x00FFFFFF,
+  0xBEBE0679,
+  0xB6BC0679,
+  0x80B40679,
+  0x00FFFFFF,
+  0xB6BC0679,
+  0xB2B40679,
+  0xA0AC0679,
+  0x969B0679,
+  0x90930679,
+  0x868C0679,
+  0x82840679,
+  0x00FFFFFF,
+  0xBFBF0679,
+  0x00FFFFFF,
+  0xBFBF0679,
+  0xB1B10679,
+  0x94940679,
+  0x80800679,
+  0x00FFFFFF,
+  0x909C0679,
+  0x00FFFFFF,
+  0xBCBF0679,
+  0xAFB90679,
+  0xAAAD0679,
+  0xA8A80679,
+  0xA6A60679,
+  0xA4A40679,
+  0x999D0679,
+  0x95950679,
+  0x8A930679,
+  0x87870679,
+  0x82820679,
+  0x00FFFFFF,
+  0x8E8E0679,
+  0x85890679,
+  0x00FFFFFF,
+  0x83840679,
+  0x00FFFFFF,
+  0xB2B30679,
+  0xABAE0679,
+  0x80A40679,
+  0x00FFFFFF,
+  0xB0BF0679,
+  0xADAD0679,
+  0xA7A70679,
+  0x80A50679,
+  0x00FFFFFF,
+  0xAFAF0679,
+  0x80A70679,
+  0x00FFFFFF,
+  0xB8BE0679,
+  0xB0B60679,
+  0xA8AE0679,
+  0xA0A60679,
+  0x80960679,
+  0x00FFFFFF,
+  0x989E0679,
+  0x90960679,
+  0x888E0679,
+  0x80860679,
+  0x00FFFFFF,
+  0xAFAF0679,
+  0x00FFFFFF,
+  0xBBBC0679,
+  0xB1B50679,
+  0x85860679,
+  0x00FFFFFF,
+  0xA1BF0679,
+  0x9D9F0679,
+  0x80960679,
+  0x00FFFFFF,
+  0xBCBF0679,
+  0x80BA0679,
+  0x00FFFFFF,
+  0xB1BF0679,
+  0x85AF0679,
+  0x00FFFFFF,
+  0xA0BF0679,
+  0x808E0679,
+  0x00FFFFFF,
+  0xB0BF0679,
+  0x00FFFFFF,
+  0x808C0679,
+  0x00FFFFFF,
+  0x90BD0679,
+  0x00FFFFFF,
+  0x90AB0679,
+  0x808C0679,
+  0x00FFFFFF,
+  0xBFBF0679,
+  0x80AE0679,
+  0x00FFFFFF,
+  0xA0BF0679,
+  0x809D0679,
+  0x00FFFFFF,
+  0xA2BF0679,
+  0x979F0679,
+  0x00FFFFFF,
+  0x8BBF0679,
+  0x80880679,
+  0x00FFFFFF,
+  0xB2BF0679,
+  0x95990679,
+  0x93930679,
+  0x90910679,
+  0x808A0679,
+  0x00FFFFFF,
+  0x8CA20679,
+  0x878A0679,
+  0x83850679,
+  0x80810679,
+  0x00FFFFFF,
+  0x82B30679,
+  0x00FFFFFF,
+  0xBDBE0679,
+  0xBBBB0679,
+  0xB2B70679,
+  0x90990679,
+  0x00FFFFFF,
+  0xB0BF0679,
+  0x80A50679,
+  0x00FFFFFF,
+  0xA0BC0679,
+  0x80860679,
+  0x00FFFFFF,
+  0x84B20679,
+  0x00FFFFFF,
+  0xA6BE0679,
+  0xA0A40679,
+  0x8F990679,
+  0x00FFFFFF,
+  0x80A80679,
+  0x00FFFFFF,
+  0xBEBF0679,
+  0xBABA0679,
+  0xA0B60679,
+  0x90990679,
+  0x848B0679,
+  0x80820679,
+  0x00FFFFFF,
+  0xB9BD0679,
+  0xB5B60679,
+  0xB1B10679,
+  0x80AF0679,
+  0x00FFFFFF,
+  0xB2B40679,
+  0xA0AA0679,
+  0x9B9D0679,
+  0x82820679,
+  0x80800679,
+  0x00FFFFFF,
+  0xB0BF0679,
+  0xA8AE0679,
+  0xA0A60679,
+  0x91960679,
+  0x898E0679,
+  0x81860679,
+  0x00FFFFFF,
+  0xB0BF0679,
+  0x9CA90679,
+  0x809A0679,
+  0x00FFFFFF,
+  0xB0B90679,
+  0x80A20679,
+  0x00FFFFFF,
+  0xB0BF0679,
+  0x80A30679,
+  0x00FFFFFF,
+  0x8BBB0679,
+  0x80860679,
+  0x00FFFFFF,
+  0xB0BF0679,
+  0x80AD0679,
+  0x00FFFFFF,
+  0x80990679,
+  0x00FFFFFF,
+  0xBEBE0679,
+  0xB8BC0679,
+  0xAAB60679,
+  0x9FA80679,
+  0x9D9D0679,
+  0x93970679,
+  0x80860679,
+  0x00FFFFFF,
+  0x86BF0679,
+  0x83840679,
+  0x80810679,
+  0x00FFFFFF,
+  0x80B10679,
+  0x00FFFFFF,
+  0x93BF0679,
+  0x00FFFFFF,
+  0x80BD0679,
+  0x00FFFFFF,
+  0x90BF0679,
+  0x00FFFFFF,
+  0x92BF0679,
+  0x808F0679,
+  0x00FFFFFF,
+  0xB0BB0679,
+  0x80870679,
+  0x00FFFFFF,
+  0xB3B40679,
+  0x00FFFFFF,
+  0xB6BF0679,
+  0xB0B40679,
+  0x8D8F0679,
+  0x00FFFFFF,
+  0x80BC0679,
+  0x00FFFFFF,
+  0xBFBF0679,
+  0xA1BA0679,
+  0x90990679,
+  0x00FFFFFF,
+  0xA6BF0679,
+  0x819A0679,
+  0x00FFFFFF,
+  0x80BE0679,
+  0x00FFFFFF,
+  0x9A9C0679,
+  0x92970679,
+  0x8A8F0679,
+  0x82870679,
+  0x00FFFFFF,
+  0xBFBF0E04,
+  0xBEBE0E01,
+  0xBDBD0DFE,
+  0xBCBC0DFA,
+  0xBABA0DF7,
+  0xB4B40DF4,
+  0xB2B30DF2,
+  0xB1B105AA,
+  0xB0B0058A,
+  0xAEAE0DF0,
+  0xADAD0DED,
+  0xACAC09CD,
+  0xABAB0DEA,
+  0xAAAA0DE8,
+  0xA9A90DE6,
+  0xA8A80DE1,
+  0xA6A60DDE,
+  0xA4A40DDB,
+  0xA3A30DD8,
+  0xA2A209CF,
+  0xA1A10DD5,
+  0xA0A00DCE,
+  0x9E9E0DCA,
+  0x9D9D0DC7,
+  0x9C9C0DC5,
+  0x989B058A,
+  0x96960DBD,
+  0x95950DB9,
+  0x94940DB6,
+  0x93930DB3,
+  0x92920DAF,
+  0x9091058A,
+  0x8F8F0DAC,
+  0x8E8E0A63,
+  0x8D8D0DA8,
+  0x8C8C0DA5,
+  0x8B8B0DA3,
+  0x8A8A0DA0,
+  0x83830D9E,
+  0x8282058A,
+  0x81810D9B,
+  0x80800D95,
+  0x00FFFFFF,
+  0xBEBE0E85,
+  0xBBBB0E83,
+  0xB6B60E7F,
+  0xB5B50E79,
+  0xB4B40E75,
+  0xB2B20E73,
+  0xB1B10E6F,
+  0xB0B00E6C,
+  0xABAB09C6,
+  0xAAAA0E68,
+  0xA9A90E65,
+  0xA8A80E61,
+  0xA7A70E5D,
+  0xA6A60E5A,
+  0xA5A50E57,
+  0xA4A40E50,
+  0xA3A30E4D,
+  0xA2A205AF,
+  0xA0A00E4B,
+  0x9D9D0E49,
+  0x9C9C0E46,
+  0x9B9B08E2,
+  0x9A9A0E43,
+  0x99990E40,
+  0x98980E36,
+  0x97970E3E,
+  0x96960E3C,
+  0x93930E38,
+  0x92920E36,
+  0x91910E32,
+  0x90900E30,
+  0x8D8D0E2D,
+  0x8C8C0915,
+  0x8B8B0E2A,
+  0x8A8A0E23,
+  0x88880E20,
+  0x87870E1C,
+  0x86860E1A,
+  0x85850E15,
+  0x84840E12,
+  0x83830E0F,
+  0x82820E0D,
+  0x81810E09,
+  0x80800E07,
+  0x00FFFFFF,
+  0xBFBF0E89,
+  0xBEBE0AC9,
+  0x95950E87,
+  0x9294058A,
+  0x8E8E0AB5,
+  0x808D058A,
+  0x00FFFFFF,
+  0x90900E3C,
+  0x808F058A,
+  0x00FFFFFF,
+  0x99990E49,
+  0x9098058A,
+  0x00FFFFFF,
+  0xBFBF0E9C,
+  0xBEBE0E9A,
+  0xBDBD0E97,
+  0xBCBC058A,
+  0xB9B9058A,
+  0xAEAE0E73,
+  0xADAD0E92,
+  0xACAC0E36,
+  0xABAB0E8F,
+  0xAAAA0AE0,
+  0xA9A90E8B,
+  0xA8A809C6,
+  0xA0A7058A,
+  0x00FFFFFF,
+  0xB4B405AA,
+  0xB3B30EA1,
+  0x9F9F0E9F,
+  0x80B2058A,
+  0x00FFFFFF,
+  0xBFBF0EA3,
+  0x00FFFFFF,
+  0xB2B20EB2,
+  0xB1B10EAF,
+  0xB0B0058A,
+  0x8B8B0EAD,
+  0x85850EA9,
+  0x84840EA7,
+  0x808A058A,
+  0x00FFFFFF,
+  0xBCBC09CF,
+  0x9F9F0EE4,
+  0x9E9E0EE0,
+  0x9D9D0EDC,
+  0x9C9C0ED8,
+  0x9B9B0ED3,
+  0x9A9A0ED0,
+  0x95950ECB,
+  0x94940EC4,
+  0x93930EC1,
+  0x92920EB8,
+  0x91910EB5,
+  0x9099058A,
+  0x00FFFFFF,
+  0xBABA0F1C,
+  0xB9B90F08,
+  0xB8B80EFE,
+  0xA5A50EFA,
+  0xA3A30EF8,
+  0xA0A4058A,
+  0x9F9F0EF3,
+  0x8B8B0EF0,
+  0x8A8A0EEE,
+  0x85850EEB,
+  0x84840EE8,
+  0x00FFFFFF,
+  0xAFAF0F22,
+  0x00FFFFFF,
+  0x9B9B0F24,
+  0x80BF058A,
+  0x00FFFFFF,
+  0xA0A00A63,
+  0x9C9C09C6,
+  0x80BF058A,
+  0x00FFFFFF,
+  0xBABA0F26,
+  0x80BF058A,
+  0x00FFFFFF,
+  0xAFAF0F29,
+  0x80AE058A,
+  0x00FFFFFF,
+  0xA8A80F2B,
+  0xA0A7058A,
+  0x00FFFFFF,
+  0x8D8D0F2D,
+  0x808C058A,
+  0x00FFFFFF,
+  0xF4F40F66,
+  0xF1F30F64,
+  0xF0F00F62,
+  0xEDED0F60,
+  0xE1EF0F5E,
+  0xE0E00F5C,
+  0xC2DF0F5A,
+  0x29290F2F,
+  0x0B7F0B98,
+  0x0AFFFFFF,
+  0x00090B98,
+  0x07000F68,
+  0x00FFFFFF,
+  0x08000BA3,
+  0xF0F010A0,
+  0xEFEF108A,
+  0xEDED1083,
+  0xEAEA1066,
+  0xE5EC1061,
+  0xE4E4105B,
+  0xE3E3104E,
+  0xE2E2103D,
+  0xE1E1100C,
+  0xE0E00FE9,
+  0xDFDF0FE2,
+  0xDEDE0FDC,
+  0xDDDD0FD7,
+  0xDCDC0FD1,
+  0xDBDB0FC8,
+  0xD9D90FC0,
+  0xD8D80FBB,
+  0xD7D70FB5,
+  0xD6D60FB0,
+  0xD5D50FA9,
+  0xD4D40FA3,
+  0xD2D20F9D,
+  0xD0DA0F78,
+  0xCFCF0F97,
+  0xCECE0F8E,
+  0xCDCD0F86,
+  0xCBCB0F7D,
+  0xC4CA0F78,
+  0xC3C30F71,
+  0xC2C20F6A,
+  0x617A0BA5,
+  0x5F5F0BA5,
+  0x415A0BA5,
+  0x303A0BA5,
+  0x20200860,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x09090860,
+  0x00080D45,
+  0x08000BA3,
+  0xBABA0D1B,
+  0xB5B50D1B,
+  0xAAAA0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB8BF0D1B,
+  0x98B60D1B,
+  0x80960D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80BF0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAEAE0D1B,
+  0xACAC0D1B,
+  0xA0A40D1B,
+  0x86910D1B,
+  0x80810D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF0D1B,
+  0xBABD0D1B,
+  0xB6B70D1B,
+  0xB0B40D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA3BF0D1B,
+  0x8EA10D1B,
+  0x8C8C0D1B,
+  0x888A0D1B,
+  0x86860D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB7BF0D1B,
+  0x80B50D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x8ABF0D1B,
+  0x80810D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB1BF0D1B,
+  0x80AF0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0BF0D1B,
+  0x99990D1B,
+  0x80960D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80880D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAFB20D1B,
+  0x90AA0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0BF0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB1BF0D1B,
+  0xAEAF0D1B,
+  0xA0A90D1B,
+  0x808A0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF0D1B,
+  0xAEBC0D1B,
+  0xA5A60D1B,
+  0x95950D1B,
+  0x80930D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x92AF0D1B,
+  0x90900D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x8DBF0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB1B10D1B,
+  0x80A50D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBABA0D1B,
+  0xB4B50D1B,
+  0x80AA0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBEBE11B2,
+  0xBDBD11AC,
+  0xBCBC11A6,
+  0xBBBB119E,
+  0xBABA1192,
+  0xB9B9118C,
+  0xB8B81186,
+  0xB7B71180,
+  0xB6B61178,
+  0xB5B5116F,
+  0xB4B41167,
+  0xB3B3115F,
+  0xB2B21154,
+  0xB1B1114C,
+  0xB0B01143,
+  0xAFAF113D,
+  0xAEAE112F,
+  0xADAD1127,
+  0xACAC111C,
+  0xABAB1114,
+  0xAAAA1109,
+  0xA9A91101,
+  0xA8A810F6,
+  0xA7A710ED,
+  0xA6A610E1,
+  0xA5A510D9,
+  0xA4A410D3,
+  0xA3A310CE,
+  0xA2A210C7,
+  0xA1A110C0,
+  0xA0A010B8,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF12C6,
+  0xBEBE12BF,
+  0xBDBD12B4,
+  0xBCBC12AD,
+  0xB8BB0BDB,
+  0xB4B60BDB,
+  0xB3B312A5,
+  0xB2B2129E,
+  0xB1B11298,
+  0xB0B01293,
+  0xAFAF128E,
+  0xAEAE1288,
+  0xADAD1282,
+  0xACAC127D,
+  0xAAAA1276,
+  0xA9A91271,
+  0xA8A8126B,
+  0xA7A71265,
+  0xA6A6125F,
+  0xA5A51259,
+  0xA4A41254,
+  0xA3A3124F,
+  0xA2A21247,
+  0xA1A11242,
+  0xA0A0123C,
+  0x9F9F1235,
+  0x9E9E1230,
+  0x9D9D1229,
+  0x9C9C1223,
+  0x9B9B121D,
+  0x9A9A1217,
+  0x99991211,
+  0x9090120C,
+  0x8F8F1206,
+  0x8E8E1200,
+  0x8D8D11FB,
+  0x8C8C11F4,
+  0x8B8B11EC,
+  0x8A8A11E3,
+  0x898911D9,
+  0x84980BDB,
+  0x838311D0,
+  0x828211C8,
+  0x818111BD,
+  0x808011B7,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB8B81323,
+  0xB7B7131B,
+  0xB6B61312,
+  0xB5B5130C,
+  0xB4B41304,
+  0xB3B312FD,
+  0xB0B20BDB,
+  0x868612F8,
+  0x858512F2,
+  0x848412E3,
+  0x828212DE,
+  0x818112D6,
+  0x808012D1,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90BF0BDB,
+  0x87871348,
+  0x86861342,
+  0x85850BDB,
+  0x8484133C,
+  0x83831336,
+  0x8282132F,
+  0x8181120C,
+  0x80801328,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB8BF0BDB,
+  0x80B60BDB,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80BF0BDB,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAFAF13DC,
+  0xADAD13D5,
+  0xACAC13CB,
+  0xABAB13C2,
+  0xAAAA13BA,
+  0xA9A913B0,
+  0xA8A813AB,
+  0xA7A713A4,
+  0xA6A6139F,
+  0xA5A51399,
+  0xA4A41393,
+  0xA3A3138B,
+  0xA2A21386,
+  0xA1A11230,
+  0xA0A0137E,
+  0x9F9F1375,
+  0x9E9E136F,
+  0x9C9C1369,
+  0x9B9B128E,
+  0x9A9A1363,
+  0x9999135D,
+  0x98981357,
+  0x93931352,
+  0x9292134D,
+  0x80BF0BDB,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9F9F13E8,
+  0x9E9E13E2,
+  0x809D0BDB,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF144E,
+  0xBEBE1449,
+  0xBDBD1443,
+  0xBCBC143C,
+  0xBBBB1437,
+  0xB9B91430,
+  0xB8B8142B,
+  0xB7B71425,
+  0xB6B6141F,
+  0xB5B5141A,
+  0xB4B41415,
+  0xAFAF1410,
+  0xAEAE140B,
+  0xADAD1404,
+  0xACAC13F9,
+  0xABAB13F4,
+  0xA9A913EE,
+  0xA4BA0BDB,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB1B11537,
+  0xAFAF1531,
+  0xAEAE152B,
+  0xACAC1525,
+  0xABAB151E,
+  0xAAAA1518,
+  0xA0B00CC4,
+  0x9F9F1513,
+  0x9E9E1504,
+  0x9D9D14F3,
+  0x9B9B14E8,
+  0x9A9A14E3,
+  0x989814DB,
+  0x97970CC4,
+  0x969614CA,
+  0x949414C4,
+  0x939314BE,
+  0x929214B4,
+  0x91911484,
+  0x90901456,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xF0F00D03,
+  0xEFEF0CED,
+  0xEDED0CE6,
+  0xEAEA0CC9,
+  0xE5EC0CC4,
+  0xE4E40CBE,
+  0xE3E30CB1,
+  0xE2E20CA0,
+  0xE1E10C6F,
+  0xE0E00C4C,
+  0xDFDF0C45,
+  0xDEDE0C3F,
+  0xDDDD0C3A,
+  0xDCDC0C34,
+  0xDBDB0C2B,
+  0xD9D90C23,
+  0xD8D80C1E,
+  0xD7D70C18,
+  0xD6D60C13,
+  0xD5D50C0C,
+  0xD4D40C06,
+  0xD2D20C00,
+  0xD0DA0BDB,
+  0xCFCF0BFA,
+  0xCECE0BF1,
+  0xCDCD0BE9,
+  0xCBCB0BE0,
+  0xC4CA0BDB,
+  0xC3C30BD4,
+  0xC2C20BCD,
+  0x617A0D1B,
+  0x5F5F0D1B,
+  0x415A0D1B,
+  0x3A3A0BA5,
+  0x30390D1B,
+  0x2828153D,
+  0x20200D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x09090D1B,
+  0x00080D45,
+  0x08000BA3,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0xF0F00155,
+  0xEFEF0142,
+  0xEDED013E,
+  0xEAEA0124,
+  0xE5EC0122,
+  0xE4E4011F,
+  0xE3E30115,
+  0xE2E20107,
+  0xE1E100D9,
+  0xE0E000B9,
+  0xDFDF00B5,
+  0xDEDE00B2,
+  0xDDDD00B0,
+  0xDCDC00AD,
+  0xDBDB00A7,
+  0xD9D900A2,
+  0xD8D800A0,
+  0xD7D7009D,
+  0xD6D6009B,
+  0xD5D50097,
+  0xD4D40094,
+  0xD2D20091,
+  0xD0DA007B,
+  0xCFCF008E,
+  0xCECE0088,
+  0xCDCD0083,
+  0xCBCB007D,
+  0xC4CA007B,
+  0xC3C30077,
+  0xC2C20073,
+  0x7272154A,
+  0x617A004E,
+  0x5F5F004E,
+  0x415A004E,
+  0x303A004E,
+  0x20200202,
+  0x09090202,
+  0x00FFFFFF,
+  0xF0F00155,
+  0xEFEF0142,
+  0xEDED013E,
+  0xEAEA0124,
+  0xE5EC0122,
+  0xE4E4011F,
+  0xE3E30115,
+  0xE2E20107,
+  0xE1E100D9,
+  0xE0E000B9,
+  0xDFDF00B5,
+  0xDEDE00B2,
+  0xDDDD00B0,
+  0xDCDC00AD,
+  0xDBDB00A7,
+  0xD9D900A2,
+  0xD8D800A0,
+  0xD7D7009D,
+  0xD6D6009B,
+  0xD5D50097,
+  0xD4D40094,
+  0xD2D20091,
+  0xD0DA007B,
+  0xCFCF008E,
+  0xCECE0088,
+  0xCDCD0083,
+  0xCBCB007D,
+  0xC4CA007B,
+  0xC3C30077,
+  0xC2C20073,
+  0x77770511,
+  0x617A004E,
+  0x5F5F004E,
+  0x415A004E,
+  0x303A004E,
+  0x20200202,
+  0x09090202,
+  0x00FFFFFF,
+  0xBFBF0679,
+  0xBCBD0679,
+  0xA8BA0679,
+  0x8DA60679,
+  0x808B0679,
+  0x00FFFFFF,
+  0x909D0679,
+  0x808D0679,
+  0x00FFFFFF,
+  0x80BA0679,
+  0x00FFFFFF,
+  0xA0BF0679,
+  0x809C0679,
+  0x00FFFFFF,
+  0x80900679,
+  0x00FFFFFF,
+  0xADBF0679,
+  0x809F0679,
+  0x00FFFFFF,
+  0x90B50679,
+  0x82890679,
+  0x80800679,
+  0x00FFFFFF,
+  0x888F0679,
+  0x80830679,
+  0x00FFFFFF,
+  0xB0BF0679,
+  0xA0A90679,
+  0x809D0679,
+  0x00FFFFFF,
+  0x98BB0679,
+  0x80930679,
+  0x00FFFFFF,
+  0xB0BF0679,
+  0x80A70679,
+  0x00FFFFFF,
+  0xBCBF0679,
+  0xB0BA0679,
+  0x80A30679,
+  0x00FFFFFF,
+  0xBBBC0679,
+  0xB3B90679,
+  0xA3B10679,
+  0x97A10679,
+  0x94950679,
+  0x8C920679,
+  0x808A0679,
+  0x00FFFFFF,
+  0x80B60679,
+  0x00FFFFFF,
+  0xA0A70679,
+  0x80950679,
+  0x00FFFFFF,
+  0xB2BA0679,
+  0x87B00679,
+  0x80850679,
+  0x00FFFFFF,
+  0xBFBF0679,
+  0xBCBC0679,
+  0xB7B80679,
+  0x8AB50679,
+  0x88880679,
+  0x80850679,
+  0x00FFFFFF,
+  0xA0B60679,
+  0x80950679,
+  0x00FFFFFF,
+  0xB4B50679,
+  0xA0B20679,
+  0x00FFFFFF,
+  0xA0B90679,
+  0x80950679,
+  0x00FFFFFF,
+  0xBEBF0679,
+  0x80B70679,
+  0x00FFFFFF,
+  0x99B50679,
+  0x95970679,
+  0x90930679,
+  0x80800679,
+  0x00FFFFFF,
+  0xA0BC0679,
+  0x00FFFFFF,
+  0x809C0679,
+  0x00FFFFFF,
+  0x89A40679,
+  0x80870679,
+  0x00FFFFFF,
+  0xA0B20679,
+  0x80950679,
+  0x00FFFFFF,
+  0x80910679,
+  0x00FFFFFF,
+  0x80B20679,
+  0x00FFFFFF,
+  0xB0B90679,
+  0x80A30679,
+  0x00FFFFFF,
+  0xB0B10679,
+  0x80A90679,
+  0x00FFFFFF,
+  0xB0BF0679,
+  0xA7A70679,
+  0x809C0679,
+  0x00FFFFFF,
+  0xB0BF0679,
+  0x80850679,
+  0x00FFFFFF,
+  0xB0BF0679,
+  0x80810679,
+  0x00FFFFFF,
+  0xA0B60679,
+  0x80840679,
+  0x00FFFFFF,
+  0x83B70679,
+  0x00FFFFFF,
+  0xB5B50679,
+  0xB1B20679,
+  0xA6AF0679,
+  0x00FFFFFF,
+  0x83AF0679,
+  0x00FFFFFF,
+  0xB0B90679,
+  0x90A80679,
+  0x00FFFFFF,
+  0xB6BF0679,
+  0x83A60679,
+  0x00FFFFFF,
+  0xB6B60679,
+  0x90B20679,
+  0x87870679,
+  0x84840679,
+  0x00FFFFFF,
+  0x83B20679,
+  0x00FFFFFF,
+  0x9C9C0679,
+  0x909A0679,
+  0x81840679,
+  0x00FFFFFF,
+  0x93AB0679,
+  0x80910679,
+  0x00FFFFFF,
+  0xB0BF0679,
+  0x9FA80679,
+  0x8F9D0679,
+  0x8A8D0679,
+  0x88880679,
+  0x80860679,
+  0x00FFFFFF,
+  0xB0B90679,
+  0x809E0679,
+  0x00FFFFFF,
+  0x9DA10679,
+  0x90900679,
+  0x00FFFFFF,
+  0x80B40679,
+  0x00FFFFFF,
+  0x9FA10679,
+  0x90990679,
+  0x878A0679,
+  0x00FFFFFF,
+  0x80AF0679,
+  0x00FFFFFF,
+  0x90990679,
+  0x87870679,
+  0x84850679,
+  0x00FFFFFF,
+  0x80AE0679,
+  0x00FFFFFF,
+  0x989B0679,
+  0x00FFFFFF,
+  0x90990679,
+  0x84840679,
+  0x00FFFFFF,
+  0xB8B80679,
+  0x80AA0679,
+  0x00FFFFFF,
+  0xB0B90679,
+  0x809A0679,
+  0x00FFFFFF,
+  0x80860679,
+  0x00FFFFFF,
+  0x80AB0679,
+  0x00FFFFFF,
+  0xBFBF0679,
+  0x80A90679,
+  0x00FFFFFF,
+  0xBFBF0679,
+  0x98AF0679,
+  0x95960679,
+  0x8C930679,
+  0x89890679,
+  0x80860679,
+  0x00FFFFFF,
+  0x90990679,
+  0x81810679,
+  0x00FFFFFF,
+  0xAABF0679,
+  0xA0A70679,
+  0x00FFFFFF,
+  0xA3A30679,
+  0xA1A10679,
+  0x80900679,
+  0x00FFFFFF,
+  0xBABA0679,
+  0x8BB20679,
+  0x80800679,
+  0x00FFFFFF,
+  0x9CBF0679,
+  0x90900679,
+  0x00FFFFFF,
+  0xB0BF0679,
+  0x9D9D0679,
+  0x80890679,
+  0x00FFFFFF,
+  0x8AAE0679,
+  0x80880679,
+  0x00FFFFFF,
+  0xB2BF0679,
+  0x90990679,
+  0x80800679,
+  0x00FFFFFF,
+  0x808F0679,
+  0x00FFFFFF,
+  0x8BB00679,
+  0x88890679,
+  0x80860679,
+  0x00FFFFFF,
+  0xAABF0679,
+  0xA7A80679,
+  0xA0A50679,
+  0x90990679,
+  0x86860679,
+  0x00FFFFFF,
+  0xA0A90679,
+  0x98980679,
+  0x80890679,
+  0x00FFFFFF,
+  0xA0B20679,
+  0x00FFFFFF,
+  0xB0B00679,
+  0x00FFFFFF,
+  0x80830679,
+  0x00FFFFFF,
+  0x80B00679,
+  0x00FFFFFF,
+  0xB0BF0679,
+  0xA0A90679,
+  0x809E0679,
+  0x00FFFFFF,
+  0x90AD0679,
+  0x80890679,
+  0x00FFFFFF,
+  0xBDBF0679,
+  0xA3B70679,
+  0x90990679,
+  0x80830679,
+  0x00FFFFFF,
+  0x90900679,
+  0x808A0679,
+  0x00FFFFFF,
+  0x939F0679,
+  0x00FFFFFF,
+  0xA3A30679,
+  0xA0A10679,
+  0x00FFFFFF,
+  0x80B70679,
+  0x00FFFFFF,
+  0x80950679,
+  0x00FFFFFF,
+  0xBDBE0679,
+  0xB5BB0679,
+  0xB0B30679,
+  0x00FFFFFF,
+  0x80A20679,
+  0x00FFFFFF,
+  0xB0BF0679,
+  0xA4A70679,
+  0x90920679,
+  0x00FFFFFF,
+  0x80BB0679,
+  0x00FFFFFF,
+  0xB0BC0679,
+  0x80AA0679,
+  0x00FFFFFF,
+  0x90990679,
+  0x80880679,
+  0x00FFFFFF,
+  0x96BF0679,
+  0x80940679,
+  0x00FFFFFF,
+  0xBDBF0679,
+  0xBBBB0679,
+  0xAEB90679,
+  0xA9AC0679,
+  0xA5A60679,
+  0xA2A20679,
+  0x9E9F0679,
+  0x809C0679,
+  0x00FFFFFF,
+  0x85BF0679,
+  0x80830679,
+  0x00FFFFFF,
+  0xBBBE0679,
+  0x9EB90679,
+  0x969C0679,
+  0x8D940679,
+  0x878A0679,
+  0x80850679,
+  0x00FFFFFF,
+  0x92BF0679,
+  0x8A900679,
+  0x86860679,
+  0x80840679,
+  0x00FFFFFF,
+  0xA8BF0679,
+  0x80A50679,
+  0x00FFFFFF,
+  0xBCBF0679,
+  0x9CBA0679,
+  0x829A0679,
+  0x80800679,
+  0x00FFFFFF,
+  0xB6BF0679,
+  0x96B40679,
+  0x80940679,
+  0x00FFFFFF,
+  0xB0BF0679,
+  0x90AE0679,
+  0x808E0679,
+  0x00FFFFFF,
+  0xAABF0679,
+  0x8AA80679,
+  0x80880679,
+  0x00FFFFFF,
+  0x8EBF0679,
+  0x848B0679,
+  0x80820679,
+  0x00FFFFFF,
+  0xB7BD0679,
+  0x80AC0679,
+  0x00FFFFFF,
+  0x8E8E0679,
+  0x80890679,
+  0x00FFFFFF,
+  0x90AD0679,
+  0x00FFFFFF,
+  0xB0B90679,
+  0x80AB0679,
+  0x00FFFFFF,
+  0xB0BE0679,
+  0xADAE0679,
+  0xA8AB0679,
+  0xA0A60679,
+  0x00FFFFFF,
+  0x80840679,
+  0x00FFFFFF,
+  0x90990679,
+  0x8B8B0679,
+  0x80830679,
+  0x00FFFFFF,
+  0xBBBB0679,
+  0xB9B90679,
+  0xB4B70679,
+  0xA9B20679,
+  0xA7A70679,
+  0xA4A40679,
+  0xA1A20679,
+  0x859F0679,
+  0x80830679,
+  0x00FFFFFF,
+  0xBEBE0679,
+  0xB9BC0679,
+  0xB4B70679,
+  0xACB20679,
+  0xA7AA0679,
+  0xA4A40679,
+  0xA1A20679,
+  0x9F9F0679,
+  0x9D9D0679,
+  0x9B9B0679,
+  0x99990679,
+  0x97970679,
+  0x94940679,
+  0x91920679,
+  0x8D8F0679,
+  0x8B8B0679,
+  0x89890679,
+  0x87870679,
+  0x82820679,
+  0x00FFFFFF,
+  0xABBB0679,
+  0xA5A90679,
+  0xA1A30679,
+  0x8B9B0679,
+  0x80890679,
+  0x00FFFFFF,
+  0xB0B90679,
+  0x00FFFFFF,
+  0x809F0679,
+  0x00FFFFFF,
+  0xB0BF0679,
+  0x80A10679,
+  0x00FFFFFF,
+  0x80A00679,
+  0x00FFFFFF,
+  0x809D0679,
+  0x00FFFFFF,
+  0x808A0679,
+  0x00FFFFFF,
+  0x08001574,
+  0xF4F41691,
+  0xF1F3168F,
+  0xF0F01679,
+  0xEFEF1666,
+  0xEEEE1664,
+  0xEDED1661,
+  0xEAEA1648,
+  0xE4E41646,
+  0xE3E3163D,
+  0xE2E2162E,
+  0xE1E11601,
+  0xE0E015E0,
+  0xDFDF15DC,
+  0xDEDE15D9,
+  0xDDDD15D7,
+  0xDCDC15D3,
+  0xDBDB15CE,
+  0xD9D915CA,
+  0xD8D815C8,
+  0xD7D715C4,
+  0xD6D615C2,
+  0xD5D515BF,
+  0xD4D415BD,
+  0xD2D215BB,
+  0xCFCF15B9,
+  0xCECE15B3,
+  0xCDCD15AE,
+  0xCCCC15AC,
+  0xCBCB15A6,
+  0xC3C315A3,
+  0xC2C2159E,
+  0x7C7F1576,
+  0x7B7B1570,
+  0x60601576,
+  0x5B5E1576,
+  0x3C401576,
+  0x3A3A1576,
+  0x20200F2F,
+  0x0B2F1576,
+  0x0AFFFFFF,
+  0x09090F2F,
+  0x00081576,
+  0x80BF0B98,
+  0x00FFFFFF,
+  0xA0BF0F5A,
+  0x00FFFFFF,
+  0x80BF0F5A,
+  0x00FFFFFF,
+  0x809F0F5A,
+  0x00FFFFFF,
+  0x90BF0F5E,
+  0x00FFFFFF,
+  0x80BF0F5E,
+  0x00FFFFFF,
+  0x808F0F5E,
+  0x00FFFFFF,
+  0xFD000000,
+  0x00FFFFFF,
+  0x08000BA3,
+  0xBABA0BA5,
+  0xB5B50BA5,
+  0xAAAA0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB8BF0BA5,
+  0x98B60BA5,
+  0x80960BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80BF0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAEAE0BA5,
+  0xACAC0BA5,
+  0xA0A40BA5,
+  0x86910BA5,
+  0x80810BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF0BA5,
+  0xBABD0BA5,
+  0xB6B70BA5,
+  0xB0B40BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA3BF0BA5,
+  0x8EA10BA5,
+  0x8C8C0BA5,
+  0x888A0BA5,
+  0x86860BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB7BF0BA5,
+  0x80B50BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x8ABF0BA5,
+  0x80810BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB1BF0BA5,
+  0x80AF0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0BF0BA5,
+  0x99990BA5,
+  0x80960BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80880BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAFB20BA5,
+  0x90AA0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0BF0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB1BF0BA5,
+  0xAEAF0BA5,
+  0xA0A90BA5,
+  0x808A0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF0BA5,
+  0xAEBC0BA5,
+  0xA5A60BA5,
+  0x95950BA5,
+  0x80930BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x92AF0BA5,
+  0x90900BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x8DBF0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB1B10BA5,
+  0x80A50BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBABA0BA5,
+  0xB4B50BA5,
+  0x80AA0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBEBE178D,
+  0xBDBD1787,
+  0xBCBC1781,
+  0xBBBB1779,
+  0xBABA176D,
+  0xB9B91767,
+  0xB8B81761,
+  0xB7B7175B,
+  0xB6B61753,
+  0xB5B5174A,
+  0xB4B41742,
+  0xB3B3173A,
+  0xB2B2172F,
+  0xB1B11727,
+  0xB0B0171E,
+  0xAFAF1718,
+  0xAEAE170A,
+  0xADAD1702,
+  0xACAC16F7,
+  0xABAB16EF,
+  0xAAAA16E4,
+  0xA9A916DC,
+  0xA8A816D1,
+  0xA7A716C8,
+  0xA6A616BC,
+  0xA5A516B4,
+  0xA4A416AE,
+  0xA3A316A9,
+  0xA2A216A2,
+  0xA1A1169B,
+  0xA0A01693,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF18A1,
+  0xBEBE189A,
+  0xBDBD188F,
+  0xBCBC1888,
+  0xB8BB0F78,
+  0xB4B60F78,
+  0xB3B31880,
+  0xB2B21879,
+  0xB1B11873,
+  0xB0B0186E,
+  0xAFAF1869,
+  0xAEAE1863,
+  0xADAD185D,
+  0xACAC1858,
+  0xAAAA1851,
+  0xA9A9184C,
+  0xA8A81846,
+  0xA7A71840,
+  0xA6A6183A,
+  0xA5A51834,
+  0xA4A4182F,
+  0xA3A3182A,
+  0xA2A21822,
+  0xA1A1181D,
+  0xA0A01817,
+  0x9F9F1810,
+  0x9E9E180B,
+  0x9D9D1804,
+  0x9C9C17FE,
+  0x9B9B17F8,
+  0x9A9A17F2,
+  0x999917EC,
+  0x909017E7,
+  0x8F8F17E1,
+  0x8E8E17DB,
+  0x8D8D17D6,
+  0x8C8C17CF,
+  0x8B8B17C7,
+  0x8A8A17BE,
+  0x898917B4,
+  0x84980F78,
+  0x838317AB,
+  0x828217A3,
+  0x81811798,
+  0x80801792,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB8B818FE,
+  0xB7B718F6,
+  0xB6B618ED,
+  0xB5B518E7,
+  0xB4B418DF,
+  0xB3B318D8,
+  0xB0B20F78,
+  0x868618D3,
+  0x858518CD,
+  0x848418BE,
+  0x828218B9,
+  0x818118B1,
+  0x808018AC,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90BF0F78,
+  0x87871923,
+  0x8686191D,
+  0x85850F78,
+  0x84841917,
+  0x83831911,
+  0x8282190A,
+  0x818117E7,
+  0x80801903,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB8BF0F78,
+  0x80B60F78,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80BF0F78,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAFAF19B7,
+  0xADAD19B0,
+  0xACAC19A6,
+  0xABAB199D,
+  0xAAAA1995,
+  0xA9A9198B,
+  0xA8A81986,
+  0xA7A7197F,
+  0xA6A6197A,
+  0xA5A51974,
+  0xA4A4196E,
+  0xA3A31966,
+  0xA2A21961,
+  0xA1A1180B,
+  0xA0A01959,
+  0x9F9F1950,
+  0x9E9E194A,
+  0x9C9C1944,
+  0x9B9B1869,
+  0x9A9A193E,
+  0x99991938,
+  0x98981932,
+  0x9393192D,
+  0x92921928,
+  0x80BF0F78,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9F9F19C3,
+  0x9E9E19BD,
+  0x809D0F78,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF1A29,
+  0xBEBE1A24,
+  0xBDBD1A1E,
+  0xBCBC1A17,
+  0xBBBB1A12,
+  0xB9B91A0B,
+  0xB8B81A06,
+  0xB7B71A00,
+  0xB6B619FA,
+  0xB5B519F5,
+  0xB4B419F0,
+  0xAFAF19EB,
+  0xAEAE19E6,
+  0xADAD19DF,
+  0xACAC19D4,
+  0xABAB19CF,
+  0xA9A919C9,
+  0xA4BA0F78,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB1B11B12,
+  0xAFAF1B0C,
+  0xAEAE1B06,
+  0xACAC1B00,
+  0xABAB1AF9,
+  0xAAAA1AF3,
+  0xA0B01061,
+  0x9F9F1AEE,
+  0x9E9E1ADF,
+  0x9D9D1ACE,
+  0x9B9B1AC3,
+  0x9A9A1ABE,
+  0x98981AB6,
+  0x97971061,
+  0x96961AA5,
+  0x94941A9F,
+  0x93931A99,
+  0x92921A8F,
+  0x91911A5F,
+  0x90901A31,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA8A80D1B,
+  0xA4A40D1B,
+  0x9A9A0D1B,
+  0x80950D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0D1B,
+  0xA0AA0D1B,
+  0x80980D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0BF0D1B,
+  0x898E0D1B,
+  0x80870D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80890D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBD0D1B,
+  0x84B90D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB1BF0D1B,
+  0xA6AF0D1B,
+  0x98A10D1B,
+  0x90900D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBD0D1B,
+  0xB6B90D1B,
+  0xB2B20D1B,
+  0xAAB00D1B,
+  0x93A80D1B,
+  0x8F900D1B,
+  0x858C0D1B,
+  0x80800D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBCBC0D1B,
+  0xA6B10D1B,
+  0x9FA10D1B,
+  0x9C9D0D1B,
+  0x8E8E0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB8B90D1B,
+  0xB5B60D1B,
+  0xB2B30D1B,
+  0xAAB00D1B,
+  0x93A80D1B,
+  0x8F900D1B,
+  0x858A0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB2B40D1B,
+  0xA6AF0D1B,
+  0x9E9E0D1B,
+  0x999C0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBD0D1B,
+  0xB5B90D1B,
+  0xB2B30D1B,
+  0xAAB00D1B,
+  0x93A80D1B,
+  0x8F910D1B,
+  0x858D0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB9B90D1B,
+  0xA6AF0D1B,
+  0xA0A10D1B,
+  0x90900D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBD0D1B,
+  0xB5B90D1B,
+  0xB2B30D1B,
+  0xAAB00D1B,
+  0x93A80D1B,
+  0x8F900D1B,
+  0x858C0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB1B10D1B,
+  0xA6AF0D1B,
+  0x9FA10D1B,
+  0x9C9D0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAEB90D1B,
+  0xA8AA0D1B,
+  0xA3A40D1B,
+  0x9E9F0D1B,
+  0x9C9C0D1B,
+  0x999A0D1B,
+  0x92950D1B,
+  0x8E900D1B,
+  0x858A0D1B,
+  0x83830D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA6AF0D1B,
+  0x90900D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBD0D1B,
+  0xAAB90D1B,
+  0x92A80D1B,
+  0x8E900D1B,
+  0x858C0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA6AF0D1B,
+  0xA0A10D1B,
+  0x9D9D0D1B,
+  0x989A0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBD0D1B,
+  0xB5B90D1B,
+  0xAAB30D1B,
+  0x92A80D1B,
+  0x8E900D1B,
+  0x858C0D1B,
+  0x80800D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB1B20D1B,
+  0xA6AF0D1B,
+  0xA0A10D1B,
+  0x9D9E0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBD0D1B,
+  0x92BA0D1B,
+  0x8E900D1B,
+  0x848C0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBABF0D1B,
+  0xA6AF0D1B,
+  0x9FA10D1B,
+  0x94960D1B,
+  0x8E8E0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBD0D1B,
+  0xB3BB0D1B,
+  0x9AB10D1B,
+  0x85960D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA6AF0D1B,
+  0x80860D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB2B30D1B,
+  0x81B00D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90990D1B,
+  0x80860D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBD0D1B,
+  0xB2B30D1B,
+  0xA7B00D1B,
+  0xA5A50D1B,
+  0x8CA30D1B,
+  0x868A0D1B,
+  0x84840D1B,
+  0x81820D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9C9F0D1B,
+  0x90990D1B,
+  0x86860D1B,
+  0x80840D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0A90D1B,
+  0x80800D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x89AC0D1B,
+  0x80870D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x888C0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF0D1B,
+  0x80AA0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB5BF0D1B,
+  0xAEB00D1B,
+  0xA5A60D1B,
+  0xA1A10D1B,
+  0x9A9D0D1B,
+  0x90950D1B,
+  0x80890D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0BF0D1B,
+  0x90990D1B,
+  0x8E8E0D1B,
+  0x80810D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBCBF0D1B,
+  0x90BA0D1B,
+  0x8D8D0D1B,
+  0x87870D1B,
+  0x80850D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0BF0D1B,
+  0x9A9D0D1B,
+  0x98980D1B,
+  0x90960D1B,
+  0x8A8D0D1B,
+  0x80880D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB8BE0D1B,
+  0xB2B50D1B,
+  0x90B00D1B,
+  0x8A8D0D1B,
+  0x80880D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x98BF0D1B,
+  0x88960D1B,
+  0x82850D1B,
+  0x80800D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x98BF0D1B,
+  0x92950D1B,
+  0x80900D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x809A0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0BF0D1B,
+  0x808F0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB8BD0D1B,
+  0x80B50D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x81BF0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAFBF0D1B,
+  0x80AC0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0BF0D1B,
+  0x819A0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB1B80D1B,
+  0x80AA0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9FB10D1B,
+  0x80910D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAEB00D1B,
+  0xA0AC0D1B,
+  0x80910D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80B30D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0A90D1B,
+  0x9C9C0D1B,
+  0x97970D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0BF0D1B,
+  0x90990D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80B80D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0D1B,
+  0xAAAA0D1B,
+  0x87A80D1B,
+  0x80840D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80B50D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x809E0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0B40D1B,
+  0x86AD0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0D1B,
+  0x80AB0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90990D1B,
+  0x80890D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0BF0D1B,
+  0x80960D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80940D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA7A70D1B,
+  0x90990D1B,
+  0x80890D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x85B30D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90990D1B,
+  0x858C0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAEBF0D1B,
+  0x83A00D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80A50D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80A30D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x8DBD0D1B,
+  0x80890D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBF0D1B,
+  0x90BA0D1B,
+  0x80880D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBABA0D1B,
+  0xB5B60D1B,
+  0xAEB30D1B,
+  0xA9AC0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0BF0D1B,
+  0x989D0D1B,
+  0x80950D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9FBD0D1B,
+  0x9D9D0D1B,
+  0x9B9B0D1B,
+  0x99990D1B,
+  0x90970D1B,
+  0x888D0D1B,
+  0x80850D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBEBE0D1B,
+  0xB6BC0D1B,
+  0x80B40D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB6BC0D1B,
+  0xB2B40D1B,
+  0xA0AC0D1B,
+  0x969B0D1B,
+  0x90930D1B,
+  0x868C0D1B,
+  0x82840D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF0D1B,
+  0xB1B10D1B,
+  0x94940D1B,
+  0x80800D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x909C0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBCBF0D1B,
+  0xAFB90D1B,
+  0xAAAD0D1B,
+  0xA8A80D1B,
+  0xA6A60D1B,
+  0xA4A40D1B,
+  0x999D0D1B,
+  0x95950D1B,
+  0x8A930D1B,
+  0x87870D1B,
+  0x82820D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x8E8E0D1B,
+  0x85890D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x83840D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB2B30D1B,
+  0xABAE0D1B,
+  0x80A40D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0D1B,
+  0xADAD0D1B,
+  0xA7A70D1B,
+  0x80A50D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAFAF0D1B,
+  0x80A70D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB8BE0D1B,
+  0xB0B60D1B,
+  0xA8AE0D1B,
+  0xA0A60D1B,
+  0x80960D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x989E0D1B,
+  0x90960D1B,
+  0x888E0D1B,
+  0x80860D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAFAF0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBBBC0D1B,
+  0xB1B50D1B,
+  0x85860D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA1BF0D1B,
+  0x9D9F0D1B,
+  0x80960D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBCBF0D1B,
+  0x80BA0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB1BF0D1B,
+  0x85AF0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0BF0D1B,
+  0x808E0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x808C0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90BD0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90AB0D1B,
+  0x808C0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF0D1B,
+  0x80AE0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0BF0D1B,
+  0x809D0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA2BF0D1B,
+  0x979F0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x8BBF0D1B,
+  0x80880D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB2BF0D1B,
+  0x95990D1B,
+  0x93930D1B,
+  0x90910D1B,
+  0x808A0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x8CA20D1B,
+  0x878A0D1B,
+  0x83850D1B,
+  0x80810D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x82B30D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBE0D1B,
+  0xBBBB0D1B,
+  0xB2B70D1B,
+  0x90990D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0D1B,
+  0x80A50D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0BC0D1B,
+  0x80860D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x84B20D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA6BE0D1B,
+  0xA0A40D1B,
+  0x8F990D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80A80D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBEBF0D1B,
+  0xBABA0D1B,
+  0xA0B60D1B,
+  0x90990D1B,
+  0x848B0D1B,
+  0x80820D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB9BD0D1B,
+  0xB5B60D1B,
+  0xB1B10D1B,
+  0x80AF0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB2B40D1B,
+  0xA0AA0D1B,
+  0x9B9D0D1B,
+  0x82820D1B,
+  0x80800D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0D1B,
+  0xA8AE0D1B,
+  0xA0A60D1B,
+  0x91960D1B,
+  0x898E0D1B,
+  0x81860D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0D1B,
+  0x9CA90D1B,
+  0x809A0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0B90D1B,
+  0x80A20D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0D1B,
+  0x80A30D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x8BBB0D1B,
+  0x80860D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0D1B,
+  0x80AD0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80990D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBEBE0D1B,
+  0xB8BC0D1B,
+  0xAAB60D1B,
+  0x9FA80D1B,
+  0x9D9D0D1B,
+  0x93970D1B,
+  0x80860D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x86BF0D1B,
+  0x83840D1B,
+  0x80810D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80B10D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x93BF0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80BD0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90BF0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x92BF0D1B,
+  0x808F0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BB0D1B,
+  0x80870D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB3B40D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB6BF0D1B,
+  0xB0B40D1B,
+  0x8D8F0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80BC0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF0D1B,
+  0xA1BA0D1B,
+  0x90990D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA6BF0D1B,
+  0x819A0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80BE0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9A9C0D1B,
+  0x92970D1B,
+  0x8A8F0D1B,
+  0x82870D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF1BEA,
+  0xBEBE1BE4,
+  0xBDBD1BDE,
+  0xBCBC1BD7,
+  0xBABA1BD1,
+  0xB4B41BCB,
+  0xB2B31BC6,
+  0xB1B10C13,
+  0xB0B00BDB,
+  0xAEAE1BC1,
+  0xADAD1BBB,
+  0xACAC124F,
+  0xABAB1BB5,
+  0xAAAA1BB0,
+  0xA9A91BAB,
+  0xA8A81BA3,
+  0xA6A61B9D,
+  0xA4A41B97,
+  0xA3A31B91,
+  0xA2A21254,
+  0xA1A11B8B,
+  0xA0A01B81,
+  0x9E9E1B7A,
+  0x9D9D1B74,
+  0x9C9C1B6F,
+  0x989B0BDB,
+  0x96961B64,
+  0x95951B5D,
+  0x94941B57,
+  0x93931B51,
+  0x92921B4A,
+  0x90910BDB,
+  0x8F8F1B44,
+  0x8E8E1363,
+  0x8D8D1B3D,
+  0x8C8C1B37,
+  0x8B8B1B32,
+  0x8A8A1B2C,
+  0x83831B27,
+  0x82820BDB,
+  0x81811B21,
+  0x80801B18,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBEBE1CE0,
+  0xBBBB1CDB,
+  0xB6B61CD4,
+  0xB5B51CCB,
+  0xB4B41CC4,
+  0xB2B21CBF,
+  0xB1B11CB8,
+  0xB0B01CB2,
+  0xABAB1242,
+  0xAAAA1CAB,
+  0xA9A91CA5,
+  0xA8A81C9E,
+  0xA7A71C97,
+  0xA6A61C91,
+  0xA5A51C8B,
+  0xA4A41C81,
+  0xA3A31C7B,
+  0xA2A20C1E,
+  0xA0A01C76,
+  0x9D9D1C71,
+  0x9C9C1C6B,
+  0x9B9B10CE,
+  0x9A9A1C65,
+  0x99991C5F,
+  0x98981C49,
+  0x97971C5A,
+  0x96961C55,
+  0x93931C4E,
+  0x92921C49,
+  0x91911C42,
+  0x90901C3D,
+  0x8D8D1C37,
+  0x8C8C111C,
+  0x8B8B1C31,
+  0x8A8A1C27,
+  0x88881C21,
+  0x87871C1A,
+  0x86861C15,
+  0x85851C0D,
+  0x84841C07,
+  0x83831C01,
+  0x82821BFC,
+  0x81811BF5,
+  0x80801BF0,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF1CEA,
+  0xBEBE141A,
+  0x95951CE5,
+  0x92940BDB,
+  0x8E8E13F4,
+  0x808D0BDB,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90901C55,
+  0x808F0BDB,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x99991C71,
+  0x90980BDB,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF1D0F,
+  0xBEBE1D0A,
+  0xBDBD1D04,
+  0xBCBC0BDB,
+  0xB9B90BDB,
+  0xAEAE1CBF,
+  0xADAD1CFC,
+  0xACAC1C49,
+  0xABAB1CF6,
+  0xAAAA1449,
+  0xA9A91CEF,
+  0xA8A81242,
+  0xA0A70BDB,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB4B40C13,
+  0xB3B31D1A,
+  0x9F9F1D15,
+  0x80B20BDB,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF1D1F,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB2B21D3D,
+  0xB1B11D37,
+  0xB0B00BDB,
+  0x8B8B1D32,
+  0x85851D2B,
+  0x84841D26,
+  0x808A0BDB,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBCBC1254,
+  0x9F9F1D90,
+  0x9E9E1D89,
+  0x9D9D1D82,
+  0x9C9C1D7B,
+  0x9B9B1D73,
+  0x9A9A1D6D,
+  0x95951D65,
+  0x94941D5B,
+  0x93931D55,
+  0x92921D49,
+  0x91911D43,
+  0x90990BDB,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBABA1DE6,
+  0xB9B91DCF,
+  0xB8B81DC2,
+  0xA5A51DBB,
+  0xA3A31DB6,
+  0xA0A40BDB,
+  0x9F9F1DAE,
+  0x8B8B1DA8,
+  0x8A8A1DA3,
+  0x85851D9D,
+  0x84841D97,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAFAF1DEF,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9B9B1DF4,
+  0x80BF0BDB,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0A01363,
+  0x9C9C1242,
+  0x80BF0BDB,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBABA1DF9,
+  0x80BF0BDB,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAFAF1DFF,
+  0x80AE0BDB,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA8A81E04,
+  0xA0A70BDB,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x8D8D1E09,
+  0x808C0BDB,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xF4F41E58,
+  0xF1F31E53,
+  0xF0F01E4E,
+  0xEDED1E49,
+  0xE1EF1E44,
+  0xE0E01E3F,
+  0xC2DF1E3A,
+  0x80FF0D45,
+  0x29291E0E,
+  0x0B7F153D,
+  0x0AFFFFFF,
+  0x0009153D,
+  0xF0F00155,
+  0xEFEF0142,
+  0xEDED013E,
+  0xEAEA0124,
+  0xE5EC0122,
+  0xE4E4011F,
+  0xE3E30115,
+  0xE2E20107,
+  0xE1E100D9,
+  0xE0E000B9,
+  0xDFDF00B5,
+  0xDEDE00B2,
+  0xDDDD00B0,
+  0xDCDC00AD,
+  0xDBDB00A7,
+  0xD9D900A2,
+  0xD8D800A0,
+  0xD7D7009D,
+  0xD6D6009B,
+  0xD5D50097,
+  0xD4D40094,
+  0xD2D20091,
+  0xD0DA007B,
+  0xCFCF008E,
+  0xCECE0088,
+  0xCDCD0083,
+  0xCBCB007D,
+  0xC4CA007B,
+  0xC3C30077,
+  0xC2C20073,
+  0x6E6E0511,
+  0x617A004E,
+  0x5F5F004E,
+  0x415A004E,
+  0x303A004E,
+  0x20200202,
+  0x09090202,
+  0x00FFFFFF,
+  0x08001574,
+  0x0BFF1570,
+  0x0AFFFFFF,
+  0x00091570,
+  0x07001E5D,
+  0x00FFFFFF,
+  0x08001574,
+  0xF4F41691,
+  0xF1F3168F,
+  0xF0F01679,
+  0xEFEF1666,
+  0xEEEE1664,
+  0xEDED1661,
+  0xEAEA1648,
+  0xE4E41646,
+  0xE3E3163D,
+  0xE2E2162E,
+  0xE1E11601,
+  0xE0E015E0,
+  0xDFDF15DC,
+  0xDEDE15D9,
+  0xDDDD15D7,
+  0xDCDC15D3,
+  0xDBDB15CE,
+  0xD9D915CA,
+  0xD8D815C8,
+  0xD7D715C4,
+  0xD6D615C2,
+  0xD5D515BF,
+  0xD4D415BD,
+  0xD2D215BB,
+  0xCFCF15B9,
+  0xCECE15B3,
+  0xCDCD15AE,
+  0xCCCC15AC,
+  0xCBCB15A6,
+  0xC3C315A3,
+  0xC2C2159E,
+  0x7C7F1576,
+  0x60601576,
+  0x5B5E1576,
+  0x3C401576,
+  0x3A3A1576,
+  0x0B2F1576,
+  0x0AFFFFFF,
+  0x00091576,
+  0xBBBF1576,
+  0xB6B91576,
+  0xABB41576,
+  0x80A91576,
+  0x00FFFFFF,
+  0xB7B71576,
+  0x97971576,
+  0x00FFFFFF,
+  0xAFBF1576,
+  0xADAD1576,
+  0xA5AB1576,
+  0x929F1576,
+  0x82851576,
+  0x00FFFFFF,
+  0x80BF1576,
+  0x00FFFFFF,
+  0xBEBE1576,
+  0xB8B91576,
+  0xB5B51576,
+  0x80AF1576,
+  0x00FFFFFF,
+  0xA2A21576,
+  0x8D8D1576,
+  0x8B8B1576,
+  0x87871576,
+  0x80851576,
+  0x00FFFFFF,
+  0xB6B61576,
+  0x00FFFFFF,
+  0x82891576,
+  0x00FFFFFF,
+  0xB0B01576,
+  0x00FFFFFF,
+  0x9A9F1576,
+  0x97981576,
+  0x00FFFFFF,
+  0x89BF1576,
+  0x00FFFFFF,
+  0xB3BF1576,
+  0xABAE1576,
+  0x808F1576,
+  0x00FFFFFF,
+  0x809F1576,
+  0x00FFFFFF,
+  0xB0B01576,
+  0xAAAD1576,
+  0x8B9F1576,
+  0x00FFFFFF,
+  0xBDBE1576,
+  0xA7AD1576,
+  0x96A41576,
+  0x94941576,
+  0x00FFFFFF,
+  0xB0BF1576,
+  0x91911576,
+  0x808F1576,
+  0x00FFFFFF,
+  0x808C1576,
+  0x00FFFFFF,
+  0xB2BF1576,
+  0xA6B01576,
+  0x00FFFFFF,
+  0xBBBF1576,
+  0xB6B91576,
+  0xABB31576,
+  0x00FFFFFF,
+  0xBFBF15AC,
+  0xBEBE1F0E,
+  0xBDBD1F0B,
+  0xBCBC1F08,
+  0xBBBB1F03,
+  0xBABA1EF9,
+  0xB9B91EF6,
+  0xB8B81EF2,
+  0xB7B71EEF,
+  0xB6B61EE9,
+  0xB5B51EE3,
+  0xB4B41EDD,
+  0xB3B31ED7,
+  0xB2B21ECF,
+  0xB1B11EC9,
+  0xB0B01EC2,
+  0xAFAF1EBE,
+  0xAEAE1EB2,
+  0xADAD1EAC,
+  0xACAC1EA3,
+  0xABAB1E9D,
+  0xAAAA1E94,
+  0xA9A91E8E,
+  0xA8A81E85,
+  0xA7A71E7E,
+  0xA6A61E75,
+  0xA5A51E70,
+  0xA4A41E6C,
+  0xA3A31E6A,
+  0xA2A21E67,
+  0xA1A11E64,
+  0xA0A01E5F,
+  0x00FFFFFF,
+  0xBFBF1F9C,
+  0xBEBE1F98,
+  0xBDBD1F90,
+  0xBCBC1F8D,
+  0xB7B715AC,
+  0xB3B31F87,
+  0xB2B21F84,
+  0xB1B11F81,
+  0xB0B01F7F,
+  0xAFAF1F7D,
+  0xAEAE1F7A,
+  0xADAD1F76,
+  0xACAC1F73,
+  0xABAB15AC,
+  0xAAAA1F6F,
+  0xA9A91F6D,
+  0xA8A81F6B,
+  0xA7A71F68,
+  0xA6A61F66,
+  0xA5A51F62,
+  0xA4A41F60,
+  0xA3A31F5E,
+  0xA2A21F5A,
+  0xA1A11F58,
+  0xA0A01F55,
+  0x9F9F1F50,
+  0x9E9E1F4E,
+  0x9D9D1F4A,
+  0x9C9C1F47,
+  0x9B9B1F44,
+  0x9A9A1F41,
+  0x99991F3F,
+  0x90901F3D,
+  0x8F8F1F3A,
+  0x8E8E1F38,
+  0x8D8D1F36,
+  0x8C8C1F33,
+  0x8B8B1F2F,
+  0x8A8A1F29,
+  0x89891F23,
+  0x83831F1E,
+  0x82821F1A,
+  0x81811F13,
+  0x80801F11,
+  0x00FFFFFF,
+  0xB9BF15AC,
+  0xB8B81FD7,
+  0xB7B71FD2,
+  0xB6B61FCC,
+  0xB5B51FC9,
+  0xB4B41FC5,
+  0xB3B31FC1,
+  0x86861FBE,
+  0x85851FBA,
+  0x84841FAE,
+  0x83AF15AC,
+  0x82821FAB,
+  0x81811FA7,
+  0x80801FA5,
+  0x00FFFFFF,
+  0x888F15AC,
+  0x87871FE9,
+  0x86861FE7,
+  0x84841FE4,
+  0x83831FE2,
+  0x82821FDF,
+  0x81811F3D,
+  0x80801FDA,
+  0x00FFFFFF,
+  0xB7B715AC,
+  0x00FFFFFF,
+  0xAFAF2039,
+  0xADAD2036,
+  0xACAC202F,
+  0xABAB2029,
+  0xAAAA2024,
+  0xA9A9201E,
+  0xA8A8201C,
+  0xA7A72017,
+  0xA6A62014,
+  0xA5A52011,
+  0xA4A4200F,
+  0xA3A32009,
+  0xA2A22006,
+  0xA1A11F4E,
+  0xA0A02001,
+  0x9F9F1FFC,
+  0x9E9E1FFA,
+  0x9C9C1FF7,
+  0x9B9B1F7D,
+  0x9A9A1FF5,
+  0x99991FF3,
+  0x98981FF0,
+  0x93931FED,
+  0x92921FEB,
+  0x00FFFFFF,
+  0x9F9F203E,
+  0x9E9E203C,
+  0x00FFFFFF,
+  0x80BF15AC,
+  0x00FFFFFF,
+  0xBFBF206F,
+  0xBEBE206D,
+  0xBDBD206A,
+  0xBCBC2066,
+  0xBBBB2064,
+  0xB9B92060,
+  0xB8B8205D,
+  0xB7B7205A,
+  0xB6B62058,
+  0xB5B52056,
+  0xB4B42054,
+  0xAFAF2052,
+  0xAEAE2050,
+  0xADAD204D,
+  0xACAC2045,
+  0xABAB2043,
+  0xA9A92041,
+  0x80A315AC,
+  0x00FFFFFF,
+  0xB2BF1664,
+  0xB1B12127,
+  0xAFAF2123,
+  0xAEAE2120,
+  0xACAC211E,
+  0xABAB211B,
+  0xAAAA2119,
+  0x9F9F2116,
+  0x9E9E2109,
+  0x9D9D20FA,
+  0x9B9B20F2,
+  0x9A9A20EF,
+  0x999C1664,
+  0x989820EA,
+  0x969620DC,
+  0x95951664,
+  0x949420D8,
+  0x939320D5,
+  0x929220CE,
+  0x919120A0,
+  0x90902075,
+  0x00FFFFFF,
+  0x80BF1664,
+  0x00FFFFFF,
+  0x808F1664,
+  0x00FFFFFF,
+  0x08000BA3,
+  0xA8A80BA5,
+  0xA4A40BA5,
+  0x9A9A0BA5,
+  0x80950BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0BA5,
+  0xA0AA0BA5,
+  0x80980BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0BF0BA5,
+  0x898E0BA5,
+  0x80870BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80890BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBD0BA5,
+  0x84B90BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB1BF0BA5,
+  0xA6AF0BA5,
+  0x98A10BA5,
+  0x90900BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBD0BA5,
+  0xB6B90BA5,
+  0xB2B20BA5,
+  0xAAB00BA5,
+  0x93A80BA5,
+  0x8F900BA5,
+  0x858C0BA5,
+  0x80800BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBCBC0BA5,
+  0xA6B10BA5,
+  0x9FA10BA5,
+  0x9C9D0BA5,
+  0x8E8E0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB8B90BA5,
+  0xB5B60BA5,
+  0xB2B30BA5,
+  0xAAB00BA5,
+  0x93A80BA5,
+  0x8F900BA5,
+  0x858A0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB2B40BA5,
+  0xA6AF0BA5,
+  0x9E9E0BA5,
+  0x999C0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBD0BA5,
+  0xB5B90BA5,
+  0xB2B30BA5,
+  0xAAB00BA5,
+  0x93A80BA5,
+  0x8F910BA5,
+  0x858D0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB9B90BA5,
+  0xA6AF0BA5,
+  0xA0A10BA5,
+  0x90900BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBD0BA5,
+  0xB5B90BA5,
+  0xB2B30BA5,
+  0xAAB00BA5,
+  0x93A80BA5,
+  0x8F900BA5,
+  0x858C0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB1B10BA5,
+  0xA6AF0BA5,
+  0x9FA10BA5,
+  0x9C9D0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAEB90BA5,
+  0xA8AA0BA5,
+  0xA3A40BA5,
+  0x9E9F0BA5,
+  0x9C9C0BA5,
+  0x999A0BA5,
+  0x92950BA5,
+  0x8E900BA5,
+  0x858A0BA5,
+  0x83830BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA6AF0BA5,
+  0x90900BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBD0BA5,
+  0xAAB90BA5,
+  0x92A80BA5,
+  0x8E900BA5,
+  0x858C0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA6AF0BA5,
+  0xA0A10BA5,
+  0x9D9D0BA5,
+  0x989A0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBD0BA5,
+  0xB5B90BA5,
+  0xAAB30BA5,
+  0x92A80BA5,
+  0x8E900BA5,
+  0x858C0BA5,
+  0x80800BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB1B20BA5,
+  0xA6AF0BA5,
+  0xA0A10BA5,
+  0x9D9E0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBD0BA5,
+  0x92BA0BA5,
+  0x8E900BA5,
+  0x848C0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBABF0BA5,
+  0xA6AF0BA5,
+  0x9FA10BA5,
+  0x94960BA5,
+  0x8E8E0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBD0BA5,
+  0xB3BB0BA5,
+  0x9AB10BA5,
+  0x85960BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA6AF0BA5,
+  0x80860BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB2B30BA5,
+  0x81B00BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90990BA5,
+  0x80860BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBD0BA5,
+  0xB2B30BA5,
+  0xA7B00BA5,
+  0xA5A50BA5,
+  0x8CA30BA5,
+  0x868A0BA5,
+  0x84840BA5,
+  0x81820BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9C9F0BA5,
+  0x90990BA5,
+  0x86860BA5,
+  0x80840BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0A90BA5,
+  0x80800BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x89AC0BA5,
+  0x80870BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x888C0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF0BA5,
+  0x80AA0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB5BF0BA5,
+  0xAEB00BA5,
+  0xA5A60BA5,
+  0xA1A10BA5,
+  0x9A9D0BA5,
+  0x90950BA5,
+  0x80890BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0BF0BA5,
+  0x90990BA5,
+  0x8E8E0BA5,
+  0x80810BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBCBF0BA5,
+  0x90BA0BA5,
+  0x8D8D0BA5,
+  0x87870BA5,
+  0x80850BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0BF0BA5,
+  0x9A9D0BA5,
+  0x98980BA5,
+  0x90960BA5,
+  0x8A8D0BA5,
+  0x80880BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB8BE0BA5,
+  0xB2B50BA5,
+  0x90B00BA5,
+  0x8A8D0BA5,
+  0x80880BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x98BF0BA5,
+  0x88960BA5,
+  0x82850BA5,
+  0x80800BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x98BF0BA5,
+  0x92950BA5,
+  0x80900BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x809A0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0BF0BA5,
+  0x808F0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB8BD0BA5,
+  0x80B50BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x81BF0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAFBF0BA5,
+  0x80AC0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0BF0BA5,
+  0x819A0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB1B80BA5,
+  0x80AA0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9FB10BA5,
+  0x80910BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAEB00BA5,
+  0xA0AC0BA5,
+  0x80910BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80B30BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0A90BA5,
+  0x9C9C0BA5,
+  0x97970BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0BF0BA5,
+  0x90990BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80B80BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0BA5,
+  0xAAAA0BA5,
+  0x87A80BA5,
+  0x80840BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80B50BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x809E0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0B40BA5,
+  0x86AD0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0BA5,
+  0x80AB0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90990BA5,
+  0x80890BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0BF0BA5,
+  0x80960BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80940BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA7A70BA5,
+  0x90990BA5,
+  0x80890BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x85B30BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90990BA5,
+  0x858C0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAEBF0BA5,
+  0x83A00BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80A50BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80A30BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x8DBD0BA5,
+  0x80890BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBF0BA5,
+  0x90BA0BA5,
+  0x80880BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBABA0BA5,
+  0xB5B60BA5,
+  0xAEB30BA5,
+  0xA9AC0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0BF0BA5,
+  0x989D0BA5,
+  0x80950BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9FBD0BA5,
+  0x9D9D0BA5,
+  0x9B9B0BA5,
+  0x99990BA5,
+  0x90970BA5,
+  0x888D0BA5,
+  0x80850BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBEBE0BA5,
+  0xB6BC0BA5,
+  0x80B40BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB6BC0BA5,
+  0xB2B40BA5,
+  0xA0AC0BA5,
+  0x969B0BA5,
+  0x90930BA5,
+  0x868C0BA5,
+  0x82840BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF0BA5,
+  0xB1B10BA5,
+  0x94940BA5,
+  0x80800BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x909C0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBCBF0BA5,
+  0xAFB90BA5,
+  0xAAAD0BA5,
+  0xA8A80BA5,
+  0xA6A60BA5,
+  0xA4A40BA5,
+  0x999D0BA5,
+  0x95950BA5,
+  0x8A930BA5,
+  0x87870BA5,
+  0x82820BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x8E8E0BA5,
+  0x85890BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x83840BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB2B30BA5,
+  0xABAE0BA5,
+  0x80A40BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0BA5,
+  0xADAD0BA5,
+  0xA7A70BA5,
+  0x80A50BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAFAF0BA5,
+  0x80A70BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB8BE0BA5,
+  0xB0B60BA5,
+  0xA8AE0BA5,
+  0xA0A60BA5,
+  0x80960BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x989E0BA5,
+  0x90960BA5,
+  0x888E0BA5,
+  0x80860BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAFAF0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBBBC0BA5,
+  0xB1B50BA5,
+  0x85860BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA1BF0BA5,
+  0x9D9F0BA5,
+  0x80960BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBCBF0BA5,
+  0x80BA0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB1BF0BA5,
+  0x85AF0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0BF0BA5,
+  0x808E0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x808C0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90BD0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90AB0BA5,
+  0x808C0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF0BA5,
+  0x80AE0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0BF0BA5,
+  0x809D0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA2BF0BA5,
+  0x979F0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x8BBF0BA5,
+  0x80880BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB2BF0BA5,
+  0x95990BA5,
+  0x93930BA5,
+  0x90910BA5,
+  0x808A0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x8CA20BA5,
+  0x878A0BA5,
+  0x83850BA5,
+  0x80810BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x82B30BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBE0BA5,
+  0xBBBB0BA5,
+  0xB2B70BA5,
+  0x90990BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0BA5,
+  0x80A50BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0BC0BA5,
+  0x80860BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x84B20BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA6BE0BA5,
+  0xA0A40BA5,
+  0x8F990BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80A80BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBEBF0BA5,
+  0xBABA0BA5,
+  0xA0B60BA5,
+  0x90990BA5,
+  0x848B0BA5,
+  0x80820BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB9BD0BA5,
+  0xB5B60BA5,
+  0xB1B10BA5,
+  0x80AF0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB2B40BA5,
+  0xA0AA0BA5,
+  0x9B9D0BA5,
+  0x82820BA5,
+  0x80800BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0BA5,
+  0xA8AE0BA5,
+  0xA0A60BA5,
+  0x91960BA5,
+  0x898E0BA5,
+  0x81860BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0BA5,
+  0x9CA90BA5,
+  0x809A0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0B90BA5,
+  0x80A20BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0BA5,
+  0x80A30BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x8BBB0BA5,
+  0x80860BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0BA5,
+  0x80AD0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80990BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBEBE0BA5,
+  0xB8BC0BA5,
+  0xAAB60BA5,
+  0x9FA80BA5,
+  0x9D9D0BA5,
+  0x93970BA5,
+  0x80860BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x86BF0BA5,
+  0x83840BA5,
+  0x80810BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80B10BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x93BF0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80BD0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90BF0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x92BF0BA5,
+  0x808F0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BB0BA5,
+  0x80870BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB3B40BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB6BF0BA5,
+  0xB0B40BA5,
+  0x8D8F0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80BC0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF0BA5,
+  0xA1BA0BA5,
+  0x90990BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA6BF0BA5,
+  0x819A0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80BE0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9A9C0BA5,
+  0x92970BA5,
+  0x8A8F0BA5,
+  0x82870BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF21FC,
+  0xBEBE21F6,
+  0xBDBD21F0,
+  0xBCBC21E9,
+  0xBABA21E3,
+  0xB4B421DD,
+  0xB2B321D8,
+  0xB1B10FB0,
+  0xB0B00F78,
+  0xAEAE21D3,
+  0xADAD21CD,
+  0xACAC182A,
+  0xABAB21C7,
+  0xAAAA21C2,
+  0xA9A921BD,
+  0xA8A821B5,
+  0xA6A621AF,
+  0xA4A421A9,
+  0xA3A321A3,
+  0xA2A2182F,
+  0xA1A1219D,
+  0xA0A02193,
+  0x9E9E218C,
+  0x9D9D2186,
+  0x9C9C2181,
+  0x989B0F78,
+  0x96962176,
+  0x9595216F,
+  0x94942169,
+  0x93932163,
+  0x9292215C,
+  0x90910F78,
+  0x8F8F2156,
+  0x8E8E193E,
+  0x8D8D214F,
+  0x8C8C2149,
+  0x8B8B2144,
+  0x8A8A213E,
+  0x83832139,
+  0x82820F78,
+  0x81812133,
+  0x8080212A,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBEBE22F2,
+  0xBBBB22ED,
+  0xB6B622E6,
+  0xB5B522DD,
+  0xB4B422D6,
+  0xB2B222D1,
+  0xB1B122CA,
+  0xB0B022C4,
+  0xABAB181D,
+  0xAAAA22BD,
+  0xA9A922B7,
+  0xA8A822B0,
+  0xA7A722A9,
+  0xA6A622A3,
+  0xA5A5229D,
+  0xA4A42293,
+  0xA3A3228D,
+  0xA2A20FBB,
+  0xA0A02288,
+  0x9D9D2283,
+  0x9C9C227D,
+  0x9B9B16A9,
+  0x9A9A2277,
+  0x99992271,
+  0x9898225B,
+  0x9797226C,
+  0x96962267,
+  0x93932260,
+  0x9292225B,
+  0x91912254,
+  0x9090224F,
+  0x8D8D2249,
+  0x8C8C16F7,
+  0x8B8B2243,
+  0x8A8A2239,
+  0x88882233,
+  0x8787222C,
+  0x86862227,
+  0x8585221F,
+  0x84842219,
+  0x83832213,
+  0x8282220E,
+  0x81812207,
+  0x80802202,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF22FC,
+  0xBEBE19F5,
+  0x959522F7,
+  0x92940F78,
+  0x8E8E19CF,
+  0x808D0F78,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90902267,
+  0x808F0F78,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x99992283,
+  0x90980F78,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF2321,
+  0xBEBE231C,
+  0xBDBD2316,
+  0xBCBC0F78,
+  0xB9B90F78,
+  0xAEAE22D1,
+  0xADAD230E,
+  0xACAC225B,
+  0xABAB2308,
+  0xAAAA1A24,
+  0xA9A92301,
+  0xA8A8181D,
+  0xA0A70F78,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB4B40FB0,
+  0xB3B3232C,
+  0x9F9F2327,
+  0x80B20F78,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF2331,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB2B2234F,
+  0xB1B12349,
+  0xB0B00F78,
+  0x8B8B2344,
+  0x8585233D,
+  0x84842338,
+  0x808A0F78,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBCBC182F,
+  0x9F9F23A2,
+  0x9E9E239B,
+  0x9D9D2394,
+  0x9C9C238D,
+  0x9B9B2385,
+  0x9A9A237F,
+  0x95952377,
+  0x9494236D,
+  0x93932367,
+  0x9292235B,
+  0x91912355,
+  0x90990F78,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBABA23F8,
+  0xB9B923E1,
+  0xB8B823D4,
+  0xA5A523CD,
+  0xA3A323C8,
+  0xA0A40F78,
+  0x9F9F23C0,
+  0x8B8B23BA,
+  0x8A8A23B5,
+  0x858523AF,
+  0x848423A9,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAFAF2401,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9B9B2406,
+  0x80BF0F78,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0A0193E,
+  0x9C9C181D,
+  0x80BF0F78,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBABA240B,
+  0x80BF0F78,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAFAF2411,
+  0x80AE0F78,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA8A82416,
+  0xA0A70F78,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x8D8D241B,
+  0x808C0F78,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF0D1B,
+  0xBCBD0D1B,
+  0xA8BA0D1B,
+  0x8DA60D1B,
+  0x808B0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x909D0D1B,
+  0x808D0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80BA0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0BF0D1B,
+  0x809C0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80900D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xADBF0D1B,
+  0x809F0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90B50D1B,
+  0x82890D1B,
+  0x80800D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x888F0D1B,
+  0x80830D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0D1B,
+  0xA0A90D1B,
+  0x809D0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x98BB0D1B,
+  0x80930D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0D1B,
+  0x80A70D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBCBF0D1B,
+  0xB0BA0D1B,
+  0x80A30D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBBBC0D1B,
+  0xB3B90D1B,
+  0xA3B10D1B,
+  0x97A10D1B,
+  0x94950D1B,
+  0x8C920D1B,
+  0x808A0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80B60D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0A70D1B,
+  0x80950D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB2BA0D1B,
+  0x87B00D1B,
+  0x80850D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF0D1B,
+  0xBCBC0D1B,
+  0xB7B80D1B,
+  0x8AB50D1B,
+  0x88880D1B,
+  0x80850D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0B60D1B,
+  0x80950D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB4B50D1B,
+  0xA0B20D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0B90D1B,
+  0x80950D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBEBF0D1B,
+  0x80B70D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x99B50D1B,
+  0x95970D1B,
+  0x90930D1B,
+  0x80800D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0BC0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x809C0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x89A40D1B,
+  0x80870D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0B20D1B,
+  0x80950D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80910D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80B20D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0B90D1B,
+  0x80A30D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0B10D1B,
+  0x80A90D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0D1B,
+  0xA7A70D1B,
+  0x809C0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0D1B,
+  0x80850D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0D1B,
+  0x80810D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0B60D1B,
+  0x80840D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x83B70D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB5B50D1B,
+  0xB1B20D1B,
+  0xA6AF0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x83AF0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0B90D1B,
+  0x90A80D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB6BF0D1B,
+  0x83A60D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB6B60D1B,
+  0x90B20D1B,
+  0x87870D1B,
+  0x84840D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x83B20D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9C9C0D1B,
+  0x909A0D1B,
+  0x81840D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x93AB0D1B,
+  0x80910D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0D1B,
+  0x9FA80D1B,
+  0x8F9D0D1B,
+  0x8A8D0D1B,
+  0x88880D1B,
+  0x80860D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0B90D1B,
+  0x809E0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9DA10D1B,
+  0x90900D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80B40D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9FA10D1B,
+  0x90990D1B,
+  0x878A0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80AF0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90990D1B,
+  0x87870D1B,
+  0x84850D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80AE0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x989B0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90990D1B,
+  0x84840D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB8B80D1B,
+  0x80AA0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0B90D1B,
+  0x809A0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80860D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80AB0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF0D1B,
+  0x80A90D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF0D1B,
+  0x98AF0D1B,
+  0x95960D1B,
+  0x8C930D1B,
+  0x89890D1B,
+  0x80860D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90990D1B,
+  0x81810D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAABF0D1B,
+  0xA0A70D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA3A30D1B,
+  0xA1A10D1B,
+  0x80900D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBABA0D1B,
+  0x8BB20D1B,
+  0x80800D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9CBF0D1B,
+  0x90900D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0D1B,
+  0x9D9D0D1B,
+  0x80890D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x8AAE0D1B,
+  0x80880D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB2BF0D1B,
+  0x90990D1B,
+  0x80800D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x808F0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x8BB00D1B,
+  0x88890D1B,
+  0x80860D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAABF0D1B,
+  0xA7A80D1B,
+  0xA0A50D1B,
+  0x90990D1B,
+  0x86860D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0A90D1B,
+  0x98980D1B,
+  0x80890D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0B20D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0B00D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80830D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80B00D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0D1B,
+  0xA0A90D1B,
+  0x809E0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90AD0D1B,
+  0x80890D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBF0D1B,
+  0xA3B70D1B,
+  0x90990D1B,
+  0x80830D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90900D1B,
+  0x808A0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x939F0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA3A30D1B,
+  0xA0A10D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80B70D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80950D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBE0D1B,
+  0xB5BB0D1B,
+  0xB0B30D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80A20D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0D1B,
+  0xA4A70D1B,
+  0x90920D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80BB0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BC0D1B,
+  0x80AA0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90990D1B,
+  0x80880D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x96BF0D1B,
+  0x80940D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBF0D1B,
+  0xBBBB0D1B,
+  0xAEB90D1B,
+  0xA9AC0D1B,
+  0xA5A60D1B,
+  0xA2A20D1B,
+  0x9E9F0D1B,
+  0x809C0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x85BF0D1B,
+  0x80830D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBBBE0D1B,
+  0x9EB90D1B,
+  0x969C0D1B,
+  0x8D940D1B,
+  0x878A0D1B,
+  0x80850D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x92BF0D1B,
+  0x8A900D1B,
+  0x86860D1B,
+  0x80840D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA8BF0D1B,
+  0x80A50D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBCBF0D1B,
+  0x9CBA0D1B,
+  0x829A0D1B,
+  0x80800D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB6BF0D1B,
+  0x96B40D1B,
+  0x80940D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0D1B,
+  0x90AE0D1B,
+  0x808E0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAABF0D1B,
+  0x8AA80D1B,
+  0x80880D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x8EBF0D1B,
+  0x848B0D1B,
+  0x80820D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB7BD0D1B,
+  0x80AC0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x8E8E0D1B,
+  0x80890D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90AD0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0B90D1B,
+  0x80AB0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BE0D1B,
+  0xADAE0D1B,
+  0xA8AB0D1B,
+  0xA0A60D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80840D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90990D1B,
+  0x8B8B0D1B,
+  0x80830D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBBBB0D1B,
+  0xB9B90D1B,
+  0xB4B70D1B,
+  0xA9B20D1B,
+  0xA7A70D1B,
+  0xA4A40D1B,
+  0xA1A20D1B,
+  0x859F0D1B,
+  0x80830D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBEBE0D1B,
+  0xB9BC0D1B,
+  0xB4B70D1B,
+  0xACB20D1B,
+  0xA7AA0D1B,
+  0xA4A40D1B,
+  0xA1A20D1B,
+  0x9F9F0D1B,
+  0x9D9D0D1B,
+  0x9B9B0D1B,
+  0x99990D1B,
+  0x97970D1B,
+  0x94940D1B,
+  0x91920D1B,
+  0x8D8F0D1B,
+  0x8B8B0D1B,
+  0x89890D1B,
+  0x87870D1B,
+  0x82820D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xABBB0D1B,
+  0xA5A90D1B,
+  0xA1A30D1B,
+  0x8B9B0D1B,
+  0x80890D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0B90D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x809F0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0D1B,
+  0x80A10D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80A00D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x809D0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x808A0D1B,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08002424,
+  0xF4F4259C,
+  0xF1F32597,
+  0xF0F0257E,
+  0xEFEF2568,
+  0xEEEE2563,
+  0xEDED255D,
+  0xEAEA2541,
+  0xE4E4253C,
+  0xE3E32530,
+  0xE2E2251E,
+  0xE1E124EE,
+  0xE0E024CA,
+  0xDFDF24C3,
+  0xDEDE24BD,
+  0xDDDD24B8,
+  0xDCDC24B1,
+  0xDBDB24A9,
+  0xD9D924A2,
+  0xD8D8249D,
+  0xD7D72496,
+  0xD6D62491,
+  0xD5D5248B,
+  0xD4D42486,
+  0xD2D22481,
+  0xCFCF247C,
+  0xCECE2473,
+  0xCDCD246B,
+  0xCCCC2466,
+  0xCBCB245D,
+  0xC3C32457,
+  0xC2C2244F,
+  0x80FF0D45,
+  0x7B7B2420,
+  0x617A0D45,
+  0x5F5F0D45,
+  0x415A0D45,
+  0x3B3B0D45,
+  0x30390D45,
+  0x20201E0E,
+  0x0B7F2426,
+  0x0AFFFFFF,
+  0x09091E0E,
+  0x00082426,
+  0x08000BA3,
+  0x80BF153D,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0BF1E3A,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80BF1E3A,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x809F1E3A,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90BF1E44,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80BF1E44,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x808F1E44,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0xFE000001,
+  0x00FFFFFF,
+  0xA9BF1576,
+  0xA5A71576,
+  0x9BA31576,
+  0x96991576,
+  0x00FFFFFF,
+  0xABAF1576,
+  0x999F1576,
+  0x00FFFFFF,
+  0x8F9F1576,
+  0x88881576,
+  0x00FFFFFF,
+  0x8ABF1576,
+  0x00FFFFFF,
+  0xBEBF1576,
+  0xBABC1576,
+  0x80831576,
+  0x00FFFFFF,
+  0xB0B01576,
+  0xA2A51576,
+  0x91971576,
+  0x808F1576,
+  0x00FFFFFF,
+  0xBEBF1576,
+  0xBABC1576,
+  0xB3B51576,
+  0xB1B11576,
+  0xA9A91576,
+  0x91921576,
+  0x8D8E1576,
+  0x81841576,
+  0x00FFFFFF,
+  0xBDBF1576,
+  0xB2BB1576,
+  0xA2A51576,
+  0x9E9E1576,
+  0x8F9B1576,
+  0x808D1576,
+  0x00FFFFFF,
+  0xBABF1576,
+  0xB7B71576,
+  0xB4B41576,
+  0xB1B11576,
+  0xA9A91576,
+  0x91921576,
+  0x8B8E1576,
+  0x80841576,
+  0x00FFFFFF,
+  0xB5BF1576,
+  0xB0B11576,
+  0x9FA51576,
+  0x9D9D1576,
+  0x80981576,
+  0x00FFFFFF,
+  0xBEBF1576,
+  0xBABC1576,
+  0xB4B41576,
+  0xB1B11576,
+  0xA9A91576,
+  0x92921576,
+  0x8E8E1576,
+  0x80841576,
+  0x00FFFFFF,
+  0xBABF1576,
+  0xB0B81576,
+  0xA2A51576,
+  0x919F1576,
+  0x808F1576,
+  0x00FFFFFF,
+  0xBEBF1576,
+  0xBABC1576,
+  0xB4B41576,
+  0xB1B11576,
+  0xA9A91576,
+  0x91921576,
+  0x8D8E1576,
+  0x80841576,
+  0x00FFFFFF,
+  0xB2BF1576,
+  0xB0B01576,
+  0xA2A51576,
+  0x9E9E1576,
+  0x809B1576,
+  0x00FFFFFF,
+  0xBABF1576,
+  0xABAD1576,
+  0xA5A71576,
+  0xA0A21576,
+  0x9D9D1576,
+  0x9B9B1576,
+  0x96981576,
+  0x91911576,
+  0x8B8D1576,
+  0x84841576,
+  0x80821576,
+  0x00FFFFFF,
+  0xB0BF1576,
+  0x91A51576,
+  0x808F1576,
+  0x00FFFFFF,
+  0xBEBF1576,
+  0xBABC1576,
+  0xA9A91576,
+  0x91911576,
+  0x8D8D1576,
+  0x80841576,
+  0x00FFFFFF,
+  0xB0BF1576,
+  0xA2A51576,
+  0x9E9F1576,
+  0x9B9C1576,
+  0x80971576,
+  0x00FFFFFF,
+  0xBEBF1576,
+  0xBABC1576,
+  0xB4B41576,
+  0xA9A91576,
+  0x91911576,
+  0x8D8D1576,
+  0x81841576,
+  0x00FFFFFF,
+  0xB3BF1576,
+  0xB0B01576,
+  0xA2A51576,
+  0x9F9F1576,
+  0x809C1576,
+  0x00FFFFFF,
+  0xBEBF1576,
+  0xBBBC1576,
+  0x91911576,
+  0x8D8D1576,
+  0x80831576,
+  0x00FFFFFF,
+  0xB0B91576,
+  0xA2A51576,
+  0x979E1576,
+  0x8F931576,
+  0x808D1576,
+  0x00FFFFFF,
+  0xBEBF1576,
+  0xBCBC1576,
+  0xB2B21576,
+  0x97991576,
+  0x80841576,
+  0x00FFFFFF,
+  0xB0BF1576,
+  0x87A51576,
+  0x00FFFFFF,
+  0xB4BF1576,
+  0xB1B11576,
+  0x80801576,
+  0x00FFFFFF,
+  0x9ABF1576,
+  0x878F1576,
+  0x00FFFFFF,
+  0xBEBF1576,
+  0xB4BC1576,
+  0xB1B11576,
+  0xA6A61576,
+  0xA4A41576,
+  0x8B8B1576,
+  0x85851576,
+  0x83831576,
+  0x80801576,
+  0x00FFFFFF,
+  0xA0BF1576,
+  0x9A9B1576,
+  0x878F1576,
+  0x85851576,
+  0x00FFFFFF,
+  0xAABF1576,
+  0x819F1576,
+  0x00FFFFFF,
+  0xADBF1576,
+  0x88881576,
+  0x00FFFFFF,
+  0x8DBF1576,
+  0x80871576,
+  0x00FFFFFF,
+  0xABBE1576,
+  0x00FFFFFF,
+  0xB1B41576,
+  0xA7AD1576,
+  0xA2A41576,
+  0x9EA01576,
+  0x96991576,
+  0x8A8F1576,
+  0x00FFFFFF,
+  0x9A9F1576,
+  0x8F8F1576,
+  0x828D1576,
+  0x00FFFFFF,
+  0xBBBB1576,
+  0x8E8F1576,
+  0x888C1576,
+  0x86861576,
+  0x00FFFFFF,
+  0x9E9F1576,
+  0x99991576,
+  0x97971576,
+  0x8E8F1576,
+  0x89891576,
+  0x00FFFFFF,
+  0xBFBF1576,
+  0xB6B71576,
+  0xB1B11576,
+  0x8E8F1576,
+  0x89891576,
+  0x00FFFFFF,
+  0x97971576,
+  0x86871576,
+  0x81811576,
+  0x00FFFFFF,
+  0x96971576,
+  0x91911576,
+  0x00FFFFFF,
+  0x9BBF1576,
+  0x00FFFFFF,
+  0x909F1576,
+  0x00FFFFFF,
+  0xBEBF1576,
+  0xB6B71576,
+  0x00FFFFFF,
+  0x80801576,
+  0x00FFFFFF,
+  0xADAE1576,
+  0x00FFFFFF,
+  0x9B9F1576,
+  0x80801576,
+  0x00FFFFFF,
+  0xB9BF1576,
+  0xABB01576,
+  0x00FFFFFF,
+  0xB2BF1576,
+  0x929E1576,
+  0x00FFFFFF,
+  0xB1BF1576,
+  0xADAD1576,
+  0x929F1576,
+  0x00FFFFFF,
+  0xB4BF1576,
+  0x00FFFFFF,
+  0xAABF1576,
+  0x9D9F1576,
+  0x989B1576,
+  0x80961576,
+  0x00FFFFFF,
+  0x9A9F1576,
+  0x808F1576,
+  0x00FFFFFF,
+  0xB9BF1576,
+  0x00FFFFFF,
+  0xABAF1576,
+  0xA9A91576,
+  0x85861576,
+  0x00FFFFFF,
+  0xB6BF1576,
+  0x00FFFFFF,
+  0x9FBF1576,
+  0x00FFFFFF,
+  0xB5BF1576,
+  0xAEAF1576,
+  0x80851576,
+  0x00FFFFFF,
+  0xACAF1576,
+  0x00FFFFFF,
+  0x9ABF1576,
+  0x8A8F1576,
+  0x00FFFFFF,
+  0x979F1576,
+  0x00FFFFFF,
+  0x95BF1576,
+  0x00FFFFFF,
+  0xA8BF1576,
+  0x9AA61576,
+  0x8A8F1576,
+  0x00FFFFFF,
+  0xB4BF1576,
+  0x80841576,
+  0x00FFFFFF,
+  0x9ABF1576,
+  0x8D8F1576,
+  0x80841576,
+  0x00FFFFFF,
+  0xA1AD1576,
+  0x80821576,
+  0x00FFFFFF,
+  0xA6BF1576,
+  0x00FFFFFF,
+  0xA4BF1576,
+  0x00FFFFFF,
+  0xBEBF1576,
+  0x8A8C1576,
+  0x00FFFFFF,
+  0xBBBC1576,
+  0x898F1576,
+  0x00FFFFFF,
+  0xBBBF1576,
+  0xB7B91576,
+  0xB4B41576,
+  0xADAD1576,
+  0x80A81576,
+  0x00FFFFFF,
+  0x9E9F1576,
+  0x96971576,
+  0x00FFFFFF,
+  0xBEBF1576,
+  0x9E9E1576,
+  0x9C9C1576,
+  0x9A9A1576,
+  0x98981576,
+  0x8E8F1576,
+  0x86871576,
+  0x00FFFFFF,
+  0xBFBF1576,
+  0xBDBD1576,
+  0xB5B51576,
+  0x00FFFFFF,
+  0xBDBF1576,
+  0xB5B51576,
+  0xADB11576,
+  0x9C9F1576,
+  0x94951576,
+  0x8D8F1576,
+  0x85851576,
+  0x80811576,
+  0x00FFFFFF,
+  0x80BE1576,
+  0x00FFFFFF,
+  0xB2BE1576,
+  0x95B01576,
+  0x81931576,
+  0x00FFFFFF,
+  0x9DBF1576,
+  0x808F1576,
+  0x00FFFFFF,
+  0xBABB1576,
+  0xAEAE1576,
+  0xA9A91576,
+  0xA7A71576,
+  0xA5A51576,
+  0x9EA31576,
+  0x96981576,
+  0x94941576,
+  0x88891576,
+  0x83861576,
+  0x80811576,
+  0x00FFFFFF,
+  0x8FBF1576,
+  0x8A8D1576,
+  0x80841576,
+  0x00FFFFFF,
+  0x85BF1576,
+  0x80821576,
+  0x00FFFFFF,
+  0xB4BF1576,
+  0xAFB11576,
+  0xA5AA1576,
+  0x00FFFFFF,
+  0xAEAF1576,
+  0xA8AC1576,
+  0xA6A61576,
+  0x00FFFFFF,
+  0xB0BF1576,
+  0xA8AE1576,
+  0x00FFFFFF,
+  0xBFBF1576,
+  0xB7B71576,
+  0xAFAF1576,
+  0xA7A71576,
+  0x979F1576,
+  0x00FFFFFF,
+  0x9FBF1576,
+  0x97971576,
+  0x8F8F1576,
+  0x87871576,
+  0x00FFFFFF,
+  0xB0BF1576,
+  0x80AE1576,
+  0x00FFFFFF,
+  0xBDBF1576,
+  0xB6BA1576,
+  0x87B01576,
+  0x80841576,
+  0x00FFFFFF,
+  0xA0A01576,
+  0x979C1576,
+  0x00FFFFFF,
+  0xBBBB1576,
+  0x00FFFFFF,
+  0xB0B01576,
+  0x80841576,
+  0x00FFFFFF,
+  0x8F9F1576,
+  0x00FFFFFF,
+  0x80AF1576,
+  0x00FFFFFF,
+  0x8DBF1576,
+  0x00FFFFFF,
+  0xBEBF1576,
+  0x808F1576,
+  0x00FFFFFF,
+  0xACBF1576,
+  0x8D8F1576,
+  0x00FFFFFF,
+  0xAFBE1576,
+  0x00FFFFFF,
+  0x9E9F1576,
+  0x00FFFFFF,
+  0xA0A11576,
+  0x80961576,
+  0x00FFFFFF,
+  0x898A1576,
+  0x00FFFFFF,
+  0x9AB11576,
+  0x94941576,
+  0x92921576,
+  0x8B8F1576,
+  0x00FFFFFF,
+  0xA3BF1576,
+  0x8B8B1576,
+  0x86861576,
+  0x82821576,
+  0x00FFFFFF,
+  0xB4BF1576,
+  0x80811576,
+  0x00FFFFFF,
+  0xBFBF1576,
+  0xBCBC1576,
+  0xB8BA1576,
+  0x9AB11576,
+  0x808F1576,
+  0x00FFFFFF,
+  0xA6AF1576,
+  0x00FFFFFF,
+  0xBDBF1576,
+  0x879F1576,
+  0x00FFFFFF,
+  0xB3BF1576,
+  0x80831576,
+  0x00FFFFFF,
+  0xBFBF1576,
+  0xA5A51576,
+  0x9A9F1576,
+  0x808E1576,
+  0x00FFFFFF,
+  0xA9BF1576,
+  0x00FFFFFF,
+  0xBBBD1576,
+  0xB7B91576,
+  0x9A9F1576,
+  0x8C8F1576,
+  0x83831576,
+  0x00FFFFFF,
+  0xBEBF1576,
+  0xB7B81576,
+  0xB2B41576,
+  0xB0B01576,
+  0x00FFFFFF,
+  0xB5BF1576,
+  0xABB11576,
+  0x9E9F1576,
+  0x839A1576,
+  0x81811576,
+  0x00FFFFFF,
+  0xAFAF1576,
+  0xA7A71576,
+  0x979F1576,
+  0x8F901576,
+  0x87881576,
+  0x80801576,
+  0x00FFFFFF,
+  0xAAAF1576,
+  0x9B9B1576,
+  0x00FFFFFF,
+  0xBABF1576,
+  0xA3AF1576,
+  0x00FFFFFF,
+  0xA4AF1576,
+  0x00FFFFFF,
+  0xBCBF1576,
+  0x878A1576,
+  0x00FFFFFF,
+  0xAEAF1576,
+  0x00FFFFFF,
+  0x9ABF1576,
+  0x00FFFFFF,
+  0xBFBF1576,
+  0xBDBD1576,
+  0xB7B71576,
+  0xA9A91576,
+  0x9E9E1576,
+  0x989C1576,
+  0x87921576,
+  0x00FFFFFF,
+  0x85851576,
+  0x82821576,
+  0x00FFFFFF,
+  0xB2BF1576,
+  0x00FFFFFF,
+  0x80921576,
+  0x00FFFFFF,
+  0xBEBF1576,
+  0x00FFFFFF,
+  0x808F1576,
+  0x00FFFFFF,
+  0x90911576,
+  0x00FFFFFF,
+  0xBCBF1576,
+  0x88AF1576,
+  0x00FFFFFF,
+  0xB5BF1576,
+  0x80B21576,
+  0x00FFFFFF,
+  0xB5B51576,
+  0x90AF1576,
+  0x808C1576,
+  0x00FFFFFF,
+  0xBDBF1576,
+  0x00FFFFFF,
+  0xBBBE1576,
+  0x9AA01576,
+  0x808F1576,
+  0x00FFFFFF,
+  0x9BA51576,
+  0x80801576,
+  0x00FFFFFF,
+  0xBFBF1576,
+  0x00FFFFFF,
+  0x9DBF1576,
+  0x98991576,
+  0x90911576,
+  0x88891576,
+  0x80811576,
+  0x00FFFFFF,
+  0xBFBF2607,
+  0xBEBE2605,
+  0xBDBD2603,
+  0xBCBC2600,
+  0xBABA25FD,
+  0xB5BB15AC,
+  0xB4B425FA,
+  0xB2B325F8,
+  0xB1B115C2,
+  0xAEAE25F6,
+  0xADAD25F3,
+  0xACAC1F5E,
+  0xABAB25F0,
+  0xAAAA25EE,
+  0xA9A925EB,
+  0xA8A825E6,
+  0xA6A625E4,
+  0xA4A425E1,
+  0xA3A325DD,
+  0xA2A21F60,
+  0xA1A125DA,
+  0xA0A025D4,
+  0x9FAF15AC,
+  0x9E9E25D0,
+  0x9D9D25CD,
+  0x9C9C25CB,
+  0x979715AC,
+  0x969625C3,
+  0x959525C0,
+  0x949425BE,
+  0x939325BB,
+  0x929225B8,
+  0x8F8F25B5,
+  0x8E8E1FF5,
+  0x8D8D25B1,
+  0x8C8C25AF,
+  0x8B8B25AD,
+  0x8A8A25AB,
+  0x848915AC,
+  0x838325A9,
+  0x818125A6,
+  0x808025A1,
+  0x00FFFFFF,
+  0xBEBE2691,
+  0xBBBB268E,
+  0xB6B6268A,
+  0xB5B52684,
+  0xB4B42680,
+  0xB2B2267E,
+  0xB1B1267B,
+  0xB0B02678,
+  0xABAB1F58,
+  0xAAAA2675,
+  0xA9A92672,
+  0xA8A8266E,
+  0xA7A7266A,
+  0xA6A62667,
+  0xA5A52663,
+  0xA4A4265D,
+  0xA3A3265B,
+  0xA2A215C8,
+  0xA0A02659,
+  0x9D9D2657,
+  0x9C9C2654,
+  0x9B9B1E6A,
+  0x9A9A2651,
+  0x9999264D,
+  0x98982641,
+  0x9797264A,
+  0x96962648,
+  0x93932643,
+  0x92922641,
+  0x9191263C,
+  0x9090263A,
+  0x8D8D2636,
+  0x8C8C1EA3,
+  0x8B8B2633,
+  0x8A8A262D,
+  0x89BF15AC,
+  0x8888262A,
+  0x87872625,
+  0x86862622,
+  0x8585261C,
+  0x84842619,
+  0x83832615,
+  0x82822612,
+  0x8181260D,
+  0x8080260A,
+  0x00FFFFFF,
+  0xBFBF2696,
+  0xBEBE2056,
+  0x96BD15AC,
+  0x95952694,
+  0x8F9115AC,
+  0x8E8E2043,
+  0x00FFFFFF,
+  0x91BF15AC,
+  0x90902648,
+  0x00FFFFFF,
+  0x9ABF15AC,
+  0x99992657,
+  0x808F15AC,
+  0x00FFFFFF,
+  0xBFBF26A8,
+  0xBEBE26A5,
+  0xBDBD26A2,
+  0xBABB15AC,
+  0xAFB815AC,
+  0xAEAE267E,
+  0xADAD269E,
+  0xACAC2641,
+  0xABAB269B,
+  0xAAAA206D,
+  0xA9A92698,
+  0xA8A81F58,
+  0x809F15AC,
+  0x00FFFFFF,
+  0xB5BF15AC,
+  0xB4B415C2,
+  0xB3B326AE,
+  0x9F9F26AC,
+  0x00FFFFFF,
+  0xBFBF26B0,
+  0x80BE15AC,
+  0x00FFFFFF,
+  0xB3BF15AC,
+  0xB2B226C0,
+  0xB1B126BD,
+  0x8CAF15AC,
+  0x8B8B26BB,
+  0x858526B7,
+  0x848426B5,
+  0x00FFFFFF,
+  0xBCBC1F60,
+  0xA0BF15AC,
+  0x9F9F26E9,
+  0x9E9E26E6,
+  0x9D9D26E3,
+  0x9C9C26E0,
+  0x9B9B26DC,
+  0x9A9A26DA,
+  0x959526D6,
+  0x949426CF,
+  0x939326CD,
+  0x929226C5,
+  0x919126C3,
+  0x808F15AC,
+  0x00FFFFFF,
+  0xBABA2723,
+  0xB9B9270E,
+  0xB8B82704,
+  0xA6BF15AC,
+  0xA5A52700,
+  0xA3A326FE,
+  0x9F9F26F8,
+  0x8B8B26F5,
+  0x8A8A26F2,
+  0x858526EF,
+  0x848426EC,
+  0x809E15AC,
+  0x00FFFFFF,
+  0xAFAF2729,
+  0x80BF15AC,
+  0x00FFFFFF,
+  0x9B9B272C,
+  0x00FFFFFF,
+  0xA0A01FF5,
+  0x9C9C1F58,
+  0x00FFFFFF,
+  0xBABA272E,
+  0x00FFFFFF,
+  0xB0BF15AC,
+  0xAFAF2730,
+  0x00FFFFFF,
+  0xA9BF15AC,
+  0xA8A82732,
+  0x809F15AC,
+  0x00FFFFFF,
+  0x8EBF15AC,
+  0x8D8D2734,
+  0x00FFFFFF,
+  0x08000BA3,
+  0xBFBF0BA5,
+  0xBCBD0BA5,
+  0xA8BA0BA5,
+  0x8DA60BA5,
+  0x808B0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x909D0BA5,
+  0x808D0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80BA0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0BF0BA5,
+  0x809C0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80900BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xADBF0BA5,
+  0x809F0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90B50BA5,
+  0x82890BA5,
+  0x80800BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x888F0BA5,
+  0x80830BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0BA5,
+  0xA0A90BA5,
+  0x809D0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x98BB0BA5,
+  0x80930BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0BA5,
+  0x80A70BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBCBF0BA5,
+  0xB0BA0BA5,
+  0x80A30BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBBBC0BA5,
+  0xB3B90BA5,
+  0xA3B10BA5,
+  0x97A10BA5,
+  0x94950BA5,
+  0x8C920BA5,
+  0x808A0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80B60BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0A70BA5,
+  0x80950BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB2BA0BA5,
+  0x87B00BA5,
+  0x80850BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF0BA5,
+  0xBCBC0BA5,
+  0xB7B80BA5,
+  0x8AB50BA5,
+  0x88880BA5,
+  0x80850BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0B60BA5,
+  0x80950BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB4B50BA5,
+  0xA0B20BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0B90BA5,
+  0x80950BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBEBF0BA5,
+  0x80B70BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x99B50BA5,
+  0x95970BA5,
+  0x90930BA5,
+  0x80800BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0BC0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x809C0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x89A40BA5,
+  0x80870BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0B20BA5,
+  0x80950BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80910BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80B20BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0B90BA5,
+  0x80A30BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0B10BA5,
+  0x80A90BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0BA5,
+  0xA7A70BA5,
+  0x809C0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0BA5,
+  0x80850BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0BA5,
+  0x80810BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0B60BA5,
+  0x80840BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x83B70BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB5B50BA5,
+  0xB1B20BA5,
+  0xA6AF0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x83AF0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0B90BA5,
+  0x90A80BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB6BF0BA5,
+  0x83A60BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB6B60BA5,
+  0x90B20BA5,
+  0x87870BA5,
+  0x84840BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x83B20BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9C9C0BA5,
+  0x909A0BA5,
+  0x81840BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x93AB0BA5,
+  0x80910BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0BA5,
+  0x9FA80BA5,
+  0x8F9D0BA5,
+  0x8A8D0BA5,
+  0x88880BA5,
+  0x80860BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0B90BA5,
+  0x809E0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9DA10BA5,
+  0x90900BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80B40BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9FA10BA5,
+  0x90990BA5,
+  0x878A0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80AF0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90990BA5,
+  0x87870BA5,
+  0x84850BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80AE0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x989B0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90990BA5,
+  0x84840BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB8B80BA5,
+  0x80AA0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0B90BA5,
+  0x809A0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80860BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80AB0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF0BA5,
+  0x80A90BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF0BA5,
+  0x98AF0BA5,
+  0x95960BA5,
+  0x8C930BA5,
+  0x89890BA5,
+  0x80860BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90990BA5,
+  0x81810BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAABF0BA5,
+  0xA0A70BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA3A30BA5,
+  0xA1A10BA5,
+  0x80900BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBABA0BA5,
+  0x8BB20BA5,
+  0x80800BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9CBF0BA5,
+  0x90900BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0BA5,
+  0x9D9D0BA5,
+  0x80890BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x8AAE0BA5,
+  0x80880BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB2BF0BA5,
+  0x90990BA5,
+  0x80800BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x808F0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x8BB00BA5,
+  0x88890BA5,
+  0x80860BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAABF0BA5,
+  0xA7A80BA5,
+  0xA0A50BA5,
+  0x90990BA5,
+  0x86860BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0A90BA5,
+  0x98980BA5,
+  0x80890BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0B20BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0B00BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80830BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80B00BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0BA5,
+  0xA0A90BA5,
+  0x809E0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90AD0BA5,
+  0x80890BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBF0BA5,
+  0xA3B70BA5,
+  0x90990BA5,
+  0x80830BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90900BA5,
+  0x808A0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x939F0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA3A30BA5,
+  0xA0A10BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80B70BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80950BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBE0BA5,
+  0xB5BB0BA5,
+  0xB0B30BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80A20BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0BA5,
+  0xA4A70BA5,
+  0x90920BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80BB0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BC0BA5,
+  0x80AA0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90990BA5,
+  0x80880BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x96BF0BA5,
+  0x80940BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBF0BA5,
+  0xBBBB0BA5,
+  0xAEB90BA5,
+  0xA9AC0BA5,
+  0xA5A60BA5,
+  0xA2A20BA5,
+  0x9E9F0BA5,
+  0x809C0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x85BF0BA5,
+  0x80830BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBBBE0BA5,
+  0x9EB90BA5,
+  0x969C0BA5,
+  0x8D940BA5,
+  0x878A0BA5,
+  0x80850BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x92BF0BA5,
+  0x8A900BA5,
+  0x86860BA5,
+  0x80840BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA8BF0BA5,
+  0x80A50BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBCBF0BA5,
+  0x9CBA0BA5,
+  0x829A0BA5,
+  0x80800BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB6BF0BA5,
+  0x96B40BA5,
+  0x80940BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0BA5,
+  0x90AE0BA5,
+  0x808E0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAABF0BA5,
+  0x8AA80BA5,
+  0x80880BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x8EBF0BA5,
+  0x848B0BA5,
+  0x80820BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB7BD0BA5,
+  0x80AC0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x8E8E0BA5,
+  0x80890BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90AD0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0B90BA5,
+  0x80AB0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BE0BA5,
+  0xADAE0BA5,
+  0xA8AB0BA5,
+  0xA0A60BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80840BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90990BA5,
+  0x8B8B0BA5,
+  0x80830BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBBBB0BA5,
+  0xB9B90BA5,
+  0xB4B70BA5,
+  0xA9B20BA5,
+  0xA7A70BA5,
+  0xA4A40BA5,
+  0xA1A20BA5,
+  0x859F0BA5,
+  0x80830BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBEBE0BA5,
+  0xB9BC0BA5,
+  0xB4B70BA5,
+  0xACB20BA5,
+  0xA7AA0BA5,
+  0xA4A40BA5,
+  0xA1A20BA5,
+  0x9F9F0BA5,
+  0x9D9D0BA5,
+  0x9B9B0BA5,
+  0x99990BA5,
+  0x97970BA5,
+  0x94940BA5,
+  0x91920BA5,
+  0x8D8F0BA5,
+  0x8B8B0BA5,
+  0x89890BA5,
+  0x87870BA5,
+  0x82820BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xABBB0BA5,
+  0xA5A90BA5,
+  0xA1A30BA5,
+  0x8B9B0BA5,
+  0x80890BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0B90BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x809F0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF0BA5,
+  0x80A10BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80A00BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x809D0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x808A0BA5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08002424,
+  0x0BFF2420,
+  0x0AFFFFFF,
+  0x00092420,
+  0x07002736,
+  0x00FFFFFF,
+  0x08002424,
+  0xF4F4259C,
+  0xF1F32597,
+  0xF0F0257E,
+  0xEFEF2568,
+  0xEEEE2563,
+  0xEDED255D,
+  0xEAEA2541,
+  0xE4E4253C,
+  0xE3E32530,
+  0xE2E2251E,
+  0xE1E124EE,
+  0xE0E024CA,
+  0xDFDF24C3,
+  0xDEDE24BD,
+  0xDDDD24B8,
+  0xDCDC24B1,
+  0xDBDB24A9,
+  0xD9D924A2,
+  0xD8D8249D,
+  0xD7D72496,
+  0xD6D62491,
+  0xD5D5248B,
+  0xD4D42486,
+  0xD2D22481,
+  0xCFCF247C,
+  0xCECE2473,
+  0xCDCD246B,
+  0xCCCC2466,
+  0xCBCB245D,
+  0xC3C32457,
+  0xC2C2244F,
+  0x80FF0D45,
+  0x617B0D45,
+  0x5F5F0D45,
+  0x415A0D45,
+  0x3B3B0D45,
+  0x30390D45,
+  0x0B7F2426,
+  0x0AFFFFFF,
+  0x00092426,
+  0x08000BA3,
+  0xBBBF2426,
+  0xB6B92426,
+  0xABB42426,
+  0x80A92426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB7B72426,
+  0x97972426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAFBF2426,
+  0xADAD2426,
+  0xA5AB2426,
+  0x929F2426,
+  0x82852426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80BF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBEBE2426,
+  0xB8B92426,
+  0xB5B52426,
+  0x80AF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA2A22426,
+  0x8D8D2426,
+  0x8B8B2426,
+  0x87872426,
+  0x80852426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB6B62426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x82892426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0B02426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9A9F2426,
+  0x97982426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x89BF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB3BF2426,
+  0xABAE2426,
+  0x808F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x809F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0B02426,
+  0xAAAD2426,
+  0x8B9F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBE2426,
+  0xA7AD2426,
+  0x96A42426,
+  0x94942426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF2426,
+  0x91912426,
+  0x808F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x808C2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB2BF2426,
+  0xA6B02426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBBBF2426,
+  0xB6B92426,
+  0xABB32426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF2466,
+  0xBEBE2841,
+  0xBDBD283B,
+  0xBCBC2835,
+  0xBBBB282D,
+  0xBABA2820,
+  0xB9B9281A,
+  0xB8B82813,
+  0xB7B7280D,
+  0xB6B62804,
+  0xB5B527FB,
+  0xB4B427F2,
+  0xB3B327E9,
+  0xB2B227DE,
+  0xB1B127D5,
+  0xB0B027CB,
+  0xAFAF27C4,
+  0xAEAE27B5,
+  0xADAD27AC,
+  0xACAC27A0,
+  0xABAB2797,
+  0xAAAA278B,
+  0xA9A92782,
+  0xA8A82776,
+  0xA7A7276C,
+  0xA6A62760,
+  0xA5A52758,
+  0xA4A42751,
+  0xA3A3274C,
+  0xA2A22746,
+  0xA1A12740,
+  0xA0A02738,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF294D,
+  0xBEBE2946,
+  0xBDBD293B,
+  0xBCBC2935,
+  0xB7B72466,
+  0xB3B3292C,
+  0xB2B22926,
+  0xB1B12920,
+  0xB0B0291B,
+  0xAFAF2916,
+  0xAEAE2910,
+  0xADAD2909,
+  0xACAC2903,
+  0xABAB2466,
+  0xAAAA28FC,
+  0xA9A928F7,
+  0xA8A828F2,
+  0xA7A728EC,
+  0xA6A628E7,
+  0xA5A528E0,
+  0xA4A428DB,
+  0xA3A328D6,
+  0xA2A228CF,
+  0xA1A128CA,
+  0xA0A028C4,
+  0x9F9F28BC,
+  0x9E9E28B7,
+  0x9D9D28B0,
+  0x9C9C28AA,
+  0x9B9B28A4,
+  0x9A9A289E,
+  0x99992899,
+  0x90902894,
+  0x8F8F288E,
+  0x8E8E2889,
+  0x8D8D2884,
+  0x8C8C287E,
+  0x8B8B2877,
+  0x8A8A286E,
+  0x89892865,
+  0x8383285D,
+  0x82822856,
+  0x8181284C,
+  0x80802847,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB9BF2466,
+  0xB8B829AC,
+  0xB7B729A4,
+  0xB6B6299B,
+  0xB5B52995,
+  0xB4B4298E,
+  0xB3B32987,
+  0x86862981,
+  0x8585297A,
+  0x8484296B,
+  0x83AF2466,
+  0x82822965,
+  0x8181295E,
+  0x80802959,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x888F2466,
+  0x878729D0,
+  0x868629CB,
+  0x848429C5,
+  0x838329C0,
+  0x828229BA,
+  0x81812894,
+  0x808029B2,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB7B72466,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAFAF2A62,
+  0xADAD2A5C,
+  0xACAC2A52,
+  0xABAB2A49,
+  0xAAAA2A41,
+  0xA9A92A38,
+  0xA8A82A33,
+  0xA7A72A2B,
+  0xA6A62A25,
+  0xA5A52A1F,
+  0xA4A42A1A,
+  0xA3A32A11,
+  0xA2A22A0B,
+  0xA1A128B7,
+  0xA0A02A03,
+  0x9F9F29FB,
+  0x9E9E29F6,
+  0x9C9C29F0,
+  0x9B9B2916,
+  0x9A9A29EB,
+  0x999929E6,
+  0x989829E0,
+  0x939329DA,
+  0x929229D5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9F9F2A6D,
+  0x9E9E2A68,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80BF2466,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF2AD1,
+  0xBEBE2ACC,
+  0xBDBD2AC6,
+  0xBCBC2ABF,
+  0xBBBB2ABA,
+  0xB9B92AB3,
+  0xB8B82AAD,
+  0xB7B72AA7,
+  0xB6B62AA2,
+  0xB5B52A9D,
+  0xB4B42A98,
+  0xAFAF2A93,
+  0xAEAE2A8E,
+  0xADAD2A88,
+  0xACAC2A7D,
+  0xABAB2A78,
+  0xA9A92A73,
+  0x80A32466,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB2BF2563,
+  0xB1B12BBF,
+  0xAFAF2BB8,
+  0xAEAE2BB2,
+  0xACAC2BAD,
+  0xABAB2BA7,
+  0xAAAA2BA2,
+  0x9F9F2B9C,
+  0x9E9E2B8C,
+  0x9D9D2B7A,
+  0x9B9B2B6F,
+  0x9A9A2B69,
+  0x999C2563,
+  0x98982B61,
+  0x96962B50,
+  0x95952563,
+  0x94942B49,
+  0x93932B43,
+  0x92922B39,
+  0x91912B08,
+  0x90902ADA,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80BF2563,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x808F2563,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0xBEBE1576,
+  0xBBBB1576,
+  0xA7A71576,
+  0x8C8C1576,
+  0x00FFFFFF,
+  0x9EBF1576,
+  0x8E8F1576,
+  0x00FFFFFF,
+  0xBBBF1576,
+  0x00FFFFFF,
+  0x9D9F1576,
+  0x00FFFFFF,
+  0x91BF1576,
+  0x00FFFFFF,
+  0xA0AC1576,
+  0x00FFFFFF,
+  0xB6BF1576,
+  0x8A8F1576,
+  0x81811576,
+  0x00FFFFFF,
+  0x90BF1576,
+  0x84871576,
+  0x00FFFFFF,
+  0xAAAF1576,
+  0x9E9F1576,
+  0x00FFFFFF,
+  0xBCBF1576,
+  0x94971576,
+  0x00FFFFFF,
+  0xA8AF1576,
+  0x00FFFFFF,
+  0xBBBB1576,
+  0xA4AF1576,
+  0x00FFFFFF,
+  0xBDBF1576,
+  0xBABA1576,
+  0xB2B21576,
+  0xA2A21576,
+  0x96961576,
+  0x93931576,
+  0x8B8B1576,
+  0x00FFFFFF,
+  0xB7BF1576,
+  0x00FFFFFF,
+  0xA8BF1576,
+  0x969F1576,
+  0x00FFFFFF,
+  0xBBBF1576,
+  0xB1B11576,
+  0x86861576,
+  0x00FFFFFF,
+  0xBDBE1576,
+  0xB9BB1576,
+  0xB6B61576,
+  0x89891576,
+  0x86871576,
+  0x00FFFFFF,
+  0xB7BF1576,
+  0x969F1576,
+  0x00FFFFFF,
+  0xB6BF1576,
+  0xB3B31576,
+  0x809F1576,
+  0x00FFFFFF,
+  0xBABF1576,
+  0x969F1576,
+  0x00FFFFFF,
+  0xB8BD1576,
+  0x00FFFFFF,
+  0xB6BF1576,
+  0x98981576,
+  0x94941576,
+  0x818F1576,
+  0x00FFFFFF,
+  0xBDBF1576,
+  0x809F1576,
+  0x00FFFFFF,
+  0x9DBF1576,
+  0x00FFFFFF,
+  0xA5BF1576,
+  0x88881576,
+  0x00FFFFFF,
+  0xB3BF1576,
+  0x969F1576,
+  0x00FFFFFF,
+  0x92BF1576,
+  0x00FFFFFF,
+  0xB3BF1576,
+  0x00FFFFFF,
+  0xBABF1576,
+  0xA4AF1576,
+  0x00FFFFFF,
+  0xB2BF1576,
+  0xAAAF1576,
+  0x00FFFFFF,
+  0xA8AF1576,
+  0x9DA61576,
+  0x00FFFFFF,
+  0x86AF1576,
+  0x00FFFFFF,
+  0x82AF1576,
+  0x00FFFFFF,
+  0xB7BF1576,
+  0x859F1576,
+  0x00FFFFFF,
+  0xB8BF1576,
+  0x80821576,
+  0x00FFFFFF,
+  0xB6BF1576,
+  0xB3B41576,
+  0xB0B01576,
+  0x80A51576,
+  0x00FFFFFF,
+  0xB0BF1576,
+  0x80821576,
+  0x00FFFFFF,
+  0xBABF1576,
+  0xA9AF1576,
+  0x808F1576,
+  0x00FFFFFF,
+  0xA7B51576,
+  0x80821576,
+  0x00FFFFFF,
+  0xB7BF1576,
+  0xB3B51576,
+  0x888F1576,
+  0x85861576,
+  0x80831576,
+  0x00FFFFFF,
+  0xB3BF1576,
+  0x80821576,
+  0x00FFFFFF,
+  0x9DBF1576,
+  0x9B9B1576,
+  0x858F1576,
+  0x80801576,
+  0x00FFFFFF,
+  0xACBF1576,
+  0x92921576,
+  0x00FFFFFF,
+  0xA9AF1576,
+  0x9E9E1576,
+  0x8E8E1576,
+  0x89891576,
+  0x87871576,
+  0x00FFFFFF,
+  0xBABF1576,
+  0x9FAF1576,
+  0x00FFFFFF,
+  0xA2BF1576,
+  0x919C1576,
+  0x808F1576,
+  0x00FFFFFF,
+  0xB5BF1576,
+  0x00FFFFFF,
+  0xA2BF1576,
+  0x9A9E1576,
+  0x8B8F1576,
+  0x80861576,
+  0x00FFFFFF,
+  0xB0BF1576,
+  0x00FFFFFF,
+  0x9ABF1576,
+  0x888F1576,
+  0x86861576,
+  0x80831576,
+  0x00FFFFFF,
+  0xAFBF1576,
+  0x00FFFFFF,
+  0x9CBF1576,
+  0x80971576,
+  0x00FFFFFF,
+  0x9ABF1576,
+  0x858F1576,
+  0x80831576,
+  0x00FFFFFF,
+  0xB9BF1576,
+  0xABB71576,
+  0x00FFFFFF,
+  0xBABF1576,
+  0x9BAF1576,
+  0x00FFFFFF,
+  0x87BF1576,
+  0x00FFFFFF,
+  0xACBF1576,
+  0x00FFFFFF,
+  0xAABE1576,
+  0x00FFFFFF,
+  0xB0BE1576,
+  0x97971576,
+  0x94941576,
+  0x8A8B1576,
+  0x87881576,
+  0x00FFFFFF,
+  0x9ABF1576,
+  0x828F1576,
+  0x80801576,
+  0x00FFFFFF,
+  0xA8A91576,
+  0x809F1576,
+  0x00FFFFFF,
+  0xA4BF1576,
+  0xA2A21576,
+  0x91A01576,
+  0x00FFFFFF,
+  0xBBBF1576,
+  0xB3B91576,
+  0x818A1576,
+  0x00FFFFFF,
+  0x919B1576,
+  0x808F1576,
+  0x00FFFFFF,
+  0x9EAF1576,
+  0x8A9C1576,
+  0x00FFFFFF,
+  0xAFBF1576,
+  0x89891576,
+  0x00FFFFFF,
+  0x9AB11576,
+  0x818F1576,
+  0x00FFFFFF,
+  0x90BF1576,
+  0x00FFFFFF,
+  0xB1BF1576,
+  0x8A8A1576,
+  0x87871576,
+  0x00FFFFFF,
+  0xA9A91576,
+  0xA6A61576,
+  0x9A9F1576,
+  0x878F1576,
+  0x80851576,
+  0x00FFFFFF,
+  0xAABF1576,
+  0x999F1576,
+  0x8A971576,
+  0x00FFFFFF,
+  0xB3BF1576,
+  0x809F1576,
+  0x00FFFFFF,
+  0xB1BF1576,
+  0x80AF1576,
+  0x00FFFFFF,
+  0x84BF1576,
+  0x00FFFFFF,
+  0xB1BF1576,
+  0x00FFFFFF,
+  0xAAAF1576,
+  0x9F9F1576,
+  0x00FFFFFF,
+  0xAEBF1576,
+  0x8A8F1576,
+  0x00FFFFFF,
+  0xB8BC1576,
+  0x9AA21576,
+  0x848F1576,
+  0x00FFFFFF,
+  0x91BF1576,
+  0x8B8F1576,
+  0x00FFFFFF,
+  0xA0BF1576,
+  0x80921576,
+  0x00FFFFFF,
+  0xA4BF1576,
+  0xA2A21576,
+  0x809F1576,
+  0x00FFFFFF,
+  0xB8BF1576,
+  0x00FFFFFF,
+  0x96BF1576,
+  0x00FFFFFF,
+  0xBFBF1576,
+  0xBCBC1576,
+  0xB4B41576,
+  0x80AF1576,
+  0x00FFFFFF,
+  0xA3BF1576,
+  0x00FFFFFF,
+  0xA8AF1576,
+  0x93A31576,
+  0x808F1576,
+  0x00FFFFFF,
+  0xBCBF1576,
+  0x00FFFFFF,
+  0xBDBF1576,
+  0xABAF1576,
+  0x00FFFFFF,
+  0x9ABF1576,
+  0x898F1576,
+  0x00FFFFFF,
+  0x95951576,
+  0x00FFFFFF,
+  0xBCBC1576,
+  0xBABA1576,
+  0xADAD1576,
+  0xA7A81576,
+  0xA3A41576,
+  0xA0A11576,
+  0x9D9D1576,
+  0x00FFFFFF,
+  0x84841576,
+  0x00FFFFFF,
+  0xBFBF1576,
+  0xBABA1576,
+  0x9D9D1576,
+  0x95951576,
+  0x8B8C1576,
+  0x86861576,
+  0x00FFFFFF,
+  0x91911576,
+  0x87891576,
+  0x85851576,
+  0x00FFFFFF,
+  0xA6A71576,
+  0x00FFFFFF,
+  0xBBBB1576,
+  0x9B9B1576,
+  0x81811576,
+  0x00FFFFFF,
+  0xB5B51576,
+  0x95951576,
+  0x00FFFFFF,
+  0xAFAF1576,
+  0x8F8F1576,
+  0x00FFFFFF,
+  0xA9A91576,
+  0x89891576,
+  0x00FFFFFF,
+  0x8C8D1576,
+  0x83831576,
+  0x00FFFFFF,
+  0xBEBF1576,
+  0xADB61576,
+  0x00FFFFFF,
+  0x8FBF1576,
+  0x8A8D1576,
+  0x00FFFFFF,
+  0xAEBF1576,
+  0x808F1576,
+  0x00FFFFFF,
+  0xBABF1576,
+  0xACAF1576,
+  0x00FFFFFF,
+  0xBFBF1576,
+  0xAFAF1576,
+  0xACAC1576,
+  0xA7A71576,
+  0x809F1576,
+  0x00FFFFFF,
+  0x85BF1576,
+  0x00FFFFFF,
+  0x9ABF1576,
+  0x8C8F1576,
+  0x848A1576,
+  0x00FFFFFF,
+  0xBCBF1576,
+  0xBABA1576,
+  0xB8B81576,
+  0xB3B31576,
+  0xA8A81576,
+  0xA5A61576,
+  0xA3A31576,
+  0xA0A01576,
+  0x84841576,
+  0x00FFFFFF,
+  0xBFBF1576,
+  0xBDBD1576,
+  0xB8B81576,
+  0xB3B31576,
+  0xABAB1576,
+  0xA5A61576,
+  0xA3A31576,
+  0xA0A01576,
+  0x9E9E1576,
+  0x9C9C1576,
+  0x9A9A1576,
+  0x98981576,
+  0x95961576,
+  0x93931576,
+  0x90901576,
+  0x8C8C1576,
+  0x8A8A1576,
+  0x88881576,
+  0x83861576,
+  0x80811576,
+  0x00FFFFFF,
+  0xBCBF1576,
+  0xAAAA1576,
+  0xA4A41576,
+  0x9CA01576,
+  0x8A8A1576,
+  0x00FFFFFF,
+  0xBABF1576,
+  0x80AF1576,
+  0x00FFFFFF,
+  0xA0BF1576,
+  0x00FFFFFF,
+  0xA2AF1576,
+  0x00FFFFFF,
+  0xA1BF1576,
+  0x00FFFFFF,
+  0x9EBF1576,
+  0x00FFFFFF,
+  0x8BBF1576,
+  0x00FFFFFF,
+  0xFD000000,
+  0x00FFFFFF,
+  0x08000BA3,
+  0xA9BF2426,
+  0xA5A72426,
+  0x9BA32426,
+  0x96992426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xABAF2426,
+  0x999F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x8F9F2426,
+  0x88882426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x8ABF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBEBF2426,
+  0xBABC2426,
+  0x80832426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0B02426,
+  0xA2A52426,
+  0x91972426,
+  0x808F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBEBF2426,
+  0xBABC2426,
+  0xB3B52426,
+  0xB1B12426,
+  0xA9A92426,
+  0x91922426,
+  0x8D8E2426,
+  0x81842426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBF2426,
+  0xB2BB2426,
+  0xA2A52426,
+  0x9E9E2426,
+  0x8F9B2426,
+  0x808D2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBABF2426,
+  0xB7B72426,
+  0xB4B42426,
+  0xB1B12426,
+  0xA9A92426,
+  0x91922426,
+  0x8B8E2426,
+  0x80842426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB5BF2426,
+  0xB0B12426,
+  0x9FA52426,
+  0x9D9D2426,
+  0x80982426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBEBF2426,
+  0xBABC2426,
+  0xB4B42426,
+  0xB1B12426,
+  0xA9A92426,
+  0x92922426,
+  0x8E8E2426,
+  0x80842426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBABF2426,
+  0xB0B82426,
+  0xA2A52426,
+  0x919F2426,
+  0x808F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBEBF2426,
+  0xBABC2426,
+  0xB4B42426,
+  0xB1B12426,
+  0xA9A92426,
+  0x91922426,
+  0x8D8E2426,
+  0x80842426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB2BF2426,
+  0xB0B02426,
+  0xA2A52426,
+  0x9E9E2426,
+  0x809B2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBABF2426,
+  0xABAD2426,
+  0xA5A72426,
+  0xA0A22426,
+  0x9D9D2426,
+  0x9B9B2426,
+  0x96982426,
+  0x91912426,
+  0x8B8D2426,
+  0x84842426,
+  0x80822426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF2426,
+  0x91A52426,
+  0x808F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBEBF2426,
+  0xBABC2426,
+  0xA9A92426,
+  0x91912426,
+  0x8D8D2426,
+  0x80842426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF2426,
+  0xA2A52426,
+  0x9E9F2426,
+  0x9B9C2426,
+  0x80972426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBEBF2426,
+  0xBABC2426,
+  0xB4B42426,
+  0xA9A92426,
+  0x91912426,
+  0x8D8D2426,
+  0x81842426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB3BF2426,
+  0xB0B02426,
+  0xA2A52426,
+  0x9F9F2426,
+  0x809C2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBEBF2426,
+  0xBBBC2426,
+  0x91912426,
+  0x8D8D2426,
+  0x80832426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0B92426,
+  0xA2A52426,
+  0x979E2426,
+  0x8F932426,
+  0x808D2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBEBF2426,
+  0xBCBC2426,
+  0xB2B22426,
+  0x97992426,
+  0x80842426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF2426,
+  0x87A52426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB4BF2426,
+  0xB1B12426,
+  0x80802426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9ABF2426,
+  0x878F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBEBF2426,
+  0xB4BC2426,
+  0xB1B12426,
+  0xA6A62426,
+  0xA4A42426,
+  0x8B8B2426,
+  0x85852426,
+  0x83832426,
+  0x80802426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0BF2426,
+  0x9A9B2426,
+  0x878F2426,
+  0x85852426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAABF2426,
+  0x819F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xADBF2426,
+  0x88882426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x8DBF2426,
+  0x80872426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xABBE2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB1B42426,
+  0xA7AD2426,
+  0xA2A42426,
+  0x9EA02426,
+  0x96992426,
+  0x8A8F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9A9F2426,
+  0x8F8F2426,
+  0x828D2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBBBB2426,
+  0x8E8F2426,
+  0x888C2426,
+  0x86862426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9E9F2426,
+  0x99992426,
+  0x97972426,
+  0x8E8F2426,
+  0x89892426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF2426,
+  0xB6B72426,
+  0xB1B12426,
+  0x8E8F2426,
+  0x89892426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x97972426,
+  0x86872426,
+  0x81812426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x96972426,
+  0x91912426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9BBF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x909F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBEBF2426,
+  0xB6B72426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80802426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xADAE2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9B9F2426,
+  0x80802426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB9BF2426,
+  0xABB02426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB2BF2426,
+  0x929E2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB1BF2426,
+  0xADAD2426,
+  0x929F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB4BF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAABF2426,
+  0x9D9F2426,
+  0x989B2426,
+  0x80962426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9A9F2426,
+  0x808F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB9BF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xABAF2426,
+  0xA9A92426,
+  0x85862426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB6BF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9FBF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB5BF2426,
+  0xAEAF2426,
+  0x80852426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xACAF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9ABF2426,
+  0x8A8F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x979F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x95BF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA8BF2426,
+  0x9AA62426,
+  0x8A8F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB4BF2426,
+  0x80842426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9ABF2426,
+  0x8D8F2426,
+  0x80842426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA1AD2426,
+  0x80822426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA6BF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA4BF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBEBF2426,
+  0x8A8C2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBBBC2426,
+  0x898F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBBBF2426,
+  0xB7B92426,
+  0xB4B42426,
+  0xADAD2426,
+  0x80A82426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9E9F2426,
+  0x96972426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBEBF2426,
+  0x9E9E2426,
+  0x9C9C2426,
+  0x9A9A2426,
+  0x98982426,
+  0x8E8F2426,
+  0x86872426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF2426,
+  0xBDBD2426,
+  0xB5B52426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBF2426,
+  0xB5B52426,
+  0xADB12426,
+  0x9C9F2426,
+  0x94952426,
+  0x8D8F2426,
+  0x85852426,
+  0x80812426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80BE2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB2BE2426,
+  0x95B02426,
+  0x81932426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9DBF2426,
+  0x808F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBABB2426,
+  0xAEAE2426,
+  0xA9A92426,
+  0xA7A72426,
+  0xA5A52426,
+  0x9EA32426,
+  0x96982426,
+  0x94942426,
+  0x88892426,
+  0x83862426,
+  0x80812426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x8FBF2426,
+  0x8A8D2426,
+  0x80842426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x85BF2426,
+  0x80822426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB4BF2426,
+  0xAFB12426,
+  0xA5AA2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAEAF2426,
+  0xA8AC2426,
+  0xA6A62426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF2426,
+  0xA8AE2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF2426,
+  0xB7B72426,
+  0xAFAF2426,
+  0xA7A72426,
+  0x979F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9FBF2426,
+  0x97972426,
+  0x8F8F2426,
+  0x87872426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF2426,
+  0x80AE2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBF2426,
+  0xB6BA2426,
+  0x87B02426,
+  0x80842426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0A02426,
+  0x979C2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBBBB2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0B02426,
+  0x80842426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x8F9F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80AF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x8DBF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBEBF2426,
+  0x808F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xACBF2426,
+  0x8D8F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAFBE2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9E9F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0A12426,
+  0x80962426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x898A2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9AB12426,
+  0x94942426,
+  0x92922426,
+  0x8B8F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA3BF2426,
+  0x8B8B2426,
+  0x86862426,
+  0x82822426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB4BF2426,
+  0x80812426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF2426,
+  0xBCBC2426,
+  0xB8BA2426,
+  0x9AB12426,
+  0x808F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA6AF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBF2426,
+  0x879F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB3BF2426,
+  0x80832426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF2426,
+  0xA5A52426,
+  0x9A9F2426,
+  0x808E2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA9BF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBBBD2426,
+  0xB7B92426,
+  0x9A9F2426,
+  0x8C8F2426,
+  0x83832426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBEBF2426,
+  0xB7B82426,
+  0xB2B42426,
+  0xB0B02426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB5BF2426,
+  0xABB12426,
+  0x9E9F2426,
+  0x839A2426,
+  0x81812426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAFAF2426,
+  0xA7A72426,
+  0x979F2426,
+  0x8F902426,
+  0x87882426,
+  0x80802426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAAAF2426,
+  0x9B9B2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBABF2426,
+  0xA3AF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA4AF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBCBF2426,
+  0x878A2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAEAF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9ABF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF2426,
+  0xBDBD2426,
+  0xB7B72426,
+  0xA9A92426,
+  0x9E9E2426,
+  0x989C2426,
+  0x87922426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x85852426,
+  0x82822426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB2BF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x80922426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBEBF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x808F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90912426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBCBF2426,
+  0x88AF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB5BF2426,
+  0x80B22426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB5B52426,
+  0x90AF2426,
+  0x808C2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBBBE2426,
+  0x9AA02426,
+  0x808F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9BA52426,
+  0x80802426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9DBF2426,
+  0x98992426,
+  0x90912426,
+  0x88892426,
+  0x80812426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF2C8E,
+  0xBEBE2C89,
+  0xBDBD2C84,
+  0xBCBC2C7E,
+  0xBABA2C78,
+  0xB5BB2466,
+  0xB4B42C72,
+  0xB2B32C6D,
+  0xB1B12491,
+  0xAEAE2C68,
+  0xADAD2C62,
+  0xACAC28D6,
+  0xABAB2C5C,
+  0xAAAA2C57,
+  0xA9A92C51,
+  0xA8A82C49,
+  0xA6A62C44,
+  0xA4A42C3E,
+  0xA3A32C37,
+  0xA2A228DB,
+  0xA1A12C31,
+  0xA0A02C28,
+  0x9FAF2466,
+  0x9E9E2C21,
+  0x9D9D2C1B,
+  0x9C9C2C16,
+  0x97972466,
+  0x96962C0B,
+  0x95952C05,
+  0x94942C00,
+  0x93932BFA,
+  0x92922BF4,
+  0x8F8F2BEE,
+  0x8E8E29EB,
+  0x8D8D2BE7,
+  0x8C8C2BE2,
+  0x8B8B2BDD,
+  0x8A8A2BD8,
+  0x84892466,
+  0x83832BD3,
+  0x81812BCD,
+  0x80802BC5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBEBE2D8D,
+  0xBBBB2D87,
+  0xB6B62D80,
+  0xB5B52D77,
+  0xB4B42D70,
+  0xB2B22D6B,
+  0xB1B12D65,
+  0xB0B02D5F,
+  0xABAB28CA,
+  0xAAAA2D59,
+  0xA9A92D53,
+  0xA8A82D4C,
+  0xA7A72D45,
+  0xA6A62D3F,
+  0xA5A52D38,
+  0xA4A42D2F,
+  0xA3A32D2A,
+  0xA2A2249D,
+  0xA0A02D25,
+  0x9D9D2D20,
+  0x9C9C2D1A,
+  0x9B9B274C,
+  0x9A9A2D14,
+  0x99992D0D,
+  0x98982CF5,
+  0x97972D07,
+  0x96962D02,
+  0x93932CFA,
+  0x92922CF5,
+  0x91912CED,
+  0x90902CE8,
+  0x8D8D2CE1,
+  0x8C8C27A0,
+  0x8B8B2CDB,
+  0x8A8A2CD2,
+  0x89BF2466,
+  0x88882CCC,
+  0x87872CC4,
+  0x86862CBE,
+  0x85852CB5,
+  0x84842CAF,
+  0x83832CA8,
+  0x82822CA2,
+  0x81812C9A,
+  0x80802C94,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF2D98,
+  0xBEBE2A9D,
+  0x96BD2466,
+  0x95952D93,
+  0x8F912466,
+  0x8E8E2A78,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x91BF2466,
+  0x90902D02,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9ABF2466,
+  0x99992D20,
+  0x808F2466,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF2DBC,
+  0xBEBE2DB6,
+  0xBDBD2DB0,
+  0xBABB2466,
+  0xAFB82466,
+  0xAEAE2D6B,
+  0xADAD2DA9,
+  0xACAC2CF5,
+  0xABAB2DA3,
+  0xAAAA2ACC,
+  0xA9A92D9D,
+  0xA8A828CA,
+  0x809F2466,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB5BF2466,
+  0xB4B42491,
+  0xB3B32DC8,
+  0x9F9F2DC3,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF2DCD,
+  0x80BE2466,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB3BF2466,
+  0xB2B22DEC,
+  0xB1B12DE6,
+  0x8CAF2466,
+  0x8B8B2DE1,
+  0x85852DDA,
+  0x84842DD5,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBCBC28DB,
+  0xA0BF2466,
+  0x9F9F2E36,
+  0x9E9E2E30,
+  0x9D9D2E2A,
+  0x9C9C2E24,
+  0x9B9B2E1D,
+  0x9A9A2E18,
+  0x95952E11,
+  0x94942E07,
+  0x93932E02,
+  0x92922DF7,
+  0x91912DF2,
+  0x808F2466,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBABA2E8E,
+  0xB9B92E76,
+  0xB8B82E69,
+  0xA6BF2466,
+  0xA5A52E62,
+  0xA3A32E5D,
+  0x9F9F2E54,
+  0x8B8B2E4E,
+  0x8A8A2E48,
+  0x85852E42,
+  0x84842E3C,
+  0x809E2466,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAFAF2E97,
+  0x80BF2466,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9B9B2E9D,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0A029EB,
+  0x9C9C28CA,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBABA2EA2,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF2466,
+  0xAFAF2EA7,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA9BF2466,
+  0xA8A82EAC,
+  0x809F2466,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x8EBF2466,
+  0x8D8D2EB1,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBEBE2426,
+  0xBBBB2426,
+  0xA7A72426,
+  0x8C8C2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9EBF2426,
+  0x8E8F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBBBF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9D9F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x91BF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0AC2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB6BF2426,
+  0x8A8F2426,
+  0x81812426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90BF2426,
+  0x84872426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAAAF2426,
+  0x9E9F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBCBF2426,
+  0x94972426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA8AF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBBBB2426,
+  0xA4AF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBF2426,
+  0xBABA2426,
+  0xB2B22426,
+  0xA2A22426,
+  0x96962426,
+  0x93932426,
+  0x8B8B2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB7BF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA8BF2426,
+  0x969F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBBBF2426,
+  0xB1B12426,
+  0x86862426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBE2426,
+  0xB9BB2426,
+  0xB6B62426,
+  0x89892426,
+  0x86872426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB7BF2426,
+  0x969F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB6BF2426,
+  0xB3B32426,
+  0x809F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBABF2426,
+  0x969F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB8BD2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB6BF2426,
+  0x98982426,
+  0x94942426,
+  0x818F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBF2426,
+  0x809F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9DBF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA5BF2426,
+  0x88882426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB3BF2426,
+  0x969F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x92BF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB3BF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBABF2426,
+  0xA4AF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB2BF2426,
+  0xAAAF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA8AF2426,
+  0x9DA62426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x86AF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x82AF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB7BF2426,
+  0x859F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB8BF2426,
+  0x80822426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB6BF2426,
+  0xB3B42426,
+  0xB0B02426,
+  0x80A52426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF2426,
+  0x80822426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBABF2426,
+  0xA9AF2426,
+  0x808F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA7B52426,
+  0x80822426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB7BF2426,
+  0xB3B52426,
+  0x888F2426,
+  0x85862426,
+  0x80832426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB3BF2426,
+  0x80822426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9DBF2426,
+  0x9B9B2426,
+  0x858F2426,
+  0x80802426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xACBF2426,
+  0x92922426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA9AF2426,
+  0x9E9E2426,
+  0x8E8E2426,
+  0x89892426,
+  0x87872426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBABF2426,
+  0x9FAF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA2BF2426,
+  0x919C2426,
+  0x808F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB5BF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA2BF2426,
+  0x9A9E2426,
+  0x8B8F2426,
+  0x80862426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9ABF2426,
+  0x888F2426,
+  0x86862426,
+  0x80832426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAFBF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9CBF2426,
+  0x80972426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9ABF2426,
+  0x858F2426,
+  0x80832426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB9BF2426,
+  0xABB72426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBABF2426,
+  0x9BAF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x87BF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xACBF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAABE2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB0BE2426,
+  0x97972426,
+  0x94942426,
+  0x8A8B2426,
+  0x87882426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9ABF2426,
+  0x828F2426,
+  0x80802426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA8A92426,
+  0x809F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA4BF2426,
+  0xA2A22426,
+  0x91A02426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBBBF2426,
+  0xB3B92426,
+  0x818A2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x919B2426,
+  0x808F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9EAF2426,
+  0x8A9C2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAFBF2426,
+  0x89892426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9AB12426,
+  0x818F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x90BF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB1BF2426,
+  0x8A8A2426,
+  0x87872426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA9A92426,
+  0xA6A62426,
+  0x9A9F2426,
+  0x878F2426,
+  0x80852426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAABF2426,
+  0x999F2426,
+  0x8A972426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB3BF2426,
+  0x809F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB1BF2426,
+  0x80AF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x84BF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB1BF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAAAF2426,
+  0x9F9F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAEBF2426,
+  0x8A8F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB8BC2426,
+  0x9AA22426,
+  0x848F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x91BF2426,
+  0x8B8F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0BF2426,
+  0x80922426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA4BF2426,
+  0xA2A22426,
+  0x809F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB8BF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x96BF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF2426,
+  0xBCBC2426,
+  0xB4B42426,
+  0x80AF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA3BF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA8AF2426,
+  0x93A32426,
+  0x808F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBCBF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBDBF2426,
+  0xABAF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9ABF2426,
+  0x898F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x95952426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBCBC2426,
+  0xBABA2426,
+  0xADAD2426,
+  0xA7A82426,
+  0xA3A42426,
+  0xA0A12426,
+  0x9D9D2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x84842426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF2426,
+  0xBABA2426,
+  0x9D9D2426,
+  0x95952426,
+  0x8B8C2426,
+  0x86862426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x91912426,
+  0x87892426,
+  0x85852426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA6A72426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBBBB2426,
+  0x9B9B2426,
+  0x81812426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xB5B52426,
+  0x95952426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAFAF2426,
+  0x8F8F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA9A92426,
+  0x89892426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x8C8D2426,
+  0x83832426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBEBF2426,
+  0xADB62426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x8FBF2426,
+  0x8A8D2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xAEBF2426,
+  0x808F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBABF2426,
+  0xACAF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF2426,
+  0xAFAF2426,
+  0xACAC2426,
+  0xA7A72426,
+  0x809F2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x85BF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9ABF2426,
+  0x8C8F2426,
+  0x848A2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBCBF2426,
+  0xBABA2426,
+  0xB8B82426,
+  0xB3B32426,
+  0xA8A82426,
+  0xA5A62426,
+  0xA3A32426,
+  0xA0A02426,
+  0x84842426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBFBF2426,
+  0xBDBD2426,
+  0xB8B82426,
+  0xB3B32426,
+  0xABAB2426,
+  0xA5A62426,
+  0xA3A32426,
+  0xA0A02426,
+  0x9E9E2426,
+  0x9C9C2426,
+  0x9A9A2426,
+  0x98982426,
+  0x95962426,
+  0x93932426,
+  0x90902426,
+  0x8C8C2426,
+  0x8A8A2426,
+  0x88882426,
+  0x83862426,
+  0x80812426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBCBF2426,
+  0xAAAA2426,
+  0xA4A42426,
+  0x9CA02426,
+  0x8A8A2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xBABF2426,
+  0x80AF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA0BF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA2AF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0xA1BF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x9EBF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+  0x08000BA3,
+  0x8BBF2426,
+  0x0BFF0D45,
+  0x0AFFFFFF,
+  0x00090D45,
+};
+
+const reflex::Pattern::Pred reflex_pred_pack1[4354] = {
+    0,  4,
+   16, 16, 16, 16, 16, 16, 16, 16, 16, 31,  0, 16, 16, 16, 16, 16,
+   16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+   31, 16, 16, 16, 16, 16, 16, 16, 24, 16, 16, 16, 16, 16, 16, 16,
+   31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 16, 16, 16, 16, 16,
+   16, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 16, 16, 16, 16, 31,
+   16, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 16, 16, 16, 16, 16,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   16, 16, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 16, 31, 31, 31,
+   31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 16, 31,
+   31, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+   30, 30, 30, 30, 30, 30, 30, 30, 28, 31, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 28, 28, 28, 28, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   31, 30, 30, 30, 30, 30, 30, 30, 28, 30, 30, 30, 30, 30, 30, 30,
+   31, 31, 31, 29, 29, 29, 29, 29, 31, 31, 31, 30, 30, 30, 30, 30,
+   28, 31, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+   29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 28, 28, 28, 28, 29,
+   28, 29, 29, 29, 29, 29, 29, 29, 31, 29, 29, 29, 29, 29, 29, 29,
+   31, 31, 31, 29, 29, 29, 29, 29, 31, 31, 31, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 28, 30, 30, 30, 28, 28, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 28, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   28, 28, 28, 28, 28, 28, 28, 28, 30, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 28, 29, 29, 29,
+   29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+   29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 28, 29,
+   29, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 28, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   30, 30, 30, 30, 30, 28, 30, 30, 30, 28, 30, 30, 28, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+};
+
+#ifndef REFLEX_CODE_DECL
+#include <reflex/pattern.h>
+#define REFLEX_CODE_DECL const reflex::Pattern::Opcode
+#endif
+
+REFLEX_CODE_DECL reflex_code_pack2[18263] =
+{
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x7B7B0062,
+  0x617A008E,
+  0x5F5F008E,
+  0x5D5D008E,
+  0x415B008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3039008E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x2020002D,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x0909002D,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x7B7B0062,
+  0x77770365,
+  0x74740338,
+  0x7373030B,
+  0x727202DE,
+  0x696902B1,
+  0x66660284,
+  0x65650257,
+  0x6363022A,
+  0x617A008E,
+  0x5F5F008E,
+  0x5D5D008E,
+  0x415B008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3039008E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x2020002D,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x0909002D,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x617A008E,
+  0x5F5F008E,
+  0x5D5D008E,
+  0x415B008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3039008E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x20200392,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x09090392,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x617A008E,
+  0x5F5F008E,
+  0x5D5D008E,
+  0x415B008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3039008E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xBABA008E,
+  0xB5B5008E,
+  0xAAAA008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8BF008E,
+  0x98B6008E,
+  0x8096008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BF008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAEAE008E,
+  0xACAC008E,
+  0xA0A4008E,
+  0x8691008E,
+  0x8081008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF008E,
+  0xBABD008E,
+  0xB6B7008E,
+  0xB0B4008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA3BF008E,
+  0x8EA1008E,
+  0x8C8C008E,
+  0x888A008E,
+  0x8686008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB7BF008E,
+  0x80B5008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8ABF008E,
+  0x8081008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1BF008E,
+  0x80AF008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF008E,
+  0x9999008E,
+  0x8096008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8088008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFB2008E,
+  0x90AA008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1BF008E,
+  0xAEAF008E,
+  0xA0A9008E,
+  0x808A008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF008E,
+  0xAEBC008E,
+  0xA5A6008E,
+  0x9595008E,
+  0x8093008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x92AF008E,
+  0x9090008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8DBF008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1B1008E,
+  0x80A5008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABA008E,
+  0xB4B5008E,
+  0x80AA008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBE0520,
+  0xBDBD0519,
+  0xBCBC0512,
+  0xBBBB0509,
+  0xBABA04FC,
+  0xB9B904F5,
+  0xB8B804EE,
+  0xB7B704E7,
+  0xB6B604DE,
+  0xB5B504D4,
+  0xB4B404CB,
+  0xB3B304C2,
+  0xB2B204B6,
+  0xB1B104AD,
+  0xB0B004A3,
+  0xAFAF049C,
+  0xAEAE048D,
+  0xADAD0484,
+  0xACAC0478,
+  0xABAB046F,
+  0xAAAA0463,
+  0xA9A9045A,
+  0xA8A8044E,
+  0xA7A70444,
+  0xA6A60437,
+  0xA5A5042E,
+  0xA4A40427,
+  0xA3A30421,
+  0xA2A20419,
+  0xA1A10411,
+  0xA0A00408,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF065E,
+  0xBEBE0656,
+  0xBDBD064A,
+  0xBCBC0642,
+  0xB8BB00CA,
+  0xB4B600CA,
+  0xB3B30639,
+  0xB2B20631,
+  0xB1B1062A,
+  0xB0B00624,
+  0xAFAF061E,
+  0xAEAE0617,
+  0xADAD0610,
+  0xACAC060A,
+  0xAAAA0602,
+  0xA9A905FC,
+  0xA8A805F5,
+  0xA7A705EE,
+  0xA6A605E7,
+  0xA5A505E0,
+  0xA4A405DA,
+  0xA3A305D4,
+  0xA2A205CB,
+  0xA1A105C5,
+  0xA0A005BE,
+  0x9F9F05B6,
+  0x9E9E05B0,
+  0x9D9D05A8,
+  0x9C9C05A1,
+  0x9B9B059A,
+  0x9A9A0593,
+  0x9999058C,
+  0x90900586,
+  0x8F8F057F,
+  0x8E8E0578,
+  0x8D8D0572,
+  0x8C8C056A,
+  0x8B8B0561,
+  0x8A8A0557,
+  0x8989054C,
+  0x849800CA,
+  0x83830542,
+  0x82820539,
+  0x8181052D,
+  0x80800526,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8B806C7,
+  0xB7B706BE,
+  0xB6B606B4,
+  0xB5B506AD,
+  0xB4B406A4,
+  0xB3B3069C,
+  0xB0B200CA,
+  0x86860696,
+  0x8585068F,
+  0x8484067F,
+  0x82820679,
+  0x81810670,
+  0x8080066A,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90BF00CA,
+  0x878706F2,
+  0x868606EB,
+  0x858500CA,
+  0x848406E4,
+  0x838306DD,
+  0x828206D5,
+  0x81810586,
+  0x808006CD,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8BF00CA,
+  0x80B600CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BF00CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFAF079C,
+  0xADAD0794,
+  0xACAC0789,
+  0xABAB077F,
+  0xAAAA0776,
+  0xA9A9076B,
+  0xA8A80765,
+  0xA7A7075D,
+  0xA6A60757,
+  0xA5A50750,
+  0xA4A40749,
+  0xA3A30740,
+  0xA2A2073A,
+  0xA1A105B0,
+  0xA0A00731,
+  0x9F9F0727,
+  0x9E9E0720,
+  0x9C9C0719,
+  0x9B9B061E,
+  0x9A9A0712,
+  0x9999070B,
+  0x98980704,
+  0x939306FE,
+  0x929206F8,
+  0x80BF00CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9F9F07AA,
+  0x9E9E07A3,
+  0x809D00CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF0821,
+  0xBEBE081B,
+  0xBDBD0814,
+  0xBCBC080C,
+  0xBBBB0806,
+  0xB9B907FE,
+  0xB8B807F8,
+  0xB7B707F1,
+  0xB6B607EA,
+  0xB5B507E4,
+  0xB4B407DE,
+  0xAFAF07D8,
+  0xAEAE07D2,
+  0xADAD07CA,
+  0xACAC07BE,
+  0xABAB07B8,
+  0xA9A907B1,
+  0xA4BA00CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1B1091C,
+  0xAFAF0915,
+  0xAEAE090E,
+  0xACAC0907,
+  0xABAB08FF,
+  0xAAAA08F8,
+  0xA0B001C9,
+  0x9F9F08F2,
+  0x9E9E08E2,
+  0x9D9D08D0,
+  0x9B9B08C4,
+  0x9A9A08BE,
+  0x989808B5,
+  0x979701C9,
+  0x969608A3,
+  0x9494089C,
+  0x93930895,
+  0x9292088A,
+  0x91910859,
+  0x9090082A,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x627A008E,
+  0x61610923,
+  0x5F5F008E,
+  0x5D5D008E,
+  0x415B008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3039008E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x6C6C0950,
+  0x617A008E,
+  0x5F5F008E,
+  0x5D5D008E,
+  0x415B008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3039008E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x6F6F097D,
+  0x617A008E,
+  0x5F5F008E,
+  0x5D5D008E,
+  0x415B008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3039008E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x666609AA,
+  0x617A008E,
+  0x5F5F008E,
+  0x5D5D008E,
+  0x415B008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3039008E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x656509D7,
+  0x617A008E,
+  0x5F5F008E,
+  0x5D5D008E,
+  0x415B008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3039008E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x77770A04,
+  0x617A008E,
+  0x5F5F008E,
+  0x5D5D008E,
+  0x415B008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3039008E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x68680A31,
+  0x617A008E,
+  0x5F5F008E,
+  0x5D5D008E,
+  0x415B008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3039008E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x68680A5E,
+  0x617A008E,
+  0x5F5F008E,
+  0x5D5D008E,
+  0x415B008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3039008E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x77770365,
+  0x74740338,
+  0x7373030B,
+  0x727202DE,
+  0x696902B1,
+  0x66660284,
+  0x65650257,
+  0x6363022A,
+  0x617A008E,
+  0x5F5F008E,
+  0x5D5D008E,
+  0x415B008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3039008E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x20200392,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x09090392,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x77770BD4,
+  0x74740BA5,
+  0x73730B76,
+  0x72720B47,
+  0x69690B18,
+  0x66660AE9,
+  0x65650ABA,
+  0x63630A8B,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x5D5D008E,
+  0x5B5B008E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x30390D6E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0x77770DC6,
+  0x74740DC0,
+  0x73730DBA,
+  0x72720DB4,
+  0x69690DAE,
+  0x66660DA8,
+  0x65650DA2,
+  0x63630D9C,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA8A8008E,
+  0xA4A4008E,
+  0x9A9A008E,
+  0x8095008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0xA0AA008E,
+  0x8098008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF008E,
+  0x898E008E,
+  0x8087008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8089008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBD008E,
+  0x84B9008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1BF008E,
+  0xA6AF008E,
+  0x98A1008E,
+  0x9090008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBD008E,
+  0xB6B9008E,
+  0xB2B2008E,
+  0xAAB0008E,
+  0x93A8008E,
+  0x8F90008E,
+  0x858C008E,
+  0x8080008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBC008E,
+  0xA6B1008E,
+  0x9FA1008E,
+  0x9C9D008E,
+  0x8E8E008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8B9008E,
+  0xB5B6008E,
+  0xB2B3008E,
+  0xAAB0008E,
+  0x93A8008E,
+  0x8F90008E,
+  0x858A008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2B4008E,
+  0xA6AF008E,
+  0x9E9E008E,
+  0x999C008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBD008E,
+  0xB5B9008E,
+  0xB2B3008E,
+  0xAAB0008E,
+  0x93A8008E,
+  0x8F91008E,
+  0x858D008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB9B9008E,
+  0xA6AF008E,
+  0xA0A1008E,
+  0x9090008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBD008E,
+  0xB5B9008E,
+  0xB2B3008E,
+  0xAAB0008E,
+  0x93A8008E,
+  0x8F90008E,
+  0x858C008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1B1008E,
+  0xA6AF008E,
+  0x9FA1008E,
+  0x9C9D008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAEB9008E,
+  0xA8AA008E,
+  0xA3A4008E,
+  0x9E9F008E,
+  0x9C9C008E,
+  0x999A008E,
+  0x9295008E,
+  0x8E90008E,
+  0x858A008E,
+  0x8383008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA6AF008E,
+  0x9090008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBD008E,
+  0xAAB9008E,
+  0x92A8008E,
+  0x8E90008E,
+  0x858C008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA6AF008E,
+  0xA0A1008E,
+  0x9D9D008E,
+  0x989A008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBD008E,
+  0xB5B9008E,
+  0xAAB3008E,
+  0x92A8008E,
+  0x8E90008E,
+  0x858C008E,
+  0x8080008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1B2008E,
+  0xA6AF008E,
+  0xA0A1008E,
+  0x9D9E008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBD008E,
+  0x92BA008E,
+  0x8E90008E,
+  0x848C008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABF008E,
+  0xA6AF008E,
+  0x9FA1008E,
+  0x9496008E,
+  0x8E8E008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBD008E,
+  0xB3BB008E,
+  0x9AB1008E,
+  0x8596008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA6AF008E,
+  0x8086008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2B3008E,
+  0x81B0008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9099008E,
+  0x8086008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBD008E,
+  0xB2B3008E,
+  0xA7B0008E,
+  0xA5A5008E,
+  0x8CA3008E,
+  0x868A008E,
+  0x8484008E,
+  0x8182008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9C9F008E,
+  0x9099008E,
+  0x8686008E,
+  0x8084008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0A9008E,
+  0x8080008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x89AC008E,
+  0x8087008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x888C008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF008E,
+  0x80AA008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB5BF008E,
+  0xAEB0008E,
+  0xA5A6008E,
+  0xA1A1008E,
+  0x9A9D008E,
+  0x9095008E,
+  0x8089008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF008E,
+  0x9099008E,
+  0x8E8E008E,
+  0x8081008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBF008E,
+  0x90BA008E,
+  0x8D8D008E,
+  0x8787008E,
+  0x8085008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF008E,
+  0x9A9D008E,
+  0x9898008E,
+  0x9096008E,
+  0x8A8D008E,
+  0x8088008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8BE008E,
+  0xB2B5008E,
+  0x90B0008E,
+  0x8A8D008E,
+  0x8088008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x98BF008E,
+  0x8896008E,
+  0x8285008E,
+  0x8080008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x98BF008E,
+  0x9295008E,
+  0x8090008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x809A008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF008E,
+  0x808F008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8BD008E,
+  0x80B5008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x81BF008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFBF008E,
+  0x80AC008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF008E,
+  0x819A008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1B8008E,
+  0x80AA008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9FB1008E,
+  0x8091008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAEB0008E,
+  0xA0AC008E,
+  0x8091008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80B3008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0A9008E,
+  0x9C9C008E,
+  0x9797008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF008E,
+  0x9099008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80B8008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0xAAAA008E,
+  0x87A8008E,
+  0x8084008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80B5008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x809E008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B4008E,
+  0x86AD008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0x80AB008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9099008E,
+  0x8089008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF008E,
+  0x8096008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8094008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA7A7008E,
+  0x9099008E,
+  0x8089008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x85B3008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9099008E,
+  0x858C008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAEBF008E,
+  0x83A0008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80A5008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80A3008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8DBD008E,
+  0x8089008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBF008E,
+  0x90BA008E,
+  0x8088008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABA008E,
+  0xB5B6008E,
+  0xAEB3008E,
+  0xA9AC008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF008E,
+  0x989D008E,
+  0x8095008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9FBD008E,
+  0x9D9D008E,
+  0x9B9B008E,
+  0x9999008E,
+  0x9097008E,
+  0x888D008E,
+  0x8085008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBE008E,
+  0xB6BC008E,
+  0x80B4008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB6BC008E,
+  0xB2B4008E,
+  0xA0AC008E,
+  0x969B008E,
+  0x9093008E,
+  0x868C008E,
+  0x8284008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF008E,
+  0xB1B1008E,
+  0x9494008E,
+  0x8080008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x909C008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBF008E,
+  0xAFB9008E,
+  0xAAAD008E,
+  0xA8A8008E,
+  0xA6A6008E,
+  0xA4A4008E,
+  0x999D008E,
+  0x9595008E,
+  0x8A93008E,
+  0x8787008E,
+  0x8282008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8E8E008E,
+  0x8589008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8384008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2B3008E,
+  0xABAE008E,
+  0x80A4008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0xADAD008E,
+  0xA7A7008E,
+  0x80A5008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFAF008E,
+  0x80A7008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8BE008E,
+  0xB0B6008E,
+  0xA8AE008E,
+  0xA0A6008E,
+  0x8096008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x989E008E,
+  0x9096008E,
+  0x888E008E,
+  0x8086008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFAF008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBC008E,
+  0xB1B5008E,
+  0x8586008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA1BF008E,
+  0x9D9F008E,
+  0x8096008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBF008E,
+  0x80BA008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1BF008E,
+  0x85AF008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF008E,
+  0x808E008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x808C008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90BD008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90AB008E,
+  0x808C008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF008E,
+  0x80AE008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF008E,
+  0x809D008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA2BF008E,
+  0x979F008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8BBF008E,
+  0x8088008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2BF008E,
+  0x9599008E,
+  0x9393008E,
+  0x9091008E,
+  0x808A008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8CA2008E,
+  0x878A008E,
+  0x8385008E,
+  0x8081008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x82B3008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBE008E,
+  0xBBBB008E,
+  0xB2B7008E,
+  0x9099008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0x80A5008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BC008E,
+  0x8086008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x84B2008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA6BE008E,
+  0xA0A4008E,
+  0x8F99008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80A8008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF008E,
+  0xBABA008E,
+  0xA0B6008E,
+  0x9099008E,
+  0x848B008E,
+  0x8082008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB9BD008E,
+  0xB5B6008E,
+  0xB1B1008E,
+  0x80AF008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2B4008E,
+  0xA0AA008E,
+  0x9B9D008E,
+  0x8282008E,
+  0x8080008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0xA8AE008E,
+  0xA0A6008E,
+  0x9196008E,
+  0x898E008E,
+  0x8186008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0x9CA9008E,
+  0x809A008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B9008E,
+  0x80A2008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0x80A3008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8BBB008E,
+  0x8086008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0x80AD008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8099008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBE008E,
+  0xB8BC008E,
+  0xAAB6008E,
+  0x9FA8008E,
+  0x9D9D008E,
+  0x9397008E,
+  0x8086008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x86BF008E,
+  0x8384008E,
+  0x8081008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80B1008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x93BF008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BD008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90BF008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x92BF008E,
+  0x808F008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BB008E,
+  0x8087008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB3B4008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB6BF008E,
+  0xB0B4008E,
+  0x8D8F008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BC008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF008E,
+  0xA1BA008E,
+  0x9099008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA6BF008E,
+  0x819A008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BE008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9A9C008E,
+  0x9297008E,
+  0x8A8F008E,
+  0x8287008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF0EBF,
+  0xBEBE0EB8,
+  0xBDBD0EB1,
+  0xBCBC0EA9,
+  0xBABA0EA2,
+  0xB4B40E9B,
+  0xB2B30E95,
+  0xB1B1010A,
+  0xB0B000CA,
+  0xAEAE0E8F,
+  0xADAD0E88,
+  0xACAC05D4,
+  0xABAB0E81,
+  0xAAAA0E7B,
+  0xA9A90E75,
+  0xA8A80E6C,
+  0xA6A60E65,
+  0xA4A40E5E,
+  0xA3A30E57,
+  0xA2A205DA,
+  0xA1A10E50,
+  0xA0A00E45,
+  0x9E9E0E3D,
+  0x9D9D0E36,
+  0x9C9C0E30,
+  0x989B00CA,
+  0x96960E24,
+  0x95950E1C,
+  0x94940E15,
+  0x93930E0E,
+  0x92920E06,
+  0x909100CA,
+  0x8F8F0DFF,
+  0x8E8E0712,
+  0x8D8D0DF7,
+  0x8C8C0DF0,
+  0x8B8B0DEA,
+  0x8A8A0DE3,
+  0x83830DDD,
+  0x828200CA,
+  0x81810DD6,
+  0x80800DCC,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBE0FDC,
+  0xBBBB0FD6,
+  0xB6B60FCE,
+  0xB5B50FC4,
+  0xB4B40FBC,
+  0xB2B20FB6,
+  0xB1B10FAE,
+  0xB0B00FA7,
+  0xABAB05C5,
+  0xAAAA0F9F,
+  0xA9A90F98,
+  0xA8A80F90,
+  0xA7A70F88,
+  0xA6A60F81,
+  0xA5A50F7A,
+  0xA4A40F6F,
+  0xA3A30F68,
+  0xA2A20117,
+  0xA0A00F62,
+  0x9D9D0F5C,
+  0x9C9C0F55,
+  0x9B9B0421,
+  0x9A9A0F4E,
+  0x99990F47,
+  0x98980F2D,
+  0x97970F41,
+  0x96960F3B,
+  0x93930F33,
+  0x92920F2D,
+  0x91910F25,
+  0x90900F1F,
+  0x8D8D0F18,
+  0x8C8C0478,
+  0x8B8B0F11,
+  0x8A8A0F06,
+  0x88880EFF,
+  0x87870EF7,
+  0x86860EF1,
+  0x85850EE8,
+  0x84840EE1,
+  0x83830EDA,
+  0x82820ED4,
+  0x81810ECC,
+  0x80800EC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF0FE8,
+  0xBEBE07E4,
+  0x95950FE2,
+  0x929400CA,
+  0x8E8E07B8,
+  0x808D00CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90900F3B,
+  0x808F00CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x99990F5C,
+  0x909800CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF1013,
+  0xBEBE100D,
+  0xBDBD1006,
+  0xBCBC00CA,
+  0xB9B900CA,
+  0xAEAE0FB6,
+  0xADAD0FFD,
+  0xACAC0F2D,
+  0xABAB0FF6,
+  0xAAAA081B,
+  0xA9A90FEE,
+  0xA8A805C5,
+  0xA0A700CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB4B4010A,
+  0xB3B31020,
+  0x9F9F101A,
+  0x80B200CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF1026,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2B21049,
+  0xB1B11042,
+  0xB0B000CA,
+  0x8B8B103C,
+  0x85851034,
+  0x8484102E,
+  0x808A00CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBC05DA,
+  0x9F9F10A7,
+  0x9E9E109F,
+  0x9D9D1097,
+  0x9C9C108F,
+  0x9B9B1086,
+  0x9A9A107F,
+  0x95951076,
+  0x9494106B,
+  0x93931064,
+  0x92921057,
+  0x91911050,
+  0x909900CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABA1107,
+  0xB9B910EF,
+  0xB8B810E1,
+  0xA5A510D9,
+  0xA3A310D3,
+  0xA0A400CA,
+  0x9F9F10CA,
+  0x8B8B10C3,
+  0x8A8A10BD,
+  0x858510B6,
+  0x848410AF,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFAF1111,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9B9B1117,
+  0x80BF00CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0A00712,
+  0x9C9C05C5,
+  0x80BF00CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABA111D,
+  0x80BF00CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFAF1124,
+  0x80AE00CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA8A8112A,
+  0xA0A700CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8D8D1130,
+  0x808C00CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x74741136,
+  0x617A008E,
+  0x5F5F008E,
+  0x5D5D008E,
+  0x415B008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3039008E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x73731163,
+  0x617A008E,
+  0x5F5F008E,
+  0x5D5D008E,
+  0x415B008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3039008E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x727209AA,
+  0x617A008E,
+  0x5F5F008E,
+  0x5D5D008E,
+  0x415B008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3039008E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0x08001190,
+  0xF0F012C8,
+  0xEFEF12B2,
+  0xEDED12AB,
+  0xEAEA128E,
+  0xE5EC1289,
+  0xE4E41283,
+  0xE3E31276,
+  0xE2E21265,
+  0xE1E11234,
+  0xE0E01211,
+  0xDFDF120A,
+  0xDEDE1204,
+  0xDDDD11FF,
+  0xDCDC11F9,
+  0xDBDB11F0,
+  0xD9D911E8,
+  0xD8D811E3,
+  0xD7D711DD,
+  0xD6D611D8,
+  0xD5D511D1,
+  0xD4D411CB,
+  0xD2D211C5,
+  0xD0DA11A0,
+  0xCFCF11BF,
+  0xCECE11B6,
+  0xCDCD11AE,
+  0xCBCB11A5,
+  0xC4CA11A0,
+  0xC3C31199,
+  0xC2C21192,
+  0x617A09AA,
+  0x5F5F09AA,
+  0x5D5D09AA,
+  0x415B09AA,
+  0x3E3E09AA,
+  0x3C3C09AA,
+  0x303909AA,
+  0x2E2E09AA,
+  0x2C2C09AA,
+  0x202012E0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x090912E0,
+  0x0008130E,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x74741312,
+  0x617A008E,
+  0x5F5F008E,
+  0x5D5D008E,
+  0x415B008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3039008E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x69690923,
+  0x617A008E,
+  0x5F5F008E,
+  0x5D5D008E,
+  0x415B008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3039008E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x7272133F,
+  0x617A008E,
+  0x5F5F008E,
+  0x5D5D008E,
+  0x415B008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3039008E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x6969136C,
+  0x617A008E,
+  0x5F5F008E,
+  0x5D5D008E,
+  0x415B008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3039008E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x627A0D6E,
+  0x616113A7,
+  0x5F5F0D6E,
+  0x5D5D008E,
+  0x5B5B008E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x30390D6E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x28281399,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x6C6C140C,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x5D5D008E,
+  0x5B5B008E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x30390D6E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x28281399,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x6F6F143B,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x5D5D008E,
+  0x5B5B008E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x30390D6E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x28281399,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x6666146A,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x5D5D008E,
+  0x5B5B008E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x30390D6E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x28281399,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x65651499,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x5D5D008E,
+  0x5B5B008E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x30390D6E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x28281399,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x777714C8,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x5D5D008E,
+  0x5B5B008E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x30390D6E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x28281399,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x686814F7,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x5D5D008E,
+  0x5B5B008E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x30390D6E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x28281399,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x68681526,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x5D5D008E,
+  0x5B5B008E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x30390D6E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x28281399,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xBABA0D6E,
+  0xB5B50D6E,
+  0xAAAA0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8BF0D6E,
+  0x98B60D6E,
+  0x80960D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BF0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAEAE0D6E,
+  0xACAC0D6E,
+  0xA0A40D6E,
+  0x86910D6E,
+  0x80810D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF0D6E,
+  0xBABD0D6E,
+  0xB6B70D6E,
+  0xB0B40D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA3BF0D6E,
+  0x8EA10D6E,
+  0x8C8C0D6E,
+  0x888A0D6E,
+  0x86860D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB7BF0D6E,
+  0x80B50D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8ABF0D6E,
+  0x80810D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1BF0D6E,
+  0x80AF0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF0D6E,
+  0x99990D6E,
+  0x80960D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80880D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFB20D6E,
+  0x90AA0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1BF0D6E,
+  0xAEAF0D6E,
+  0xA0A90D6E,
+  0x808A0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF0D6E,
+  0xAEBC0D6E,
+  0xA5A60D6E,
+  0x95950D6E,
+  0x80930D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x92AF0D6E,
+  0x90900D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8DBF0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1B10D6E,
+  0x80A50D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABA0D6E,
+  0xB4B50D6E,
+  0x80AA0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBE166D,
+  0xBDBD1666,
+  0xBCBC165F,
+  0xBBBB1656,
+  0xBABA1649,
+  0xB9B91642,
+  0xB8B8163B,
+  0xB7B71634,
+  0xB6B6162B,
+  0xB5B51621,
+  0xB4B41618,
+  0xB3B3160F,
+  0xB2B21603,
+  0xB1B115FA,
+  0xB0B015F0,
+  0xAFAF15E9,
+  0xAEAE15DA,
+  0xADAD15D1,
+  0xACAC15C5,
+  0xABAB15BC,
+  0xAAAA15B0,
+  0xA9A915A7,
+  0xA8A8159B,
+  0xA7A71591,
+  0xA6A61584,
+  0xA5A5157B,
+  0xA4A41574,
+  0xA3A3156E,
+  0xA2A21566,
+  0xA1A1155E,
+  0xA0A01555,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF17AB,
+  0xBEBE17A3,
+  0xBDBD1797,
+  0xBCBC178F,
+  0xB8BB0C13,
+  0xB4B60C13,
+  0xB3B31786,
+  0xB2B2177E,
+  0xB1B11777,
+  0xB0B01771,
+  0xAFAF176B,
+  0xAEAE1764,
+  0xADAD175D,
+  0xACAC1757,
+  0xAAAA174F,
+  0xA9A91749,
+  0xA8A81742,
+  0xA7A7173B,
+  0xA6A61734,
+  0xA5A5172D,
+  0xA4A41727,
+  0xA3A31721,
+  0xA2A21718,
+  0xA1A11712,
+  0xA0A0170B,
+  0x9F9F1703,
+  0x9E9E16FD,
+  0x9D9D16F5,
+  0x9C9C16EE,
+  0x9B9B16E7,
+  0x9A9A16E0,
+  0x999916D9,
+  0x909016D3,
+  0x8F8F16CC,
+  0x8E8E16C5,
+  0x8D8D16BF,
+  0x8C8C16B7,
+  0x8B8B16AE,
+  0x8A8A16A4,
+  0x89891699,
+  0x84980C13,
+  0x8383168F,
+  0x82821686,
+  0x8181167A,
+  0x80801673,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8B81814,
+  0xB7B7180B,
+  0xB6B61801,
+  0xB5B517FA,
+  0xB4B417F1,
+  0xB3B317E9,
+  0xB0B20C13,
+  0x868617E3,
+  0x858517DC,
+  0x848417CC,
+  0x828217C6,
+  0x818117BD,
+  0x808017B7,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90BF0C13,
+  0x8787183F,
+  0x86861838,
+  0x85850C13,
+  0x84841831,
+  0x8383182A,
+  0x82821822,
+  0x818116D3,
+  0x8080181A,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8BF0C13,
+  0x80B60C13,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BF0C13,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFAF18E9,
+  0xADAD18E1,
+  0xACAC18D6,
+  0xABAB18CC,
+  0xAAAA18C3,
+  0xA9A918B8,
+  0xA8A818B2,
+  0xA7A718AA,
+  0xA6A618A4,
+  0xA5A5189D,
+  0xA4A41896,
+  0xA3A3188D,
+  0xA2A21887,
+  0xA1A116FD,
+  0xA0A0187E,
+  0x9F9F1874,
+  0x9E9E186D,
+  0x9C9C1866,
+  0x9B9B176B,
+  0x9A9A185F,
+  0x99991858,
+  0x98981851,
+  0x9393184B,
+  0x92921845,
+  0x80BF0C13,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9F9F18F7,
+  0x9E9E18F0,
+  0x809D0C13,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF196E,
+  0xBEBE1968,
+  0xBDBD1961,
+  0xBCBC1959,
+  0xBBBB1953,
+  0xB9B9194B,
+  0xB8B81945,
+  0xB7B7193E,
+  0xB6B61937,
+  0xB5B51931,
+  0xB4B4192B,
+  0xAFAF1925,
+  0xAEAE191F,
+  0xADAD1917,
+  0xACAC190B,
+  0xABAB1905,
+  0xA9A918FE,
+  0xA4BA0C13,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1B11A69,
+  0xAFAF1A62,
+  0xAEAE1A5B,
+  0xACAC1A54,
+  0xABAB1A4C,
+  0xAAAA1A45,
+  0xA0B00D12,
+  0x9F9F1A3F,
+  0x9E9E1A2F,
+  0x9D9D1A1D,
+  0x9B9B1A11,
+  0x9A9A1A0B,
+  0x98981A02,
+  0x97970D12,
+  0x969619F0,
+  0x949419E9,
+  0x939319E2,
+  0x929219D7,
+  0x919119A6,
+  0x90901977,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x5D5D008E,
+  0x5B5B008E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x30390D6E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x28281399,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0x61611A70,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x6C6C1A76,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x6F6F1A7C,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x6666130E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x65651A82,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x77771A88,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x68681A8E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x68681A94,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF008E,
+  0xBCBD008E,
+  0xA8BA008E,
+  0x8DA6008E,
+  0x808B008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x909D008E,
+  0x808D008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BA008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF008E,
+  0x809C008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8090008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xADBF008E,
+  0x809F008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90B5008E,
+  0x8289008E,
+  0x8080008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x888F008E,
+  0x8083008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0xA0A9008E,
+  0x809D008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x98BB008E,
+  0x8093008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0x80A7008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBF008E,
+  0xB0BA008E,
+  0x80A3008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBC008E,
+  0xB3B9008E,
+  0xA3B1008E,
+  0x97A1008E,
+  0x9495008E,
+  0x8C92008E,
+  0x808A008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80B6008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0A7008E,
+  0x8095008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2BA008E,
+  0x87B0008E,
+  0x8085008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF008E,
+  0xBCBC008E,
+  0xB7B8008E,
+  0x8AB5008E,
+  0x8888008E,
+  0x8085008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0B6008E,
+  0x8095008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB4B5008E,
+  0xA0B2008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0B9008E,
+  0x8095008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF008E,
+  0x80B7008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x99B5008E,
+  0x9597008E,
+  0x9093008E,
+  0x8080008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BC008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x809C008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x89A4008E,
+  0x8087008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0B2008E,
+  0x8095008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8091008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80B2008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B9008E,
+  0x80A3008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B1008E,
+  0x80A9008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0xA7A7008E,
+  0x809C008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0x8085008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0x8081008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0B6008E,
+  0x8084008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x83B7008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB5B5008E,
+  0xB1B2008E,
+  0xA6AF008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x83AF008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B9008E,
+  0x90A8008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB6BF008E,
+  0x83A6008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB6B6008E,
+  0x90B2008E,
+  0x8787008E,
+  0x8484008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x83B2008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9C9C008E,
+  0x909A008E,
+  0x8184008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x93AB008E,
+  0x8091008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0x9FA8008E,
+  0x8F9D008E,
+  0x8A8D008E,
+  0x8888008E,
+  0x8086008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B9008E,
+  0x809E008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9DA1008E,
+  0x9090008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80B4008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9FA1008E,
+  0x9099008E,
+  0x878A008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80AF008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9099008E,
+  0x8787008E,
+  0x8485008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80AE008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x989B008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9099008E,
+  0x8484008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8B8008E,
+  0x80AA008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B9008E,
+  0x809A008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8086008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80AB008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF008E,
+  0x80A9008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF008E,
+  0x98AF008E,
+  0x9596008E,
+  0x8C93008E,
+  0x8989008E,
+  0x8086008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9099008E,
+  0x8181008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAABF008E,
+  0xA0A7008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA3A3008E,
+  0xA1A1008E,
+  0x8090008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABA008E,
+  0x8BB2008E,
+  0x8080008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9CBF008E,
+  0x9090008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0x9D9D008E,
+  0x8089008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8AAE008E,
+  0x8088008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2BF008E,
+  0x9099008E,
+  0x8080008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x808F008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8BB0008E,
+  0x8889008E,
+  0x8086008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAABF008E,
+  0xA7A8008E,
+  0xA0A5008E,
+  0x9099008E,
+  0x8686008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0A9008E,
+  0x9898008E,
+  0x8089008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0B2008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B0008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8083008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80B0008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0xA0A9008E,
+  0x809E008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90AD008E,
+  0x8089008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBF008E,
+  0xA3B7008E,
+  0x9099008E,
+  0x8083008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9090008E,
+  0x808A008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x939F008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA3A3008E,
+  0xA0A1008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80B7008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8095008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBE008E,
+  0xB5BB008E,
+  0xB0B3008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80A2008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0xA4A7008E,
+  0x9092008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BB008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BC008E,
+  0x80AA008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9099008E,
+  0x8088008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x96BF008E,
+  0x8094008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBF008E,
+  0xBBBB008E,
+  0xAEB9008E,
+  0xA9AC008E,
+  0xA5A6008E,
+  0xA2A2008E,
+  0x9E9F008E,
+  0x809C008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x85BF008E,
+  0x8083008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBE008E,
+  0x9EB9008E,
+  0x969C008E,
+  0x8D94008E,
+  0x878A008E,
+  0x8085008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x92BF008E,
+  0x8A90008E,
+  0x8686008E,
+  0x8084008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA8BF008E,
+  0x80A5008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBF008E,
+  0x9CBA008E,
+  0x829A008E,
+  0x8080008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB6BF008E,
+  0x96B4008E,
+  0x8094008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0x90AE008E,
+  0x808E008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAABF008E,
+  0x8AA8008E,
+  0x8088008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8EBF008E,
+  0x848B008E,
+  0x8082008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB7BD008E,
+  0x80AC008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8E8E008E,
+  0x8089008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90AD008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B9008E,
+  0x80AB008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BE008E,
+  0xADAE008E,
+  0xA8AB008E,
+  0xA0A6008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8084008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9099008E,
+  0x8B8B008E,
+  0x8083008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBB008E,
+  0xB9B9008E,
+  0xB4B7008E,
+  0xA9B2008E,
+  0xA7A7008E,
+  0xA4A4008E,
+  0xA1A2008E,
+  0x859F008E,
+  0x8083008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBE008E,
+  0xB9BC008E,
+  0xB4B7008E,
+  0xACB2008E,
+  0xA7AA008E,
+  0xA4A4008E,
+  0xA1A2008E,
+  0x9F9F008E,
+  0x9D9D008E,
+  0x9B9B008E,
+  0x9999008E,
+  0x9797008E,
+  0x9494008E,
+  0x9192008E,
+  0x8D8F008E,
+  0x8B8B008E,
+  0x8989008E,
+  0x8787008E,
+  0x8282008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xABBB008E,
+  0xA5A9008E,
+  0xA1A3008E,
+  0x8B9B008E,
+  0x8089008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B9008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x809F008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF008E,
+  0x80A1008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80A0008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x809D008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x808A008E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x63631A9A,
+  0x617A008E,
+  0x5F5F008E,
+  0x5D5D008E,
+  0x415B008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3039008E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x656509AA,
+  0x617A008E,
+  0x5F5F008E,
+  0x5D5D008E,
+  0x415B008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3039008E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0x07001AC7,
+  0x00FFFFFF,
+  0x08001190,
+  0xBABA09AA,
+  0xB5B509AA,
+  0xAAAA09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8BF09AA,
+  0x98B609AA,
+  0x809609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BF09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAEAE09AA,
+  0xACAC09AA,
+  0xA0A409AA,
+  0x869109AA,
+  0x808109AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF09AA,
+  0xBABD09AA,
+  0xB6B709AA,
+  0xB0B409AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA3BF09AA,
+  0x8EA109AA,
+  0x8C8C09AA,
+  0x888A09AA,
+  0x868609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB7BF09AA,
+  0x80B509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8ABF09AA,
+  0x808109AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1BF09AA,
+  0x80AF09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF09AA,
+  0x999909AA,
+  0x809609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x808809AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFB209AA,
+  0x90AA09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1BF09AA,
+  0xAEAF09AA,
+  0xA0A909AA,
+  0x808A09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF09AA,
+  0xAEBC09AA,
+  0xA5A609AA,
+  0x959509AA,
+  0x809309AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x92AF09AA,
+  0x909009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8DBF09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1B109AA,
+  0x80A509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABA09AA,
+  0xB4B509AA,
+  0x80AA09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBE1BC3,
+  0xBDBD1BBD,
+  0xBCBC1BB7,
+  0xBBBB1BAF,
+  0xBABA1BA3,
+  0xB9B91B9D,
+  0xB8B81B97,
+  0xB7B71B91,
+  0xB6B61B89,
+  0xB5B51B80,
+  0xB4B41B78,
+  0xB3B31B70,
+  0xB2B21B65,
+  0xB1B11B5D,
+  0xB0B01B54,
+  0xAFAF1B4E,
+  0xAEAE1B40,
+  0xADAD1B38,
+  0xACAC1B2D,
+  0xABAB1B25,
+  0xAAAA1B1A,
+  0xA9A91B12,
+  0xA8A81B07,
+  0xA7A71AFE,
+  0xA6A61AF2,
+  0xA5A51AEA,
+  0xA4A41AE4,
+  0xA3A31ADF,
+  0xA2A21AD8,
+  0xA1A11AD1,
+  0xA0A01AC9,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF1CD7,
+  0xBEBE1CD0,
+  0xBDBD1CC5,
+  0xBCBC1CBE,
+  0xB8BB11A0,
+  0xB4B611A0,
+  0xB3B31CB6,
+  0xB2B21CAF,
+  0xB1B11CA9,
+  0xB0B01CA4,
+  0xAFAF1C9F,
+  0xAEAE1C99,
+  0xADAD1C93,
+  0xACAC1C8E,
+  0xAAAA1C87,
+  0xA9A91C82,
+  0xA8A81C7C,
+  0xA7A71C76,
+  0xA6A61C70,
+  0xA5A51C6A,
+  0xA4A41C65,
+  0xA3A31C60,
+  0xA2A21C58,
+  0xA1A11C53,
+  0xA0A01C4D,
+  0x9F9F1C46,
+  0x9E9E1C41,
+  0x9D9D1C3A,
+  0x9C9C1C34,
+  0x9B9B1C2E,
+  0x9A9A1C28,
+  0x99991C22,
+  0x90901C1D,
+  0x8F8F1C17,
+  0x8E8E1C11,
+  0x8D8D1C0C,
+  0x8C8C1C05,
+  0x8B8B1BFD,
+  0x8A8A1BF4,
+  0x89891BEA,
+  0x849811A0,
+  0x83831BE1,
+  0x82821BD9,
+  0x81811BCE,
+  0x80801BC8,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8B81D34,
+  0xB7B71D2C,
+  0xB6B61D23,
+  0xB5B51D1D,
+  0xB4B41D15,
+  0xB3B31D0E,
+  0xB0B211A0,
+  0x86861D09,
+  0x85851D03,
+  0x84841CF4,
+  0x82821CEF,
+  0x81811CE7,
+  0x80801CE2,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90BF11A0,
+  0x87871D59,
+  0x86861D53,
+  0x858511A0,
+  0x84841D4D,
+  0x83831D47,
+  0x82821D40,
+  0x81811C1D,
+  0x80801D39,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8BF11A0,
+  0x80B611A0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BF11A0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFAF1DED,
+  0xADAD1DE6,
+  0xACAC1DDC,
+  0xABAB1DD3,
+  0xAAAA1DCB,
+  0xA9A91DC1,
+  0xA8A81DBC,
+  0xA7A71DB5,
+  0xA6A61DB0,
+  0xA5A51DAA,
+  0xA4A41DA4,
+  0xA3A31D9C,
+  0xA2A21D97,
+  0xA1A11C41,
+  0xA0A01D8F,
+  0x9F9F1D86,
+  0x9E9E1D80,
+  0x9C9C1D7A,
+  0x9B9B1C9F,
+  0x9A9A1D74,
+  0x99991D6E,
+  0x98981D68,
+  0x93931D63,
+  0x92921D5E,
+  0x80BF11A0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9F9F1DF9,
+  0x9E9E1DF3,
+  0x809D11A0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF1E5F,
+  0xBEBE1E5A,
+  0xBDBD1E54,
+  0xBCBC1E4D,
+  0xBBBB1E48,
+  0xB9B91E41,
+  0xB8B81E3C,
+  0xB7B71E36,
+  0xB6B61E30,
+  0xB5B51E2B,
+  0xB4B41E26,
+  0xAFAF1E21,
+  0xAEAE1E1C,
+  0xADAD1E15,
+  0xACAC1E0A,
+  0xABAB1E05,
+  0xA9A91DFF,
+  0xA4BA11A0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1B11F48,
+  0xAFAF1F42,
+  0xAEAE1F3C,
+  0xACAC1F36,
+  0xABAB1F2F,
+  0xAAAA1F29,
+  0xA0B01289,
+  0x9F9F1F24,
+  0x9E9E1F15,
+  0x9D9D1F04,
+  0x9B9B1EF9,
+  0x9A9A1EF4,
+  0x98981EEC,
+  0x97971289,
+  0x96961EDB,
+  0x94941ED5,
+  0x93931ECF,
+  0x92921EC5,
+  0x91911E95,
+  0x90901E67,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xF0F02084,
+  0xEFEF206E,
+  0xEDED2067,
+  0xEAEA204A,
+  0xE5EC2045,
+  0xE4E4203F,
+  0xE3E32032,
+  0xE2E22021,
+  0xE1E11FF0,
+  0xE0E01FCD,
+  0xDFDF1FC6,
+  0xDEDE1FC0,
+  0xDDDD1FBB,
+  0xDCDC1FB5,
+  0xDBDB1FAC,
+  0xD9D91FA4,
+  0xD8D81F9F,
+  0xD7D71F99,
+  0xD6D61F94,
+  0xD5D51F8D,
+  0xD4D41F87,
+  0xD2D21F81,
+  0xD0DA1F5C,
+  0xCFCF1F7B,
+  0xCECE1F72,
+  0xCDCD1F6A,
+  0xCBCB1F61,
+  0xC4CA1F5C,
+  0xC3C31F55,
+  0xC2C21F4E,
+  0x617A146A,
+  0x5F5F146A,
+  0x5D5D09AA,
+  0x5B5B09AA,
+  0x415A146A,
+  0x3E3E09AA,
+  0x3C3C09AA,
+  0x3039146A,
+  0x2E2E09AA,
+  0x2C2C09AA,
+  0x202012E0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x090912E0,
+  0x0008130E,
+  0x08001190,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x7575209C,
+  0x617A008E,
+  0x5F5F008E,
+  0x5D5D008E,
+  0x415B008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3039008E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x6F6F20C9,
+  0x617A008E,
+  0x5F5F008E,
+  0x5D5D008E,
+  0x415B008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3039008E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x6C6C1163,
+  0x617A008E,
+  0x5F5F008E,
+  0x5D5D008E,
+  0x415B008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3039008E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF4F42146,
+  0xF1F32140,
+  0xF0F0213A,
+  0xEDED2134,
+  0xE1EF212E,
+  0xE0E02128,
+  0xC2DF2122,
+  0x80FF0225,
+  0x292920F6,
+  0x2020214C,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x0909214C,
+  0x00081399,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x74742162,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x5D5D008E,
+  0x5B5B008E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x30390D6E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x28281399,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x77770BD4,
+  0x74740BA5,
+  0x73730B76,
+  0x72720B47,
+  0x69690B18,
+  0x66660AE9,
+  0x65650ABA,
+  0x63630A8B,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x5D5D008E,
+  0x5B5B008E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x30390D6E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x28281399,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x73732191,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x5D5D008E,
+  0x5B5B008E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x30390D6E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x28281399,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x7272146A,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x5D5D008E,
+  0x5B5B008E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x30390D6E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x28281399,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0x08001190,
+  0xF0F02084,
+  0xEFEF206E,
+  0xEDED2067,
+  0xEAEA204A,
+  0xE5EC2045,
+  0xE4E4203F,
+  0xE3E32032,
+  0xE2E22021,
+  0xE1E11FF0,
+  0xE0E01FCD,
+  0xDFDF1FC6,
+  0xDEDE1FC0,
+  0xDDDD1FBB,
+  0xDCDC1FB5,
+  0xDBDB1FAC,
+  0xD9D91FA4,
+  0xD8D81F9F,
+  0xD7D71F99,
+  0xD6D61F94,
+  0xD5D51F8D,
+  0xD4D41F87,
+  0xD2D21F81,
+  0xD0DA1F5C,
+  0xCFCF1F7B,
+  0xCECE1F72,
+  0xCDCD1F6A,
+  0xCBCB1F61,
+  0xC4CA1F5C,
+  0xC3C31F55,
+  0xC2C21F4E,
+  0x617A146A,
+  0x5F5F146A,
+  0x5D5D09AA,
+  0x5B5B09AA,
+  0x415A146A,
+  0x3E3E09AA,
+  0x3C3C09AA,
+  0x3039146A,
+  0x2E2E09AA,
+  0x2C2C09AA,
+  0x282821C0,
+  0x2020146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0909146A,
+  0x0008130E,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x747421CD,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x5D5D008E,
+  0x5B5B008E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x30390D6E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x28281399,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x696913A7,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x5D5D008E,
+  0x5B5B008E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x30390D6E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x28281399,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x727221FC,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x5D5D008E,
+  0x5B5B008E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x30390D6E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x28281399,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x6969222B,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x5D5D008E,
+  0x5B5B008E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x30390D6E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x28281399,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xA8A80D6E,
+  0xA4A40D6E,
+  0x9A9A0D6E,
+  0x80950D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0xA0AA0D6E,
+  0x80980D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF0D6E,
+  0x898E0D6E,
+  0x80870D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80890D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBD0D6E,
+  0x84B90D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1BF0D6E,
+  0xA6AF0D6E,
+  0x98A10D6E,
+  0x90900D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBD0D6E,
+  0xB6B90D6E,
+  0xB2B20D6E,
+  0xAAB00D6E,
+  0x93A80D6E,
+  0x8F900D6E,
+  0x858C0D6E,
+  0x80800D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBC0D6E,
+  0xA6B10D6E,
+  0x9FA10D6E,
+  0x9C9D0D6E,
+  0x8E8E0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8B90D6E,
+  0xB5B60D6E,
+  0xB2B30D6E,
+  0xAAB00D6E,
+  0x93A80D6E,
+  0x8F900D6E,
+  0x858A0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2B40D6E,
+  0xA6AF0D6E,
+  0x9E9E0D6E,
+  0x999C0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBD0D6E,
+  0xB5B90D6E,
+  0xB2B30D6E,
+  0xAAB00D6E,
+  0x93A80D6E,
+  0x8F910D6E,
+  0x858D0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB9B90D6E,
+  0xA6AF0D6E,
+  0xA0A10D6E,
+  0x90900D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBD0D6E,
+  0xB5B90D6E,
+  0xB2B30D6E,
+  0xAAB00D6E,
+  0x93A80D6E,
+  0x8F900D6E,
+  0x858C0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1B10D6E,
+  0xA6AF0D6E,
+  0x9FA10D6E,
+  0x9C9D0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAEB90D6E,
+  0xA8AA0D6E,
+  0xA3A40D6E,
+  0x9E9F0D6E,
+  0x9C9C0D6E,
+  0x999A0D6E,
+  0x92950D6E,
+  0x8E900D6E,
+  0x858A0D6E,
+  0x83830D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA6AF0D6E,
+  0x90900D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBD0D6E,
+  0xAAB90D6E,
+  0x92A80D6E,
+  0x8E900D6E,
+  0x858C0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA6AF0D6E,
+  0xA0A10D6E,
+  0x9D9D0D6E,
+  0x989A0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBD0D6E,
+  0xB5B90D6E,
+  0xAAB30D6E,
+  0x92A80D6E,
+  0x8E900D6E,
+  0x858C0D6E,
+  0x80800D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1B20D6E,
+  0xA6AF0D6E,
+  0xA0A10D6E,
+  0x9D9E0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBD0D6E,
+  0x92BA0D6E,
+  0x8E900D6E,
+  0x848C0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABF0D6E,
+  0xA6AF0D6E,
+  0x9FA10D6E,
+  0x94960D6E,
+  0x8E8E0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBD0D6E,
+  0xB3BB0D6E,
+  0x9AB10D6E,
+  0x85960D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA6AF0D6E,
+  0x80860D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2B30D6E,
+  0x81B00D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90990D6E,
+  0x80860D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBD0D6E,
+  0xB2B30D6E,
+  0xA7B00D6E,
+  0xA5A50D6E,
+  0x8CA30D6E,
+  0x868A0D6E,
+  0x84840D6E,
+  0x81820D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9C9F0D6E,
+  0x90990D6E,
+  0x86860D6E,
+  0x80840D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0A90D6E,
+  0x80800D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x89AC0D6E,
+  0x80870D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x888C0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF0D6E,
+  0x80AA0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB5BF0D6E,
+  0xAEB00D6E,
+  0xA5A60D6E,
+  0xA1A10D6E,
+  0x9A9D0D6E,
+  0x90950D6E,
+  0x80890D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF0D6E,
+  0x90990D6E,
+  0x8E8E0D6E,
+  0x80810D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBF0D6E,
+  0x90BA0D6E,
+  0x8D8D0D6E,
+  0x87870D6E,
+  0x80850D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF0D6E,
+  0x9A9D0D6E,
+  0x98980D6E,
+  0x90960D6E,
+  0x8A8D0D6E,
+  0x80880D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8BE0D6E,
+  0xB2B50D6E,
+  0x90B00D6E,
+  0x8A8D0D6E,
+  0x80880D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x98BF0D6E,
+  0x88960D6E,
+  0x82850D6E,
+  0x80800D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x98BF0D6E,
+  0x92950D6E,
+  0x80900D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x809A0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF0D6E,
+  0x808F0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8BD0D6E,
+  0x80B50D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x81BF0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFBF0D6E,
+  0x80AC0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF0D6E,
+  0x819A0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1B80D6E,
+  0x80AA0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9FB10D6E,
+  0x80910D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAEB00D6E,
+  0xA0AC0D6E,
+  0x80910D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80B30D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0A90D6E,
+  0x9C9C0D6E,
+  0x97970D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF0D6E,
+  0x90990D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80B80D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0xAAAA0D6E,
+  0x87A80D6E,
+  0x80840D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80B50D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x809E0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B40D6E,
+  0x86AD0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0x80AB0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90990D6E,
+  0x80890D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF0D6E,
+  0x80960D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80940D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA7A70D6E,
+  0x90990D6E,
+  0x80890D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x85B30D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90990D6E,
+  0x858C0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAEBF0D6E,
+  0x83A00D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80A50D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80A30D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8DBD0D6E,
+  0x80890D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBF0D6E,
+  0x90BA0D6E,
+  0x80880D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABA0D6E,
+  0xB5B60D6E,
+  0xAEB30D6E,
+  0xA9AC0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF0D6E,
+  0x989D0D6E,
+  0x80950D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9FBD0D6E,
+  0x9D9D0D6E,
+  0x9B9B0D6E,
+  0x99990D6E,
+  0x90970D6E,
+  0x888D0D6E,
+  0x80850D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBE0D6E,
+  0xB6BC0D6E,
+  0x80B40D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB6BC0D6E,
+  0xB2B40D6E,
+  0xA0AC0D6E,
+  0x969B0D6E,
+  0x90930D6E,
+  0x868C0D6E,
+  0x82840D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF0D6E,
+  0xB1B10D6E,
+  0x94940D6E,
+  0x80800D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x909C0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBF0D6E,
+  0xAFB90D6E,
+  0xAAAD0D6E,
+  0xA8A80D6E,
+  0xA6A60D6E,
+  0xA4A40D6E,
+  0x999D0D6E,
+  0x95950D6E,
+  0x8A930D6E,
+  0x87870D6E,
+  0x82820D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8E8E0D6E,
+  0x85890D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x83840D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2B30D6E,
+  0xABAE0D6E,
+  0x80A40D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0xADAD0D6E,
+  0xA7A70D6E,
+  0x80A50D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFAF0D6E,
+  0x80A70D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8BE0D6E,
+  0xB0B60D6E,
+  0xA8AE0D6E,
+  0xA0A60D6E,
+  0x80960D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x989E0D6E,
+  0x90960D6E,
+  0x888E0D6E,
+  0x80860D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFAF0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBC0D6E,
+  0xB1B50D6E,
+  0x85860D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA1BF0D6E,
+  0x9D9F0D6E,
+  0x80960D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBF0D6E,
+  0x80BA0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1BF0D6E,
+  0x85AF0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF0D6E,
+  0x808E0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x808C0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90BD0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90AB0D6E,
+  0x808C0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF0D6E,
+  0x80AE0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF0D6E,
+  0x809D0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA2BF0D6E,
+  0x979F0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8BBF0D6E,
+  0x80880D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2BF0D6E,
+  0x95990D6E,
+  0x93930D6E,
+  0x90910D6E,
+  0x808A0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8CA20D6E,
+  0x878A0D6E,
+  0x83850D6E,
+  0x80810D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x82B30D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBE0D6E,
+  0xBBBB0D6E,
+  0xB2B70D6E,
+  0x90990D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0x80A50D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BC0D6E,
+  0x80860D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x84B20D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA6BE0D6E,
+  0xA0A40D6E,
+  0x8F990D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80A80D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF0D6E,
+  0xBABA0D6E,
+  0xA0B60D6E,
+  0x90990D6E,
+  0x848B0D6E,
+  0x80820D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB9BD0D6E,
+  0xB5B60D6E,
+  0xB1B10D6E,
+  0x80AF0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2B40D6E,
+  0xA0AA0D6E,
+  0x9B9D0D6E,
+  0x82820D6E,
+  0x80800D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0xA8AE0D6E,
+  0xA0A60D6E,
+  0x91960D6E,
+  0x898E0D6E,
+  0x81860D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0x9CA90D6E,
+  0x809A0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B90D6E,
+  0x80A20D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0x80A30D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8BBB0D6E,
+  0x80860D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0x80AD0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80990D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBE0D6E,
+  0xB8BC0D6E,
+  0xAAB60D6E,
+  0x9FA80D6E,
+  0x9D9D0D6E,
+  0x93970D6E,
+  0x80860D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x86BF0D6E,
+  0x83840D6E,
+  0x80810D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80B10D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x93BF0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BD0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90BF0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x92BF0D6E,
+  0x808F0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BB0D6E,
+  0x80870D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB3B40D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB6BF0D6E,
+  0xB0B40D6E,
+  0x8D8F0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BC0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF0D6E,
+  0xA1BA0D6E,
+  0x90990D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA6BF0D6E,
+  0x819A0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BE0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9A9C0D6E,
+  0x92970D6E,
+  0x8A8F0D6E,
+  0x82870D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF234D,
+  0xBEBE2346,
+  0xBDBD233F,
+  0xBCBC2337,
+  0xBABA2330,
+  0xB4B42329,
+  0xB2B32323,
+  0xB1B10C53,
+  0xB0B00C13,
+  0xAEAE231D,
+  0xADAD2316,
+  0xACAC1721,
+  0xABAB230F,
+  0xAAAA2309,
+  0xA9A92303,
+  0xA8A822FA,
+  0xA6A622F3,
+  0xA4A422EC,
+  0xA3A322E5,
+  0xA2A21727,
+  0xA1A122DE,
+  0xA0A022D3,
+  0x9E9E22CB,
+  0x9D9D22C4,
+  0x9C9C22BE,
+  0x989B0C13,
+  0x969622B2,
+  0x959522AA,
+  0x949422A3,
+  0x9393229C,
+  0x92922294,
+  0x90910C13,
+  0x8F8F228D,
+  0x8E8E185F,
+  0x8D8D2285,
+  0x8C8C227E,
+  0x8B8B2278,
+  0x8A8A2271,
+  0x8383226B,
+  0x82820C13,
+  0x81812264,
+  0x8080225A,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBE246A,
+  0xBBBB2464,
+  0xB6B6245C,
+  0xB5B52452,
+  0xB4B4244A,
+  0xB2B22444,
+  0xB1B1243C,
+  0xB0B02435,
+  0xABAB1712,
+  0xAAAA242D,
+  0xA9A92426,
+  0xA8A8241E,
+  0xA7A72416,
+  0xA6A6240F,
+  0xA5A52408,
+  0xA4A423FD,
+  0xA3A323F6,
+  0xA2A20C60,
+  0xA0A023F0,
+  0x9D9D23EA,
+  0x9C9C23E3,
+  0x9B9B156E,
+  0x9A9A23DC,
+  0x999923D5,
+  0x989823BB,
+  0x979723CF,
+  0x969623C9,
+  0x939323C1,
+  0x929223BB,
+  0x919123B3,
+  0x909023AD,
+  0x8D8D23A6,
+  0x8C8C15C5,
+  0x8B8B239F,
+  0x8A8A2394,
+  0x8888238D,
+  0x87872385,
+  0x8686237F,
+  0x85852376,
+  0x8484236F,
+  0x83832368,
+  0x82822362,
+  0x8181235A,
+  0x80802354,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF2476,
+  0xBEBE1931,
+  0x95952470,
+  0x92940C13,
+  0x8E8E1905,
+  0x808D0C13,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x909023C9,
+  0x808F0C13,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x999923EA,
+  0x90980C13,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF24A1,
+  0xBEBE249B,
+  0xBDBD2494,
+  0xBCBC0C13,
+  0xB9B90C13,
+  0xAEAE2444,
+  0xADAD248B,
+  0xACAC23BB,
+  0xABAB2484,
+  0xAAAA1968,
+  0xA9A9247C,
+  0xA8A81712,
+  0xA0A70C13,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB4B40C53,
+  0xB3B324AE,
+  0x9F9F24A8,
+  0x80B20C13,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF24B4,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2B224D7,
+  0xB1B124D0,
+  0xB0B00C13,
+  0x8B8B24CA,
+  0x858524C2,
+  0x848424BC,
+  0x808A0C13,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBC1727,
+  0x9F9F2535,
+  0x9E9E252D,
+  0x9D9D2525,
+  0x9C9C251D,
+  0x9B9B2514,
+  0x9A9A250D,
+  0x95952504,
+  0x949424F9,
+  0x939324F2,
+  0x929224E5,
+  0x919124DE,
+  0x90990C13,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABA2595,
+  0xB9B9257D,
+  0xB8B8256F,
+  0xA5A52567,
+  0xA3A32561,
+  0xA0A40C13,
+  0x9F9F2558,
+  0x8B8B2551,
+  0x8A8A254B,
+  0x85852544,
+  0x8484253D,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFAF259F,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9B9B25A5,
+  0x80BF0C13,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0A0185F,
+  0x9C9C1712,
+  0x80BF0C13,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABA25AB,
+  0x80BF0C13,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFAF25B2,
+  0x80AE0C13,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA8A825B8,
+  0xA0A70C13,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8D8D25BE,
+  0x808C0C13,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x747425C4,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x737325CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x7272130E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x747425D0,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x69691A70,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x727225D6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x696925DC,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x686809AA,
+  0x617A008E,
+  0x5F5F008E,
+  0x5D5D008E,
+  0x415B008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3039008E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xFD000000,
+  0x00FFFFFF,
+  0x08001190,
+  0xA8A809AA,
+  0xA4A409AA,
+  0x9A9A09AA,
+  0x809509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0xA0AA09AA,
+  0x809809AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF09AA,
+  0x898E09AA,
+  0x808709AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x808909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBD09AA,
+  0x84B909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1BF09AA,
+  0xA6AF09AA,
+  0x98A109AA,
+  0x909009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBD09AA,
+  0xB6B909AA,
+  0xB2B209AA,
+  0xAAB009AA,
+  0x93A809AA,
+  0x8F9009AA,
+  0x858C09AA,
+  0x808009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBC09AA,
+  0xA6B109AA,
+  0x9FA109AA,
+  0x9C9D09AA,
+  0x8E8E09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8B909AA,
+  0xB5B609AA,
+  0xB2B309AA,
+  0xAAB009AA,
+  0x93A809AA,
+  0x8F9009AA,
+  0x858A09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2B409AA,
+  0xA6AF09AA,
+  0x9E9E09AA,
+  0x999C09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBD09AA,
+  0xB5B909AA,
+  0xB2B309AA,
+  0xAAB009AA,
+  0x93A809AA,
+  0x8F9109AA,
+  0x858D09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB9B909AA,
+  0xA6AF09AA,
+  0xA0A109AA,
+  0x909009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBD09AA,
+  0xB5B909AA,
+  0xB2B309AA,
+  0xAAB009AA,
+  0x93A809AA,
+  0x8F9009AA,
+  0x858C09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1B109AA,
+  0xA6AF09AA,
+  0x9FA109AA,
+  0x9C9D09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAEB909AA,
+  0xA8AA09AA,
+  0xA3A409AA,
+  0x9E9F09AA,
+  0x9C9C09AA,
+  0x999A09AA,
+  0x929509AA,
+  0x8E9009AA,
+  0x858A09AA,
+  0x838309AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA6AF09AA,
+  0x909009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBD09AA,
+  0xAAB909AA,
+  0x92A809AA,
+  0x8E9009AA,
+  0x858C09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA6AF09AA,
+  0xA0A109AA,
+  0x9D9D09AA,
+  0x989A09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBD09AA,
+  0xB5B909AA,
+  0xAAB309AA,
+  0x92A809AA,
+  0x8E9009AA,
+  0x858C09AA,
+  0x808009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1B209AA,
+  0xA6AF09AA,
+  0xA0A109AA,
+  0x9D9E09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBD09AA,
+  0x92BA09AA,
+  0x8E9009AA,
+  0x848C09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABF09AA,
+  0xA6AF09AA,
+  0x9FA109AA,
+  0x949609AA,
+  0x8E8E09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBD09AA,
+  0xB3BB09AA,
+  0x9AB109AA,
+  0x859609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA6AF09AA,
+  0x808609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2B309AA,
+  0x81B009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x909909AA,
+  0x808609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBD09AA,
+  0xB2B309AA,
+  0xA7B009AA,
+  0xA5A509AA,
+  0x8CA309AA,
+  0x868A09AA,
+  0x848409AA,
+  0x818209AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9C9F09AA,
+  0x909909AA,
+  0x868609AA,
+  0x808409AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0A909AA,
+  0x808009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x89AC09AA,
+  0x808709AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x888C09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF09AA,
+  0x80AA09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB5BF09AA,
+  0xAEB009AA,
+  0xA5A609AA,
+  0xA1A109AA,
+  0x9A9D09AA,
+  0x909509AA,
+  0x808909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF09AA,
+  0x909909AA,
+  0x8E8E09AA,
+  0x808109AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBF09AA,
+  0x90BA09AA,
+  0x8D8D09AA,
+  0x878709AA,
+  0x808509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF09AA,
+  0x9A9D09AA,
+  0x989809AA,
+  0x909609AA,
+  0x8A8D09AA,
+  0x808809AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8BE09AA,
+  0xB2B509AA,
+  0x90B009AA,
+  0x8A8D09AA,
+  0x808809AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x98BF09AA,
+  0x889609AA,
+  0x828509AA,
+  0x808009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x98BF09AA,
+  0x929509AA,
+  0x809009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x809A09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF09AA,
+  0x808F09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8BD09AA,
+  0x80B509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x81BF09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFBF09AA,
+  0x80AC09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF09AA,
+  0x819A09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1B809AA,
+  0x80AA09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9FB109AA,
+  0x809109AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAEB009AA,
+  0xA0AC09AA,
+  0x809109AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80B309AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0A909AA,
+  0x9C9C09AA,
+  0x979709AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF09AA,
+  0x909909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80B809AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0xAAAA09AA,
+  0x87A809AA,
+  0x808409AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80B509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x809E09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B409AA,
+  0x86AD09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0x80AB09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x909909AA,
+  0x808909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF09AA,
+  0x809609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x809409AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA7A709AA,
+  0x909909AA,
+  0x808909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x85B309AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x909909AA,
+  0x858C09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAEBF09AA,
+  0x83A009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80A509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80A309AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8DBD09AA,
+  0x808909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBF09AA,
+  0x90BA09AA,
+  0x808809AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABA09AA,
+  0xB5B609AA,
+  0xAEB309AA,
+  0xA9AC09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF09AA,
+  0x989D09AA,
+  0x809509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9FBD09AA,
+  0x9D9D09AA,
+  0x9B9B09AA,
+  0x999909AA,
+  0x909709AA,
+  0x888D09AA,
+  0x808509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBE09AA,
+  0xB6BC09AA,
+  0x80B409AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB6BC09AA,
+  0xB2B409AA,
+  0xA0AC09AA,
+  0x969B09AA,
+  0x909309AA,
+  0x868C09AA,
+  0x828409AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF09AA,
+  0xB1B109AA,
+  0x949409AA,
+  0x808009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x909C09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBF09AA,
+  0xAFB909AA,
+  0xAAAD09AA,
+  0xA8A809AA,
+  0xA6A609AA,
+  0xA4A409AA,
+  0x999D09AA,
+  0x959509AA,
+  0x8A9309AA,
+  0x878709AA,
+  0x828209AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8E8E09AA,
+  0x858909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x838409AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2B309AA,
+  0xABAE09AA,
+  0x80A409AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0xADAD09AA,
+  0xA7A709AA,
+  0x80A509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFAF09AA,
+  0x80A709AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8BE09AA,
+  0xB0B609AA,
+  0xA8AE09AA,
+  0xA0A609AA,
+  0x809609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x989E09AA,
+  0x909609AA,
+  0x888E09AA,
+  0x808609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFAF09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBC09AA,
+  0xB1B509AA,
+  0x858609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA1BF09AA,
+  0x9D9F09AA,
+  0x809609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBF09AA,
+  0x80BA09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1BF09AA,
+  0x85AF09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF09AA,
+  0x808E09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x808C09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90BD09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90AB09AA,
+  0x808C09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF09AA,
+  0x80AE09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF09AA,
+  0x809D09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA2BF09AA,
+  0x979F09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8BBF09AA,
+  0x808809AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2BF09AA,
+  0x959909AA,
+  0x939309AA,
+  0x909109AA,
+  0x808A09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8CA209AA,
+  0x878A09AA,
+  0x838509AA,
+  0x808109AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x82B309AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBE09AA,
+  0xBBBB09AA,
+  0xB2B709AA,
+  0x909909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0x80A509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BC09AA,
+  0x808609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x84B209AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA6BE09AA,
+  0xA0A409AA,
+  0x8F9909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80A809AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF09AA,
+  0xBABA09AA,
+  0xA0B609AA,
+  0x909909AA,
+  0x848B09AA,
+  0x808209AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB9BD09AA,
+  0xB5B609AA,
+  0xB1B109AA,
+  0x80AF09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2B409AA,
+  0xA0AA09AA,
+  0x9B9D09AA,
+  0x828209AA,
+  0x808009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0xA8AE09AA,
+  0xA0A609AA,
+  0x919609AA,
+  0x898E09AA,
+  0x818609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0x9CA909AA,
+  0x809A09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B909AA,
+  0x80A209AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0x80A309AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8BBB09AA,
+  0x808609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0x80AD09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x809909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBE09AA,
+  0xB8BC09AA,
+  0xAAB609AA,
+  0x9FA809AA,
+  0x9D9D09AA,
+  0x939709AA,
+  0x808609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x86BF09AA,
+  0x838409AA,
+  0x808109AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80B109AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x93BF09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BD09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90BF09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x92BF09AA,
+  0x808F09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BB09AA,
+  0x808709AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB3B409AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB6BF09AA,
+  0xB0B409AA,
+  0x8D8F09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BC09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF09AA,
+  0xA1BA09AA,
+  0x909909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA6BF09AA,
+  0x819A09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BE09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9A9C09AA,
+  0x929709AA,
+  0x8A8F09AA,
+  0x828709AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF26B4,
+  0xBEBE26AE,
+  0xBDBD26A8,
+  0xBCBC26A1,
+  0xBABA269B,
+  0xB4B42695,
+  0xB2B32690,
+  0xB1B111D8,
+  0xB0B011A0,
+  0xAEAE268B,
+  0xADAD2685,
+  0xACAC1C60,
+  0xABAB267F,
+  0xAAAA267A,
+  0xA9A92675,
+  0xA8A8266D,
+  0xA6A62667,
+  0xA4A42661,
+  0xA3A3265B,
+  0xA2A21C65,
+  0xA1A12655,
+  0xA0A0264B,
+  0x9E9E2644,
+  0x9D9D263E,
+  0x9C9C2639,
+  0x989B11A0,
+  0x9696262E,
+  0x95952627,
+  0x94942621,
+  0x9393261B,
+  0x92922614,
+  0x909111A0,
+  0x8F8F260E,
+  0x8E8E1D74,
+  0x8D8D2607,
+  0x8C8C2601,
+  0x8B8B25FC,
+  0x8A8A25F6,
+  0x838325F1,
+  0x828211A0,
+  0x818125EB,
+  0x808025E2,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBE27AA,
+  0xBBBB27A5,
+  0xB6B6279E,
+  0xB5B52795,
+  0xB4B4278E,
+  0xB2B22789,
+  0xB1B12782,
+  0xB0B0277C,
+  0xABAB1C53,
+  0xAAAA2775,
+  0xA9A9276F,
+  0xA8A82768,
+  0xA7A72761,
+  0xA6A6275B,
+  0xA5A52755,
+  0xA4A4274B,
+  0xA3A32745,
+  0xA2A211E3,
+  0xA0A02740,
+  0x9D9D273B,
+  0x9C9C2735,
+  0x9B9B1ADF,
+  0x9A9A272F,
+  0x99992729,
+  0x98982713,
+  0x97972724,
+  0x9696271F,
+  0x93932718,
+  0x92922713,
+  0x9191270C,
+  0x90902707,
+  0x8D8D2701,
+  0x8C8C1B2D,
+  0x8B8B26FB,
+  0x8A8A26F1,
+  0x888826EB,
+  0x878726E4,
+  0x868626DF,
+  0x858526D7,
+  0x848426D1,
+  0x838326CB,
+  0x828226C6,
+  0x818126BF,
+  0x808026BA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF27B4,
+  0xBEBE1E2B,
+  0x959527AF,
+  0x929411A0,
+  0x8E8E1E05,
+  0x808D11A0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9090271F,
+  0x808F11A0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9999273B,
+  0x909811A0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF27D9,
+  0xBEBE27D4,
+  0xBDBD27CE,
+  0xBCBC11A0,
+  0xB9B911A0,
+  0xAEAE2789,
+  0xADAD27C6,
+  0xACAC2713,
+  0xABAB27C0,
+  0xAAAA1E5A,
+  0xA9A927B9,
+  0xA8A81C53,
+  0xA0A711A0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB4B411D8,
+  0xB3B327E4,
+  0x9F9F27DF,
+  0x80B211A0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF27E9,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2B22807,
+  0xB1B12801,
+  0xB0B011A0,
+  0x8B8B27FC,
+  0x858527F5,
+  0x848427F0,
+  0x808A11A0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBC1C65,
+  0x9F9F285A,
+  0x9E9E2853,
+  0x9D9D284C,
+  0x9C9C2845,
+  0x9B9B283D,
+  0x9A9A2837,
+  0x9595282F,
+  0x94942825,
+  0x9393281F,
+  0x92922813,
+  0x9191280D,
+  0x909911A0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABA28B0,
+  0xB9B92899,
+  0xB8B8288C,
+  0xA5A52885,
+  0xA3A32880,
+  0xA0A411A0,
+  0x9F9F2878,
+  0x8B8B2872,
+  0x8A8A286D,
+  0x85852867,
+  0x84842861,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFAF28B9,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9B9B28BE,
+  0x80BF11A0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0A01D74,
+  0x9C9C1C53,
+  0x80BF11A0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABA28C3,
+  0x80BF11A0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFAF28C9,
+  0x80AE11A0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA8A828CE,
+  0xA0A711A0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8D8D28D3,
+  0x808C11A0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABA146A,
+  0xB5B5146A,
+  0xAAAA146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8BF146A,
+  0x98B6146A,
+  0x8096146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BF146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAEAE146A,
+  0xACAC146A,
+  0xA0A4146A,
+  0x8691146A,
+  0x8081146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF146A,
+  0xBABD146A,
+  0xB6B7146A,
+  0xB0B4146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA3BF146A,
+  0x8EA1146A,
+  0x8C8C146A,
+  0x888A146A,
+  0x8686146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB7BF146A,
+  0x80B5146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8ABF146A,
+  0x8081146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1BF146A,
+  0x80AF146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF146A,
+  0x9999146A,
+  0x8096146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8088146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFB2146A,
+  0x90AA146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1BF146A,
+  0xAEAF146A,
+  0xA0A9146A,
+  0x808A146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF146A,
+  0xAEBC146A,
+  0xA5A6146A,
+  0x9595146A,
+  0x8093146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x92AF146A,
+  0x9090146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8DBF146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1B1146A,
+  0x80A5146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABA146A,
+  0xB4B5146A,
+  0x80AA146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBE29D2,
+  0xBDBD29CC,
+  0xBCBC29C6,
+  0xBBBB29BE,
+  0xBABA29B2,
+  0xB9B929AC,
+  0xB8B829A6,
+  0xB7B729A0,
+  0xB6B62998,
+  0xB5B5298F,
+  0xB4B42987,
+  0xB3B3297F,
+  0xB2B22974,
+  0xB1B1296C,
+  0xB0B02963,
+  0xAFAF295D,
+  0xAEAE294F,
+  0xADAD2947,
+  0xACAC293C,
+  0xABAB2934,
+  0xAAAA2929,
+  0xA9A92921,
+  0xA8A82916,
+  0xA7A7290D,
+  0xA6A62901,
+  0xA5A528F9,
+  0xA4A428F3,
+  0xA3A328EE,
+  0xA2A228E7,
+  0xA1A128E0,
+  0xA0A028D8,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF2AE6,
+  0xBEBE2ADF,
+  0xBDBD2AD4,
+  0xBCBC2ACD,
+  0xB8BB1F5C,
+  0xB4B61F5C,
+  0xB3B32AC5,
+  0xB2B22ABE,
+  0xB1B12AB8,
+  0xB0B02AB3,
+  0xAFAF2AAE,
+  0xAEAE2AA8,
+  0xADAD2AA2,
+  0xACAC2A9D,
+  0xAAAA2A96,
+  0xA9A92A91,
+  0xA8A82A8B,
+  0xA7A72A85,
+  0xA6A62A7F,
+  0xA5A52A79,
+  0xA4A42A74,
+  0xA3A32A6F,
+  0xA2A22A67,
+  0xA1A12A62,
+  0xA0A02A5C,
+  0x9F9F2A55,
+  0x9E9E2A50,
+  0x9D9D2A49,
+  0x9C9C2A43,
+  0x9B9B2A3D,
+  0x9A9A2A37,
+  0x99992A31,
+  0x90902A2C,
+  0x8F8F2A26,
+  0x8E8E2A20,
+  0x8D8D2A1B,
+  0x8C8C2A14,
+  0x8B8B2A0C,
+  0x8A8A2A03,
+  0x898929F9,
+  0x84981F5C,
+  0x838329F0,
+  0x828229E8,
+  0x818129DD,
+  0x808029D7,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8B82B43,
+  0xB7B72B3B,
+  0xB6B62B32,
+  0xB5B52B2C,
+  0xB4B42B24,
+  0xB3B32B1D,
+  0xB0B21F5C,
+  0x86862B18,
+  0x85852B12,
+  0x84842B03,
+  0x82822AFE,
+  0x81812AF6,
+  0x80802AF1,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90BF1F5C,
+  0x87872B68,
+  0x86862B62,
+  0x85851F5C,
+  0x84842B5C,
+  0x83832B56,
+  0x82822B4F,
+  0x81812A2C,
+  0x80802B48,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8BF1F5C,
+  0x80B61F5C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BF1F5C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFAF2BFC,
+  0xADAD2BF5,
+  0xACAC2BEB,
+  0xABAB2BE2,
+  0xAAAA2BDA,
+  0xA9A92BD0,
+  0xA8A82BCB,
+  0xA7A72BC4,
+  0xA6A62BBF,
+  0xA5A52BB9,
+  0xA4A42BB3,
+  0xA3A32BAB,
+  0xA2A22BA6,
+  0xA1A12A50,
+  0xA0A02B9E,
+  0x9F9F2B95,
+  0x9E9E2B8F,
+  0x9C9C2B89,
+  0x9B9B2AAE,
+  0x9A9A2B83,
+  0x99992B7D,
+  0x98982B77,
+  0x93932B72,
+  0x92922B6D,
+  0x80BF1F5C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9F9F2C08,
+  0x9E9E2C02,
+  0x809D1F5C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF2C6E,
+  0xBEBE2C69,
+  0xBDBD2C63,
+  0xBCBC2C5C,
+  0xBBBB2C57,
+  0xB9B92C50,
+  0xB8B82C4B,
+  0xB7B72C45,
+  0xB6B62C3F,
+  0xB5B52C3A,
+  0xB4B42C35,
+  0xAFAF2C30,
+  0xAEAE2C2B,
+  0xADAD2C24,
+  0xACAC2C19,
+  0xABAB2C14,
+  0xA9A92C0E,
+  0xA4BA1F5C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1B12D57,
+  0xAFAF2D51,
+  0xAEAE2D4B,
+  0xACAC2D45,
+  0xABAB2D3E,
+  0xAAAA2D38,
+  0xA0B02045,
+  0x9F9F2D33,
+  0x9E9E2D24,
+  0x9D9D2D13,
+  0x9B9B2D08,
+  0x9A9A2D03,
+  0x98982CFB,
+  0x97972045,
+  0x96962CEA,
+  0x94942CE4,
+  0x93932CDE,
+  0x92922CD4,
+  0x91912CA4,
+  0x90902C76,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x72722D5D,
+  0x617A008E,
+  0x5F5F008E,
+  0x5D5D008E,
+  0x415B008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3039008E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x777709AA,
+  0x617A008E,
+  0x5F5F008E,
+  0x5D5D008E,
+  0x415B008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3039008E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0x08002D90,
+  0xF4F42F5C,
+  0xF1F32F56,
+  0xF0F02F3C,
+  0xEFEF2F25,
+  0xEEEE2F1F,
+  0xEDED2F18,
+  0xEAEA2EFB,
+  0xE4E42EF5,
+  0xE3E32EE8,
+  0xE2E22ED5,
+  0xE1E12EA4,
+  0xE0E02E7F,
+  0xDFDF2E77,
+  0xDEDE2E70,
+  0xDDDD2E6A,
+  0xDCDC2E62,
+  0xDBDB2E59,
+  0xD9D92E51,
+  0xD8D82E4B,
+  0xD7D72E43,
+  0xD6D62E3D,
+  0xD5D52E36,
+  0xD4D42E30,
+  0xD2D22E2A,
+  0xCFCF2E24,
+  0xCECE2E1A,
+  0xCDCD2E11,
+  0xCCCC2E0B,
+  0xCBCB2E01,
+  0xC3C32DFA,
+  0xC2C22DF1,
+  0x80FF0225,
+  0x7B7B2D8A,
+  0x617A0225,
+  0x5F5F0225,
+  0x415A0225,
+  0x3B3B0225,
+  0x30390225,
+  0x20202D92,
+  0x0B7F2DC6,
+  0x0AFFFFFF,
+  0x09092D92,
+  0x00082DC6,
+  0x80BF1399,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF2122,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BF2122,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x809F2122,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90BF212E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BF212E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x808F212E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xF4F42146,
+  0xF1F32140,
+  0xF0F0213A,
+  0xEDED2134,
+  0xE1EF212E,
+  0xE0E02128,
+  0xC2DF2122,
+  0x80FF0225,
+  0x77772FCB,
+  0x74742FBC,
+  0x73732FAD,
+  0x72722F9E,
+  0x69692F8F,
+  0x66662F80,
+  0x65652F71,
+  0x63632F62,
+  0x292920F6,
+  0x2020214C,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x0909214C,
+  0x00081399,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x63632FDA,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x5D5D008E,
+  0x5B5B008E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x30390D6E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x28281399,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x6565146A,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x5D5D008E,
+  0x5B5B008E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x30390D6E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x28281399,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0x08001190,
+  0xF4F43053,
+  0xF1F3304E,
+  0xF0F03049,
+  0xEDED3044,
+  0xE1EF303F,
+  0xE0E0303A,
+  0xC2DF3035,
+  0x80FF130E,
+  0x29293009,
+  0x0B7F21C0,
+  0x0AFFFFFF,
+  0x000921C0,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x75753058,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x5D5D008E,
+  0x5B5B008E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x30390D6E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x28281399,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x6F6F3087,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x5D5D008E,
+  0x5B5B008E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x30390D6E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x28281399,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x6C6C2191,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x5D5D008E,
+  0x5B5B008E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x30390D6E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x28281399,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xBFBF0D6E,
+  0xBCBD0D6E,
+  0xA8BA0D6E,
+  0x8DA60D6E,
+  0x808B0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x909D0D6E,
+  0x808D0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BA0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF0D6E,
+  0x809C0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80900D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xADBF0D6E,
+  0x809F0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90B50D6E,
+  0x82890D6E,
+  0x80800D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x888F0D6E,
+  0x80830D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0xA0A90D6E,
+  0x809D0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x98BB0D6E,
+  0x80930D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0x80A70D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBF0D6E,
+  0xB0BA0D6E,
+  0x80A30D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBC0D6E,
+  0xB3B90D6E,
+  0xA3B10D6E,
+  0x97A10D6E,
+  0x94950D6E,
+  0x8C920D6E,
+  0x808A0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80B60D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0A70D6E,
+  0x80950D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2BA0D6E,
+  0x87B00D6E,
+  0x80850D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF0D6E,
+  0xBCBC0D6E,
+  0xB7B80D6E,
+  0x8AB50D6E,
+  0x88880D6E,
+  0x80850D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0B60D6E,
+  0x80950D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB4B50D6E,
+  0xA0B20D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0B90D6E,
+  0x80950D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF0D6E,
+  0x80B70D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x99B50D6E,
+  0x95970D6E,
+  0x90930D6E,
+  0x80800D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BC0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x809C0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x89A40D6E,
+  0x80870D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0B20D6E,
+  0x80950D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80910D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80B20D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B90D6E,
+  0x80A30D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B10D6E,
+  0x80A90D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0xA7A70D6E,
+  0x809C0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0x80850D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0x80810D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0B60D6E,
+  0x80840D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x83B70D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB5B50D6E,
+  0xB1B20D6E,
+  0xA6AF0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x83AF0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B90D6E,
+  0x90A80D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB6BF0D6E,
+  0x83A60D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB6B60D6E,
+  0x90B20D6E,
+  0x87870D6E,
+  0x84840D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x83B20D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9C9C0D6E,
+  0x909A0D6E,
+  0x81840D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x93AB0D6E,
+  0x80910D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0x9FA80D6E,
+  0x8F9D0D6E,
+  0x8A8D0D6E,
+  0x88880D6E,
+  0x80860D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B90D6E,
+  0x809E0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9DA10D6E,
+  0x90900D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80B40D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9FA10D6E,
+  0x90990D6E,
+  0x878A0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80AF0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90990D6E,
+  0x87870D6E,
+  0x84850D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80AE0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x989B0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90990D6E,
+  0x84840D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8B80D6E,
+  0x80AA0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B90D6E,
+  0x809A0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80860D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80AB0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF0D6E,
+  0x80A90D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF0D6E,
+  0x98AF0D6E,
+  0x95960D6E,
+  0x8C930D6E,
+  0x89890D6E,
+  0x80860D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90990D6E,
+  0x81810D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAABF0D6E,
+  0xA0A70D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA3A30D6E,
+  0xA1A10D6E,
+  0x80900D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABA0D6E,
+  0x8BB20D6E,
+  0x80800D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9CBF0D6E,
+  0x90900D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0x9D9D0D6E,
+  0x80890D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8AAE0D6E,
+  0x80880D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2BF0D6E,
+  0x90990D6E,
+  0x80800D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x808F0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8BB00D6E,
+  0x88890D6E,
+  0x80860D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAABF0D6E,
+  0xA7A80D6E,
+  0xA0A50D6E,
+  0x90990D6E,
+  0x86860D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0A90D6E,
+  0x98980D6E,
+  0x80890D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0B20D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B00D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80830D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80B00D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0xA0A90D6E,
+  0x809E0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90AD0D6E,
+  0x80890D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBF0D6E,
+  0xA3B70D6E,
+  0x90990D6E,
+  0x80830D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90900D6E,
+  0x808A0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x939F0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA3A30D6E,
+  0xA0A10D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80B70D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80950D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBE0D6E,
+  0xB5BB0D6E,
+  0xB0B30D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80A20D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0xA4A70D6E,
+  0x90920D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BB0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BC0D6E,
+  0x80AA0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90990D6E,
+  0x80880D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x96BF0D6E,
+  0x80940D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBF0D6E,
+  0xBBBB0D6E,
+  0xAEB90D6E,
+  0xA9AC0D6E,
+  0xA5A60D6E,
+  0xA2A20D6E,
+  0x9E9F0D6E,
+  0x809C0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x85BF0D6E,
+  0x80830D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBE0D6E,
+  0x9EB90D6E,
+  0x969C0D6E,
+  0x8D940D6E,
+  0x878A0D6E,
+  0x80850D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x92BF0D6E,
+  0x8A900D6E,
+  0x86860D6E,
+  0x80840D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA8BF0D6E,
+  0x80A50D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBF0D6E,
+  0x9CBA0D6E,
+  0x829A0D6E,
+  0x80800D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB6BF0D6E,
+  0x96B40D6E,
+  0x80940D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0x90AE0D6E,
+  0x808E0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAABF0D6E,
+  0x8AA80D6E,
+  0x80880D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8EBF0D6E,
+  0x848B0D6E,
+  0x80820D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB7BD0D6E,
+  0x80AC0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8E8E0D6E,
+  0x80890D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90AD0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B90D6E,
+  0x80AB0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BE0D6E,
+  0xADAE0D6E,
+  0xA8AB0D6E,
+  0xA0A60D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80840D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90990D6E,
+  0x8B8B0D6E,
+  0x80830D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBB0D6E,
+  0xB9B90D6E,
+  0xB4B70D6E,
+  0xA9B20D6E,
+  0xA7A70D6E,
+  0xA4A40D6E,
+  0xA1A20D6E,
+  0x859F0D6E,
+  0x80830D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBE0D6E,
+  0xB9BC0D6E,
+  0xB4B70D6E,
+  0xACB20D6E,
+  0xA7AA0D6E,
+  0xA4A40D6E,
+  0xA1A20D6E,
+  0x9F9F0D6E,
+  0x9D9D0D6E,
+  0x9B9B0D6E,
+  0x99990D6E,
+  0x97970D6E,
+  0x94940D6E,
+  0x91920D6E,
+  0x8D8F0D6E,
+  0x8B8B0D6E,
+  0x89890D6E,
+  0x87870D6E,
+  0x82820D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xABBB0D6E,
+  0xA5A90D6E,
+  0xA1A30D6E,
+  0x8B9B0D6E,
+  0x80890D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B90D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x809F0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF0D6E,
+  0x80A10D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80A00D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x809D0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x808A0D6E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x636330B6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x6565130E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x757530BC,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x6F6F30C2,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x6C6C25CA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x08001190,
+  0xBFBF09AA,
+  0xBCBD09AA,
+  0xA8BA09AA,
+  0x8DA609AA,
+  0x808B09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x909D09AA,
+  0x808D09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BA09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF09AA,
+  0x809C09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x809009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xADBF09AA,
+  0x809F09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90B509AA,
+  0x828909AA,
+  0x808009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x888F09AA,
+  0x808309AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0xA0A909AA,
+  0x809D09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x98BB09AA,
+  0x809309AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0x80A709AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBF09AA,
+  0xB0BA09AA,
+  0x80A309AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBC09AA,
+  0xB3B909AA,
+  0xA3B109AA,
+  0x97A109AA,
+  0x949509AA,
+  0x8C9209AA,
+  0x808A09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80B609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0A709AA,
+  0x809509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2BA09AA,
+  0x87B009AA,
+  0x808509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF09AA,
+  0xBCBC09AA,
+  0xB7B809AA,
+  0x8AB509AA,
+  0x888809AA,
+  0x808509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0B609AA,
+  0x809509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB4B509AA,
+  0xA0B209AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0B909AA,
+  0x809509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF09AA,
+  0x80B709AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x99B509AA,
+  0x959709AA,
+  0x909309AA,
+  0x808009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BC09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x809C09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x89A409AA,
+  0x808709AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0B209AA,
+  0x809509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x809109AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80B209AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B909AA,
+  0x80A309AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B109AA,
+  0x80A909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0xA7A709AA,
+  0x809C09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0x808509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0x808109AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0B609AA,
+  0x808409AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x83B709AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB5B509AA,
+  0xB1B209AA,
+  0xA6AF09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x83AF09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B909AA,
+  0x90A809AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB6BF09AA,
+  0x83A609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB6B609AA,
+  0x90B209AA,
+  0x878709AA,
+  0x848409AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x83B209AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9C9C09AA,
+  0x909A09AA,
+  0x818409AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x93AB09AA,
+  0x809109AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0x9FA809AA,
+  0x8F9D09AA,
+  0x8A8D09AA,
+  0x888809AA,
+  0x808609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B909AA,
+  0x809E09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9DA109AA,
+  0x909009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80B409AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9FA109AA,
+  0x909909AA,
+  0x878A09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80AF09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x909909AA,
+  0x878709AA,
+  0x848509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80AE09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x989B09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x909909AA,
+  0x848409AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8B809AA,
+  0x80AA09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B909AA,
+  0x809A09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x808609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80AB09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF09AA,
+  0x80A909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF09AA,
+  0x98AF09AA,
+  0x959609AA,
+  0x8C9309AA,
+  0x898909AA,
+  0x808609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x909909AA,
+  0x818109AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAABF09AA,
+  0xA0A709AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA3A309AA,
+  0xA1A109AA,
+  0x809009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABA09AA,
+  0x8BB209AA,
+  0x808009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9CBF09AA,
+  0x909009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0x9D9D09AA,
+  0x808909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8AAE09AA,
+  0x808809AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2BF09AA,
+  0x909909AA,
+  0x808009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x808F09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8BB009AA,
+  0x888909AA,
+  0x808609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAABF09AA,
+  0xA7A809AA,
+  0xA0A509AA,
+  0x909909AA,
+  0x868609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0A909AA,
+  0x989809AA,
+  0x808909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0B209AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x808309AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80B009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0xA0A909AA,
+  0x809E09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90AD09AA,
+  0x808909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBF09AA,
+  0xA3B709AA,
+  0x909909AA,
+  0x808309AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x909009AA,
+  0x808A09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x939F09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA3A309AA,
+  0xA0A109AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80B709AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x809509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBE09AA,
+  0xB5BB09AA,
+  0xB0B309AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80A209AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0xA4A709AA,
+  0x909209AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BB09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BC09AA,
+  0x80AA09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x909909AA,
+  0x808809AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x96BF09AA,
+  0x809409AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBF09AA,
+  0xBBBB09AA,
+  0xAEB909AA,
+  0xA9AC09AA,
+  0xA5A609AA,
+  0xA2A209AA,
+  0x9E9F09AA,
+  0x809C09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x85BF09AA,
+  0x808309AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBE09AA,
+  0x9EB909AA,
+  0x969C09AA,
+  0x8D9409AA,
+  0x878A09AA,
+  0x808509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x92BF09AA,
+  0x8A9009AA,
+  0x868609AA,
+  0x808409AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA8BF09AA,
+  0x80A509AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBF09AA,
+  0x9CBA09AA,
+  0x829A09AA,
+  0x808009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB6BF09AA,
+  0x96B409AA,
+  0x809409AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0x90AE09AA,
+  0x808E09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAABF09AA,
+  0x8AA809AA,
+  0x808809AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8EBF09AA,
+  0x848B09AA,
+  0x808209AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB7BD09AA,
+  0x80AC09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8E8E09AA,
+  0x808909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90AD09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B909AA,
+  0x80AB09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BE09AA,
+  0xADAE09AA,
+  0xA8AB09AA,
+  0xA0A609AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x808409AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x909909AA,
+  0x8B8B09AA,
+  0x808309AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBB09AA,
+  0xB9B909AA,
+  0xB4B709AA,
+  0xA9B209AA,
+  0xA7A709AA,
+  0xA4A409AA,
+  0xA1A209AA,
+  0x859F09AA,
+  0x808309AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBE09AA,
+  0xB9BC09AA,
+  0xB4B709AA,
+  0xACB209AA,
+  0xA7AA09AA,
+  0xA4A409AA,
+  0xA1A209AA,
+  0x9F9F09AA,
+  0x9D9D09AA,
+  0x9B9B09AA,
+  0x999909AA,
+  0x979709AA,
+  0x949409AA,
+  0x919209AA,
+  0x8D8F09AA,
+  0x8B8B09AA,
+  0x898909AA,
+  0x878709AA,
+  0x828209AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xABBB09AA,
+  0xA5A909AA,
+  0xA1A309AA,
+  0x8B9B09AA,
+  0x808909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B909AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x809F09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF09AA,
+  0x80A109AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80A009AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x809D09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x808A09AA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA8A8146A,
+  0xA4A4146A,
+  0x9A9A146A,
+  0x8095146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0xA0AA146A,
+  0x8098146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF146A,
+  0x898E146A,
+  0x8087146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8089146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBD146A,
+  0x84B9146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1BF146A,
+  0xA6AF146A,
+  0x98A1146A,
+  0x9090146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBD146A,
+  0xB6B9146A,
+  0xB2B2146A,
+  0xAAB0146A,
+  0x93A8146A,
+  0x8F90146A,
+  0x858C146A,
+  0x8080146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBC146A,
+  0xA6B1146A,
+  0x9FA1146A,
+  0x9C9D146A,
+  0x8E8E146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8B9146A,
+  0xB5B6146A,
+  0xB2B3146A,
+  0xAAB0146A,
+  0x93A8146A,
+  0x8F90146A,
+  0x858A146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2B4146A,
+  0xA6AF146A,
+  0x9E9E146A,
+  0x999C146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBD146A,
+  0xB5B9146A,
+  0xB2B3146A,
+  0xAAB0146A,
+  0x93A8146A,
+  0x8F91146A,
+  0x858D146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB9B9146A,
+  0xA6AF146A,
+  0xA0A1146A,
+  0x9090146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBD146A,
+  0xB5B9146A,
+  0xB2B3146A,
+  0xAAB0146A,
+  0x93A8146A,
+  0x8F90146A,
+  0x858C146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1B1146A,
+  0xA6AF146A,
+  0x9FA1146A,
+  0x9C9D146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAEB9146A,
+  0xA8AA146A,
+  0xA3A4146A,
+  0x9E9F146A,
+  0x9C9C146A,
+  0x999A146A,
+  0x9295146A,
+  0x8E90146A,
+  0x858A146A,
+  0x8383146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA6AF146A,
+  0x9090146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBD146A,
+  0xAAB9146A,
+  0x92A8146A,
+  0x8E90146A,
+  0x858C146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA6AF146A,
+  0xA0A1146A,
+  0x9D9D146A,
+  0x989A146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBD146A,
+  0xB5B9146A,
+  0xAAB3146A,
+  0x92A8146A,
+  0x8E90146A,
+  0x858C146A,
+  0x8080146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1B2146A,
+  0xA6AF146A,
+  0xA0A1146A,
+  0x9D9E146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBD146A,
+  0x92BA146A,
+  0x8E90146A,
+  0x848C146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABF146A,
+  0xA6AF146A,
+  0x9FA1146A,
+  0x9496146A,
+  0x8E8E146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBD146A,
+  0xB3BB146A,
+  0x9AB1146A,
+  0x8596146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA6AF146A,
+  0x8086146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2B3146A,
+  0x81B0146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9099146A,
+  0x8086146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBD146A,
+  0xB2B3146A,
+  0xA7B0146A,
+  0xA5A5146A,
+  0x8CA3146A,
+  0x868A146A,
+  0x8484146A,
+  0x8182146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9C9F146A,
+  0x9099146A,
+  0x8686146A,
+  0x8084146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0A9146A,
+  0x8080146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x89AC146A,
+  0x8087146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x888C146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF146A,
+  0x80AA146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB5BF146A,
+  0xAEB0146A,
+  0xA5A6146A,
+  0xA1A1146A,
+  0x9A9D146A,
+  0x9095146A,
+  0x8089146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF146A,
+  0x9099146A,
+  0x8E8E146A,
+  0x8081146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBF146A,
+  0x90BA146A,
+  0x8D8D146A,
+  0x8787146A,
+  0x8085146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF146A,
+  0x9A9D146A,
+  0x9898146A,
+  0x9096146A,
+  0x8A8D146A,
+  0x8088146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8BE146A,
+  0xB2B5146A,
+  0x90B0146A,
+  0x8A8D146A,
+  0x8088146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x98BF146A,
+  0x8896146A,
+  0x8285146A,
+  0x8080146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x98BF146A,
+  0x9295146A,
+  0x8090146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x809A146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF146A,
+  0x808F146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8BD146A,
+  0x80B5146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x81BF146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFBF146A,
+  0x80AC146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF146A,
+  0x819A146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1B8146A,
+  0x80AA146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9FB1146A,
+  0x8091146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAEB0146A,
+  0xA0AC146A,
+  0x8091146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80B3146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0A9146A,
+  0x9C9C146A,
+  0x9797146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF146A,
+  0x9099146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80B8146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0xAAAA146A,
+  0x87A8146A,
+  0x8084146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80B5146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x809E146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B4146A,
+  0x86AD146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0x80AB146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9099146A,
+  0x8089146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF146A,
+  0x8096146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8094146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA7A7146A,
+  0x9099146A,
+  0x8089146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x85B3146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9099146A,
+  0x858C146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAEBF146A,
+  0x83A0146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80A5146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80A3146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8DBD146A,
+  0x8089146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBF146A,
+  0x90BA146A,
+  0x8088146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABA146A,
+  0xB5B6146A,
+  0xAEB3146A,
+  0xA9AC146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF146A,
+  0x989D146A,
+  0x8095146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9FBD146A,
+  0x9D9D146A,
+  0x9B9B146A,
+  0x9999146A,
+  0x9097146A,
+  0x888D146A,
+  0x8085146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBE146A,
+  0xB6BC146A,
+  0x80B4146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB6BC146A,
+  0xB2B4146A,
+  0xA0AC146A,
+  0x969B146A,
+  0x9093146A,
+  0x868C146A,
+  0x8284146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF146A,
+  0xB1B1146A,
+  0x9494146A,
+  0x8080146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x909C146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBF146A,
+  0xAFB9146A,
+  0xAAAD146A,
+  0xA8A8146A,
+  0xA6A6146A,
+  0xA4A4146A,
+  0x999D146A,
+  0x9595146A,
+  0x8A93146A,
+  0x8787146A,
+  0x8282146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8E8E146A,
+  0x8589146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8384146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2B3146A,
+  0xABAE146A,
+  0x80A4146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0xADAD146A,
+  0xA7A7146A,
+  0x80A5146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFAF146A,
+  0x80A7146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8BE146A,
+  0xB0B6146A,
+  0xA8AE146A,
+  0xA0A6146A,
+  0x8096146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x989E146A,
+  0x9096146A,
+  0x888E146A,
+  0x8086146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFAF146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBC146A,
+  0xB1B5146A,
+  0x8586146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA1BF146A,
+  0x9D9F146A,
+  0x8096146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBF146A,
+  0x80BA146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1BF146A,
+  0x85AF146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF146A,
+  0x808E146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x808C146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90BD146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90AB146A,
+  0x808C146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF146A,
+  0x80AE146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF146A,
+  0x809D146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA2BF146A,
+  0x979F146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8BBF146A,
+  0x8088146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2BF146A,
+  0x9599146A,
+  0x9393146A,
+  0x9091146A,
+  0x808A146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8CA2146A,
+  0x878A146A,
+  0x8385146A,
+  0x8081146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x82B3146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBE146A,
+  0xBBBB146A,
+  0xB2B7146A,
+  0x9099146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0x80A5146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BC146A,
+  0x8086146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x84B2146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA6BE146A,
+  0xA0A4146A,
+  0x8F99146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80A8146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF146A,
+  0xBABA146A,
+  0xA0B6146A,
+  0x9099146A,
+  0x848B146A,
+  0x8082146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB9BD146A,
+  0xB5B6146A,
+  0xB1B1146A,
+  0x80AF146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2B4146A,
+  0xA0AA146A,
+  0x9B9D146A,
+  0x8282146A,
+  0x8080146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0xA8AE146A,
+  0xA0A6146A,
+  0x9196146A,
+  0x898E146A,
+  0x8186146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0x9CA9146A,
+  0x809A146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B9146A,
+  0x80A2146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0x80A3146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8BBB146A,
+  0x8086146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0x80AD146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8099146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBE146A,
+  0xB8BC146A,
+  0xAAB6146A,
+  0x9FA8146A,
+  0x9D9D146A,
+  0x9397146A,
+  0x8086146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x86BF146A,
+  0x8384146A,
+  0x8081146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80B1146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x93BF146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BD146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90BF146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x92BF146A,
+  0x808F146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BB146A,
+  0x8087146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB3B4146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB6BF146A,
+  0xB0B4146A,
+  0x8D8F146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BC146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF146A,
+  0xA1BA146A,
+  0x9099146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA6BF146A,
+  0x819A146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BE146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9A9C146A,
+  0x9297146A,
+  0x8A8F146A,
+  0x8287146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF319A,
+  0xBEBE3194,
+  0xBDBD318E,
+  0xBCBC3187,
+  0xBABA3181,
+  0xB4B4317B,
+  0xB2B33176,
+  0xB1B11F94,
+  0xB0B01F5C,
+  0xAEAE3171,
+  0xADAD316B,
+  0xACAC2A6F,
+  0xABAB3165,
+  0xAAAA3160,
+  0xA9A9315B,
+  0xA8A83153,
+  0xA6A6314D,
+  0xA4A43147,
+  0xA3A33141,
+  0xA2A22A74,
+  0xA1A1313B,
+  0xA0A03131,
+  0x9E9E312A,
+  0x9D9D3124,
+  0x9C9C311F,
+  0x989B1F5C,
+  0x96963114,
+  0x9595310D,
+  0x94943107,
+  0x93933101,
+  0x929230FA,
+  0x90911F5C,
+  0x8F8F30F4,
+  0x8E8E2B83,
+  0x8D8D30ED,
+  0x8C8C30E7,
+  0x8B8B30E2,
+  0x8A8A30DC,
+  0x838330D7,
+  0x82821F5C,
+  0x818130D1,
+  0x808030C8,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBE3290,
+  0xBBBB328B,
+  0xB6B63284,
+  0xB5B5327B,
+  0xB4B43274,
+  0xB2B2326F,
+  0xB1B13268,
+  0xB0B03262,
+  0xABAB2A62,
+  0xAAAA325B,
+  0xA9A93255,
+  0xA8A8324E,
+  0xA7A73247,
+  0xA6A63241,
+  0xA5A5323B,
+  0xA4A43231,
+  0xA3A3322B,
+  0xA2A21F9F,
+  0xA0A03226,
+  0x9D9D3221,
+  0x9C9C321B,
+  0x9B9B28EE,
+  0x9A9A3215,
+  0x9999320F,
+  0x989831F9,
+  0x9797320A,
+  0x96963205,
+  0x939331FE,
+  0x929231F9,
+  0x919131F2,
+  0x909031ED,
+  0x8D8D31E7,
+  0x8C8C293C,
+  0x8B8B31E1,
+  0x8A8A31D7,
+  0x888831D1,
+  0x878731CA,
+  0x868631C5,
+  0x858531BD,
+  0x848431B7,
+  0x838331B1,
+  0x828231AC,
+  0x818131A5,
+  0x808031A0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF329A,
+  0xBEBE2C3A,
+  0x95953295,
+  0x92941F5C,
+  0x8E8E2C14,
+  0x808D1F5C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90903205,
+  0x808F1F5C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x99993221,
+  0x90981F5C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF32BF,
+  0xBEBE32BA,
+  0xBDBD32B4,
+  0xBCBC1F5C,
+  0xB9B91F5C,
+  0xAEAE326F,
+  0xADAD32AC,
+  0xACAC31F9,
+  0xABAB32A6,
+  0xAAAA2C69,
+  0xA9A9329F,
+  0xA8A82A62,
+  0xA0A71F5C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB4B41F94,
+  0xB3B332CA,
+  0x9F9F32C5,
+  0x80B21F5C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF32CF,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2B232ED,
+  0xB1B132E7,
+  0xB0B01F5C,
+  0x8B8B32E2,
+  0x858532DB,
+  0x848432D6,
+  0x808A1F5C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBC2A74,
+  0x9F9F3340,
+  0x9E9E3339,
+  0x9D9D3332,
+  0x9C9C332B,
+  0x9B9B3323,
+  0x9A9A331D,
+  0x95953315,
+  0x9494330B,
+  0x93933305,
+  0x929232F9,
+  0x919132F3,
+  0x90991F5C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABA3396,
+  0xB9B9337F,
+  0xB8B83372,
+  0xA5A5336B,
+  0xA3A33366,
+  0xA0A41F5C,
+  0x9F9F335E,
+  0x8B8B3358,
+  0x8A8A3353,
+  0x8585334D,
+  0x84843347,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFAF339F,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9B9B33A4,
+  0x80BF1F5C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0A02B83,
+  0x9C9C2A62,
+  0x80BF1F5C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABA33A9,
+  0x80BF1F5C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFAF33AF,
+  0x80AE1F5C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA8A833B4,
+  0xA0A71F5C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8D8D33B9,
+  0x808C1F5C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0xF0F0020C,
+  0xEFEF01F5,
+  0xEDED01ED,
+  0xEAEA01CF,
+  0xE5EC01C9,
+  0xE4E401C2,
+  0xE3E301B4,
+  0xE2E201A2,
+  0xE1E10170,
+  0xE0E0014C,
+  0xDFDF0144,
+  0xDEDE013D,
+  0xDDDD0137,
+  0xDCDC0130,
+  0xDBDB0126,
+  0xD9D9011D,
+  0xD8D80117,
+  0xD7D70110,
+  0xD6D6010A,
+  0xD5D50102,
+  0xD4D400FB,
+  0xD2D200F4,
+  0xD0DA00CA,
+  0xCFCF00ED,
+  0xCECE00E3,
+  0xCDCD00DA,
+  0xCBCB00D0,
+  0xC4CA00CA,
+  0xC3C300C2,
+  0xC2C200BA,
+  0x6E6E09AA,
+  0x617A008E,
+  0x5F5F008E,
+  0x5D5D008E,
+  0x415B008E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x3039008E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x202003C6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903C6,
+  0x00080225,
+  0x08002D90,
+  0x202033BE,
+  0x0BFF2D8A,
+  0x0AFFFFFF,
+  0x090933BE,
+  0x00082D8A,
+  0x070033CC,
+  0x00FFFFFF,
+  0x08002D90,
+  0xF4F42F5C,
+  0xF1F32F56,
+  0xF0F02F3C,
+  0xEFEF2F25,
+  0xEEEE2F1F,
+  0xEDED2F18,
+  0xEAEA2EFB,
+  0xE4E42EF5,
+  0xE3E32EE8,
+  0xE2E22ED5,
+  0xE1E12EA4,
+  0xE0E02E7F,
+  0xDFDF2E77,
+  0xDEDE2E70,
+  0xDDDD2E6A,
+  0xDCDC2E62,
+  0xDBDB2E59,
+  0xD9D92E51,
+  0xD8D82E4B,
+  0xD7D72E43,
+  0xD6D62E3D,
+  0xD5D52E36,
+  0xD4D42E30,
+  0xD2D22E2A,
+  0xCFCF2E24,
+  0xCECE2E1A,
+  0xCDCD2E11,
+  0xCCCC2E0B,
+  0xCBCB2E01,
+  0xC3C32DFA,
+  0xC2C22DF1,
+  0x80FF0225,
+  0x7B7B2D8A,
+  0x77770DC6,
+  0x74740DC0,
+  0x73730DBA,
+  0x72720DB4,
+  0x69690DAE,
+  0x66660DA8,
+  0x65650DA2,
+  0x63630D9C,
+  0x617A0225,
+  0x5F5F0225,
+  0x415A0225,
+  0x3B3B0225,
+  0x30390225,
+  0x20202D92,
+  0x0B7F2DC6,
+  0x0AFFFFFF,
+  0x09092D92,
+  0x00082DC6,
+  0x08002D90,
+  0xF4F42F5C,
+  0xF1F32F56,
+  0xF0F02F3C,
+  0xEFEF2F25,
+  0xEEEE2F1F,
+  0xEDED2F18,
+  0xEAEA2EFB,
+  0xE4E42EF5,
+  0xE3E32EE8,
+  0xE2E22ED5,
+  0xE1E12EA4,
+  0xE0E02E7F,
+  0xDFDF2E77,
+  0xDEDE2E70,
+  0xDDDD2E6A,
+  0xDCDC2E62,
+  0xDBDB2E59,
+  0xD9D92E51,
+  0xD8D82E4B,
+  0xD7D72E43,
+  0xD6D62E3D,
+  0xD5D52E36,
+  0xD4D42E30,
+  0xD2D22E2A,
+  0xCFCF2E24,
+  0xCECE2E1A,
+  0xCDCD2E11,
+  0xCCCC2E0B,
+  0xCBCB2E01,
+  0xC3C32DFA,
+  0xC2C22DF1,
+  0x80FF0225,
+  0x617B0225,
+  0x5F5F0225,
+  0x415A0225,
+  0x3B3B0225,
+  0x30390225,
+  0x202033CE,
+  0x0B7F2DC6,
+  0x0AFFFFFF,
+  0x090933CE,
+  0x00082DC6,
+  0xBBBF2DC6,
+  0xB6B92DC6,
+  0xABB42DC6,
+  0x80A92DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB7B72DC6,
+  0x97972DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFBF2DC6,
+  0xADAD2DC6,
+  0xA5AB2DC6,
+  0x929F2DC6,
+  0x82852DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBE2DC6,
+  0xB8B92DC6,
+  0xB5B52DC6,
+  0x80AF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA2A22DC6,
+  0x8D8D2DC6,
+  0x8B8B2DC6,
+  0x87872DC6,
+  0x80852DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB6B62DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x82892DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B02DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9A9F2DC6,
+  0x97982DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x89BF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB3BF2DC6,
+  0xABAE2DC6,
+  0x808F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x809F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B02DC6,
+  0xAAAD2DC6,
+  0x8B9F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBE2DC6,
+  0xA7AD2DC6,
+  0x96A42DC6,
+  0x94942DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF2DC6,
+  0x91912DC6,
+  0x808F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x808C2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2BF2DC6,
+  0xA6B02DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBF2DC6,
+  0xB6B92DC6,
+  0xABB32DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF2E0B,
+  0xBEBE3528,
+  0xBDBD3521,
+  0xBCBC351A,
+  0xBBBB3511,
+  0xBABA3503,
+  0xB9B934FC,
+  0xB8B834F4,
+  0xB7B734ED,
+  0xB6B634E3,
+  0xB5B534D9,
+  0xB4B434CF,
+  0xB3B334C5,
+  0xB2B234B9,
+  0xB1B134AF,
+  0xB0B034A4,
+  0xAFAF349C,
+  0xAEAE348C,
+  0xADAD3482,
+  0xACAC3475,
+  0xABAB346B,
+  0xAAAA345E,
+  0xA9A93454,
+  0xA8A83447,
+  0xA7A7343C,
+  0xA6A6342F,
+  0xA5A53426,
+  0xA4A4341E,
+  0xA3A33418,
+  0xA2A23411,
+  0xA1A1340A,
+  0xA0A03401,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF365E,
+  0xBEBE3656,
+  0xBDBD364A,
+  0xBCBC3643,
+  0xB7B72E0B,
+  0xB3B33639,
+  0xB2B23632,
+  0xB1B1362B,
+  0xB0B03625,
+  0xAFAF361F,
+  0xAEAE3618,
+  0xADAD3610,
+  0xACAC3609,
+  0xABAB2E0B,
+  0xAAAA3601,
+  0xA9A935FB,
+  0xA8A835F5,
+  0xA7A735EE,
+  0xA6A635E8,
+  0xA5A535E0,
+  0xA4A435DA,
+  0xA3A335D4,
+  0xA2A235CC,
+  0xA1A135C6,
+  0xA0A035BF,
+  0x9F9F35B6,
+  0x9E9E35B0,
+  0x9D9D35A8,
+  0x9C9C35A1,
+  0x9B9B359A,
+  0x9A9A3593,
+  0x9999358D,
+  0x90903587,
+  0x8F8F3580,
+  0x8E8E357A,
+  0x8D8D3574,
+  0x8C8C356D,
+  0x8B8B3565,
+  0x8A8A355B,
+  0x89893551,
+  0x83833548,
+  0x82823540,
+  0x81813535,
+  0x8080352F,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB9BF2E0B,
+  0xB8B836C9,
+  0xB7B736C0,
+  0xB6B636B6,
+  0xB5B536AF,
+  0xB4B436A7,
+  0xB3B3369F,
+  0x86863698,
+  0x85853690,
+  0x84843680,
+  0x83AF2E0B,
+  0x82823679,
+  0x81813671,
+  0x8080366B,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x888F2E0B,
+  0x878736F3,
+  0x868636ED,
+  0x848436E6,
+  0x838336E0,
+  0x828236D9,
+  0x81813587,
+  0x808036D0,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB7B72E0B,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFAF379B,
+  0xADAD3794,
+  0xACAC3789,
+  0xABAB377F,
+  0xAAAA3776,
+  0xA9A9376C,
+  0xA8A83766,
+  0xA7A7375D,
+  0xA6A63756,
+  0xA5A5374F,
+  0xA4A43749,
+  0xA3A3373F,
+  0xA2A23738,
+  0xA1A135B0,
+  0xA0A0372F,
+  0x9F9F3726,
+  0x9E9E3720,
+  0x9C9C3719,
+  0x9B9B361F,
+  0x9A9A3713,
+  0x9999370D,
+  0x98983706,
+  0x939336FF,
+  0x929236F9,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9F9F37A8,
+  0x9E9E37A2,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BF2E0B,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF381D,
+  0xBEBE3817,
+  0xBDBD3810,
+  0xBCBC3808,
+  0xBBBB3802,
+  0xB9B937FA,
+  0xB8B837F3,
+  0xB7B737EC,
+  0xB6B637E6,
+  0xB5B537E0,
+  0xB4B437DA,
+  0xAFAF37D4,
+  0xAEAE37CE,
+  0xADAD37C7,
+  0xACAC37BB,
+  0xABAB37B5,
+  0xA9A937AF,
+  0x80A32E0B,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2BF2F1F,
+  0xB1B1391D,
+  0xAFAF3915,
+  0xAEAE390E,
+  0xACAC3908,
+  0xABAB3901,
+  0xAAAA38FB,
+  0x9F9F38F4,
+  0x9E9E38E3,
+  0x9D9D38D0,
+  0x9B9B38C4,
+  0x9A9A38BD,
+  0x999C2F1F,
+  0x989838B4,
+  0x969638A2,
+  0x95952F1F,
+  0x9494389A,
+  0x93933893,
+  0x92923888,
+  0x91913856,
+  0x90903827,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BF2F1F,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x808F2F1F,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xF4F42146,
+  0xF1F32140,
+  0xF0F0213A,
+  0xEDED2134,
+  0xE1EF212E,
+  0xE0E02128,
+  0xC2DF2122,
+  0x80FF0225,
+  0x61613924,
+  0x292920F6,
+  0x2020214C,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x0909214C,
+  0x00081399,
+  0xF4F42146,
+  0xF1F32140,
+  0xF0F0213A,
+  0xEDED2134,
+  0xE1EF212E,
+  0xE0E02128,
+  0xC2DF2122,
+  0x80FF0225,
+  0x6C6C3933,
+  0x292920F6,
+  0x2020214C,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x0909214C,
+  0x00081399,
+  0xF4F42146,
+  0xF1F32140,
+  0xF0F0213A,
+  0xEDED2134,
+  0xE1EF212E,
+  0xE0E02128,
+  0xC2DF2122,
+  0x80FF0225,
+  0x6F6F3942,
+  0x292920F6,
+  0x2020214C,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x0909214C,
+  0x00081399,
+  0xF4F42146,
+  0xF1F32140,
+  0xF0F0213A,
+  0xEDED2134,
+  0xE1EF212E,
+  0xE0E02128,
+  0xC2DF2122,
+  0x80FF0225,
+  0x666621C0,
+  0x292920F6,
+  0x2020214C,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x0909214C,
+  0x00081399,
+  0xF4F42146,
+  0xF1F32140,
+  0xF0F0213A,
+  0xEDED2134,
+  0xE1EF212E,
+  0xE0E02128,
+  0xC2DF2122,
+  0x80FF0225,
+  0x65653951,
+  0x292920F6,
+  0x2020214C,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x0909214C,
+  0x00081399,
+  0xF4F42146,
+  0xF1F32140,
+  0xF0F0213A,
+  0xEDED2134,
+  0xE1EF212E,
+  0xE0E02128,
+  0xC2DF2122,
+  0x80FF0225,
+  0x77773960,
+  0x292920F6,
+  0x2020214C,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x0909214C,
+  0x00081399,
+  0xF4F42146,
+  0xF1F32140,
+  0xF0F0213A,
+  0xEDED2134,
+  0xE1EF212E,
+  0xE0E02128,
+  0xC2DF2122,
+  0x80FF0225,
+  0x6868396F,
+  0x292920F6,
+  0x2020214C,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x0909214C,
+  0x00081399,
+  0xF4F42146,
+  0xF1F32140,
+  0xF0F0213A,
+  0xEDED2134,
+  0xE1EF212E,
+  0xE0E02128,
+  0xC2DF2122,
+  0x80FF0225,
+  0x6868397E,
+  0x292920F6,
+  0x2020214C,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x0909214C,
+  0x00081399,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x6868146A,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x5D5D008E,
+  0x5B5B008E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x30390D6E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x28281399,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0x08003991,
+  0xF4F43B09,
+  0xF1F33B04,
+  0xF0F03AEB,
+  0xEFEF3AD5,
+  0xEEEE3AD0,
+  0xEDED3ACA,
+  0xEAEA3AAE,
+  0xE4E43AA9,
+  0xE3E33A9D,
+  0xE2E23A8B,
+  0xE1E13A5B,
+  0xE0E03A37,
+  0xDFDF3A30,
+  0xDEDE3A2A,
+  0xDDDD3A25,
+  0xDCDC3A1E,
+  0xDBDB3A16,
+  0xD9D93A0F,
+  0xD8D83A0A,
+  0xD7D73A03,
+  0xD6D639FE,
+  0xD5D539F8,
+  0xD4D439F3,
+  0xD2D239EE,
+  0xCFCF39E9,
+  0xCECE39E0,
+  0xCDCD39D8,
+  0xCCCC39D3,
+  0xCBCB39CA,
+  0xC3C339C4,
+  0xC2C239BC,
+  0x80FF130E,
+  0x7B7B398D,
+  0x617A130E,
+  0x5F5F130E,
+  0x415A130E,
+  0x3B3B130E,
+  0x3039130E,
+  0x20203009,
+  0x0B7F3993,
+  0x0AFFFFFF,
+  0x09093009,
+  0x00083993,
+  0x08001190,
+  0x80BF21C0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF3035,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BF3035,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x809F3035,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90BF303F,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BF303F,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x808F303F,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x72723B0E,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x5D5D008E,
+  0x5B5B008E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x30390D6E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x28281399,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x7777146A,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x5D5D008E,
+  0x5B5B008E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x30390D6E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x28281399,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0x6868130E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x72723B3D,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x7777130E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x08001190,
+  0xBFBF146A,
+  0xBCBD146A,
+  0xA8BA146A,
+  0x8DA6146A,
+  0x808B146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x909D146A,
+  0x808D146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BA146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF146A,
+  0x809C146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8090146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xADBF146A,
+  0x809F146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90B5146A,
+  0x8289146A,
+  0x8080146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x888F146A,
+  0x8083146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0xA0A9146A,
+  0x809D146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x98BB146A,
+  0x8093146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0x80A7146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBF146A,
+  0xB0BA146A,
+  0x80A3146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBC146A,
+  0xB3B9146A,
+  0xA3B1146A,
+  0x97A1146A,
+  0x9495146A,
+  0x8C92146A,
+  0x808A146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80B6146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0A7146A,
+  0x8095146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2BA146A,
+  0x87B0146A,
+  0x8085146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF146A,
+  0xBCBC146A,
+  0xB7B8146A,
+  0x8AB5146A,
+  0x8888146A,
+  0x8085146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0B6146A,
+  0x8095146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB4B5146A,
+  0xA0B2146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0B9146A,
+  0x8095146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF146A,
+  0x80B7146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x99B5146A,
+  0x9597146A,
+  0x9093146A,
+  0x8080146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BC146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x809C146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x89A4146A,
+  0x8087146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0B2146A,
+  0x8095146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8091146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80B2146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B9146A,
+  0x80A3146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B1146A,
+  0x80A9146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0xA7A7146A,
+  0x809C146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0x8085146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0x8081146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0B6146A,
+  0x8084146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x83B7146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB5B5146A,
+  0xB1B2146A,
+  0xA6AF146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x83AF146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B9146A,
+  0x90A8146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB6BF146A,
+  0x83A6146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB6B6146A,
+  0x90B2146A,
+  0x8787146A,
+  0x8484146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x83B2146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9C9C146A,
+  0x909A146A,
+  0x8184146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x93AB146A,
+  0x8091146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0x9FA8146A,
+  0x8F9D146A,
+  0x8A8D146A,
+  0x8888146A,
+  0x8086146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B9146A,
+  0x809E146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9DA1146A,
+  0x9090146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80B4146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9FA1146A,
+  0x9099146A,
+  0x878A146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80AF146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9099146A,
+  0x8787146A,
+  0x8485146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80AE146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x989B146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9099146A,
+  0x8484146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8B8146A,
+  0x80AA146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B9146A,
+  0x809A146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8086146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80AB146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF146A,
+  0x80A9146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF146A,
+  0x98AF146A,
+  0x9596146A,
+  0x8C93146A,
+  0x8989146A,
+  0x8086146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9099146A,
+  0x8181146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAABF146A,
+  0xA0A7146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA3A3146A,
+  0xA1A1146A,
+  0x8090146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABA146A,
+  0x8BB2146A,
+  0x8080146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9CBF146A,
+  0x9090146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0x9D9D146A,
+  0x8089146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8AAE146A,
+  0x8088146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2BF146A,
+  0x9099146A,
+  0x8080146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x808F146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8BB0146A,
+  0x8889146A,
+  0x8086146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAABF146A,
+  0xA7A8146A,
+  0xA0A5146A,
+  0x9099146A,
+  0x8686146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0A9146A,
+  0x9898146A,
+  0x8089146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0B2146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B0146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8083146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80B0146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0xA0A9146A,
+  0x809E146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90AD146A,
+  0x8089146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBF146A,
+  0xA3B7146A,
+  0x9099146A,
+  0x8083146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9090146A,
+  0x808A146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x939F146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA3A3146A,
+  0xA0A1146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80B7146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8095146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBE146A,
+  0xB5BB146A,
+  0xB0B3146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80A2146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0xA4A7146A,
+  0x9092146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BB146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BC146A,
+  0x80AA146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9099146A,
+  0x8088146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x96BF146A,
+  0x8094146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBF146A,
+  0xBBBB146A,
+  0xAEB9146A,
+  0xA9AC146A,
+  0xA5A6146A,
+  0xA2A2146A,
+  0x9E9F146A,
+  0x809C146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x85BF146A,
+  0x8083146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBE146A,
+  0x9EB9146A,
+  0x969C146A,
+  0x8D94146A,
+  0x878A146A,
+  0x8085146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x92BF146A,
+  0x8A90146A,
+  0x8686146A,
+  0x8084146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA8BF146A,
+  0x80A5146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBF146A,
+  0x9CBA146A,
+  0x829A146A,
+  0x8080146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB6BF146A,
+  0x96B4146A,
+  0x8094146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0x90AE146A,
+  0x808E146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAABF146A,
+  0x8AA8146A,
+  0x8088146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8EBF146A,
+  0x848B146A,
+  0x8082146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB7BD146A,
+  0x80AC146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8E8E146A,
+  0x8089146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90AD146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B9146A,
+  0x80AB146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BE146A,
+  0xADAE146A,
+  0xA8AB146A,
+  0xA0A6146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8084146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9099146A,
+  0x8B8B146A,
+  0x8083146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBB146A,
+  0xB9B9146A,
+  0xB4B7146A,
+  0xA9B2146A,
+  0xA7A7146A,
+  0xA4A4146A,
+  0xA1A2146A,
+  0x859F146A,
+  0x8083146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBE146A,
+  0xB9BC146A,
+  0xB4B7146A,
+  0xACB2146A,
+  0xA7AA146A,
+  0xA4A4146A,
+  0xA1A2146A,
+  0x9F9F146A,
+  0x9D9D146A,
+  0x9B9B146A,
+  0x9999146A,
+  0x9797146A,
+  0x9494146A,
+  0x9192146A,
+  0x8D8F146A,
+  0x8B8B146A,
+  0x8989146A,
+  0x8787146A,
+  0x8282146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xABBB146A,
+  0xA5A9146A,
+  0xA1A3146A,
+  0x8B9B146A,
+  0x8089146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B9146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x809F146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF146A,
+  0x80A1146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80A0146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x809D146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x808A146A,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08002D90,
+  0x77773B74,
+  0x74743B6D,
+  0x73733B66,
+  0x72723B5F,
+  0x69693B58,
+  0x66663B51,
+  0x65653B4A,
+  0x63633B43,
+  0x202033BE,
+  0x0BFF2D8A,
+  0x0AFFFFFF,
+  0x090933BE,
+  0x00082D8A,
+  0xFE000001,
+  0x00FFFFFF,
+  0x08002D90,
+  0xF4F42F5C,
+  0xF1F32F56,
+  0xF0F02F3C,
+  0xEFEF2F25,
+  0xEEEE2F1F,
+  0xEDED2F18,
+  0xEAEA2EFB,
+  0xE4E42EF5,
+  0xE3E32EE8,
+  0xE2E22ED5,
+  0xE1E12EA4,
+  0xE0E02E7F,
+  0xDFDF2E77,
+  0xDEDE2E70,
+  0xDDDD2E6A,
+  0xDCDC2E62,
+  0xDBDB2E59,
+  0xD9D92E51,
+  0xD8D82E4B,
+  0xD7D72E43,
+  0xD6D62E3D,
+  0xD5D52E36,
+  0xD4D42E30,
+  0xD2D22E2A,
+  0xCFCF2E24,
+  0xCECE2E1A,
+  0xCDCD2E11,
+  0xCCCC2E0B,
+  0xCBCB2E01,
+  0xC3C32DFA,
+  0xC2C22DF1,
+  0x80FF0225,
+  0x77770DC6,
+  0x74740DC0,
+  0x73730DBA,
+  0x72720DB4,
+  0x69690DAE,
+  0x66660DA8,
+  0x65650DA2,
+  0x63630D9C,
+  0x617B0225,
+  0x5F5F0225,
+  0x415A0225,
+  0x3B3B0225,
+  0x30390225,
+  0x202033CE,
+  0x0B7F2DC6,
+  0x0AFFFFFF,
+  0x090933CE,
+  0x00082DC6,
+  0xA9BF2DC6,
+  0xA5A72DC6,
+  0x9BA32DC6,
+  0x96992DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xABAF2DC6,
+  0x999F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8F9F2DC6,
+  0x88882DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8ABF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF2DC6,
+  0xBABC2DC6,
+  0x80832DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B02DC6,
+  0xA2A52DC6,
+  0x91972DC6,
+  0x808F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF2DC6,
+  0xBABC2DC6,
+  0xB3B52DC6,
+  0xB1B12DC6,
+  0xA9A92DC6,
+  0x91922DC6,
+  0x8D8E2DC6,
+  0x81842DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBF2DC6,
+  0xB2BB2DC6,
+  0xA2A52DC6,
+  0x9E9E2DC6,
+  0x8F9B2DC6,
+  0x808D2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABF2DC6,
+  0xB7B72DC6,
+  0xB4B42DC6,
+  0xB1B12DC6,
+  0xA9A92DC6,
+  0x91922DC6,
+  0x8B8E2DC6,
+  0x80842DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB5BF2DC6,
+  0xB0B12DC6,
+  0x9FA52DC6,
+  0x9D9D2DC6,
+  0x80982DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF2DC6,
+  0xBABC2DC6,
+  0xB4B42DC6,
+  0xB1B12DC6,
+  0xA9A92DC6,
+  0x92922DC6,
+  0x8E8E2DC6,
+  0x80842DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABF2DC6,
+  0xB0B82DC6,
+  0xA2A52DC6,
+  0x919F2DC6,
+  0x808F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF2DC6,
+  0xBABC2DC6,
+  0xB4B42DC6,
+  0xB1B12DC6,
+  0xA9A92DC6,
+  0x91922DC6,
+  0x8D8E2DC6,
+  0x80842DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2BF2DC6,
+  0xB0B02DC6,
+  0xA2A52DC6,
+  0x9E9E2DC6,
+  0x809B2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABF2DC6,
+  0xABAD2DC6,
+  0xA5A72DC6,
+  0xA0A22DC6,
+  0x9D9D2DC6,
+  0x9B9B2DC6,
+  0x96982DC6,
+  0x91912DC6,
+  0x8B8D2DC6,
+  0x84842DC6,
+  0x80822DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF2DC6,
+  0x91A52DC6,
+  0x808F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF2DC6,
+  0xBABC2DC6,
+  0xA9A92DC6,
+  0x91912DC6,
+  0x8D8D2DC6,
+  0x80842DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF2DC6,
+  0xA2A52DC6,
+  0x9E9F2DC6,
+  0x9B9C2DC6,
+  0x80972DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF2DC6,
+  0xBABC2DC6,
+  0xB4B42DC6,
+  0xA9A92DC6,
+  0x91912DC6,
+  0x8D8D2DC6,
+  0x81842DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB3BF2DC6,
+  0xB0B02DC6,
+  0xA2A52DC6,
+  0x9F9F2DC6,
+  0x809C2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF2DC6,
+  0xBBBC2DC6,
+  0x91912DC6,
+  0x8D8D2DC6,
+  0x80832DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B92DC6,
+  0xA2A52DC6,
+  0x979E2DC6,
+  0x8F932DC6,
+  0x808D2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF2DC6,
+  0xBCBC2DC6,
+  0xB2B22DC6,
+  0x97992DC6,
+  0x80842DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF2DC6,
+  0x87A52DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB4BF2DC6,
+  0xB1B12DC6,
+  0x80802DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9ABF2DC6,
+  0x878F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF2DC6,
+  0xB4BC2DC6,
+  0xB1B12DC6,
+  0xA6A62DC6,
+  0xA4A42DC6,
+  0x8B8B2DC6,
+  0x85852DC6,
+  0x83832DC6,
+  0x80802DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF2DC6,
+  0x9A9B2DC6,
+  0x878F2DC6,
+  0x85852DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAABF2DC6,
+  0x819F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xADBF2DC6,
+  0x88882DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8DBF2DC6,
+  0x80872DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xABBE2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1B42DC6,
+  0xA7AD2DC6,
+  0xA2A42DC6,
+  0x9EA02DC6,
+  0x96992DC6,
+  0x8A8F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9A9F2DC6,
+  0x8F8F2DC6,
+  0x828D2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBB2DC6,
+  0x8E8F2DC6,
+  0x888C2DC6,
+  0x86862DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9E9F2DC6,
+  0x99992DC6,
+  0x97972DC6,
+  0x8E8F2DC6,
+  0x89892DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF2DC6,
+  0xB6B72DC6,
+  0xB1B12DC6,
+  0x8E8F2DC6,
+  0x89892DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x97972DC6,
+  0x86872DC6,
+  0x81812DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x96972DC6,
+  0x91912DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9BBF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x909F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF2DC6,
+  0xB6B72DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80802DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xADAE2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9B9F2DC6,
+  0x80802DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB9BF2DC6,
+  0xABB02DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2BF2DC6,
+  0x929E2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1BF2DC6,
+  0xADAD2DC6,
+  0x929F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB4BF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAABF2DC6,
+  0x9D9F2DC6,
+  0x989B2DC6,
+  0x80962DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9A9F2DC6,
+  0x808F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB9BF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xABAF2DC6,
+  0xA9A92DC6,
+  0x85862DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB6BF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9FBF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB5BF2DC6,
+  0xAEAF2DC6,
+  0x80852DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xACAF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9ABF2DC6,
+  0x8A8F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x979F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x95BF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA8BF2DC6,
+  0x9AA62DC6,
+  0x8A8F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB4BF2DC6,
+  0x80842DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9ABF2DC6,
+  0x8D8F2DC6,
+  0x80842DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA1AD2DC6,
+  0x80822DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA6BF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA4BF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF2DC6,
+  0x8A8C2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBC2DC6,
+  0x898F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBF2DC6,
+  0xB7B92DC6,
+  0xB4B42DC6,
+  0xADAD2DC6,
+  0x80A82DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9E9F2DC6,
+  0x96972DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF2DC6,
+  0x9E9E2DC6,
+  0x9C9C2DC6,
+  0x9A9A2DC6,
+  0x98982DC6,
+  0x8E8F2DC6,
+  0x86872DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF2DC6,
+  0xBDBD2DC6,
+  0xB5B52DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBF2DC6,
+  0xB5B52DC6,
+  0xADB12DC6,
+  0x9C9F2DC6,
+  0x94952DC6,
+  0x8D8F2DC6,
+  0x85852DC6,
+  0x80812DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80BE2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2BE2DC6,
+  0x95B02DC6,
+  0x81932DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9DBF2DC6,
+  0x808F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABB2DC6,
+  0xAEAE2DC6,
+  0xA9A92DC6,
+  0xA7A72DC6,
+  0xA5A52DC6,
+  0x9EA32DC6,
+  0x96982DC6,
+  0x94942DC6,
+  0x88892DC6,
+  0x83862DC6,
+  0x80812DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8FBF2DC6,
+  0x8A8D2DC6,
+  0x80842DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x85BF2DC6,
+  0x80822DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB4BF2DC6,
+  0xAFB12DC6,
+  0xA5AA2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAEAF2DC6,
+  0xA8AC2DC6,
+  0xA6A62DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF2DC6,
+  0xA8AE2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF2DC6,
+  0xB7B72DC6,
+  0xAFAF2DC6,
+  0xA7A72DC6,
+  0x979F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9FBF2DC6,
+  0x97972DC6,
+  0x8F8F2DC6,
+  0x87872DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF2DC6,
+  0x80AE2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBF2DC6,
+  0xB6BA2DC6,
+  0x87B02DC6,
+  0x80842DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0A02DC6,
+  0x979C2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBB2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0B02DC6,
+  0x80842DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8F9F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80AF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8DBF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF2DC6,
+  0x808F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xACBF2DC6,
+  0x8D8F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFBE2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9E9F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0A12DC6,
+  0x80962DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x898A2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9AB12DC6,
+  0x94942DC6,
+  0x92922DC6,
+  0x8B8F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA3BF2DC6,
+  0x8B8B2DC6,
+  0x86862DC6,
+  0x82822DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB4BF2DC6,
+  0x80812DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF2DC6,
+  0xBCBC2DC6,
+  0xB8BA2DC6,
+  0x9AB12DC6,
+  0x808F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA6AF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBF2DC6,
+  0x879F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB3BF2DC6,
+  0x80832DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF2DC6,
+  0xA5A52DC6,
+  0x9A9F2DC6,
+  0x808E2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA9BF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBD2DC6,
+  0xB7B92DC6,
+  0x9A9F2DC6,
+  0x8C8F2DC6,
+  0x83832DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF2DC6,
+  0xB7B82DC6,
+  0xB2B42DC6,
+  0xB0B02DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB5BF2DC6,
+  0xABB12DC6,
+  0x9E9F2DC6,
+  0x839A2DC6,
+  0x81812DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFAF2DC6,
+  0xA7A72DC6,
+  0x979F2DC6,
+  0x8F902DC6,
+  0x87882DC6,
+  0x80802DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAAAF2DC6,
+  0x9B9B2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABF2DC6,
+  0xA3AF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA4AF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBF2DC6,
+  0x878A2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAEAF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9ABF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF2DC6,
+  0xBDBD2DC6,
+  0xB7B72DC6,
+  0xA9A92DC6,
+  0x9E9E2DC6,
+  0x989C2DC6,
+  0x87922DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x85852DC6,
+  0x82822DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2BF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x80922DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x808F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90912DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBF2DC6,
+  0x88AF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB5BF2DC6,
+  0x80B22DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB5B52DC6,
+  0x90AF2DC6,
+  0x808C2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBE2DC6,
+  0x9AA02DC6,
+  0x808F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9BA52DC6,
+  0x80802DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9DBF2DC6,
+  0x98992DC6,
+  0x90912DC6,
+  0x88892DC6,
+  0x80812DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF3C65,
+  0xBEBE3C5F,
+  0xBDBD3C59,
+  0xBCBC3C52,
+  0xBABA3C4B,
+  0xB5BB2E0B,
+  0xB4B43C44,
+  0xB2B33C3E,
+  0xB1B12E3D,
+  0xAEAE3C38,
+  0xADAD3C31,
+  0xACAC35D4,
+  0xABAB3C2A,
+  0xAAAA3C24,
+  0xA9A93C1D,
+  0xA8A83C14,
+  0xA6A63C0E,
+  0xA4A43C07,
+  0xA3A33BFF,
+  0xA2A235DA,
+  0xA1A13BF8,
+  0xA0A03BEE,
+  0x9FAF2E0B,
+  0x9E9E3BE6,
+  0x9D9D3BDF,
+  0x9C9C3BD9,
+  0x97972E0B,
+  0x96963BCD,
+  0x95953BC6,
+  0x94943BC0,
+  0x93933BB9,
+  0x92923BB2,
+  0x8F8F3BAB,
+  0x8E8E3713,
+  0x8D8D3BA3,
+  0x8C8C3B9D,
+  0x8B8B3B97,
+  0x8A8A3B91,
+  0x84892E0B,
+  0x83833B8B,
+  0x81813B84,
+  0x80803B7B,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBE3D8B,
+  0xBBBB3D84,
+  0xB6B63D7C,
+  0xB5B53D72,
+  0xB4B43D6A,
+  0xB2B23D64,
+  0xB1B13D5D,
+  0xB0B03D56,
+  0xABAB35C6,
+  0xAAAA3D4F,
+  0xA9A93D48,
+  0xA8A83D40,
+  0xA7A73D38,
+  0xA6A63D31,
+  0xA5A53D29,
+  0xA4A43D1F,
+  0xA3A33D19,
+  0xA2A22E4B,
+  0xA0A03D13,
+  0x9D9D3D0D,
+  0x9C9C3D06,
+  0x9B9B3418,
+  0x9A9A3CFF,
+  0x99993CF7,
+  0x98983CDB,
+  0x97973CF0,
+  0x96963CEA,
+  0x93933CE1,
+  0x92923CDB,
+  0x91913CD2,
+  0x90903CCC,
+  0x8D8D3CC4,
+  0x8C8C3475,
+  0x8B8B3CBD,
+  0x8A8A3CB3,
+  0x89BF2E0B,
+  0x88883CAC,
+  0x87873CA3,
+  0x86863C9C,
+  0x85853C92,
+  0x84843C8B,
+  0x83833C83,
+  0x82823C7C,
+  0x81813C73,
+  0x80803C6C,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF3D98,
+  0xBEBE37E0,
+  0x96BD2E0B,
+  0x95953D92,
+  0x8F912E0B,
+  0x8E8E37B5,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x91BF2E0B,
+  0x90903CEA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9ABF2E0B,
+  0x99993D0D,
+  0x808F2E0B,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF3DC2,
+  0xBEBE3DBB,
+  0xBDBD3DB4,
+  0xBABB2E0B,
+  0xAFB82E0B,
+  0xAEAE3D64,
+  0xADAD3DAC,
+  0xACAC3CDB,
+  0xABAB3DA5,
+  0xAAAA3817,
+  0xA9A93D9E,
+  0xA8A835C6,
+  0x809F2E0B,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB5BF2E0B,
+  0xB4B42E3D,
+  0xB3B33DD0,
+  0x9F9F3DCA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF3DD6,
+  0x80BE2E0B,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB3BF2E0B,
+  0xB2B23DFA,
+  0xB1B13DF3,
+  0x8CAF2E0B,
+  0x8B8B3DED,
+  0x85853DE5,
+  0x84843DDF,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBC35DA,
+  0xA0BF2E0B,
+  0x9F9F3E4F,
+  0x9E9E3E48,
+  0x9D9D3E41,
+  0x9C9C3E3A,
+  0x9B9B3E32,
+  0x9A9A3E2C,
+  0x95953E24,
+  0x94943E19,
+  0x93933E13,
+  0x92923E07,
+  0x91913E01,
+  0x808F2E0B,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABA3EB1,
+  0xB9B93E98,
+  0xB8B83E8A,
+  0xA6BF2E0B,
+  0xA5A53E82,
+  0xA3A33E7C,
+  0x9F9F3E72,
+  0x8B8B3E6B,
+  0x8A8A3E64,
+  0x85853E5D,
+  0x84843E56,
+  0x809E2E0B,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFAF3EBB,
+  0x80BF2E0B,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9B9B3EC2,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0A03713,
+  0x9C9C35C6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABA3EC8,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF2E0B,
+  0xAFAF3ECE,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA9BF2E0B,
+  0xA8A83ED4,
+  0x809F2E0B,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8EBF2E0B,
+  0x8D8D3EDA,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xF4F42146,
+  0xF1F32140,
+  0xF0F0213A,
+  0xEDED2134,
+  0xE1EF212E,
+  0xE0E02128,
+  0xC2DF2122,
+  0x80FF0225,
+  0x74743EE0,
+  0x292920F6,
+  0x2020214C,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x0909214C,
+  0x00081399,
+  0xF4F42146,
+  0xF1F32140,
+  0xF0F0213A,
+  0xEDED2134,
+  0xE1EF212E,
+  0xE0E02128,
+  0xC2DF2122,
+  0x80FF0225,
+  0x73733EEF,
+  0x292920F6,
+  0x2020214C,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x0909214C,
+  0x00081399,
+  0xF4F42146,
+  0xF1F32140,
+  0xF0F0213A,
+  0xEDED2134,
+  0xE1EF212E,
+  0xE0E02128,
+  0xC2DF2122,
+  0x80FF0225,
+  0x727221C0,
+  0x292920F6,
+  0x2020214C,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x0909214C,
+  0x00081399,
+  0xF4F42146,
+  0xF1F32140,
+  0xF0F0213A,
+  0xEDED2134,
+  0xE1EF212E,
+  0xE0E02128,
+  0xC2DF2122,
+  0x80FF0225,
+  0x74743EFE,
+  0x292920F6,
+  0x2020214C,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x0909214C,
+  0x00081399,
+  0xF4F42146,
+  0xF1F32140,
+  0xF0F0213A,
+  0xEDED2134,
+  0xE1EF212E,
+  0xE0E02128,
+  0xC2DF2122,
+  0x80FF0225,
+  0x69693924,
+  0x292920F6,
+  0x2020214C,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x0909214C,
+  0x00081399,
+  0xF4F42146,
+  0xF1F32140,
+  0xF0F0213A,
+  0xEDED2134,
+  0xE1EF212E,
+  0xE0E02128,
+  0xC2DF2122,
+  0x80FF0225,
+  0x72723F0D,
+  0x292920F6,
+  0x2020214C,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x0909214C,
+  0x00081399,
+  0xF4F42146,
+  0xF1F32140,
+  0xF0F0213A,
+  0xEDED2134,
+  0xE1EF212E,
+  0xE0E02128,
+  0xC2DF2122,
+  0x80FF0225,
+  0x69693F1C,
+  0x292920F6,
+  0x2020214C,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x0909214C,
+  0x00081399,
+  0x08003991,
+  0x0BFF398D,
+  0x0AFFFFFF,
+  0x0009398D,
+  0x07003F2B,
+  0x00FFFFFF,
+  0x08003991,
+  0xF4F43B09,
+  0xF1F33B04,
+  0xF0F03AEB,
+  0xEFEF3AD5,
+  0xEEEE3AD0,
+  0xEDED3ACA,
+  0xEAEA3AAE,
+  0xE4E43AA9,
+  0xE3E33A9D,
+  0xE2E23A8B,
+  0xE1E13A5B,
+  0xE0E03A37,
+  0xDFDF3A30,
+  0xDEDE3A2A,
+  0xDDDD3A25,
+  0xDCDC3A1E,
+  0xDBDB3A16,
+  0xD9D93A0F,
+  0xD8D83A0A,
+  0xD7D73A03,
+  0xD6D639FE,
+  0xD5D539F8,
+  0xD4D439F3,
+  0xD2D239EE,
+  0xCFCF39E9,
+  0xCECE39E0,
+  0xCDCD39D8,
+  0xCCCC39D3,
+  0xCBCB39CA,
+  0xC3C339C4,
+  0xC2C239BC,
+  0x80FF130E,
+  0x617B130E,
+  0x5F5F130E,
+  0x415A130E,
+  0x3B3B130E,
+  0x3039130E,
+  0x0B7F3993,
+  0x0AFFFFFF,
+  0x00093993,
+  0x08001190,
+  0xBBBF3993,
+  0xB6B93993,
+  0xABB43993,
+  0x80A93993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB7B73993,
+  0x97973993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFBF3993,
+  0xADAD3993,
+  0xA5AB3993,
+  0x929F3993,
+  0x82853993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBE3993,
+  0xB8B93993,
+  0xB5B53993,
+  0x80AF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA2A23993,
+  0x8D8D3993,
+  0x8B8B3993,
+  0x87873993,
+  0x80853993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB6B63993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x82893993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B03993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9A9F3993,
+  0x97983993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x89BF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB3BF3993,
+  0xABAE3993,
+  0x808F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x809F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B03993,
+  0xAAAD3993,
+  0x8B9F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBE3993,
+  0xA7AD3993,
+  0x96A43993,
+  0x94943993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF3993,
+  0x91913993,
+  0x808F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x808C3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2BF3993,
+  0xA6B03993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBF3993,
+  0xB6B93993,
+  0xABB33993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF39D3,
+  0xBEBE4036,
+  0xBDBD4030,
+  0xBCBC402A,
+  0xBBBB4022,
+  0xBABA4015,
+  0xB9B9400F,
+  0xB8B84008,
+  0xB7B74002,
+  0xB6B63FF9,
+  0xB5B53FF0,
+  0xB4B43FE7,
+  0xB3B33FDE,
+  0xB2B23FD3,
+  0xB1B13FCA,
+  0xB0B03FC0,
+  0xAFAF3FB9,
+  0xAEAE3FAA,
+  0xADAD3FA1,
+  0xACAC3F95,
+  0xABAB3F8C,
+  0xAAAA3F80,
+  0xA9A93F77,
+  0xA8A83F6B,
+  0xA7A73F61,
+  0xA6A63F55,
+  0xA5A53F4D,
+  0xA4A43F46,
+  0xA3A33F41,
+  0xA2A23F3B,
+  0xA1A13F35,
+  0xA0A03F2D,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF4142,
+  0xBEBE413B,
+  0xBDBD4130,
+  0xBCBC412A,
+  0xB7B739D3,
+  0xB3B34121,
+  0xB2B2411B,
+  0xB1B14115,
+  0xB0B04110,
+  0xAFAF410B,
+  0xAEAE4105,
+  0xADAD40FE,
+  0xACAC40F8,
+  0xABAB39D3,
+  0xAAAA40F1,
+  0xA9A940EC,
+  0xA8A840E7,
+  0xA7A740E1,
+  0xA6A640DC,
+  0xA5A540D5,
+  0xA4A440D0,
+  0xA3A340CB,
+  0xA2A240C4,
+  0xA1A140BF,
+  0xA0A040B9,
+  0x9F9F40B1,
+  0x9E9E40AC,
+  0x9D9D40A5,
+  0x9C9C409F,
+  0x9B9B4099,
+  0x9A9A4093,
+  0x9999408E,
+  0x90904089,
+  0x8F8F4083,
+  0x8E8E407E,
+  0x8D8D4079,
+  0x8C8C4073,
+  0x8B8B406C,
+  0x8A8A4063,
+  0x8989405A,
+  0x83834052,
+  0x8282404B,
+  0x81814041,
+  0x8080403C,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB9BF39D3,
+  0xB8B841A1,
+  0xB7B74199,
+  0xB6B64190,
+  0xB5B5418A,
+  0xB4B44183,
+  0xB3B3417C,
+  0x86864176,
+  0x8585416F,
+  0x84844160,
+  0x83AF39D3,
+  0x8282415A,
+  0x81814153,
+  0x8080414E,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x888F39D3,
+  0x878741C5,
+  0x868641C0,
+  0x848441BA,
+  0x838341B5,
+  0x828241AF,
+  0x81814089,
+  0x808041A7,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB7B739D3,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFAF4257,
+  0xADAD4251,
+  0xACAC4247,
+  0xABAB423E,
+  0xAAAA4236,
+  0xA9A9422D,
+  0xA8A84228,
+  0xA7A74220,
+  0xA6A6421A,
+  0xA5A54214,
+  0xA4A4420F,
+  0xA3A34206,
+  0xA2A24200,
+  0xA1A140AC,
+  0xA0A041F8,
+  0x9F9F41F0,
+  0x9E9E41EB,
+  0x9C9C41E5,
+  0x9B9B410B,
+  0x9A9A41E0,
+  0x999941DB,
+  0x989841D5,
+  0x939341CF,
+  0x929241CA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9F9F4262,
+  0x9E9E425D,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BF39D3,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF42C6,
+  0xBEBE42C1,
+  0xBDBD42BB,
+  0xBCBC42B4,
+  0xBBBB42AF,
+  0xB9B942A8,
+  0xB8B842A2,
+  0xB7B7429C,
+  0xB6B64297,
+  0xB5B54292,
+  0xB4B4428D,
+  0xAFAF4288,
+  0xAEAE4283,
+  0xADAD427D,
+  0xACAC4272,
+  0xABAB426D,
+  0xA9A94268,
+  0x80A339D3,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2BF3AD0,
+  0xB1B143B4,
+  0xAFAF43AD,
+  0xAEAE43A7,
+  0xACAC43A2,
+  0xABAB439C,
+  0xAAAA4397,
+  0x9F9F4391,
+  0x9E9E4381,
+  0x9D9D436F,
+  0x9B9B4364,
+  0x9A9A435E,
+  0x999C3AD0,
+  0x98984356,
+  0x96964345,
+  0x95953AD0,
+  0x9494433E,
+  0x93934338,
+  0x9292432E,
+  0x919142FD,
+  0x909042CF,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BF3AD0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x808F3AD0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0xF0F00D55,
+  0xEFEF0D3E,
+  0xEDED0D36,
+  0xEAEA0D18,
+  0xE5EC0D12,
+  0xE4E40D0B,
+  0xE3E30CFD,
+  0xE2E20CEB,
+  0xE1E10CB9,
+  0xE0E00C95,
+  0xDFDF0C8D,
+  0xDEDE0C86,
+  0xDDDD0C80,
+  0xDCDC0C79,
+  0xDBDB0C6F,
+  0xD9D90C66,
+  0xD8D80C60,
+  0xD7D70C59,
+  0xD6D60C53,
+  0xD5D50C4B,
+  0xD4D40C44,
+  0xD2D20C3D,
+  0xD0DA0C13,
+  0xCFCF0C36,
+  0xCECE0C2C,
+  0xCDCD0C23,
+  0xCBCB0C19,
+  0xC4CA0C13,
+  0xC3C30C0B,
+  0xC2C20C03,
+  0x6E6E146A,
+  0x617A0D6E,
+  0x5F5F0D6E,
+  0x5D5D008E,
+  0x5B5B008E,
+  0x415A0D6E,
+  0x3E3E008E,
+  0x3C3C008E,
+  0x30390D6E,
+  0x2E2E008E,
+  0x2C2C008E,
+  0x28281399,
+  0x202013D6,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090913D6,
+  0x00080225,
+  0x6E6E130E,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x08002D90,
+  0x616143BA,
+  0x202033BE,
+  0x0BFF2D8A,
+  0x0AFFFFFF,
+  0x090933BE,
+  0x00082D8A,
+  0x08002D90,
+  0x6C6C43C1,
+  0x202033BE,
+  0x0BFF2D8A,
+  0x0AFFFFFF,
+  0x090933BE,
+  0x00082D8A,
+  0x08002D90,
+  0x6F6F43C8,
+  0x202033BE,
+  0x0BFF2D8A,
+  0x0AFFFFFF,
+  0x090933BE,
+  0x00082D8A,
+  0x08002D90,
+  0x6666398D,
+  0x202033BE,
+  0x0BFF2D8A,
+  0x0AFFFFFF,
+  0x090933BE,
+  0x00082D8A,
+  0x08002D90,
+  0x656543CF,
+  0x202033BE,
+  0x0BFF2D8A,
+  0x0AFFFFFF,
+  0x090933BE,
+  0x00082D8A,
+  0x08002D90,
+  0x777743D6,
+  0x202033BE,
+  0x0BFF2D8A,
+  0x0AFFFFFF,
+  0x090933BE,
+  0x00082D8A,
+  0x08002D90,
+  0x686843DD,
+  0x202033BE,
+  0x0BFF2D8A,
+  0x0AFFFFFF,
+  0x090933BE,
+  0x00082D8A,
+  0x08002D90,
+  0x686843E4,
+  0x202033BE,
+  0x0BFF2D8A,
+  0x0AFFFFFF,
+  0x090933BE,
+  0x00082D8A,
+  0xBEBE2DC6,
+  0xBBBB2DC6,
+  0xA7A72DC6,
+  0x8C8C2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9EBF2DC6,
+  0x8E8F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9D9F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x91BF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0AC2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB6BF2DC6,
+  0x8A8F2DC6,
+  0x81812DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90BF2DC6,
+  0x84872DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAAAF2DC6,
+  0x9E9F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBF2DC6,
+  0x94972DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA8AF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBB2DC6,
+  0xA4AF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBF2DC6,
+  0xBABA2DC6,
+  0xB2B22DC6,
+  0xA2A22DC6,
+  0x96962DC6,
+  0x93932DC6,
+  0x8B8B2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB7BF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA8BF2DC6,
+  0x969F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBF2DC6,
+  0xB1B12DC6,
+  0x86862DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBE2DC6,
+  0xB9BB2DC6,
+  0xB6B62DC6,
+  0x89892DC6,
+  0x86872DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB7BF2DC6,
+  0x969F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB6BF2DC6,
+  0xB3B32DC6,
+  0x809F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABF2DC6,
+  0x969F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8BD2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB6BF2DC6,
+  0x98982DC6,
+  0x94942DC6,
+  0x818F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBF2DC6,
+  0x809F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9DBF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA5BF2DC6,
+  0x88882DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB3BF2DC6,
+  0x969F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x92BF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB3BF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABF2DC6,
+  0xA4AF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB2BF2DC6,
+  0xAAAF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA8AF2DC6,
+  0x9DA62DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x86AF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x82AF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB7BF2DC6,
+  0x859F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8BF2DC6,
+  0x80822DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB6BF2DC6,
+  0xB3B42DC6,
+  0xB0B02DC6,
+  0x80A52DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF2DC6,
+  0x80822DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABF2DC6,
+  0xA9AF2DC6,
+  0x808F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA7B52DC6,
+  0x80822DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB7BF2DC6,
+  0xB3B52DC6,
+  0x888F2DC6,
+  0x85862DC6,
+  0x80832DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB3BF2DC6,
+  0x80822DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9DBF2DC6,
+  0x9B9B2DC6,
+  0x858F2DC6,
+  0x80802DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xACBF2DC6,
+  0x92922DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA9AF2DC6,
+  0x9E9E2DC6,
+  0x8E8E2DC6,
+  0x89892DC6,
+  0x87872DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABF2DC6,
+  0x9FAF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA2BF2DC6,
+  0x919C2DC6,
+  0x808F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB5BF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA2BF2DC6,
+  0x9A9E2DC6,
+  0x8B8F2DC6,
+  0x80862DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9ABF2DC6,
+  0x888F2DC6,
+  0x86862DC6,
+  0x80832DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFBF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9CBF2DC6,
+  0x80972DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9ABF2DC6,
+  0x858F2DC6,
+  0x80832DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB9BF2DC6,
+  0xABB72DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABF2DC6,
+  0x9BAF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x87BF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xACBF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAABE2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB0BE2DC6,
+  0x97972DC6,
+  0x94942DC6,
+  0x8A8B2DC6,
+  0x87882DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9ABF2DC6,
+  0x828F2DC6,
+  0x80802DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA8A92DC6,
+  0x809F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA4BF2DC6,
+  0xA2A22DC6,
+  0x91A02DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBF2DC6,
+  0xB3B92DC6,
+  0x818A2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x919B2DC6,
+  0x808F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9EAF2DC6,
+  0x8A9C2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFBF2DC6,
+  0x89892DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9AB12DC6,
+  0x818F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x90BF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1BF2DC6,
+  0x8A8A2DC6,
+  0x87872DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA9A92DC6,
+  0xA6A62DC6,
+  0x9A9F2DC6,
+  0x878F2DC6,
+  0x80852DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAABF2DC6,
+  0x999F2DC6,
+  0x8A972DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB3BF2DC6,
+  0x809F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1BF2DC6,
+  0x80AF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x84BF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB1BF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAAAF2DC6,
+  0x9F9F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAEBF2DC6,
+  0x8A8F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8BC2DC6,
+  0x9AA22DC6,
+  0x848F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x91BF2DC6,
+  0x8B8F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF2DC6,
+  0x80922DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA4BF2DC6,
+  0xA2A22DC6,
+  0x809F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB8BF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x96BF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF2DC6,
+  0xBCBC2DC6,
+  0xB4B42DC6,
+  0x80AF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA3BF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA8AF2DC6,
+  0x93A32DC6,
+  0x808F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBDBF2DC6,
+  0xABAF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9ABF2DC6,
+  0x898F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x95952DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBC2DC6,
+  0xBABA2DC6,
+  0xADAD2DC6,
+  0xA7A82DC6,
+  0xA3A42DC6,
+  0xA0A12DC6,
+  0x9D9D2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x84842DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF2DC6,
+  0xBABA2DC6,
+  0x9D9D2DC6,
+  0x95952DC6,
+  0x8B8C2DC6,
+  0x86862DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x91912DC6,
+  0x87892DC6,
+  0x85852DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA6A72DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBBBB2DC6,
+  0x9B9B2DC6,
+  0x81812DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xB5B52DC6,
+  0x95952DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAFAF2DC6,
+  0x8F8F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA9A92DC6,
+  0x89892DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8C8D2DC6,
+  0x83832DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBEBF2DC6,
+  0xADB62DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8FBF2DC6,
+  0x8A8D2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xAEBF2DC6,
+  0x808F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABF2DC6,
+  0xACAF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF2DC6,
+  0xAFAF2DC6,
+  0xACAC2DC6,
+  0xA7A72DC6,
+  0x809F2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x85BF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9ABF2DC6,
+  0x8C8F2DC6,
+  0x848A2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBF2DC6,
+  0xBABA2DC6,
+  0xB8B82DC6,
+  0xB3B32DC6,
+  0xA8A82DC6,
+  0xA5A62DC6,
+  0xA3A32DC6,
+  0xA0A02DC6,
+  0x84842DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBFBF2DC6,
+  0xBDBD2DC6,
+  0xB8B82DC6,
+  0xB3B32DC6,
+  0xABAB2DC6,
+  0xA5A62DC6,
+  0xA3A32DC6,
+  0xA0A02DC6,
+  0x9E9E2DC6,
+  0x9C9C2DC6,
+  0x9A9A2DC6,
+  0x98982DC6,
+  0x95962DC6,
+  0x93932DC6,
+  0x90902DC6,
+  0x8C8C2DC6,
+  0x8A8A2DC6,
+  0x88882DC6,
+  0x83862DC6,
+  0x80812DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBCBF2DC6,
+  0xAAAA2DC6,
+  0xA4A42DC6,
+  0x9CA02DC6,
+  0x8A8A2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xBABF2DC6,
+  0x80AF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA0BF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA2AF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xA1BF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x9EBF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0x8BBF2DC6,
+  0x202003FB,
+  0x0BFF0225,
+  0x0AFFFFFF,
+  0x090903FB,
+  0x00080225,
+  0xF4F42146,
+  0xF1F32140,
+  0xF0F0213A,
+  0xEDED2134,
+  0xE1EF212E,
+  0xE0E02128,
+  0xC2DF2122,
+  0x80FF0225,
+  0x636343EB,
+  0x292920F6,
+  0x2020214C,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x0909214C,
+  0x00081399,
+  0xF4F42146,
+  0xF1F32140,
+  0xF0F0213A,
+  0xEDED2134,
+  0xE1EF212E,
+  0xE0E02128,
+  0xC2DF2122,
+  0x80FF0225,
+  0x656521C0,
+  0x292920F6,
+  0x2020214C,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x0909214C,
+  0x00081399,
+  0xF4F42146,
+  0xF1F32140,
+  0xF0F0213A,
+  0xEDED2134,
+  0xE1EF212E,
+  0xE0E02128,
+  0xC2DF2122,
+  0x80FF0225,
+  0x757543FA,
+  0x292920F6,
+  0x2020214C,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x0909214C,
+  0x00081399,
+  0xF4F42146,
+  0xF1F32140,
+  0xF0F0213A,
+  0xEDED2134,
+  0xE1EF212E,
+  0xE0E02128,
+  0xC2DF2122,
+  0x80FF0225,
+  0x6F6F4409,
+  0x292920F6,
+  0x2020214C,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x0909214C,
+  0x00081399,
+  0xF4F42146,
+  0xF1F32140,
+  0xF0F0213A,
+  0xEDED2134,
+  0xE1EF212E,
+  0xE0E02128,
+  0xC2DF2122,
+  0x80FF0225,
+  0x6C6C3EEF,
+  0x292920F6,
+  0x2020214C,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x0909214C,
+  0x00081399,
+  0xFD000000,
+  0x00FFFFFF,
+  0x08001190,
+  0xA9BF3993,
+  0xA5A73993,
+  0x9BA33993,
+  0x96993993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xABAF3993,
+  0x999F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8F9F3993,
+  0x88883993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8ABF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF3993,
+  0xBABC3993,
+  0x80833993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B03993,
+  0xA2A53993,
+  0x91973993,
+  0x808F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF3993,
+  0xBABC3993,
+  0xB3B53993,
+  0xB1B13993,
+  0xA9A93993,
+  0x91923993,
+  0x8D8E3993,
+  0x81843993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBF3993,
+  0xB2BB3993,
+  0xA2A53993,
+  0x9E9E3993,
+  0x8F9B3993,
+  0x808D3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABF3993,
+  0xB7B73993,
+  0xB4B43993,
+  0xB1B13993,
+  0xA9A93993,
+  0x91923993,
+  0x8B8E3993,
+  0x80843993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB5BF3993,
+  0xB0B13993,
+  0x9FA53993,
+  0x9D9D3993,
+  0x80983993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF3993,
+  0xBABC3993,
+  0xB4B43993,
+  0xB1B13993,
+  0xA9A93993,
+  0x92923993,
+  0x8E8E3993,
+  0x80843993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABF3993,
+  0xB0B83993,
+  0xA2A53993,
+  0x919F3993,
+  0x808F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF3993,
+  0xBABC3993,
+  0xB4B43993,
+  0xB1B13993,
+  0xA9A93993,
+  0x91923993,
+  0x8D8E3993,
+  0x80843993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2BF3993,
+  0xB0B03993,
+  0xA2A53993,
+  0x9E9E3993,
+  0x809B3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABF3993,
+  0xABAD3993,
+  0xA5A73993,
+  0xA0A23993,
+  0x9D9D3993,
+  0x9B9B3993,
+  0x96983993,
+  0x91913993,
+  0x8B8D3993,
+  0x84843993,
+  0x80823993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF3993,
+  0x91A53993,
+  0x808F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF3993,
+  0xBABC3993,
+  0xA9A93993,
+  0x91913993,
+  0x8D8D3993,
+  0x80843993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF3993,
+  0xA2A53993,
+  0x9E9F3993,
+  0x9B9C3993,
+  0x80973993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF3993,
+  0xBABC3993,
+  0xB4B43993,
+  0xA9A93993,
+  0x91913993,
+  0x8D8D3993,
+  0x81843993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB3BF3993,
+  0xB0B03993,
+  0xA2A53993,
+  0x9F9F3993,
+  0x809C3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF3993,
+  0xBBBC3993,
+  0x91913993,
+  0x8D8D3993,
+  0x80833993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B93993,
+  0xA2A53993,
+  0x979E3993,
+  0x8F933993,
+  0x808D3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF3993,
+  0xBCBC3993,
+  0xB2B23993,
+  0x97993993,
+  0x80843993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF3993,
+  0x87A53993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB4BF3993,
+  0xB1B13993,
+  0x80803993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9ABF3993,
+  0x878F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF3993,
+  0xB4BC3993,
+  0xB1B13993,
+  0xA6A63993,
+  0xA4A43993,
+  0x8B8B3993,
+  0x85853993,
+  0x83833993,
+  0x80803993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF3993,
+  0x9A9B3993,
+  0x878F3993,
+  0x85853993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAABF3993,
+  0x819F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xADBF3993,
+  0x88883993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8DBF3993,
+  0x80873993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xABBE3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1B43993,
+  0xA7AD3993,
+  0xA2A43993,
+  0x9EA03993,
+  0x96993993,
+  0x8A8F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9A9F3993,
+  0x8F8F3993,
+  0x828D3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBB3993,
+  0x8E8F3993,
+  0x888C3993,
+  0x86863993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9E9F3993,
+  0x99993993,
+  0x97973993,
+  0x8E8F3993,
+  0x89893993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF3993,
+  0xB6B73993,
+  0xB1B13993,
+  0x8E8F3993,
+  0x89893993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x97973993,
+  0x86873993,
+  0x81813993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x96973993,
+  0x91913993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9BBF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x909F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF3993,
+  0xB6B73993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80803993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xADAE3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9B9F3993,
+  0x80803993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB9BF3993,
+  0xABB03993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2BF3993,
+  0x929E3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1BF3993,
+  0xADAD3993,
+  0x929F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB4BF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAABF3993,
+  0x9D9F3993,
+  0x989B3993,
+  0x80963993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9A9F3993,
+  0x808F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB9BF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xABAF3993,
+  0xA9A93993,
+  0x85863993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB6BF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9FBF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB5BF3993,
+  0xAEAF3993,
+  0x80853993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xACAF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9ABF3993,
+  0x8A8F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x979F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x95BF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA8BF3993,
+  0x9AA63993,
+  0x8A8F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB4BF3993,
+  0x80843993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9ABF3993,
+  0x8D8F3993,
+  0x80843993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA1AD3993,
+  0x80823993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA6BF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA4BF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF3993,
+  0x8A8C3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBC3993,
+  0x898F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBF3993,
+  0xB7B93993,
+  0xB4B43993,
+  0xADAD3993,
+  0x80A83993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9E9F3993,
+  0x96973993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF3993,
+  0x9E9E3993,
+  0x9C9C3993,
+  0x9A9A3993,
+  0x98983993,
+  0x8E8F3993,
+  0x86873993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF3993,
+  0xBDBD3993,
+  0xB5B53993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBF3993,
+  0xB5B53993,
+  0xADB13993,
+  0x9C9F3993,
+  0x94953993,
+  0x8D8F3993,
+  0x85853993,
+  0x80813993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80BE3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2BE3993,
+  0x95B03993,
+  0x81933993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9DBF3993,
+  0x808F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABB3993,
+  0xAEAE3993,
+  0xA9A93993,
+  0xA7A73993,
+  0xA5A53993,
+  0x9EA33993,
+  0x96983993,
+  0x94943993,
+  0x88893993,
+  0x83863993,
+  0x80813993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8FBF3993,
+  0x8A8D3993,
+  0x80843993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x85BF3993,
+  0x80823993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB4BF3993,
+  0xAFB13993,
+  0xA5AA3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAEAF3993,
+  0xA8AC3993,
+  0xA6A63993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF3993,
+  0xA8AE3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF3993,
+  0xB7B73993,
+  0xAFAF3993,
+  0xA7A73993,
+  0x979F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9FBF3993,
+  0x97973993,
+  0x8F8F3993,
+  0x87873993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF3993,
+  0x80AE3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBF3993,
+  0xB6BA3993,
+  0x87B03993,
+  0x80843993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0A03993,
+  0x979C3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBB3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0B03993,
+  0x80843993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8F9F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80AF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8DBF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF3993,
+  0x808F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xACBF3993,
+  0x8D8F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFBE3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9E9F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0A13993,
+  0x80963993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x898A3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9AB13993,
+  0x94943993,
+  0x92923993,
+  0x8B8F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA3BF3993,
+  0x8B8B3993,
+  0x86863993,
+  0x82823993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB4BF3993,
+  0x80813993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF3993,
+  0xBCBC3993,
+  0xB8BA3993,
+  0x9AB13993,
+  0x808F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA6AF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBF3993,
+  0x879F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB3BF3993,
+  0x80833993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF3993,
+  0xA5A53993,
+  0x9A9F3993,
+  0x808E3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA9BF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBD3993,
+  0xB7B93993,
+  0x9A9F3993,
+  0x8C8F3993,
+  0x83833993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF3993,
+  0xB7B83993,
+  0xB2B43993,
+  0xB0B03993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB5BF3993,
+  0xABB13993,
+  0x9E9F3993,
+  0x839A3993,
+  0x81813993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFAF3993,
+  0xA7A73993,
+  0x979F3993,
+  0x8F903993,
+  0x87883993,
+  0x80803993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAAAF3993,
+  0x9B9B3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABF3993,
+  0xA3AF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA4AF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBF3993,
+  0x878A3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAEAF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9ABF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF3993,
+  0xBDBD3993,
+  0xB7B73993,
+  0xA9A93993,
+  0x9E9E3993,
+  0x989C3993,
+  0x87923993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x85853993,
+  0x82823993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2BF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x80923993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x808F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90913993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBF3993,
+  0x88AF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB5BF3993,
+  0x80B23993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB5B53993,
+  0x90AF3993,
+  0x808C3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBE3993,
+  0x9AA03993,
+  0x808F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9BA53993,
+  0x80803993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9DBF3993,
+  0x98993993,
+  0x90913993,
+  0x88893993,
+  0x80813993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF44E1,
+  0xBEBE44DC,
+  0xBDBD44D7,
+  0xBCBC44D1,
+  0xBABA44CB,
+  0xB5BB39D3,
+  0xB4B444C5,
+  0xB2B344C0,
+  0xB1B139FE,
+  0xAEAE44BB,
+  0xADAD44B5,
+  0xACAC40CB,
+  0xABAB44AF,
+  0xAAAA44AA,
+  0xA9A944A4,
+  0xA8A8449C,
+  0xA6A64497,
+  0xA4A44491,
+  0xA3A3448A,
+  0xA2A240D0,
+  0xA1A14484,
+  0xA0A0447B,
+  0x9FAF39D3,
+  0x9E9E4474,
+  0x9D9D446E,
+  0x9C9C4469,
+  0x979739D3,
+  0x9696445E,
+  0x95954458,
+  0x94944453,
+  0x9393444D,
+  0x92924447,
+  0x8F8F4441,
+  0x8E8E41E0,
+  0x8D8D443A,
+  0x8C8C4435,
+  0x8B8B4430,
+  0x8A8A442B,
+  0x848939D3,
+  0x83834426,
+  0x81814420,
+  0x80804418,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBE45E0,
+  0xBBBB45DA,
+  0xB6B645D3,
+  0xB5B545CA,
+  0xB4B445C3,
+  0xB2B245BE,
+  0xB1B145B8,
+  0xB0B045B2,
+  0xABAB40BF,
+  0xAAAA45AC,
+  0xA9A945A6,
+  0xA8A8459F,
+  0xA7A74598,
+  0xA6A64592,
+  0xA5A5458B,
+  0xA4A44582,
+  0xA3A3457D,
+  0xA2A23A0A,
+  0xA0A04578,
+  0x9D9D4573,
+  0x9C9C456D,
+  0x9B9B3F41,
+  0x9A9A4567,
+  0x99994560,
+  0x98984548,
+  0x9797455A,
+  0x96964555,
+  0x9393454D,
+  0x92924548,
+  0x91914540,
+  0x9090453B,
+  0x8D8D4534,
+  0x8C8C3F95,
+  0x8B8B452E,
+  0x8A8A4525,
+  0x89BF39D3,
+  0x8888451F,
+  0x87874517,
+  0x86864511,
+  0x85854508,
+  0x84844502,
+  0x838344FB,
+  0x828244F5,
+  0x818144ED,
+  0x808044E7,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF45EB,
+  0xBEBE4292,
+  0x96BD39D3,
+  0x959545E6,
+  0x8F9139D3,
+  0x8E8E426D,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x91BF39D3,
+  0x90904555,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9ABF39D3,
+  0x99994573,
+  0x808F39D3,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF460F,
+  0xBEBE4609,
+  0xBDBD4603,
+  0xBABB39D3,
+  0xAFB839D3,
+  0xAEAE45BE,
+  0xADAD45FC,
+  0xACAC4548,
+  0xABAB45F6,
+  0xAAAA42C1,
+  0xA9A945F0,
+  0xA8A840BF,
+  0x809F39D3,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB5BF39D3,
+  0xB4B439FE,
+  0xB3B3461B,
+  0x9F9F4616,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF4620,
+  0x80BE39D3,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB3BF39D3,
+  0xB2B2463F,
+  0xB1B14639,
+  0x8CAF39D3,
+  0x8B8B4634,
+  0x8585462D,
+  0x84844628,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBC40D0,
+  0xA0BF39D3,
+  0x9F9F4689,
+  0x9E9E4683,
+  0x9D9D467D,
+  0x9C9C4677,
+  0x9B9B4670,
+  0x9A9A466B,
+  0x95954664,
+  0x9494465A,
+  0x93934655,
+  0x9292464A,
+  0x91914645,
+  0x808F39D3,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABA46E1,
+  0xB9B946C9,
+  0xB8B846BC,
+  0xA6BF39D3,
+  0xA5A546B5,
+  0xA3A346B0,
+  0x9F9F46A7,
+  0x8B8B46A1,
+  0x8A8A469B,
+  0x85854695,
+  0x8484468F,
+  0x809E39D3,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFAF46EA,
+  0x80BF39D3,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9B9B46F0,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0A041E0,
+  0x9C9C40BF,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABA46F5,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF39D3,
+  0xAFAF46FA,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA9BF39D3,
+  0xA8A846FF,
+  0x809F39D3,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8EBF39D3,
+  0x8D8D4704,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08002D90,
+  0x74744709,
+  0x202033BE,
+  0x0BFF2D8A,
+  0x0AFFFFFF,
+  0x090933BE,
+  0x00082D8A,
+  0x08002D90,
+  0x73734710,
+  0x202033BE,
+  0x0BFF2D8A,
+  0x0AFFFFFF,
+  0x090933BE,
+  0x00082D8A,
+  0x08002D90,
+  0x7272398D,
+  0x202033BE,
+  0x0BFF2D8A,
+  0x0AFFFFFF,
+  0x090933BE,
+  0x00082D8A,
+  0x08002D90,
+  0x74744717,
+  0x202033BE,
+  0x0BFF2D8A,
+  0x0AFFFFFF,
+  0x090933BE,
+  0x00082D8A,
+  0x08002D90,
+  0x696943BA,
+  0x202033BE,
+  0x0BFF2D8A,
+  0x0AFFFFFF,
+  0x090933BE,
+  0x00082D8A,
+  0x08002D90,
+  0x7272471E,
+  0x202033BE,
+  0x0BFF2D8A,
+  0x0AFFFFFF,
+  0x090933BE,
+  0x00082D8A,
+  0x08002D90,
+  0x69694725,
+  0x202033BE,
+  0x0BFF2D8A,
+  0x0AFFFFFF,
+  0x090933BE,
+  0x00082D8A,
+  0xF4F42146,
+  0xF1F32140,
+  0xF0F0213A,
+  0xEDED2134,
+  0xE1EF212E,
+  0xE0E02128,
+  0xC2DF2122,
+  0x80FF0225,
+  0x686821C0,
+  0x292920F6,
+  0x2020214C,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x0909214C,
+  0x00081399,
+  0xF4F42146,
+  0xF1F32140,
+  0xF0F0213A,
+  0xEDED2134,
+  0xE1EF212E,
+  0xE0E02128,
+  0xC2DF2122,
+  0x80FF0225,
+  0x7272472C,
+  0x292920F6,
+  0x2020214C,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x0909214C,
+  0x00081399,
+  0xF4F42146,
+  0xF1F32140,
+  0xF0F0213A,
+  0xEDED2134,
+  0xE1EF212E,
+  0xE0E02128,
+  0xC2DF2122,
+  0x80FF0225,
+  0x777721C0,
+  0x292920F6,
+  0x2020214C,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x0909214C,
+  0x00081399,
+  0x08001190,
+  0xBEBE3993,
+  0xBBBB3993,
+  0xA7A73993,
+  0x8C8C3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9EBF3993,
+  0x8E8F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9D9F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x91BF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0AC3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB6BF3993,
+  0x8A8F3993,
+  0x81813993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90BF3993,
+  0x84873993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAAAF3993,
+  0x9E9F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBF3993,
+  0x94973993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA8AF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBB3993,
+  0xA4AF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBF3993,
+  0xBABA3993,
+  0xB2B23993,
+  0xA2A23993,
+  0x96963993,
+  0x93933993,
+  0x8B8B3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB7BF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA8BF3993,
+  0x969F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBF3993,
+  0xB1B13993,
+  0x86863993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBE3993,
+  0xB9BB3993,
+  0xB6B63993,
+  0x89893993,
+  0x86873993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB7BF3993,
+  0x969F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB6BF3993,
+  0xB3B33993,
+  0x809F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABF3993,
+  0x969F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8BD3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB6BF3993,
+  0x98983993,
+  0x94943993,
+  0x818F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBF3993,
+  0x809F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9DBF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA5BF3993,
+  0x88883993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB3BF3993,
+  0x969F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x92BF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB3BF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABF3993,
+  0xA4AF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB2BF3993,
+  0xAAAF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA8AF3993,
+  0x9DA63993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x86AF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x82AF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB7BF3993,
+  0x859F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8BF3993,
+  0x80823993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB6BF3993,
+  0xB3B43993,
+  0xB0B03993,
+  0x80A53993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF3993,
+  0x80823993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABF3993,
+  0xA9AF3993,
+  0x808F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA7B53993,
+  0x80823993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB7BF3993,
+  0xB3B53993,
+  0x888F3993,
+  0x85863993,
+  0x80833993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB3BF3993,
+  0x80823993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9DBF3993,
+  0x9B9B3993,
+  0x858F3993,
+  0x80803993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xACBF3993,
+  0x92923993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA9AF3993,
+  0x9E9E3993,
+  0x8E8E3993,
+  0x89893993,
+  0x87873993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABF3993,
+  0x9FAF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA2BF3993,
+  0x919C3993,
+  0x808F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB5BF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA2BF3993,
+  0x9A9E3993,
+  0x8B8F3993,
+  0x80863993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9ABF3993,
+  0x888F3993,
+  0x86863993,
+  0x80833993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFBF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9CBF3993,
+  0x80973993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9ABF3993,
+  0x858F3993,
+  0x80833993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB9BF3993,
+  0xABB73993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABF3993,
+  0x9BAF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x87BF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xACBF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAABE3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB0BE3993,
+  0x97973993,
+  0x94943993,
+  0x8A8B3993,
+  0x87883993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9ABF3993,
+  0x828F3993,
+  0x80803993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA8A93993,
+  0x809F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA4BF3993,
+  0xA2A23993,
+  0x91A03993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBF3993,
+  0xB3B93993,
+  0x818A3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x919B3993,
+  0x808F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9EAF3993,
+  0x8A9C3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFBF3993,
+  0x89893993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9AB13993,
+  0x818F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x90BF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1BF3993,
+  0x8A8A3993,
+  0x87873993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA9A93993,
+  0xA6A63993,
+  0x9A9F3993,
+  0x878F3993,
+  0x80853993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAABF3993,
+  0x999F3993,
+  0x8A973993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB3BF3993,
+  0x809F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1BF3993,
+  0x80AF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x84BF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB1BF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAAAF3993,
+  0x9F9F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAEBF3993,
+  0x8A8F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8BC3993,
+  0x9AA23993,
+  0x848F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x91BF3993,
+  0x8B8F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF3993,
+  0x80923993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA4BF3993,
+  0xA2A23993,
+  0x809F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB8BF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x96BF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF3993,
+  0xBCBC3993,
+  0xB4B43993,
+  0x80AF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA3BF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA8AF3993,
+  0x93A33993,
+  0x808F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBDBF3993,
+  0xABAF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9ABF3993,
+  0x898F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x95953993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBC3993,
+  0xBABA3993,
+  0xADAD3993,
+  0xA7A83993,
+  0xA3A43993,
+  0xA0A13993,
+  0x9D9D3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x84843993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF3993,
+  0xBABA3993,
+  0x9D9D3993,
+  0x95953993,
+  0x8B8C3993,
+  0x86863993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x91913993,
+  0x87893993,
+  0x85853993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA6A73993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBBBB3993,
+  0x9B9B3993,
+  0x81813993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xB5B53993,
+  0x95953993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAFAF3993,
+  0x8F8F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA9A93993,
+  0x89893993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8C8D3993,
+  0x83833993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBEBF3993,
+  0xADB63993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8FBF3993,
+  0x8A8D3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xAEBF3993,
+  0x808F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABF3993,
+  0xACAF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF3993,
+  0xAFAF3993,
+  0xACAC3993,
+  0xA7A73993,
+  0x809F3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x85BF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9ABF3993,
+  0x8C8F3993,
+  0x848A3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBF3993,
+  0xBABA3993,
+  0xB8B83993,
+  0xB3B33993,
+  0xA8A83993,
+  0xA5A63993,
+  0xA3A33993,
+  0xA0A03993,
+  0x84843993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBFBF3993,
+  0xBDBD3993,
+  0xB8B83993,
+  0xB3B33993,
+  0xABAB3993,
+  0xA5A63993,
+  0xA3A33993,
+  0xA0A03993,
+  0x9E9E3993,
+  0x9C9C3993,
+  0x9A9A3993,
+  0x98983993,
+  0x95963993,
+  0x93933993,
+  0x90903993,
+  0x8C8C3993,
+  0x8A8A3993,
+  0x88883993,
+  0x83863993,
+  0x80813993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBCBF3993,
+  0xAAAA3993,
+  0xA4A43993,
+  0x9CA03993,
+  0x8A8A3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xBABF3993,
+  0x80AF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA0BF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA2AF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0xA1BF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x9EBF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08001190,
+  0x8BBF3993,
+  0x0BFF130E,
+  0x0AFFFFFF,
+  0x0009130E,
+  0x08002D90,
+  0x6363473B,
+  0x202033BE,
+  0x0BFF2D8A,
+  0x0AFFFFFF,
+  0x090933BE,
+  0x00082D8A,
+  0x08002D90,
+  0x6565398D,
+  0x202033BE,
+  0x0BFF2D8A,
+  0x0AFFFFFF,
+  0x090933BE,
+  0x00082D8A,
+  0x08002D90,
+  0x75754742,
+  0x202033BE,
+  0x0BFF2D8A,
+  0x0AFFFFFF,
+  0x090933BE,
+  0x00082D8A,
+  0x08002D90,
+  0x6F6F4749,
+  0x202033BE,
+  0x0BFF2D8A,
+  0x0AFFFFFF,
+  0x090933BE,
+  0x00082D8A,
+  0x08002D90,
+  0x6C6C4710,
+  0x202033BE,
+  0x0BFF2D8A,
+  0x0AFFFFFF,
+  0x090933BE,
+  0x00082D8A,
+  0xF4F42146,
+  0xF1F32140,
+  0xF0F0213A,
+  0xEDED2134,
+  0xE1EF212E,
+  0xE0E02128,
+  0xC2DF2122,
+  0x80FF0225,
+  0x6E6E21C0,
+  0x292920F6,
+  0x2020214C,
+  0x0B7F1399,
+  0x0AFFFFFF,
+  0x0909214C,
+  0x00081399,
+  0x08002D90,
+  0x6868398D,
+  0x202033BE,
+  0x0BFF2D8A,
+  0x0AFFFFFF,
+  0x090933BE,
+  0x00082D8A,
+  0x08002D90,
+  0x72724750,
+  0x202033BE,
+  0x0BFF2D8A,
+  0x0AFFFFFF,
+  0x090933BE,
+  0x00082D8A,
+  0x08002D90,
+  0x7777398D,
+  0x202033BE,
+  0x0BFF2D8A,
+  0x0AFFFFFF,
+  0x090933BE,
+  0x00082D8A,
+  0x08002D90,
+  0x6E6E398D,
+  0x202033BE,
+  0x0BFF2D8A,
+  0x0AFFFFFF,
+  0x090933BE,
+  0x00082D8A,
+};
+
+const reflex::Pattern::Pred reflex_pred_pack2[4354] = {
+    0,  3,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15,  0, 15, 15, 15, 15, 15,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+   87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 23, 87, 87, 87, 87, 87,
+   87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+   87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+   87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+   87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+   87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+   87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+   87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+   87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+   87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+   87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+   87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+   87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+   87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+   87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+   87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 31, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7, 15,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+    7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+};
+
+#ifndef REFLEX_CODE_DECL
+#include <reflex/pattern.h>
+#define REFLEX_CODE_DECL const reflex::Pattern::Opcode
+#endif
+
+REFLEX_CODE_DECL reflex_code_pack3[7436] =
+{
+  0x66660007,
+  0x3D3D000C,
+  0x20200000,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x09090000,
+  0x00080014,
+  0x75750018,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x6666001D,
+  0x3D3D000C,
+  0x28280022,
+  0x2020000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x0909000C,
+  0x00080014,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x6E6E0029,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x7575002E,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x6666001D,
+  0x3D3D000C,
+  0x20200022,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x09090022,
+  0x00080014,
+  0x63630033,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x6E6E0038,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x7474003D,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x63630042,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x69690047,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x7474004C,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x6F6F0051,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x69690056,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x6E6E005B,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x6F6F0061,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x3D3D000C,
+  0x20200066,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x09090066,
+  0x00080014,
+  0x6E6E008E,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xF0F001F4,
+  0xEFEF01DE,
+  0xEDED01D7,
+  0xEAEA01BA,
+  0xE5EC01B5,
+  0xE4E401AF,
+  0xE3E301A2,
+  0xE2E20191,
+  0xE1E10160,
+  0xE0E0013D,
+  0xDFDF0136,
+  0xDEDE0130,
+  0xDDDD012B,
+  0xDCDC0125,
+  0xDBDB011C,
+  0xD9D90114,
+  0xD8D8010F,
+  0xD7D70109,
+  0xD6D60104,
+  0xD5D500FD,
+  0xD4D400F7,
+  0xD2D200F1,
+  0xD0DA00CC,
+  0xCFCF00EB,
+  0xCECE00E2,
+  0xCDCD00DA,
+  0xCBCB00D1,
+  0xC4CA00CC,
+  0xC3C300C5,
+  0xC2C200BE,
+  0x617A0095,
+  0x5F5F0095,
+  0x415A0095,
+  0x3D3D000C,
+  0x30390095,
+  0x20200066,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x09090066,
+  0x00080014,
+  0x3D3D000C,
+  0x2828020C,
+  0x2020008E,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x0909008E,
+  0x00080014,
+  0xF0F001F4,
+  0xEFEF01DE,
+  0xEDED01D7,
+  0xEAEA01BA,
+  0xE5EC01B5,
+  0xE4E401AF,
+  0xE3E301A2,
+  0xE2E20191,
+  0xE1E10160,
+  0xE0E0013D,
+  0xDFDF0136,
+  0xDEDE0130,
+  0xDDDD012B,
+  0xDCDC0125,
+  0xDBDB011C,
+  0xD9D90114,
+  0xD8D8010F,
+  0xD7D70109,
+  0xD6D60104,
+  0xD5D500FD,
+  0xD4D400F7,
+  0xD2D200F1,
+  0xD0DA00CC,
+  0xCFCF00EB,
+  0xCECE00E2,
+  0xCDCD00DA,
+  0xCBCB00D1,
+  0xC4CA00CC,
+  0xC3C300C5,
+  0xC2C200BE,
+  0x617A0095,
+  0x5F5F0095,
+  0x415A0095,
+  0x3D3D000C,
+  0x30390095,
+  0x28280218,
+  0x20200224,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x09090224,
+  0x00080014,
+  0xBABA0095,
+  0xB5B50095,
+  0xAAAA0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB8BF0095,
+  0x98B60095,
+  0x80960095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80BF0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAEAE0095,
+  0xACAC0095,
+  0xA0A40095,
+  0x86910095,
+  0x80810095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF0095,
+  0xBABD0095,
+  0xB6B70095,
+  0xB0B40095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA3BF0095,
+  0x8EA10095,
+  0x8C8C0095,
+  0x888A0095,
+  0x86860095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB7BF0095,
+  0x80B50095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x8ABF0095,
+  0x80810095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB1BF0095,
+  0x80AF0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0BF0095,
+  0x99990095,
+  0x80960095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80880095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAFB20095,
+  0x90AA0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0BF0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB1BF0095,
+  0xAEAF0095,
+  0xA0A90095,
+  0x808A0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF0095,
+  0xAEBC0095,
+  0xA5A60095,
+  0x95950095,
+  0x80930095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x92AF0095,
+  0x90900095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x8DBF0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB1B10095,
+  0x80A50095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBABA0095,
+  0xB4B50095,
+  0x80AA0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBE0325,
+  0xBDBD031F,
+  0xBCBC0319,
+  0xBBBB0311,
+  0xBABA0305,
+  0xB9B902FF,
+  0xB8B802F9,
+  0xB7B702F3,
+  0xB6B602EB,
+  0xB5B502E2,
+  0xB4B402DA,
+  0xB3B302D2,
+  0xB2B202C7,
+  0xB1B102BF,
+  0xB0B002B6,
+  0xAFAF02B0,
+  0xAEAE02A2,
+  0xADAD029A,
+  0xACAC028F,
+  0xABAB0287,
+  0xAAAA027C,
+  0xA9A90274,
+  0xA8A80269,
+  0xA7A70260,
+  0xA6A60254,
+  0xA5A5024C,
+  0xA4A40246,
+  0xA3A30241,
+  0xA2A2023A,
+  0xA1A10233,
+  0xA0A0022B,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF0439,
+  0xBEBE0432,
+  0xBDBD0427,
+  0xBCBC0420,
+  0xB8BB00CC,
+  0xB4B600CC,
+  0xB3B30418,
+  0xB2B20411,
+  0xB1B1040B,
+  0xB0B00406,
+  0xAFAF0401,
+  0xAEAE03FB,
+  0xADAD03F5,
+  0xACAC03F0,
+  0xAAAA03E9,
+  0xA9A903E4,
+  0xA8A803DE,
+  0xA7A703D8,
+  0xA6A603D2,
+  0xA5A503CC,
+  0xA4A403C7,
+  0xA3A303C2,
+  0xA2A203BA,
+  0xA1A103B5,
+  0xA0A003AF,
+  0x9F9F03A8,
+  0x9E9E03A3,
+  0x9D9D039C,
+  0x9C9C0396,
+  0x9B9B0390,
+  0x9A9A038A,
+  0x99990384,
+  0x9090037F,
+  0x8F8F0379,
+  0x8E8E0373,
+  0x8D8D036E,
+  0x8C8C0367,
+  0x8B8B035F,
+  0x8A8A0356,
+  0x8989034C,
+  0x849800CC,
+  0x83830343,
+  0x8282033B,
+  0x81810330,
+  0x8080032A,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB8B80496,
+  0xB7B7048E,
+  0xB6B60485,
+  0xB5B5047F,
+  0xB4B40477,
+  0xB3B30470,
+  0xB0B200CC,
+  0x8686046B,
+  0x85850465,
+  0x84840456,
+  0x82820451,
+  0x81810449,
+  0x80800444,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x90BF00CC,
+  0x878704BB,
+  0x868604B5,
+  0x858500CC,
+  0x848404AF,
+  0x838304A9,
+  0x828204A2,
+  0x8181037F,
+  0x8080049B,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB8BF00CC,
+  0x80B600CC,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80BF00CC,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAFAF054F,
+  0xADAD0548,
+  0xACAC053E,
+  0xABAB0535,
+  0xAAAA052D,
+  0xA9A90523,
+  0xA8A8051E,
+  0xA7A70517,
+  0xA6A60512,
+  0xA5A5050C,
+  0xA4A40506,
+  0xA3A304FE,
+  0xA2A204F9,
+  0xA1A103A3,
+  0xA0A004F1,
+  0x9F9F04E8,
+  0x9E9E04E2,
+  0x9C9C04DC,
+  0x9B9B0401,
+  0x9A9A04D6,
+  0x999904D0,
+  0x989804CA,
+  0x939304C5,
+  0x929204C0,
+  0x80BF00CC,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9F9F055B,
+  0x9E9E0555,
+  0x809D00CC,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF05C1,
+  0xBEBE05BC,
+  0xBDBD05B6,
+  0xBCBC05AF,
+  0xBBBB05AA,
+  0xB9B905A3,
+  0xB8B8059E,
+  0xB7B70598,
+  0xB6B60592,
+  0xB5B5058D,
+  0xB4B40588,
+  0xAFAF0583,
+  0xAEAE057E,
+  0xADAD0577,
+  0xACAC056C,
+  0xABAB0567,
+  0xA9A90561,
+  0xA4BA00CC,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB1B106AA,
+  0xAFAF06A4,
+  0xAEAE069E,
+  0xACAC0698,
+  0xABAB0691,
+  0xAAAA068B,
+  0xA0B001B5,
+  0x9F9F0686,
+  0x9E9E0677,
+  0x9D9D0666,
+  0x9B9B065B,
+  0x9A9A0656,
+  0x9898064E,
+  0x979701B5,
+  0x9696063D,
+  0x94940637,
+  0x93930631,
+  0x92920627,
+  0x919105F7,
+  0x909005C9,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xF4F406FB,
+  0xF1F306F6,
+  0xF0F006F1,
+  0xEDED06EC,
+  0xE1EF06E7,
+  0xE0E006E2,
+  0xC2DF06DD,
+  0x80FF0014,
+  0x292906B0,
+  0x0B7F020C,
+  0x0AFFFFFF,
+  0x0009020C,
+  0xF4F4072A,
+  0xF1F30725,
+  0xF0F00720,
+  0xEDED071B,
+  0xE1EF0716,
+  0xE0E00711,
+  0xC2DF070C,
+  0x80FF0014,
+  0x29290014,
+  0x0B7F0700,
+  0x0AFFFFFF,
+  0x00090700,
+  0x3D3D000C,
+  0x28280218,
+  0x20200224,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x09090224,
+  0x00080014,
+  0xA8A80095,
+  0xA4A40095,
+  0x9A9A0095,
+  0x80950095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF0095,
+  0xA0AA0095,
+  0x80980095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0BF0095,
+  0x898E0095,
+  0x80870095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80890095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBDBD0095,
+  0x84B90095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB1BF0095,
+  0xA6AF0095,
+  0x98A10095,
+  0x90900095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBDBD0095,
+  0xB6B90095,
+  0xB2B20095,
+  0xAAB00095,
+  0x93A80095,
+  0x8F900095,
+  0x858C0095,
+  0x80800095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBCBC0095,
+  0xA6B10095,
+  0x9FA10095,
+  0x9C9D0095,
+  0x8E8E0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB8B90095,
+  0xB5B60095,
+  0xB2B30095,
+  0xAAB00095,
+  0x93A80095,
+  0x8F900095,
+  0x858A0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB2B40095,
+  0xA6AF0095,
+  0x9E9E0095,
+  0x999C0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBDBD0095,
+  0xB5B90095,
+  0xB2B30095,
+  0xAAB00095,
+  0x93A80095,
+  0x8F910095,
+  0x858D0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB9B90095,
+  0xA6AF0095,
+  0xA0A10095,
+  0x90900095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBDBD0095,
+  0xB5B90095,
+  0xB2B30095,
+  0xAAB00095,
+  0x93A80095,
+  0x8F900095,
+  0x858C0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB1B10095,
+  0xA6AF0095,
+  0x9FA10095,
+  0x9C9D0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAEB90095,
+  0xA8AA0095,
+  0xA3A40095,
+  0x9E9F0095,
+  0x9C9C0095,
+  0x999A0095,
+  0x92950095,
+  0x8E900095,
+  0x858A0095,
+  0x83830095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA6AF0095,
+  0x90900095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBDBD0095,
+  0xAAB90095,
+  0x92A80095,
+  0x8E900095,
+  0x858C0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA6AF0095,
+  0xA0A10095,
+  0x9D9D0095,
+  0x989A0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBDBD0095,
+  0xB5B90095,
+  0xAAB30095,
+  0x92A80095,
+  0x8E900095,
+  0x858C0095,
+  0x80800095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB1B20095,
+  0xA6AF0095,
+  0xA0A10095,
+  0x9D9E0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBDBD0095,
+  0x92BA0095,
+  0x8E900095,
+  0x848C0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBABF0095,
+  0xA6AF0095,
+  0x9FA10095,
+  0x94960095,
+  0x8E8E0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBDBD0095,
+  0xB3BB0095,
+  0x9AB10095,
+  0x85960095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA6AF0095,
+  0x80860095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB2B30095,
+  0x81B00095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x90990095,
+  0x80860095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBDBD0095,
+  0xB2B30095,
+  0xA7B00095,
+  0xA5A50095,
+  0x8CA30095,
+  0x868A0095,
+  0x84840095,
+  0x81820095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9C9F0095,
+  0x90990095,
+  0x86860095,
+  0x80840095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0A90095,
+  0x80800095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x89AC0095,
+  0x80870095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x888C0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF0095,
+  0x80AA0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB5BF0095,
+  0xAEB00095,
+  0xA5A60095,
+  0xA1A10095,
+  0x9A9D0095,
+  0x90950095,
+  0x80890095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0BF0095,
+  0x90990095,
+  0x8E8E0095,
+  0x80810095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBCBF0095,
+  0x90BA0095,
+  0x8D8D0095,
+  0x87870095,
+  0x80850095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0BF0095,
+  0x9A9D0095,
+  0x98980095,
+  0x90960095,
+  0x8A8D0095,
+  0x80880095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB8BE0095,
+  0xB2B50095,
+  0x90B00095,
+  0x8A8D0095,
+  0x80880095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x98BF0095,
+  0x88960095,
+  0x82850095,
+  0x80800095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x98BF0095,
+  0x92950095,
+  0x80900095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x809A0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0BF0095,
+  0x808F0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB8BD0095,
+  0x80B50095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x81BF0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAFBF0095,
+  0x80AC0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0BF0095,
+  0x819A0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB1B80095,
+  0x80AA0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9FB10095,
+  0x80910095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAEB00095,
+  0xA0AC0095,
+  0x80910095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80B30095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0A90095,
+  0x9C9C0095,
+  0x97970095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0BF0095,
+  0x90990095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80B80095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF0095,
+  0xAAAA0095,
+  0x87A80095,
+  0x80840095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80B50095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x809E0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0B40095,
+  0x86AD0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF0095,
+  0x80AB0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x90990095,
+  0x80890095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0BF0095,
+  0x80960095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80940095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA7A70095,
+  0x90990095,
+  0x80890095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x85B30095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x90990095,
+  0x858C0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAEBF0095,
+  0x83A00095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80A50095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80A30095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x8DBD0095,
+  0x80890095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBDBF0095,
+  0x90BA0095,
+  0x80880095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBABA0095,
+  0xB5B60095,
+  0xAEB30095,
+  0xA9AC0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0BF0095,
+  0x989D0095,
+  0x80950095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9FBD0095,
+  0x9D9D0095,
+  0x9B9B0095,
+  0x99990095,
+  0x90970095,
+  0x888D0095,
+  0x80850095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBE0095,
+  0xB6BC0095,
+  0x80B40095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB6BC0095,
+  0xB2B40095,
+  0xA0AC0095,
+  0x969B0095,
+  0x90930095,
+  0x868C0095,
+  0x82840095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF0095,
+  0xB1B10095,
+  0x94940095,
+  0x80800095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x909C0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBCBF0095,
+  0xAFB90095,
+  0xAAAD0095,
+  0xA8A80095,
+  0xA6A60095,
+  0xA4A40095,
+  0x999D0095,
+  0x95950095,
+  0x8A930095,
+  0x87870095,
+  0x82820095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x8E8E0095,
+  0x85890095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x83840095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB2B30095,
+  0xABAE0095,
+  0x80A40095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF0095,
+  0xADAD0095,
+  0xA7A70095,
+  0x80A50095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAFAF0095,
+  0x80A70095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB8BE0095,
+  0xB0B60095,
+  0xA8AE0095,
+  0xA0A60095,
+  0x80960095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x989E0095,
+  0x90960095,
+  0x888E0095,
+  0x80860095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAFAF0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBBBC0095,
+  0xB1B50095,
+  0x85860095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA1BF0095,
+  0x9D9F0095,
+  0x80960095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBCBF0095,
+  0x80BA0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB1BF0095,
+  0x85AF0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0BF0095,
+  0x808E0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x808C0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x90BD0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x90AB0095,
+  0x808C0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF0095,
+  0x80AE0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0BF0095,
+  0x809D0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA2BF0095,
+  0x979F0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x8BBF0095,
+  0x80880095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB2BF0095,
+  0x95990095,
+  0x93930095,
+  0x90910095,
+  0x808A0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x8CA20095,
+  0x878A0095,
+  0x83850095,
+  0x80810095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x82B30095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBDBE0095,
+  0xBBBB0095,
+  0xB2B70095,
+  0x90990095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF0095,
+  0x80A50095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0BC0095,
+  0x80860095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x84B20095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA6BE0095,
+  0xA0A40095,
+  0x8F990095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80A80095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBF0095,
+  0xBABA0095,
+  0xA0B60095,
+  0x90990095,
+  0x848B0095,
+  0x80820095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB9BD0095,
+  0xB5B60095,
+  0xB1B10095,
+  0x80AF0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB2B40095,
+  0xA0AA0095,
+  0x9B9D0095,
+  0x82820095,
+  0x80800095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF0095,
+  0xA8AE0095,
+  0xA0A60095,
+  0x91960095,
+  0x898E0095,
+  0x81860095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF0095,
+  0x9CA90095,
+  0x809A0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0B90095,
+  0x80A20095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF0095,
+  0x80A30095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x8BBB0095,
+  0x80860095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF0095,
+  0x80AD0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80990095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBE0095,
+  0xB8BC0095,
+  0xAAB60095,
+  0x9FA80095,
+  0x9D9D0095,
+  0x93970095,
+  0x80860095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x86BF0095,
+  0x83840095,
+  0x80810095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80B10095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x93BF0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80BD0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x90BF0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x92BF0095,
+  0x808F0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BB0095,
+  0x80870095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB3B40095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB6BF0095,
+  0xB0B40095,
+  0x8D8F0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80BC0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF0095,
+  0xA1BA0095,
+  0x90990095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA6BF0095,
+  0x819A0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80BE0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9A9C0095,
+  0x92970095,
+  0x8A8F0095,
+  0x82870095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF0801,
+  0xBEBE07FB,
+  0xBDBD07F5,
+  0xBCBC07EE,
+  0xBABA07E8,
+  0xB4B407E2,
+  0xB2B307DD,
+  0xB1B10104,
+  0xB0B000CC,
+  0xAEAE07D8,
+  0xADAD07D2,
+  0xACAC03C2,
+  0xABAB07CC,
+  0xAAAA07C7,
+  0xA9A907C2,
+  0xA8A807BA,
+  0xA6A607B4,
+  0xA4A407AE,
+  0xA3A307A8,
+  0xA2A203C7,
+  0xA1A107A2,
+  0xA0A00798,
+  0x9E9E0791,
+  0x9D9D078B,
+  0x9C9C0786,
+  0x989B00CC,
+  0x9696077B,
+  0x95950774,
+  0x9494076E,
+  0x93930768,
+  0x92920761,
+  0x909100CC,
+  0x8F8F075B,
+  0x8E8E04D6,
+  0x8D8D0754,
+  0x8C8C074E,
+  0x8B8B0749,
+  0x8A8A0743,
+  0x8383073E,
+  0x828200CC,
+  0x81810738,
+  0x8080072F,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBE08F7,
+  0xBBBB08F2,
+  0xB6B608EB,
+  0xB5B508E2,
+  0xB4B408DB,
+  0xB2B208D6,
+  0xB1B108CF,
+  0xB0B008C9,
+  0xABAB03B5,
+  0xAAAA08C2,
+  0xA9A908BC,
+  0xA8A808B5,
+  0xA7A708AE,
+  0xA6A608A8,
+  0xA5A508A2,
+  0xA4A40898,
+  0xA3A30892,
+  0xA2A2010F,
+  0xA0A0088D,
+  0x9D9D0888,
+  0x9C9C0882,
+  0x9B9B0241,
+  0x9A9A087C,
+  0x99990876,
+  0x98980860,
+  0x97970871,
+  0x9696086C,
+  0x93930865,
+  0x92920860,
+  0x91910859,
+  0x90900854,
+  0x8D8D084E,
+  0x8C8C028F,
+  0x8B8B0848,
+  0x8A8A083E,
+  0x88880838,
+  0x87870831,
+  0x8686082C,
+  0x85850824,
+  0x8484081E,
+  0x83830818,
+  0x82820813,
+  0x8181080C,
+  0x80800807,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF0901,
+  0xBEBE058D,
+  0x959508FC,
+  0x929400CC,
+  0x8E8E0567,
+  0x808D00CC,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9090086C,
+  0x808F00CC,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x99990888,
+  0x909800CC,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF0926,
+  0xBEBE0921,
+  0xBDBD091B,
+  0xBCBC00CC,
+  0xB9B900CC,
+  0xAEAE08D6,
+  0xADAD0913,
+  0xACAC0860,
+  0xABAB090D,
+  0xAAAA05BC,
+  0xA9A90906,
+  0xA8A803B5,
+  0xA0A700CC,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB4B40104,
+  0xB3B30931,
+  0x9F9F092C,
+  0x80B200CC,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF0936,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB2B20954,
+  0xB1B1094E,
+  0xB0B000CC,
+  0x8B8B0949,
+  0x85850942,
+  0x8484093D,
+  0x808A00CC,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBCBC03C7,
+  0x9F9F09A7,
+  0x9E9E09A0,
+  0x9D9D0999,
+  0x9C9C0992,
+  0x9B9B098A,
+  0x9A9A0984,
+  0x9595097C,
+  0x94940972,
+  0x9393096C,
+  0x92920960,
+  0x9191095A,
+  0x909900CC,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBABA09FD,
+  0xB9B909E6,
+  0xB8B809D9,
+  0xA5A509D2,
+  0xA3A309CD,
+  0xA0A400CC,
+  0x9F9F09C5,
+  0x8B8B09BF,
+  0x8A8A09BA,
+  0x858509B4,
+  0x848409AE,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAFAF0A06,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9B9B0A0B,
+  0x80BF00CC,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0A004D6,
+  0x9C9C03B5,
+  0x80BF00CC,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBABA0A10,
+  0x80BF00CC,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAFAF0A16,
+  0x80AE00CC,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA8A80A1B,
+  0xA0A700CC,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x8D8D0A20,
+  0x808C00CC,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x08000A57,
+  0xF4F40BD0,
+  0xF1F30BCB,
+  0xF0F00BB2,
+  0xEFEF0B9C,
+  0xEEEE0B97,
+  0xEDED0B91,
+  0xEAEA0B75,
+  0xE4E40B70,
+  0xE3E30B64,
+  0xE2E20B52,
+  0xE1E10B22,
+  0xE0E00AFE,
+  0xDFDF0AF7,
+  0xDEDE0AF1,
+  0xDDDD0AEC,
+  0xDCDC0AE5,
+  0xDBDB0ADD,
+  0xD9D90AD6,
+  0xD8D80AD1,
+  0xD7D70ACA,
+  0xD6D60AC5,
+  0xD5D50ABF,
+  0xD4D40ABA,
+  0xD2D20AB5,
+  0xCFCF0AB0,
+  0xCECE0AA7,
+  0xCDCD0A9F,
+  0xCCCC0A9A,
+  0xCBCB0A91,
+  0xC3C30A8B,
+  0xC2C20A83,
+  0x80FF0014,
+  0x7B7B0A53,
+  0x617A0014,
+  0x5F5F0014,
+  0x415A0014,
+  0x3D3D0A25,
+  0x3B3B0014,
+  0x30390014,
+  0x202006B0,
+  0x0B7F0A59,
+  0x0AFFFFFF,
+  0x090906B0,
+  0x00080A59,
+  0x80BF020C,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0BF06DD,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80BF06DD,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x809F06DD,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x90BF06E7,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80BF06E7,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x808F06E7,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xF4F4072A,
+  0xF1F30725,
+  0xF0F00720,
+  0xEDED071B,
+  0xE1EF0716,
+  0xE0E00711,
+  0xC2DF070C,
+  0x80FF0014,
+  0x29290BD5,
+  0x0B7F0700,
+  0x0AFFFFFF,
+  0x00090700,
+  0x80BF0700,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0BF070C,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80BF070C,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x809F070C,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x90BF0716,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80BF0716,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x808F0716,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF0095,
+  0xBCBD0095,
+  0xA8BA0095,
+  0x8DA60095,
+  0x808B0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x909D0095,
+  0x808D0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80BA0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0BF0095,
+  0x809C0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80900095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xADBF0095,
+  0x809F0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x90B50095,
+  0x82890095,
+  0x80800095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x888F0095,
+  0x80830095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF0095,
+  0xA0A90095,
+  0x809D0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x98BB0095,
+  0x80930095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF0095,
+  0x80A70095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBCBF0095,
+  0xB0BA0095,
+  0x80A30095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBBBC0095,
+  0xB3B90095,
+  0xA3B10095,
+  0x97A10095,
+  0x94950095,
+  0x8C920095,
+  0x808A0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80B60095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0A70095,
+  0x80950095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB2BA0095,
+  0x87B00095,
+  0x80850095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF0095,
+  0xBCBC0095,
+  0xB7B80095,
+  0x8AB50095,
+  0x88880095,
+  0x80850095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0B60095,
+  0x80950095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB4B50095,
+  0xA0B20095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0B90095,
+  0x80950095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBF0095,
+  0x80B70095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x99B50095,
+  0x95970095,
+  0x90930095,
+  0x80800095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0BC0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x809C0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x89A40095,
+  0x80870095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0B20095,
+  0x80950095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80910095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80B20095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0B90095,
+  0x80A30095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0B10095,
+  0x80A90095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF0095,
+  0xA7A70095,
+  0x809C0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF0095,
+  0x80850095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF0095,
+  0x80810095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0B60095,
+  0x80840095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x83B70095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB5B50095,
+  0xB1B20095,
+  0xA6AF0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x83AF0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0B90095,
+  0x90A80095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB6BF0095,
+  0x83A60095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB6B60095,
+  0x90B20095,
+  0x87870095,
+  0x84840095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x83B20095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9C9C0095,
+  0x909A0095,
+  0x81840095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x93AB0095,
+  0x80910095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF0095,
+  0x9FA80095,
+  0x8F9D0095,
+  0x8A8D0095,
+  0x88880095,
+  0x80860095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0B90095,
+  0x809E0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9DA10095,
+  0x90900095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80B40095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9FA10095,
+  0x90990095,
+  0x878A0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80AF0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x90990095,
+  0x87870095,
+  0x84850095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80AE0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x989B0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x90990095,
+  0x84840095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB8B80095,
+  0x80AA0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0B90095,
+  0x809A0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80860095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80AB0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF0095,
+  0x80A90095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF0095,
+  0x98AF0095,
+  0x95960095,
+  0x8C930095,
+  0x89890095,
+  0x80860095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x90990095,
+  0x81810095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAABF0095,
+  0xA0A70095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA3A30095,
+  0xA1A10095,
+  0x80900095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBABA0095,
+  0x8BB20095,
+  0x80800095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9CBF0095,
+  0x90900095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF0095,
+  0x9D9D0095,
+  0x80890095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x8AAE0095,
+  0x80880095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB2BF0095,
+  0x90990095,
+  0x80800095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x808F0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x8BB00095,
+  0x88890095,
+  0x80860095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAABF0095,
+  0xA7A80095,
+  0xA0A50095,
+  0x90990095,
+  0x86860095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0A90095,
+  0x98980095,
+  0x80890095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0B20095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0B00095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80830095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80B00095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF0095,
+  0xA0A90095,
+  0x809E0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x90AD0095,
+  0x80890095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBDBF0095,
+  0xA3B70095,
+  0x90990095,
+  0x80830095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x90900095,
+  0x808A0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x939F0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA3A30095,
+  0xA0A10095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80B70095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80950095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBDBE0095,
+  0xB5BB0095,
+  0xB0B30095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80A20095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF0095,
+  0xA4A70095,
+  0x90920095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80BB0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BC0095,
+  0x80AA0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x90990095,
+  0x80880095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x96BF0095,
+  0x80940095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBDBF0095,
+  0xBBBB0095,
+  0xAEB90095,
+  0xA9AC0095,
+  0xA5A60095,
+  0xA2A20095,
+  0x9E9F0095,
+  0x809C0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x85BF0095,
+  0x80830095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBBBE0095,
+  0x9EB90095,
+  0x969C0095,
+  0x8D940095,
+  0x878A0095,
+  0x80850095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x92BF0095,
+  0x8A900095,
+  0x86860095,
+  0x80840095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA8BF0095,
+  0x80A50095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBCBF0095,
+  0x9CBA0095,
+  0x829A0095,
+  0x80800095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB6BF0095,
+  0x96B40095,
+  0x80940095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF0095,
+  0x90AE0095,
+  0x808E0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAABF0095,
+  0x8AA80095,
+  0x80880095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x8EBF0095,
+  0x848B0095,
+  0x80820095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB7BD0095,
+  0x80AC0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x8E8E0095,
+  0x80890095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x90AD0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0B90095,
+  0x80AB0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BE0095,
+  0xADAE0095,
+  0xA8AB0095,
+  0xA0A60095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80840095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x90990095,
+  0x8B8B0095,
+  0x80830095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBBBB0095,
+  0xB9B90095,
+  0xB4B70095,
+  0xA9B20095,
+  0xA7A70095,
+  0xA4A40095,
+  0xA1A20095,
+  0x859F0095,
+  0x80830095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBE0095,
+  0xB9BC0095,
+  0xB4B70095,
+  0xACB20095,
+  0xA7AA0095,
+  0xA4A40095,
+  0xA1A20095,
+  0x9F9F0095,
+  0x9D9D0095,
+  0x9B9B0095,
+  0x99990095,
+  0x97970095,
+  0x94940095,
+  0x91920095,
+  0x8D8F0095,
+  0x8B8B0095,
+  0x89890095,
+  0x87870095,
+  0x82820095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xABBB0095,
+  0xA5A90095,
+  0xA1A30095,
+  0x8B9B0095,
+  0x80890095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0B90095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x809F0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF0095,
+  0x80A10095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80A00095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x809D0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x808A0095,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x08000A57,
+  0xF4F40BD0,
+  0xF1F30BCB,
+  0xF0F00BB2,
+  0xEFEF0B9C,
+  0xEEEE0B97,
+  0xEDED0B91,
+  0xEAEA0B75,
+  0xE4E40B70,
+  0xE3E30B64,
+  0xE2E20B52,
+  0xE1E10B22,
+  0xE0E00AFE,
+  0xDFDF0AF7,
+  0xDEDE0AF1,
+  0xDDDD0AEC,
+  0xDCDC0AE5,
+  0xDBDB0ADD,
+  0xD9D90AD6,
+  0xD8D80AD1,
+  0xD7D70ACA,
+  0xD6D60AC5,
+  0xD5D50ABF,
+  0xD4D40ABA,
+  0xD2D20AB5,
+  0xCFCF0AB0,
+  0xCECE0AA7,
+  0xCDCD0A9F,
+  0xCCCC0A9A,
+  0xCBCB0A91,
+  0xC3C30A8B,
+  0xC2C20A83,
+  0x80FF0014,
+  0x6666001D,
+  0x617B0014,
+  0x5F5F0014,
+  0x415A0014,
+  0x3D3D0A25,
+  0x3B3B0014,
+  0x30390014,
+  0x28280C02,
+  0x20200A25,
+  0x0B7F0A59,
+  0x0AFFFFFF,
+  0x09090A25,
+  0x00080A59,
+  0x08000A57,
+  0x0BFF0A53,
+  0x0AFFFFFF,
+  0x00090A53,
+  0x07000C2F,
+  0x00FFFFFF,
+  0x08000A57,
+  0xF4F40BD0,
+  0xF1F30BCB,
+  0xF0F00BB2,
+  0xEFEF0B9C,
+  0xEEEE0B97,
+  0xEDED0B91,
+  0xEAEA0B75,
+  0xE4E40B70,
+  0xE3E30B64,
+  0xE2E20B52,
+  0xE1E10B22,
+  0xE0E00AFE,
+  0xDFDF0AF7,
+  0xDEDE0AF1,
+  0xDDDD0AEC,
+  0xDCDC0AE5,
+  0xDBDB0ADD,
+  0xD9D90AD6,
+  0xD8D80AD1,
+  0xD7D70ACA,
+  0xD6D60AC5,
+  0xD5D50ABF,
+  0xD4D40ABA,
+  0xD2D20AB5,
+  0xCFCF0AB0,
+  0xCECE0AA7,
+  0xCDCD0A9F,
+  0xCCCC0A9A,
+  0xCBCB0A91,
+  0xC3C30A8B,
+  0xC2C20A83,
+  0x80FF0014,
+  0x617B0014,
+  0x5F5F0014,
+  0x415A0014,
+  0x3D3D0A25,
+  0x3B3B0014,
+  0x30390014,
+  0x0B7F0A59,
+  0x0AFFFFFF,
+  0x00090A59,
+  0xBBBF0A59,
+  0xB6B90A59,
+  0xABB40A59,
+  0x80A90A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB7B70A59,
+  0x97970A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAFBF0A59,
+  0xADAD0A59,
+  0xA5AB0A59,
+  0x929F0A59,
+  0x82850A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80BF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBE0A59,
+  0xB8B90A59,
+  0xB5B50A59,
+  0x80AF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA2A20A59,
+  0x8D8D0A59,
+  0x8B8B0A59,
+  0x87870A59,
+  0x80850A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB6B60A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x82890A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0B00A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9A9F0A59,
+  0x97980A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x89BF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB3BF0A59,
+  0xABAE0A59,
+  0x808F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x809F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0B00A59,
+  0xAAAD0A59,
+  0x8B9F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBDBE0A59,
+  0xA7AD0A59,
+  0x96A40A59,
+  0x94940A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF0A59,
+  0x91910A59,
+  0x808F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x808C0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB2BF0A59,
+  0xA6B00A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBBBF0A59,
+  0xB6B90A59,
+  0xABB30A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF0A9A,
+  0xBEBE0D3A,
+  0xBDBD0D34,
+  0xBCBC0D2E,
+  0xBBBB0D26,
+  0xBABA0D19,
+  0xB9B90D13,
+  0xB8B80D0C,
+  0xB7B70D06,
+  0xB6B60CFD,
+  0xB5B50CF4,
+  0xB4B40CEB,
+  0xB3B30CE2,
+  0xB2B20CD7,
+  0xB1B10CCE,
+  0xB0B00CC4,
+  0xAFAF0CBD,
+  0xAEAE0CAE,
+  0xADAD0CA5,
+  0xACAC0C99,
+  0xABAB0C90,
+  0xAAAA0C84,
+  0xA9A90C7B,
+  0xA8A80C6F,
+  0xA7A70C65,
+  0xA6A60C59,
+  0xA5A50C51,
+  0xA4A40C4A,
+  0xA3A30C45,
+  0xA2A20C3F,
+  0xA1A10C39,
+  0xA0A00C31,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF0E46,
+  0xBEBE0E3F,
+  0xBDBD0E34,
+  0xBCBC0E2E,
+  0xB7B70A9A,
+  0xB3B30E25,
+  0xB2B20E1F,
+  0xB1B10E19,
+  0xB0B00E14,
+  0xAFAF0E0F,
+  0xAEAE0E09,
+  0xADAD0E02,
+  0xACAC0DFC,
+  0xABAB0A9A,
+  0xAAAA0DF5,
+  0xA9A90DF0,
+  0xA8A80DEB,
+  0xA7A70DE5,
+  0xA6A60DE0,
+  0xA5A50DD9,
+  0xA4A40DD4,
+  0xA3A30DCF,
+  0xA2A20DC8,
+  0xA1A10DC3,
+  0xA0A00DBD,
+  0x9F9F0DB5,
+  0x9E9E0DB0,
+  0x9D9D0DA9,
+  0x9C9C0DA3,
+  0x9B9B0D9D,
+  0x9A9A0D97,
+  0x99990D92,
+  0x90900D8D,
+  0x8F8F0D87,
+  0x8E8E0D82,
+  0x8D8D0D7D,
+  0x8C8C0D77,
+  0x8B8B0D70,
+  0x8A8A0D67,
+  0x89890D5E,
+  0x83830D56,
+  0x82820D4F,
+  0x81810D45,
+  0x80800D40,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB9BF0A9A,
+  0xB8B80EA5,
+  0xB7B70E9D,
+  0xB6B60E94,
+  0xB5B50E8E,
+  0xB4B40E87,
+  0xB3B30E80,
+  0x86860E7A,
+  0x85850E73,
+  0x84840E64,
+  0x83AF0A9A,
+  0x82820E5E,
+  0x81810E57,
+  0x80800E52,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x888F0A9A,
+  0x87870EC9,
+  0x86860EC4,
+  0x84840EBE,
+  0x83830EB9,
+  0x82820EB3,
+  0x81810D8D,
+  0x80800EAB,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB7B70A9A,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAFAF0F5B,
+  0xADAD0F55,
+  0xACAC0F4B,
+  0xABAB0F42,
+  0xAAAA0F3A,
+  0xA9A90F31,
+  0xA8A80F2C,
+  0xA7A70F24,
+  0xA6A60F1E,
+  0xA5A50F18,
+  0xA4A40F13,
+  0xA3A30F0A,
+  0xA2A20F04,
+  0xA1A10DB0,
+  0xA0A00EFC,
+  0x9F9F0EF4,
+  0x9E9E0EEF,
+  0x9C9C0EE9,
+  0x9B9B0E0F,
+  0x9A9A0EE4,
+  0x99990EDF,
+  0x98980ED9,
+  0x93930ED3,
+  0x92920ECE,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9F9F0F66,
+  0x9E9E0F61,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80BF0A9A,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF0FCA,
+  0xBEBE0FC5,
+  0xBDBD0FBF,
+  0xBCBC0FB8,
+  0xBBBB0FB3,
+  0xB9B90FAC,
+  0xB8B80FA6,
+  0xB7B70FA0,
+  0xB6B60F9B,
+  0xB5B50F96,
+  0xB4B40F91,
+  0xAFAF0F8C,
+  0xAEAE0F87,
+  0xADAD0F81,
+  0xACAC0F76,
+  0xABAB0F71,
+  0xA9A90F6C,
+  0x80A30A9A,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB2BF0B97,
+  0xB1B110B8,
+  0xAFAF10B1,
+  0xAEAE10AB,
+  0xACAC10A6,
+  0xABAB10A0,
+  0xAAAA109B,
+  0x9F9F1095,
+  0x9E9E1085,
+  0x9D9D1073,
+  0x9B9B1068,
+  0x9A9A1062,
+  0x999C0B97,
+  0x9898105A,
+  0x96961049,
+  0x95950B97,
+  0x94941042,
+  0x9393103C,
+  0x92921032,
+  0x91911001,
+  0x90900FD3,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80BF0B97,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x808F0B97,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x080010C2,
+  0xF4F41269,
+  0xF1F31264,
+  0xF0F0124B,
+  0xEFEF1235,
+  0xEEEE1230,
+  0xEDED122A,
+  0xEAEA120E,
+  0xE4E41209,
+  0xE3E311FD,
+  0xE2E211EB,
+  0xE1E111BB,
+  0xE0E01197,
+  0xDFDF1190,
+  0xDEDE118A,
+  0xDDDD1185,
+  0xDCDC117E,
+  0xDBDB1176,
+  0xD9D9116F,
+  0xD8D8116A,
+  0xD7D71163,
+  0xD6D6115E,
+  0xD5D51158,
+  0xD4D41153,
+  0xD2D2114E,
+  0xCFCF1149,
+  0xCECE1140,
+  0xCDCD1138,
+  0xCCCC1133,
+  0xCBCB112A,
+  0xC3C31124,
+  0xC2C2111C,
+  0x80FF0014,
+  0x7B7B10BE,
+  0x617A0014,
+  0x5F5F0014,
+  0x415A0014,
+  0x3D3D10C4,
+  0x3B3B0014,
+  0x30390014,
+  0x20200BD5,
+  0x0B7F10F2,
+  0x0AFFFFFF,
+  0x09090BD5,
+  0x000810F2,
+  0x08000A57,
+  0xF4F40BD0,
+  0xF1F30BCB,
+  0xF0F00BB2,
+  0xEFEF0B9C,
+  0xEEEE0B97,
+  0xEDED0B91,
+  0xEAEA0B75,
+  0xE4E40B70,
+  0xE3E30B64,
+  0xE2E20B52,
+  0xE1E10B22,
+  0xE0E00AFE,
+  0xDFDF0AF7,
+  0xDEDE0AF1,
+  0xDDDD0AEC,
+  0xDCDC0AE5,
+  0xDBDB0ADD,
+  0xD9D90AD6,
+  0xD8D80AD1,
+  0xD7D70ACA,
+  0xD6D60AC5,
+  0xD5D50ABF,
+  0xD4D40ABA,
+  0xD2D20AB5,
+  0xCFCF0AB0,
+  0xCECE0AA7,
+  0xCDCD0A9F,
+  0xCCCC0A9A,
+  0xCBCB0A91,
+  0xC3C30A8B,
+  0xC2C20A83,
+  0x80FF0014,
+  0x6666001D,
+  0x617B0014,
+  0x5F5F0014,
+  0x415A0014,
+  0x3D3D0A25,
+  0x3B3B0014,
+  0x30390014,
+  0x20200C02,
+  0x0B7F0A59,
+  0x0AFFFFFF,
+  0x09090C02,
+  0x00080A59,
+  0xFE000002,
+  0x00FFFFFF,
+  0xA9BF0A59,
+  0xA5A70A59,
+  0x9BA30A59,
+  0x96990A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xABAF0A59,
+  0x999F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x8F9F0A59,
+  0x88880A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x8ABF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBF0A59,
+  0xBABC0A59,
+  0x80830A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0B00A59,
+  0xA2A50A59,
+  0x91970A59,
+  0x808F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBF0A59,
+  0xBABC0A59,
+  0xB3B50A59,
+  0xB1B10A59,
+  0xA9A90A59,
+  0x91920A59,
+  0x8D8E0A59,
+  0x81840A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBDBF0A59,
+  0xB2BB0A59,
+  0xA2A50A59,
+  0x9E9E0A59,
+  0x8F9B0A59,
+  0x808D0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBABF0A59,
+  0xB7B70A59,
+  0xB4B40A59,
+  0xB1B10A59,
+  0xA9A90A59,
+  0x91920A59,
+  0x8B8E0A59,
+  0x80840A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB5BF0A59,
+  0xB0B10A59,
+  0x9FA50A59,
+  0x9D9D0A59,
+  0x80980A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBF0A59,
+  0xBABC0A59,
+  0xB4B40A59,
+  0xB1B10A59,
+  0xA9A90A59,
+  0x92920A59,
+  0x8E8E0A59,
+  0x80840A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBABF0A59,
+  0xB0B80A59,
+  0xA2A50A59,
+  0x919F0A59,
+  0x808F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBF0A59,
+  0xBABC0A59,
+  0xB4B40A59,
+  0xB1B10A59,
+  0xA9A90A59,
+  0x91920A59,
+  0x8D8E0A59,
+  0x80840A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB2BF0A59,
+  0xB0B00A59,
+  0xA2A50A59,
+  0x9E9E0A59,
+  0x809B0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBABF0A59,
+  0xABAD0A59,
+  0xA5A70A59,
+  0xA0A20A59,
+  0x9D9D0A59,
+  0x9B9B0A59,
+  0x96980A59,
+  0x91910A59,
+  0x8B8D0A59,
+  0x84840A59,
+  0x80820A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF0A59,
+  0x91A50A59,
+  0x808F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBF0A59,
+  0xBABC0A59,
+  0xA9A90A59,
+  0x91910A59,
+  0x8D8D0A59,
+  0x80840A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF0A59,
+  0xA2A50A59,
+  0x9E9F0A59,
+  0x9B9C0A59,
+  0x80970A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBF0A59,
+  0xBABC0A59,
+  0xB4B40A59,
+  0xA9A90A59,
+  0x91910A59,
+  0x8D8D0A59,
+  0x81840A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB3BF0A59,
+  0xB0B00A59,
+  0xA2A50A59,
+  0x9F9F0A59,
+  0x809C0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBF0A59,
+  0xBBBC0A59,
+  0x91910A59,
+  0x8D8D0A59,
+  0x80830A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0B90A59,
+  0xA2A50A59,
+  0x979E0A59,
+  0x8F930A59,
+  0x808D0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBF0A59,
+  0xBCBC0A59,
+  0xB2B20A59,
+  0x97990A59,
+  0x80840A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF0A59,
+  0x87A50A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB4BF0A59,
+  0xB1B10A59,
+  0x80800A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9ABF0A59,
+  0x878F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBF0A59,
+  0xB4BC0A59,
+  0xB1B10A59,
+  0xA6A60A59,
+  0xA4A40A59,
+  0x8B8B0A59,
+  0x85850A59,
+  0x83830A59,
+  0x80800A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0BF0A59,
+  0x9A9B0A59,
+  0x878F0A59,
+  0x85850A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAABF0A59,
+  0x819F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xADBF0A59,
+  0x88880A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x8DBF0A59,
+  0x80870A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xABBE0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB1B40A59,
+  0xA7AD0A59,
+  0xA2A40A59,
+  0x9EA00A59,
+  0x96990A59,
+  0x8A8F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9A9F0A59,
+  0x8F8F0A59,
+  0x828D0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBBBB0A59,
+  0x8E8F0A59,
+  0x888C0A59,
+  0x86860A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9E9F0A59,
+  0x99990A59,
+  0x97970A59,
+  0x8E8F0A59,
+  0x89890A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF0A59,
+  0xB6B70A59,
+  0xB1B10A59,
+  0x8E8F0A59,
+  0x89890A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x97970A59,
+  0x86870A59,
+  0x81810A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x96970A59,
+  0x91910A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9BBF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x909F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBF0A59,
+  0xB6B70A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80800A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xADAE0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9B9F0A59,
+  0x80800A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB9BF0A59,
+  0xABB00A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB2BF0A59,
+  0x929E0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB1BF0A59,
+  0xADAD0A59,
+  0x929F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB4BF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAABF0A59,
+  0x9D9F0A59,
+  0x989B0A59,
+  0x80960A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9A9F0A59,
+  0x808F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB9BF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xABAF0A59,
+  0xA9A90A59,
+  0x85860A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB6BF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9FBF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB5BF0A59,
+  0xAEAF0A59,
+  0x80850A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xACAF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9ABF0A59,
+  0x8A8F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x979F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x95BF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA8BF0A59,
+  0x9AA60A59,
+  0x8A8F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB4BF0A59,
+  0x80840A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9ABF0A59,
+  0x8D8F0A59,
+  0x80840A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA1AD0A59,
+  0x80820A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA6BF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA4BF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBF0A59,
+  0x8A8C0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBBBC0A59,
+  0x898F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBBBF0A59,
+  0xB7B90A59,
+  0xB4B40A59,
+  0xADAD0A59,
+  0x80A80A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9E9F0A59,
+  0x96970A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBF0A59,
+  0x9E9E0A59,
+  0x9C9C0A59,
+  0x9A9A0A59,
+  0x98980A59,
+  0x8E8F0A59,
+  0x86870A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF0A59,
+  0xBDBD0A59,
+  0xB5B50A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBDBF0A59,
+  0xB5B50A59,
+  0xADB10A59,
+  0x9C9F0A59,
+  0x94950A59,
+  0x8D8F0A59,
+  0x85850A59,
+  0x80810A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80BE0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB2BE0A59,
+  0x95B00A59,
+  0x81930A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9DBF0A59,
+  0x808F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBABB0A59,
+  0xAEAE0A59,
+  0xA9A90A59,
+  0xA7A70A59,
+  0xA5A50A59,
+  0x9EA30A59,
+  0x96980A59,
+  0x94940A59,
+  0x88890A59,
+  0x83860A59,
+  0x80810A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x8FBF0A59,
+  0x8A8D0A59,
+  0x80840A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x85BF0A59,
+  0x80820A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB4BF0A59,
+  0xAFB10A59,
+  0xA5AA0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAEAF0A59,
+  0xA8AC0A59,
+  0xA6A60A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF0A59,
+  0xA8AE0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF0A59,
+  0xB7B70A59,
+  0xAFAF0A59,
+  0xA7A70A59,
+  0x979F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9FBF0A59,
+  0x97970A59,
+  0x8F8F0A59,
+  0x87870A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF0A59,
+  0x80AE0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBDBF0A59,
+  0xB6BA0A59,
+  0x87B00A59,
+  0x80840A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0A00A59,
+  0x979C0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBBBB0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0B00A59,
+  0x80840A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x8F9F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80AF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x8DBF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBF0A59,
+  0x808F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xACBF0A59,
+  0x8D8F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAFBE0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9E9F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0A10A59,
+  0x80960A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x898A0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9AB10A59,
+  0x94940A59,
+  0x92920A59,
+  0x8B8F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA3BF0A59,
+  0x8B8B0A59,
+  0x86860A59,
+  0x82820A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB4BF0A59,
+  0x80810A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF0A59,
+  0xBCBC0A59,
+  0xB8BA0A59,
+  0x9AB10A59,
+  0x808F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA6AF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBDBF0A59,
+  0x879F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB3BF0A59,
+  0x80830A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF0A59,
+  0xA5A50A59,
+  0x9A9F0A59,
+  0x808E0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA9BF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBBBD0A59,
+  0xB7B90A59,
+  0x9A9F0A59,
+  0x8C8F0A59,
+  0x83830A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBF0A59,
+  0xB7B80A59,
+  0xB2B40A59,
+  0xB0B00A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB5BF0A59,
+  0xABB10A59,
+  0x9E9F0A59,
+  0x839A0A59,
+  0x81810A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAFAF0A59,
+  0xA7A70A59,
+  0x979F0A59,
+  0x8F900A59,
+  0x87880A59,
+  0x80800A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAAAF0A59,
+  0x9B9B0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBABF0A59,
+  0xA3AF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA4AF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBCBF0A59,
+  0x878A0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAEAF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9ABF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF0A59,
+  0xBDBD0A59,
+  0xB7B70A59,
+  0xA9A90A59,
+  0x9E9E0A59,
+  0x989C0A59,
+  0x87920A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x85850A59,
+  0x82820A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB2BF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80920A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x808F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x90910A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBCBF0A59,
+  0x88AF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB5BF0A59,
+  0x80B20A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB5B50A59,
+  0x90AF0A59,
+  0x808C0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBDBF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBBBE0A59,
+  0x9AA00A59,
+  0x808F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9BA50A59,
+  0x80800A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9DBF0A59,
+  0x98990A59,
+  0x90910A59,
+  0x88890A59,
+  0x80810A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF1337,
+  0xBEBE1332,
+  0xBDBD132D,
+  0xBCBC1327,
+  0xBABA1321,
+  0xB5BB0A9A,
+  0xB4B4131B,
+  0xB2B31316,
+  0xB1B10AC5,
+  0xAEAE1311,
+  0xADAD130B,
+  0xACAC0DCF,
+  0xABAB1305,
+  0xAAAA1300,
+  0xA9A912FA,
+  0xA8A812F2,
+  0xA6A612ED,
+  0xA4A412E7,
+  0xA3A312E0,
+  0xA2A20DD4,
+  0xA1A112DA,
+  0xA0A012D1,
+  0x9FAF0A9A,
+  0x9E9E12CA,
+  0x9D9D12C4,
+  0x9C9C12BF,
+  0x97970A9A,
+  0x969612B4,
+  0x959512AE,
+  0x949412A9,
+  0x939312A3,
+  0x9292129D,
+  0x8F8F1297,
+  0x8E8E0EE4,
+  0x8D8D1290,
+  0x8C8C128B,
+  0x8B8B1286,
+  0x8A8A1281,
+  0x84890A9A,
+  0x8383127C,
+  0x81811276,
+  0x8080126E,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBE1436,
+  0xBBBB1430,
+  0xB6B61429,
+  0xB5B51420,
+  0xB4B41419,
+  0xB2B21414,
+  0xB1B1140E,
+  0xB0B01408,
+  0xABAB0DC3,
+  0xAAAA1402,
+  0xA9A913FC,
+  0xA8A813F5,
+  0xA7A713EE,
+  0xA6A613E8,
+  0xA5A513E1,
+  0xA4A413D8,
+  0xA3A313D3,
+  0xA2A20AD1,
+  0xA0A013CE,
+  0x9D9D13C9,
+  0x9C9C13C3,
+  0x9B9B0C45,
+  0x9A9A13BD,
+  0x999913B6,
+  0x9898139E,
+  0x979713B0,
+  0x969613AB,
+  0x939313A3,
+  0x9292139E,
+  0x91911396,
+  0x90901391,
+  0x8D8D138A,
+  0x8C8C0C99,
+  0x8B8B1384,
+  0x8A8A137B,
+  0x89BF0A9A,
+  0x88881375,
+  0x8787136D,
+  0x86861367,
+  0x8585135E,
+  0x84841358,
+  0x83831351,
+  0x8282134B,
+  0x81811343,
+  0x8080133D,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF1441,
+  0xBEBE0F96,
+  0x96BD0A9A,
+  0x9595143C,
+  0x8F910A9A,
+  0x8E8E0F71,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x91BF0A9A,
+  0x909013AB,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9ABF0A9A,
+  0x999913C9,
+  0x808F0A9A,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF1465,
+  0xBEBE145F,
+  0xBDBD1459,
+  0xBABB0A9A,
+  0xAFB80A9A,
+  0xAEAE1414,
+  0xADAD1452,
+  0xACAC139E,
+  0xABAB144C,
+  0xAAAA0FC5,
+  0xA9A91446,
+  0xA8A80DC3,
+  0x809F0A9A,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB5BF0A9A,
+  0xB4B40AC5,
+  0xB3B31471,
+  0x9F9F146C,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF1476,
+  0x80BE0A9A,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB3BF0A9A,
+  0xB2B21495,
+  0xB1B1148F,
+  0x8CAF0A9A,
+  0x8B8B148A,
+  0x85851483,
+  0x8484147E,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBCBC0DD4,
+  0xA0BF0A9A,
+  0x9F9F14DF,
+  0x9E9E14D9,
+  0x9D9D14D3,
+  0x9C9C14CD,
+  0x9B9B14C6,
+  0x9A9A14C1,
+  0x959514BA,
+  0x949414B0,
+  0x939314AB,
+  0x929214A0,
+  0x9191149B,
+  0x808F0A9A,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBABA1537,
+  0xB9B9151F,
+  0xB8B81512,
+  0xA6BF0A9A,
+  0xA5A5150B,
+  0xA3A31506,
+  0x9F9F14FD,
+  0x8B8B14F7,
+  0x8A8A14F1,
+  0x858514EB,
+  0x848414E5,
+  0x809E0A9A,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAFAF1540,
+  0x80BF0A9A,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9B9B1546,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0A00EE4,
+  0x9C9C0DC3,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBABA154B,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF0A9A,
+  0xAFAF1550,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA9BF0A9A,
+  0xA8A81555,
+  0x809F0A9A,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x8EBF0A9A,
+  0x8D8D155A,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x080010C2,
+  0x0BFF10BE,
+  0x0AFFFFFF,
+  0x000910BE,
+  0x0700155F,
+  0x00FFFFFF,
+  0x080010C2,
+  0xF4F41269,
+  0xF1F31264,
+  0xF0F0124B,
+  0xEFEF1235,
+  0xEEEE1230,
+  0xEDED122A,
+  0xEAEA120E,
+  0xE4E41209,
+  0xE3E311FD,
+  0xE2E211EB,
+  0xE1E111BB,
+  0xE0E01197,
+  0xDFDF1190,
+  0xDEDE118A,
+  0xDDDD1185,
+  0xDCDC117E,
+  0xDBDB1176,
+  0xD9D9116F,
+  0xD8D8116A,
+  0xD7D71163,
+  0xD6D6115E,
+  0xD5D51158,
+  0xD4D41153,
+  0xD2D2114E,
+  0xCFCF1149,
+  0xCECE1140,
+  0xCDCD1138,
+  0xCCCC1133,
+  0xCBCB112A,
+  0xC3C31124,
+  0xC2C2111C,
+  0x80FF0014,
+  0x6666001D,
+  0x617B0014,
+  0x5F5F0014,
+  0x415A0014,
+  0x3D3D10C4,
+  0x3B3B0014,
+  0x30390014,
+  0x28281561,
+  0x202010C4,
+  0x0B7F10F2,
+  0x0AFFFFFF,
+  0x090910C4,
+  0x000810F2,
+  0x080010C2,
+  0xF4F41269,
+  0xF1F31264,
+  0xF0F0124B,
+  0xEFEF1235,
+  0xEEEE1230,
+  0xEDED122A,
+  0xEAEA120E,
+  0xE4E41209,
+  0xE3E311FD,
+  0xE2E211EB,
+  0xE1E111BB,
+  0xE0E01197,
+  0xDFDF1190,
+  0xDEDE118A,
+  0xDDDD1185,
+  0xDCDC117E,
+  0xDBDB1176,
+  0xD9D9116F,
+  0xD8D8116A,
+  0xD7D71163,
+  0xD6D6115E,
+  0xD5D51158,
+  0xD4D41153,
+  0xD2D2114E,
+  0xCFCF1149,
+  0xCECE1140,
+  0xCDCD1138,
+  0xCCCC1133,
+  0xCBCB112A,
+  0xC3C31124,
+  0xC2C2111C,
+  0x80FF0014,
+  0x617B0014,
+  0x5F5F0014,
+  0x415A0014,
+  0x3D3D10C4,
+  0x3B3B0014,
+  0x30390014,
+  0x0B7F10F2,
+  0x0AFFFFFF,
+  0x000910F2,
+  0xBBBF10F2,
+  0xB6B910F2,
+  0xABB410F2,
+  0x80A910F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB7B710F2,
+  0x979710F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAFBF10F2,
+  0xADAD10F2,
+  0xA5AB10F2,
+  0x929F10F2,
+  0x828510F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80BF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBE10F2,
+  0xB8B910F2,
+  0xB5B510F2,
+  0x80AF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA2A210F2,
+  0x8D8D10F2,
+  0x8B8B10F2,
+  0x878710F2,
+  0x808510F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB6B610F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x828910F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0B010F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9A9F10F2,
+  0x979810F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x89BF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB3BF10F2,
+  0xABAE10F2,
+  0x808F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x809F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0B010F2,
+  0xAAAD10F2,
+  0x8B9F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBDBE10F2,
+  0xA7AD10F2,
+  0x96A410F2,
+  0x949410F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF10F2,
+  0x919110F2,
+  0x808F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x808C10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB2BF10F2,
+  0xA6B010F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBBBF10F2,
+  0xB6B910F2,
+  0xABB310F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF1133,
+  0xBEBE1697,
+  0xBDBD1691,
+  0xBCBC168B,
+  0xBBBB1683,
+  0xBABA1676,
+  0xB9B91670,
+  0xB8B81669,
+  0xB7B71663,
+  0xB6B6165A,
+  0xB5B51651,
+  0xB4B41648,
+  0xB3B3163F,
+  0xB2B21634,
+  0xB1B1162B,
+  0xB0B01621,
+  0xAFAF161A,
+  0xAEAE160B,
+  0xADAD1602,
+  0xACAC15F6,
+  0xABAB15ED,
+  0xAAAA15E1,
+  0xA9A915D8,
+  0xA8A815CC,
+  0xA7A715C2,
+  0xA6A615B6,
+  0xA5A515AE,
+  0xA4A415A7,
+  0xA3A315A2,
+  0xA2A2159C,
+  0xA1A11596,
+  0xA0A0158E,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF17A3,
+  0xBEBE179C,
+  0xBDBD1791,
+  0xBCBC178B,
+  0xB7B71133,
+  0xB3B31782,
+  0xB2B2177C,
+  0xB1B11776,
+  0xB0B01771,
+  0xAFAF176C,
+  0xAEAE1766,
+  0xADAD175F,
+  0xACAC1759,
+  0xABAB1133,
+  0xAAAA1752,
+  0xA9A9174D,
+  0xA8A81748,
+  0xA7A71742,
+  0xA6A6173D,
+  0xA5A51736,
+  0xA4A41731,
+  0xA3A3172C,
+  0xA2A21725,
+  0xA1A11720,
+  0xA0A0171A,
+  0x9F9F1712,
+  0x9E9E170D,
+  0x9D9D1706,
+  0x9C9C1700,
+  0x9B9B16FA,
+  0x9A9A16F4,
+  0x999916EF,
+  0x909016EA,
+  0x8F8F16E4,
+  0x8E8E16DF,
+  0x8D8D16DA,
+  0x8C8C16D4,
+  0x8B8B16CD,
+  0x8A8A16C4,
+  0x898916BB,
+  0x838316B3,
+  0x828216AC,
+  0x818116A2,
+  0x8080169D,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB9BF1133,
+  0xB8B81802,
+  0xB7B717FA,
+  0xB6B617F1,
+  0xB5B517EB,
+  0xB4B417E4,
+  0xB3B317DD,
+  0x868617D7,
+  0x858517D0,
+  0x848417C1,
+  0x83AF1133,
+  0x828217BB,
+  0x818117B4,
+  0x808017AF,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x888F1133,
+  0x87871826,
+  0x86861821,
+  0x8484181B,
+  0x83831816,
+  0x82821810,
+  0x818116EA,
+  0x80801808,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB7B71133,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAFAF18B8,
+  0xADAD18B2,
+  0xACAC18A8,
+  0xABAB189F,
+  0xAAAA1897,
+  0xA9A9188E,
+  0xA8A81889,
+  0xA7A71881,
+  0xA6A6187B,
+  0xA5A51875,
+  0xA4A41870,
+  0xA3A31867,
+  0xA2A21861,
+  0xA1A1170D,
+  0xA0A01859,
+  0x9F9F1851,
+  0x9E9E184C,
+  0x9C9C1846,
+  0x9B9B176C,
+  0x9A9A1841,
+  0x9999183C,
+  0x98981836,
+  0x93931830,
+  0x9292182B,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9F9F18C3,
+  0x9E9E18BE,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80BF1133,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF1927,
+  0xBEBE1922,
+  0xBDBD191C,
+  0xBCBC1915,
+  0xBBBB1910,
+  0xB9B91909,
+  0xB8B81903,
+  0xB7B718FD,
+  0xB6B618F8,
+  0xB5B518F3,
+  0xB4B418EE,
+  0xAFAF18E9,
+  0xAEAE18E4,
+  0xADAD18DE,
+  0xACAC18D3,
+  0xABAB18CE,
+  0xA9A918C9,
+  0x80A31133,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB2BF1230,
+  0xB1B11A15,
+  0xAFAF1A0E,
+  0xAEAE1A08,
+  0xACAC1A03,
+  0xABAB19FD,
+  0xAAAA19F8,
+  0x9F9F19F2,
+  0x9E9E19E2,
+  0x9D9D19D0,
+  0x9B9B19C5,
+  0x9A9A19BF,
+  0x999C1230,
+  0x989819B7,
+  0x969619A6,
+  0x95951230,
+  0x9494199F,
+  0x93931999,
+  0x9292198F,
+  0x9191195E,
+  0x90901930,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80BF1230,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x808F1230,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBE0A59,
+  0xBBBB0A59,
+  0xA7A70A59,
+  0x8C8C0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9EBF0A59,
+  0x8E8F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBBBF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9D9F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x91BF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0AC0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB6BF0A59,
+  0x8A8F0A59,
+  0x81810A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x90BF0A59,
+  0x84870A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAAAF0A59,
+  0x9E9F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBCBF0A59,
+  0x94970A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA8AF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBBBB0A59,
+  0xA4AF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBDBF0A59,
+  0xBABA0A59,
+  0xB2B20A59,
+  0xA2A20A59,
+  0x96960A59,
+  0x93930A59,
+  0x8B8B0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB7BF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA8BF0A59,
+  0x969F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBBBF0A59,
+  0xB1B10A59,
+  0x86860A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBDBE0A59,
+  0xB9BB0A59,
+  0xB6B60A59,
+  0x89890A59,
+  0x86870A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB7BF0A59,
+  0x969F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB6BF0A59,
+  0xB3B30A59,
+  0x809F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBABF0A59,
+  0x969F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB8BD0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB6BF0A59,
+  0x98980A59,
+  0x94940A59,
+  0x818F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBDBF0A59,
+  0x809F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9DBF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA5BF0A59,
+  0x88880A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB3BF0A59,
+  0x969F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x92BF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB3BF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBABF0A59,
+  0xA4AF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB2BF0A59,
+  0xAAAF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA8AF0A59,
+  0x9DA60A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x86AF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x82AF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB7BF0A59,
+  0x859F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB8BF0A59,
+  0x80820A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB6BF0A59,
+  0xB3B40A59,
+  0xB0B00A59,
+  0x80A50A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF0A59,
+  0x80820A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBABF0A59,
+  0xA9AF0A59,
+  0x808F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA7B50A59,
+  0x80820A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB7BF0A59,
+  0xB3B50A59,
+  0x888F0A59,
+  0x85860A59,
+  0x80830A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB3BF0A59,
+  0x80820A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9DBF0A59,
+  0x9B9B0A59,
+  0x858F0A59,
+  0x80800A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xACBF0A59,
+  0x92920A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA9AF0A59,
+  0x9E9E0A59,
+  0x8E8E0A59,
+  0x89890A59,
+  0x87870A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBABF0A59,
+  0x9FAF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA2BF0A59,
+  0x919C0A59,
+  0x808F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB5BF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA2BF0A59,
+  0x9A9E0A59,
+  0x8B8F0A59,
+  0x80860A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9ABF0A59,
+  0x888F0A59,
+  0x86860A59,
+  0x80830A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAFBF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9CBF0A59,
+  0x80970A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9ABF0A59,
+  0x858F0A59,
+  0x80830A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB9BF0A59,
+  0xABB70A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBABF0A59,
+  0x9BAF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x87BF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xACBF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAABE0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BE0A59,
+  0x97970A59,
+  0x94940A59,
+  0x8A8B0A59,
+  0x87880A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9ABF0A59,
+  0x828F0A59,
+  0x80800A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA8A90A59,
+  0x809F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA4BF0A59,
+  0xA2A20A59,
+  0x91A00A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBBBF0A59,
+  0xB3B90A59,
+  0x818A0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x919B0A59,
+  0x808F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9EAF0A59,
+  0x8A9C0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAFBF0A59,
+  0x89890A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9AB10A59,
+  0x818F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x90BF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB1BF0A59,
+  0x8A8A0A59,
+  0x87870A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA9A90A59,
+  0xA6A60A59,
+  0x9A9F0A59,
+  0x878F0A59,
+  0x80850A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAABF0A59,
+  0x999F0A59,
+  0x8A970A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB3BF0A59,
+  0x809F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB1BF0A59,
+  0x80AF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x84BF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB1BF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAAAF0A59,
+  0x9F9F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAEBF0A59,
+  0x8A8F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB8BC0A59,
+  0x9AA20A59,
+  0x848F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x91BF0A59,
+  0x8B8F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0BF0A59,
+  0x80920A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA4BF0A59,
+  0xA2A20A59,
+  0x809F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB8BF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x96BF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF0A59,
+  0xBCBC0A59,
+  0xB4B40A59,
+  0x80AF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA3BF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA8AF0A59,
+  0x93A30A59,
+  0x808F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBCBF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBDBF0A59,
+  0xABAF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9ABF0A59,
+  0x898F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x95950A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBCBC0A59,
+  0xBABA0A59,
+  0xADAD0A59,
+  0xA7A80A59,
+  0xA3A40A59,
+  0xA0A10A59,
+  0x9D9D0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x84840A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF0A59,
+  0xBABA0A59,
+  0x9D9D0A59,
+  0x95950A59,
+  0x8B8C0A59,
+  0x86860A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x91910A59,
+  0x87890A59,
+  0x85850A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA6A70A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBBBB0A59,
+  0x9B9B0A59,
+  0x81810A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB5B50A59,
+  0x95950A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAFAF0A59,
+  0x8F8F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA9A90A59,
+  0x89890A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x8C8D0A59,
+  0x83830A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBF0A59,
+  0xADB60A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x8FBF0A59,
+  0x8A8D0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAEBF0A59,
+  0x808F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBABF0A59,
+  0xACAF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF0A59,
+  0xAFAF0A59,
+  0xACAC0A59,
+  0xA7A70A59,
+  0x809F0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x85BF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9ABF0A59,
+  0x8C8F0A59,
+  0x848A0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBCBF0A59,
+  0xBABA0A59,
+  0xB8B80A59,
+  0xB3B30A59,
+  0xA8A80A59,
+  0xA5A60A59,
+  0xA3A30A59,
+  0xA0A00A59,
+  0x84840A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF0A59,
+  0xBDBD0A59,
+  0xB8B80A59,
+  0xB3B30A59,
+  0xABAB0A59,
+  0xA5A60A59,
+  0xA3A30A59,
+  0xA0A00A59,
+  0x9E9E0A59,
+  0x9C9C0A59,
+  0x9A9A0A59,
+  0x98980A59,
+  0x95960A59,
+  0x93930A59,
+  0x90900A59,
+  0x8C8C0A59,
+  0x8A8A0A59,
+  0x88880A59,
+  0x83860A59,
+  0x80810A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBCBF0A59,
+  0xAAAA0A59,
+  0xA4A40A59,
+  0x9CA00A59,
+  0x8A8A0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBABF0A59,
+  0x80AF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0BF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA2AF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA1BF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9EBF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x8BBF0A59,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xFE000001,
+  0x00FFFFFF,
+  0x080010C2,
+  0xF4F41269,
+  0xF1F31264,
+  0xF0F0124B,
+  0xEFEF1235,
+  0xEEEE1230,
+  0xEDED122A,
+  0xEAEA120E,
+  0xE4E41209,
+  0xE3E311FD,
+  0xE2E211EB,
+  0xE1E111BB,
+  0xE0E01197,
+  0xDFDF1190,
+  0xDEDE118A,
+  0xDDDD1185,
+  0xDCDC117E,
+  0xDBDB1176,
+  0xD9D9116F,
+  0xD8D8116A,
+  0xD7D71163,
+  0xD6D6115E,
+  0xD5D51158,
+  0xD4D41153,
+  0xD2D2114E,
+  0xCFCF1149,
+  0xCECE1140,
+  0xCDCD1138,
+  0xCCCC1133,
+  0xCBCB112A,
+  0xC3C31124,
+  0xC2C2111C,
+  0x80FF0014,
+  0x6666001D,
+  0x617B0014,
+  0x5F5F0014,
+  0x415A0014,
+  0x3D3D10C4,
+  0x3B3B0014,
+  0x30390014,
+  0x20201561,
+  0x0B7F10F2,
+  0x0AFFFFFF,
+  0x09091561,
+  0x000810F2,
+  0xA9BF10F2,
+  0xA5A710F2,
+  0x9BA310F2,
+  0x969910F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xABAF10F2,
+  0x999F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x8F9F10F2,
+  0x888810F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x8ABF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBF10F2,
+  0xBABC10F2,
+  0x808310F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0B010F2,
+  0xA2A510F2,
+  0x919710F2,
+  0x808F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBF10F2,
+  0xBABC10F2,
+  0xB3B510F2,
+  0xB1B110F2,
+  0xA9A910F2,
+  0x919210F2,
+  0x8D8E10F2,
+  0x818410F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBDBF10F2,
+  0xB2BB10F2,
+  0xA2A510F2,
+  0x9E9E10F2,
+  0x8F9B10F2,
+  0x808D10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBABF10F2,
+  0xB7B710F2,
+  0xB4B410F2,
+  0xB1B110F2,
+  0xA9A910F2,
+  0x919210F2,
+  0x8B8E10F2,
+  0x808410F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB5BF10F2,
+  0xB0B110F2,
+  0x9FA510F2,
+  0x9D9D10F2,
+  0x809810F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBF10F2,
+  0xBABC10F2,
+  0xB4B410F2,
+  0xB1B110F2,
+  0xA9A910F2,
+  0x929210F2,
+  0x8E8E10F2,
+  0x808410F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBABF10F2,
+  0xB0B810F2,
+  0xA2A510F2,
+  0x919F10F2,
+  0x808F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBF10F2,
+  0xBABC10F2,
+  0xB4B410F2,
+  0xB1B110F2,
+  0xA9A910F2,
+  0x919210F2,
+  0x8D8E10F2,
+  0x808410F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB2BF10F2,
+  0xB0B010F2,
+  0xA2A510F2,
+  0x9E9E10F2,
+  0x809B10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBABF10F2,
+  0xABAD10F2,
+  0xA5A710F2,
+  0xA0A210F2,
+  0x9D9D10F2,
+  0x9B9B10F2,
+  0x969810F2,
+  0x919110F2,
+  0x8B8D10F2,
+  0x848410F2,
+  0x808210F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF10F2,
+  0x91A510F2,
+  0x808F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBF10F2,
+  0xBABC10F2,
+  0xA9A910F2,
+  0x919110F2,
+  0x8D8D10F2,
+  0x808410F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF10F2,
+  0xA2A510F2,
+  0x9E9F10F2,
+  0x9B9C10F2,
+  0x809710F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBF10F2,
+  0xBABC10F2,
+  0xB4B410F2,
+  0xA9A910F2,
+  0x919110F2,
+  0x8D8D10F2,
+  0x818410F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB3BF10F2,
+  0xB0B010F2,
+  0xA2A510F2,
+  0x9F9F10F2,
+  0x809C10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBF10F2,
+  0xBBBC10F2,
+  0x919110F2,
+  0x8D8D10F2,
+  0x808310F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0B910F2,
+  0xA2A510F2,
+  0x979E10F2,
+  0x8F9310F2,
+  0x808D10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBF10F2,
+  0xBCBC10F2,
+  0xB2B210F2,
+  0x979910F2,
+  0x808410F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF10F2,
+  0x87A510F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB4BF10F2,
+  0xB1B110F2,
+  0x808010F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9ABF10F2,
+  0x878F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBF10F2,
+  0xB4BC10F2,
+  0xB1B110F2,
+  0xA6A610F2,
+  0xA4A410F2,
+  0x8B8B10F2,
+  0x858510F2,
+  0x838310F2,
+  0x808010F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0BF10F2,
+  0x9A9B10F2,
+  0x878F10F2,
+  0x858510F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAABF10F2,
+  0x819F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xADBF10F2,
+  0x888810F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x8DBF10F2,
+  0x808710F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xABBE10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB1B410F2,
+  0xA7AD10F2,
+  0xA2A410F2,
+  0x9EA010F2,
+  0x969910F2,
+  0x8A8F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9A9F10F2,
+  0x8F8F10F2,
+  0x828D10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBBBB10F2,
+  0x8E8F10F2,
+  0x888C10F2,
+  0x868610F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9E9F10F2,
+  0x999910F2,
+  0x979710F2,
+  0x8E8F10F2,
+  0x898910F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF10F2,
+  0xB6B710F2,
+  0xB1B110F2,
+  0x8E8F10F2,
+  0x898910F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x979710F2,
+  0x868710F2,
+  0x818110F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x969710F2,
+  0x919110F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9BBF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x909F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBF10F2,
+  0xB6B710F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x808010F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xADAE10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9B9F10F2,
+  0x808010F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB9BF10F2,
+  0xABB010F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB2BF10F2,
+  0x929E10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB1BF10F2,
+  0xADAD10F2,
+  0x929F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB4BF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAABF10F2,
+  0x9D9F10F2,
+  0x989B10F2,
+  0x809610F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9A9F10F2,
+  0x808F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB9BF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xABAF10F2,
+  0xA9A910F2,
+  0x858610F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB6BF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9FBF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB5BF10F2,
+  0xAEAF10F2,
+  0x808510F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xACAF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9ABF10F2,
+  0x8A8F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x979F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x95BF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA8BF10F2,
+  0x9AA610F2,
+  0x8A8F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB4BF10F2,
+  0x808410F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9ABF10F2,
+  0x8D8F10F2,
+  0x808410F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA1AD10F2,
+  0x808210F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA6BF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA4BF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBF10F2,
+  0x8A8C10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBBBC10F2,
+  0x898F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBBBF10F2,
+  0xB7B910F2,
+  0xB4B410F2,
+  0xADAD10F2,
+  0x80A810F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9E9F10F2,
+  0x969710F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBF10F2,
+  0x9E9E10F2,
+  0x9C9C10F2,
+  0x9A9A10F2,
+  0x989810F2,
+  0x8E8F10F2,
+  0x868710F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF10F2,
+  0xBDBD10F2,
+  0xB5B510F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBDBF10F2,
+  0xB5B510F2,
+  0xADB110F2,
+  0x9C9F10F2,
+  0x949510F2,
+  0x8D8F10F2,
+  0x858510F2,
+  0x808110F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80BE10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB2BE10F2,
+  0x95B010F2,
+  0x819310F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9DBF10F2,
+  0x808F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBABB10F2,
+  0xAEAE10F2,
+  0xA9A910F2,
+  0xA7A710F2,
+  0xA5A510F2,
+  0x9EA310F2,
+  0x969810F2,
+  0x949410F2,
+  0x888910F2,
+  0x838610F2,
+  0x808110F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x8FBF10F2,
+  0x8A8D10F2,
+  0x808410F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x85BF10F2,
+  0x808210F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB4BF10F2,
+  0xAFB110F2,
+  0xA5AA10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAEAF10F2,
+  0xA8AC10F2,
+  0xA6A610F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF10F2,
+  0xA8AE10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF10F2,
+  0xB7B710F2,
+  0xAFAF10F2,
+  0xA7A710F2,
+  0x979F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9FBF10F2,
+  0x979710F2,
+  0x8F8F10F2,
+  0x878710F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF10F2,
+  0x80AE10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBDBF10F2,
+  0xB6BA10F2,
+  0x87B010F2,
+  0x808410F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0A010F2,
+  0x979C10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBBBB10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0B010F2,
+  0x808410F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x8F9F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x80AF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x8DBF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBF10F2,
+  0x808F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xACBF10F2,
+  0x8D8F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAFBE10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9E9F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0A110F2,
+  0x809610F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x898A10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9AB110F2,
+  0x949410F2,
+  0x929210F2,
+  0x8B8F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA3BF10F2,
+  0x8B8B10F2,
+  0x868610F2,
+  0x828210F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB4BF10F2,
+  0x808110F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF10F2,
+  0xBCBC10F2,
+  0xB8BA10F2,
+  0x9AB110F2,
+  0x808F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA6AF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBDBF10F2,
+  0x879F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB3BF10F2,
+  0x808310F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF10F2,
+  0xA5A510F2,
+  0x9A9F10F2,
+  0x808E10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA9BF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBBBD10F2,
+  0xB7B910F2,
+  0x9A9F10F2,
+  0x8C8F10F2,
+  0x838310F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBF10F2,
+  0xB7B810F2,
+  0xB2B410F2,
+  0xB0B010F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB5BF10F2,
+  0xABB110F2,
+  0x9E9F10F2,
+  0x839A10F2,
+  0x818110F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAFAF10F2,
+  0xA7A710F2,
+  0x979F10F2,
+  0x8F9010F2,
+  0x878810F2,
+  0x808010F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAAAF10F2,
+  0x9B9B10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBABF10F2,
+  0xA3AF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA4AF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBCBF10F2,
+  0x878A10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAEAF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9ABF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF10F2,
+  0xBDBD10F2,
+  0xB7B710F2,
+  0xA9A910F2,
+  0x9E9E10F2,
+  0x989C10F2,
+  0x879210F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x858510F2,
+  0x828210F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB2BF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x809210F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x808F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x909110F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBCBF10F2,
+  0x88AF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB5BF10F2,
+  0x80B210F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB5B510F2,
+  0x90AF10F2,
+  0x808C10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBDBF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBBBE10F2,
+  0x9AA010F2,
+  0x808F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9BA510F2,
+  0x808010F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9DBF10F2,
+  0x989910F2,
+  0x909110F2,
+  0x888910F2,
+  0x808110F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF1AE4,
+  0xBEBE1ADF,
+  0xBDBD1ADA,
+  0xBCBC1AD4,
+  0xBABA1ACE,
+  0xB5BB1133,
+  0xB4B41AC8,
+  0xB2B31AC3,
+  0xB1B1115E,
+  0xAEAE1ABE,
+  0xADAD1AB8,
+  0xACAC172C,
+  0xABAB1AB2,
+  0xAAAA1AAD,
+  0xA9A91AA7,
+  0xA8A81A9F,
+  0xA6A61A9A,
+  0xA4A41A94,
+  0xA3A31A8D,
+  0xA2A21731,
+  0xA1A11A87,
+  0xA0A01A7E,
+  0x9FAF1133,
+  0x9E9E1A77,
+  0x9D9D1A71,
+  0x9C9C1A6C,
+  0x97971133,
+  0x96961A61,
+  0x95951A5B,
+  0x94941A56,
+  0x93931A50,
+  0x92921A4A,
+  0x8F8F1A44,
+  0x8E8E1841,
+  0x8D8D1A3D,
+  0x8C8C1A38,
+  0x8B8B1A33,
+  0x8A8A1A2E,
+  0x84891133,
+  0x83831A29,
+  0x81811A23,
+  0x80801A1B,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBE1BE3,
+  0xBBBB1BDD,
+  0xB6B61BD6,
+  0xB5B51BCD,
+  0xB4B41BC6,
+  0xB2B21BC1,
+  0xB1B11BBB,
+  0xB0B01BB5,
+  0xABAB1720,
+  0xAAAA1BAF,
+  0xA9A91BA9,
+  0xA8A81BA2,
+  0xA7A71B9B,
+  0xA6A61B95,
+  0xA5A51B8E,
+  0xA4A41B85,
+  0xA3A31B80,
+  0xA2A2116A,
+  0xA0A01B7B,
+  0x9D9D1B76,
+  0x9C9C1B70,
+  0x9B9B15A2,
+  0x9A9A1B6A,
+  0x99991B63,
+  0x98981B4B,
+  0x97971B5D,
+  0x96961B58,
+  0x93931B50,
+  0x92921B4B,
+  0x91911B43,
+  0x90901B3E,
+  0x8D8D1B37,
+  0x8C8C15F6,
+  0x8B8B1B31,
+  0x8A8A1B28,
+  0x89BF1133,
+  0x88881B22,
+  0x87871B1A,
+  0x86861B14,
+  0x85851B0B,
+  0x84841B05,
+  0x83831AFE,
+  0x82821AF8,
+  0x81811AF0,
+  0x80801AEA,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF1BEE,
+  0xBEBE18F3,
+  0x96BD1133,
+  0x95951BE9,
+  0x8F911133,
+  0x8E8E18CE,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x91BF1133,
+  0x90901B58,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9ABF1133,
+  0x99991B76,
+  0x808F1133,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF1C12,
+  0xBEBE1C0C,
+  0xBDBD1C06,
+  0xBABB1133,
+  0xAFB81133,
+  0xAEAE1BC1,
+  0xADAD1BFF,
+  0xACAC1B4B,
+  0xABAB1BF9,
+  0xAAAA1922,
+  0xA9A91BF3,
+  0xA8A81720,
+  0x809F1133,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB5BF1133,
+  0xB4B4115E,
+  0xB3B31C1E,
+  0x9F9F1C19,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF1C23,
+  0x80BE1133,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB3BF1133,
+  0xB2B21C42,
+  0xB1B11C3C,
+  0x8CAF1133,
+  0x8B8B1C37,
+  0x85851C30,
+  0x84841C2B,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBCBC1731,
+  0xA0BF1133,
+  0x9F9F1C8C,
+  0x9E9E1C86,
+  0x9D9D1C80,
+  0x9C9C1C7A,
+  0x9B9B1C73,
+  0x9A9A1C6E,
+  0x95951C67,
+  0x94941C5D,
+  0x93931C58,
+  0x92921C4D,
+  0x91911C48,
+  0x808F1133,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBABA1CE4,
+  0xB9B91CCC,
+  0xB8B81CBF,
+  0xA6BF1133,
+  0xA5A51CB8,
+  0xA3A31CB3,
+  0x9F9F1CAA,
+  0x8B8B1CA4,
+  0x8A8A1C9E,
+  0x85851C98,
+  0x84841C92,
+  0x809E1133,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAFAF1CED,
+  0x80BF1133,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9B9B1CF3,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0A01841,
+  0x9C9C1720,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBABA1CF8,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF1133,
+  0xAFAF1CFD,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA9BF1133,
+  0xA8A81D02,
+  0x809F1133,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x8EBF1133,
+  0x8D8D1D07,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBE10F2,
+  0xBBBB10F2,
+  0xA7A710F2,
+  0x8C8C10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9EBF10F2,
+  0x8E8F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBBBF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9D9F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x91BF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0AC10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB6BF10F2,
+  0x8A8F10F2,
+  0x818110F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x90BF10F2,
+  0x848710F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAAAF10F2,
+  0x9E9F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBCBF10F2,
+  0x949710F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA8AF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBBBB10F2,
+  0xA4AF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBDBF10F2,
+  0xBABA10F2,
+  0xB2B210F2,
+  0xA2A210F2,
+  0x969610F2,
+  0x939310F2,
+  0x8B8B10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB7BF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA8BF10F2,
+  0x969F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBBBF10F2,
+  0xB1B110F2,
+  0x868610F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBDBE10F2,
+  0xB9BB10F2,
+  0xB6B610F2,
+  0x898910F2,
+  0x868710F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB7BF10F2,
+  0x969F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB6BF10F2,
+  0xB3B310F2,
+  0x809F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBABF10F2,
+  0x969F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB8BD10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB6BF10F2,
+  0x989810F2,
+  0x949410F2,
+  0x818F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBDBF10F2,
+  0x809F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9DBF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA5BF10F2,
+  0x888810F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB3BF10F2,
+  0x969F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x92BF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB3BF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBABF10F2,
+  0xA4AF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB2BF10F2,
+  0xAAAF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA8AF10F2,
+  0x9DA610F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x86AF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x82AF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB7BF10F2,
+  0x859F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB8BF10F2,
+  0x808210F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB6BF10F2,
+  0xB3B410F2,
+  0xB0B010F2,
+  0x80A510F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF10F2,
+  0x808210F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBABF10F2,
+  0xA9AF10F2,
+  0x808F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA7B510F2,
+  0x808210F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB7BF10F2,
+  0xB3B510F2,
+  0x888F10F2,
+  0x858610F2,
+  0x808310F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB3BF10F2,
+  0x808210F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9DBF10F2,
+  0x9B9B10F2,
+  0x858F10F2,
+  0x808010F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xACBF10F2,
+  0x929210F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA9AF10F2,
+  0x9E9E10F2,
+  0x8E8E10F2,
+  0x898910F2,
+  0x878710F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBABF10F2,
+  0x9FAF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA2BF10F2,
+  0x919C10F2,
+  0x808F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB5BF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA2BF10F2,
+  0x9A9E10F2,
+  0x8B8F10F2,
+  0x808610F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9ABF10F2,
+  0x888F10F2,
+  0x868610F2,
+  0x808310F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAFBF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9CBF10F2,
+  0x809710F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9ABF10F2,
+  0x858F10F2,
+  0x808310F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB9BF10F2,
+  0xABB710F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBABF10F2,
+  0x9BAF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x87BF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xACBF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAABE10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB0BE10F2,
+  0x979710F2,
+  0x949410F2,
+  0x8A8B10F2,
+  0x878810F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9ABF10F2,
+  0x828F10F2,
+  0x808010F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA8A910F2,
+  0x809F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA4BF10F2,
+  0xA2A210F2,
+  0x91A010F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBBBF10F2,
+  0xB3B910F2,
+  0x818A10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x919B10F2,
+  0x808F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9EAF10F2,
+  0x8A9C10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAFBF10F2,
+  0x898910F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9AB110F2,
+  0x818F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x90BF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB1BF10F2,
+  0x8A8A10F2,
+  0x878710F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA9A910F2,
+  0xA6A610F2,
+  0x9A9F10F2,
+  0x878F10F2,
+  0x808510F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAABF10F2,
+  0x999F10F2,
+  0x8A9710F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB3BF10F2,
+  0x809F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB1BF10F2,
+  0x80AF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x84BF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB1BF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAAAF10F2,
+  0x9F9F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAEBF10F2,
+  0x8A8F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB8BC10F2,
+  0x9AA210F2,
+  0x848F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x91BF10F2,
+  0x8B8F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0BF10F2,
+  0x809210F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA4BF10F2,
+  0xA2A210F2,
+  0x809F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB8BF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x96BF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF10F2,
+  0xBCBC10F2,
+  0xB4B410F2,
+  0x80AF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA3BF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA8AF10F2,
+  0x93A310F2,
+  0x808F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBCBF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBDBF10F2,
+  0xABAF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9ABF10F2,
+  0x898F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x959510F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBCBC10F2,
+  0xBABA10F2,
+  0xADAD10F2,
+  0xA7A810F2,
+  0xA3A410F2,
+  0xA0A110F2,
+  0x9D9D10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x848410F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF10F2,
+  0xBABA10F2,
+  0x9D9D10F2,
+  0x959510F2,
+  0x8B8C10F2,
+  0x868610F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x919110F2,
+  0x878910F2,
+  0x858510F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA6A710F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBBBB10F2,
+  0x9B9B10F2,
+  0x818110F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xB5B510F2,
+  0x959510F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAFAF10F2,
+  0x8F8F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA9A910F2,
+  0x898910F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x8C8D10F2,
+  0x838310F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBEBF10F2,
+  0xADB610F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x8FBF10F2,
+  0x8A8D10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xAEBF10F2,
+  0x808F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBABF10F2,
+  0xACAF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF10F2,
+  0xAFAF10F2,
+  0xACAC10F2,
+  0xA7A710F2,
+  0x809F10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x85BF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9ABF10F2,
+  0x8C8F10F2,
+  0x848A10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBCBF10F2,
+  0xBABA10F2,
+  0xB8B810F2,
+  0xB3B310F2,
+  0xA8A810F2,
+  0xA5A610F2,
+  0xA3A310F2,
+  0xA0A010F2,
+  0x848410F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBFBF10F2,
+  0xBDBD10F2,
+  0xB8B810F2,
+  0xB3B310F2,
+  0xABAB10F2,
+  0xA5A610F2,
+  0xA3A310F2,
+  0xA0A010F2,
+  0x9E9E10F2,
+  0x9C9C10F2,
+  0x9A9A10F2,
+  0x989810F2,
+  0x959610F2,
+  0x939310F2,
+  0x909010F2,
+  0x8C8C10F2,
+  0x8A8A10F2,
+  0x888810F2,
+  0x838610F2,
+  0x808110F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBCBF10F2,
+  0xAAAA10F2,
+  0xA4A410F2,
+  0x9CA010F2,
+  0x8A8A10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xBABF10F2,
+  0x80AF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA0BF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA2AF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0xA1BF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x9EBF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+  0x8BBF10F2,
+  0x3D3D000C,
+  0x0BFF0014,
+  0x0AFFFFFF,
+  0x00090014,
+};
+
+const reflex::Pattern::Pred reflex_pred_pack3[4354] = {
+    0,  8,
+  255,255,255,255,255,255,255,255,255,255,  0,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,254,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+  252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,252,
+};
+
+const Pack packs[] = {
+  { "(?m)^\\h*\\{?\\h*([\\w:*&<,>]+\\h+)+\\w+\\h*\\([^)\\n]*\\)\\h*((const|final|noexcept|override|throw\\h*\\([^)\\n]*\\))\\h*)*([:{].*|[^{;\\w\\n]*)$|(?^^.*\\h+(catch|else|for|if|return|switch|throw|while).*$)", 514, false, reflex_code_pack0, reflex_pred_pack0 },
+  { "(?m)^(\\h*[\\w:]+)+\\h+\\w+\\h*\\([^)\\n]*\\)\\h*(\\{.*|[^{;\\w\\n]*)$|(?^^\\h+(else|if|return|throw)\\h+.*$)", 514, false, reflex_code_pack1, reflex_pred_pack1 },
+  { "(?m)^\\h*\\{?\\h*([\\w.<,>\\[\\]]+\\h+)+\\w+\\h*\\([^)\\n]*\\)\\h*(\\{.*|[^{;\\w\\n]*)$|(?^^.*\\h+(catch|else|for|if|return|switch|throw|while).*$)", 514, false, reflex_code_pack2, reflex_pred_pack2 },
+  { "(?m)^\\h*function\\h+\\w+\\h*\\([^)\\n]+\\)\\h*(\\{.*|[^{;\\w\\n]*)$|^.*=\\h*\\(?\\h*function\\h*\\([^)\\n]*\\)\\h*(\\{.*|[^{;\\w\\n]*)$", 514, false, reflex_code_pack3, reflex_pred_pack3 },
+  { NULL, 0, false, NULL, NULL }
+};
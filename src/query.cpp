@@ -48,56 +48,12 @@
 
 #include <direct.h>
 
-// create a non-blocking pipe (Windows named pipe)
-inline HANDLE nonblocking_pipe(int fd[2])
-{
-  DWORD pid = GetCurrentProcessId();
-  std::string pipe_name = "\\\\.\\pipe\\ugrep_";
-  pipe_name.append(std::to_string(pid)).append("_").append(std::to_string(time(NULL)));
-  DWORD buffer_size = QUERY_BUFFER_SIZE;
-  HANDLE pipe_r = CreateNamedPipeA(pipe_name.c_str(), PIPE_ACCESS_INBOUND | FILE_FLAG_OVERLAPPED, PIPE_TYPE_BYTE | PIPE_READMODE_BYTE | PIPE_WAIT, 1, buffer_size, buffer_size, 0, NULL);
-  if (pipe_r != INVALID_HANDLE_VALUE)
-  {
-    HANDLE pipe_w = CreateFileA(pipe_name.c_str(), GENERIC_WRITE, 0, NULL, OPEN_EXISTING, 0, NULL);
-    if (pipe_w != INVALID_HANDLE_VALUE)
-    {
-      fd[0] = _open_osfhandle(reinterpret_cast<intptr_t>(pipe_r), _O_RDONLY);
-      fd[1] = _open_osfhandle(reinterpret_cast<intptr_t>(pipe_w), _O_WRONLY);
-    }
-    else
-    {
-      CloseHandle(pipe_r);
-      pipe_r = INVALID_HANDLE_VALUE;
-    }
-  }
-  return pipe_r;
-}
-
 #else
 
 #include <signal.h>
 #include <unistd.h>
 #include <sys/stat.h>
 
-// create a pipe with non-blocking read end
-inline int nonblocking_pipe(int fd[2])
-{
-  if (pipe(fd) == 0)
-  {
-    if (fcntl(fd[0], F_SETFL, fcntl(fd[0], F_GETFL) | O_NONBLOCK) >= 0)
-      return 0;
-    close(fd[0]);
-    close(fd[1]);
-  }
-  return -1;
-}
-
-// make a pipe block
-inline void set_blocking(int fd0)
-{
-  fcntl(fd0, F_SETFL, fcntl(fd0, F_GETFL) & ~O_NONBLOCK);
-}
-
 #endif
 
 static const char *PROMPT = "\033[32;1m";    // bright green
@@ -670,10 +626,10 @@ void Query::query()
   if (!flag_quiet)
     print();
 
-  // close the search pipe to terminate the search threads, if still open
+  // close the search channel to terminate the search threads, if still open
   if (!eof_)
   {
-    close(search_pipe_[0]);
+    channel_.close();
     eof_ = true;
 
     // graciously shut down ugrep() if still running
@@ -717,7 +673,6 @@ void Query::query_ui()
   select_all_ = false;
   globbing_   = false;
   eof_        = true;
-  buflen_     = 0;
 
   Screen::clear();
 
@@ -1280,42 +1235,13 @@ void Query::search()
 
   if (cancel)
   {
-    close(search_pipe_[0]);
+    channel_.close();
     eof_ = true;
-    buflen_ = 0;
 
     // graciously shut down ugrep() if still running
     Static::cancel_ugrep();
   }
 
-#ifdef OS_WIN
-
-  hPipe_ = nonblocking_pipe(search_pipe_);
-
-  if (hPipe_ == INVALID_HANDLE_VALUE)
-  {
-    what_.assign("cannot create pipe");
-    // error at the end of the line, not within
-    error_ = line_wsize();
-    return;
-  }
-
-  memset(&overlapped_, 0, sizeof(overlapped_));
-  blocking_ = false;
-  pending_ = false;
-
-#else
-
-  if (nonblocking_pipe(search_pipe_) < 0)
-  {
-    what_.assign("cannot create pipe");
-    // error at the end of the line, not within
-    error_ = line_wsize();
-    return;
-  }
-
-#endif
-
   if (search_thread_.joinable())
   {
     if (cancel && error_ == -1)
@@ -1332,6 +1258,9 @@ void Query::search()
     search_thread_.join();
   }
 
+  // the previous search thread finished, open the channel to receive the new search results
+  channel_.open();
+
   eof_ = false;
   row_ = 0;
   rows_ = 0;
@@ -1371,7 +1300,11 @@ void Query::search()
     // delete old matcher, if any, to prevent preview from using it (rows_ == 0 prevents that too)
     Static::matcher.reset();
 
-    search_thread_ = std::thread(Query::execute, search_pipe_[1]);
+    search_thread_ = std::thread(Query::execute);
+  }
+  else
+  {
+    channel_.finish();
   }
 
   select_ = -1;
@@ -1557,222 +1490,91 @@ bool Query::update()
   return begin < rows_;
 }
 
-// fetch rows up to and including the specified row, when available, i.e. do not block when pipe is non-blocking
+// fetch rows up to and including the specified row, when available, i.e. does not block
 bool Query::fetch(int row)
 {
   int prev_rows = rows_;
 
-  while (rows_ <= row)
+  while (rows_ <= row && !eof_)
   {
-    bool incomplete = false;
-
-    // look for the first newline character in the buffer
-    char *nlptr = static_cast<char*>(memchr(buffer_, '\n', buflen_));
-
-    if (nlptr == NULL)
+    // allocate more rows on demand
+    if (rows_ >= static_cast<int>(view_.size()))
     {
-      // no newline and buffer is not full and not EOF reached yet, get more data
-      if (buflen_ < QUERY_BUFFER_SIZE && !eof_)
-      {
-#ifdef OS_WIN
-
-        // try to fetch more data from the non-blocking pipe when immediately available
-        DWORD nread = 0;
-        bool avail = !pending_;
-
-        if (pending_)
-        {
-          pending_ = false;
-
-          if (!GetOverlappedResult(hPipe_, &overlapped_, &nread, FALSE))
-          {
-            switch (GetLastError())
-            {
-              case ERROR_IO_INCOMPLETE:
-                pending_ = true;
-                break;
-
-              case ERROR_MORE_DATA:
-                break;
-
-              case ERROR_HANDLE_EOF:
-              default:
-                close(search_pipe_[0]);
-                eof_ = true;
-                Static::cancel_ugrep();
-            }
-          }
-        }
-
-        if (avail)
-        {
-          pending_ = false;
-
-          if (!ReadFile(hPipe_, buffer_ + buflen_, static_cast<DWORD>(QUERY_BUFFER_SIZE - buflen_), &nread, blocking_ ? NULL : &overlapped_))
-          {
-            switch (GetLastError())
-            {
-              case ERROR_IO_PENDING:
-                pending_ = true;
-                break;
-
-              case ERROR_MORE_DATA:
-                break;
-
-              case ERROR_HANDLE_EOF:
-              case ERROR_BROKEN_PIPE:
-              default:
-                close(search_pipe_[0]);
-                eof_ = true;
-                Static::cancel_ugrep();
-            }
-          }
-        }
-
-        buflen_ += nread;
-
-#else
-
-        // try to fetch more data from the non-blocking pipe when immediately available
-        ssize_t nread = read(search_pipe_[0], buffer_ + buflen_, QUERY_BUFFER_SIZE - buflen_);
-
-        if (nread > 0)
-        {
-          // success, more data read into the buffer
-          buflen_ += nread;
-        }
-        else if (nread < 0)
-        {
-          // if pipe is empty but not EINTR/EAGAIN/EWOULDBLOCK then error (EOF)
-          if (errno != EINTR && errno != EAGAIN && errno != EWOULDBLOCK)
-          {
-            close(search_pipe_[0]);
-            eof_ = true;
-            Static::cancel_ugrep();
-          }
-        }
-        else
-        {
-          // no data, pipe is closed (EOF)
-          close(search_pipe_[0]);
-          eof_ = true;
-          Static::cancel_ugrep();
-        }
-
-#endif
-      }
-
-      if (buflen_ == 0)
-        break;
-
-      // we may have more data now, so look again for the first newline character in the buffer
-      nlptr = static_cast<char*>(memchr(buffer_, '\n', buflen_));
-
-      if (nlptr == NULL)
-      {
-        // data has no newline but buffer_[] is full, so we will add it and mark it as an incomplete row
-        nlptr = buffer_ + buflen_;
-
-        if (!eof_)
-          incomplete = true;
-      }
+      view_.emplace_back();
+      records_.emplace_back();
+      selected_.push_back(select_all_);
     }
 
-    if (nlptr != NULL)
+    // receive the next row and its record sent by the search thread, when available
+    if (!channel_.receive(view_[rows_], records_[rows_]))
     {
-      // allocate more rows on demand
-      if (rows_ >= static_cast<int>(view_.size()))
+      // no more rows will be sent?
+      if (channel_.eof())
       {
-        view_.emplace_back();
-        selected_.push_back(select_all_);
+        eof_ = true;
+        Static::cancel_ugrep();
       }
 
-      // assign or append the row from the buffer
-      if (append_)
-        view_[rows_].append(buffer_, nlptr - buffer_);
-      else
-        view_[rows_].assign(buffer_, nlptr - buffer_);
-
-      // this row is selected if select all is set
-      selected_[rows_] = select_all_;
-
-      // if row is complete, move to the next
-      if (!incomplete)
-      {
-        // added another row
-        ++rows_;
-
-        // skip \n
-        if (nlptr < buffer_ + buflen_)
-          ++nlptr;
-      }
-
-      // append the next chunk of text from the buffer
-      append_ = incomplete;
+      break;
+    }
 
-      buflen_ -= nlptr - buffer_;
+    // this row is selected if select all is set
+    selected_[rows_] = select_all_;
 
-      // shift the buffer
-      memmove(buffer_, nlptr, buflen_);
-    }
+    // added another row
+    ++rows_;
   }
 
   // true if more rows were fetched
   return prev_rows < rows_;
 }
 
-// execute the search in a new thread and send results to a pipe
-void Query::execute(int pipe_fd)
+// execute the search in a new thread and send results to the channel
+void Query::execute()
 {
-  Static::output = fdopen(pipe_fd, "wb");
+  // all output is sent to the channel
+  Static::output = NULL;
+  Static::channel = &channel_;
 
-  if (Static::output != NULL)
+  try
   {
-    try
-    {
-      ugrep();
-    }
-
-    catch (reflex::regex_error& error)
-    {
-      what_.assign(error.what());
-
-      // error position in the pattern
-      error_ = static_cast<int>(error.pos());
+    ugrep();
+  }
 
-      // subtract 4 for (?m) or (?misx)
-      if (error_ >= 4 + flag_ignore_case + flag_dotall + flag_free_space)
-        error_ -= 4 + flag_ignore_case + flag_dotall + flag_free_space;
+  catch (reflex::regex_error& error)
+  {
+    what_.assign(error.what());
 
-      // subtract 2 for -F
-      if (flag_fixed_strings && error_ >= 2)
-        error_ -= 2;
+    // error position in the pattern
+    error_ = static_cast<int>(error.pos());
 
-      // subtract 2 or 3 for -x or -w
-      if (flags_[27].flag && error_ >= 2)
-        error_ -= 2;
-      else if (flags_[25].flag && error_ >= 3)
-        error_ -= 3;
-    }
+    // subtract 4 for (?m) or (?misx)
+    if (error_ >= 4 + flag_ignore_case + flag_dotall + flag_free_space)
+      error_ -= 4 + flag_ignore_case + flag_dotall + flag_free_space;
 
-    catch (std::exception& error)
-    {
-      what_.assign(error.what());
-
-      // error at the end of the line, not within
-      error_ = line_wsize();
-    }
+    // subtract 2 for -F
+    if (flag_fixed_strings && error_ >= 2)
+      error_ -= 2;
 
-    fclose(Static::output);
-    Static::output = NULL;
+    // subtract 2 or 3 for -x or -w
+    if (flags_[27].flag && error_ >= 2)
+      error_ -= 2;
+    else if (flags_[25].flag && error_ >= 3)
+      error_ -= 3;
   }
-  else
+
+  catch (std::exception& error)
   {
-    what_.assign("cannot fdopen pipe");
+    what_.assign(error.what());
 
     // error at the end of the line, not within
     error_ = line_wsize();
   }
+
+  // send the last incomplete row, if any, and signal the end of the search results
+  channel_.finish();
+
+  Static::channel = NULL;
 }
 
 // cursor up
@@ -1966,12 +1768,12 @@ void Query::back()
     while (ref > 0 && !(found = find_filename(ref, filename, compare_dir)))
       --ref;
 
-    if (found && (compare_dir || !flag_heading))
+    if (found)
     {
       ++ref;
 
       // --tree: skip over directory tree spacing
-      if (compare_dir && flag_tree && (view_[ref].empty() || view_[ref].front() != '\0'))
+      if (compare_dir && flag_tree && records_[ref].pathname.empty())
         ++ref;
     }
   }
@@ -2008,7 +1810,7 @@ void Query::next()
 
       redraw();
 
-      if (found || (eof_ && buflen_ == 0))
+      if (found || eof_)
         return;
 
       // fetch more search results when available
@@ -2046,7 +1848,7 @@ void Query::next()
 
       redraw();
 
-      if (found || (eof_ && buflen_ == 0))
+      if (found || eof_)
         return;
 
       // fetch more search results when available
@@ -2094,7 +1896,7 @@ void Query::jump(int row)
         ++ref;
 
       // exit if at the desired row or if the desired row is beyond the end of the search results
-      if (ref == row || (eof_ && buflen_ == 0))
+      if (ref == row || eof_)
         break;
 
       redraw();
@@ -2118,41 +1920,6 @@ void Query::jump(int row)
   redraw();
 }
 
-// skip over ANSI escape sequence when present on a line
-static size_t skip_escapes(const std::string& line, size_t pos)
-{
-  size_t end = line.size();
-
-  while (pos < end && line.at(pos) == '\033')
-  {
-    if (pos + 1 < end && line.at(pos + 1) == '[')
-    {
-      // CSI \e[... sequence
-      pos += 2;
-      while (pos < end && (line.at(pos) < 0x40 || line.at(pos) > 0x7e))
-        ++pos;
-      ++pos;
-    }
-    else if (pos + 1 < end && line.at(pos + 1) == ']')
-    {
-      // OSC \e]...BEL|ST sequence
-      pos += 2;
-      while (pos < end && line.at(pos) != '\a' && (line.at(pos) != '\033' || (pos + 1 < end && line.at(pos + 1) != '\\')))
-        ++pos;
-      if (pos < end && line.at(pos) == '\033')
-        ++pos;
-      ++pos;
-    }
-    else
-    {
-      // ESC x sequence
-      pos += 2;
-    }
-  }
-
-  return pos;
-}
-
 // view or edit the file located under the cursor or just above in the screen (when not in selection mode)
 void Query::view()
 {
@@ -2206,7 +1973,7 @@ void Query::view()
     if (flag_tree && (flag_files_with_matches || flag_count))
     {
       // --tree with -c or -l: move down over non-filename lines to reach a filename
-      while (ref + 1 < rows_ && (view_[ref].empty() || view_[ref].front() != '\0'))
+      while (ref + 1 < rows_ && records_[ref].pathname.empty())
         ++ref;
     }
     else
@@ -2216,15 +1983,11 @@ void Query::view()
         ++ref;
     }
 
-    // move up until a filename header is found, unless we're at an empty line
+    // move up to a row that belongs to a file, unless we're at an empty line
     if (!view_[ref].empty())
       while (ref >= 0 && !(found = find_filename(ref, filename, false, true, &partname)))
         --ref;
 
-    // only a partname was present, no filename
-    if (filename.empty())
-      found = false;
-
     if (!found && Static::arg_files.size() == 1)
     {
       // if not found an only one FILE argument was provided then view FILE
@@ -2350,18 +2113,14 @@ void Query::preview()
 
     // --tree with -c or -l: move down over non-filename lines to reach a filename
     if (flag_tree && (flag_files_with_matches || flag_count))
-      while (ref + 1 < rows_ && (view_[ref].empty() || view_[ref].front() != '\0'))
+      while (ref + 1 < rows_ && records_[ref].pathname.empty())
         ++ref;
 
-    // find a filename upwards, unless we're at an empty line
+    // find a row that belongs to a file upwards, unless we're at an empty line
     if (!view_[ref].empty())
       while (ref >= 0 && !(found = find_filename(ref, filename, false, true, &partname)))
         --ref;
 
-    // only a partname was present, no filename
-    if (filename.empty())
-      found = false;
-
     if (found && filename.back() == PATHSEPCHR)
     {
       found = false;
@@ -2474,10 +2233,10 @@ void Query::select()
   // --tree: move down over non-filename lines to reach a filename
   if (flag_tree && (flag_files_with_matches || flag_count))
   {
-    while (row + 1 < rows_ && (view_[row].empty() || view_[row].front() != '\0'))
+    while (row + 1 < rows_ && records_[row].pathname.empty())
       ++row;
   }
-  else if (row + 1 < rows_ && (view_[row].empty() || view_[row].front() != '\0'))
+  else if (row + 1 < rows_ && records_[row].pathname.empty())
   {
     ++row; // skip a non-filename line to get to a potential filename just below this line
   }
@@ -2485,7 +2244,7 @@ void Query::select()
   std::string pathname;
   bool found = false;
 
-  // move up until a filename header is found
+  // move up to a row that belongs to a file
   while (row >= 0 && !(found = find_filename(row, pathname, false, true)))
     --row;
 
@@ -3296,33 +3055,22 @@ void Query::print()
   }
 
   // if all lines are selected, output the remaining lines that aren't in view
-  if (select_all_ && (!eof_ || buflen_ > 0))
+  if (select_all_ && !eof_)
   {
-    // reading the search pipe should block until data is received
-#ifdef OS_WIN
-    blocking_ = true;
-    pending_ = false;
-#else
-    set_blocking(search_pipe_[0]);
-#endif
-
-    while (!eof_ || buflen_ > 0)
+    while (!eof_)
     {
-      // if not appending to a row, start over at the begin of the view to conserve memory
-      if (!append_)
-        rows_ = 0;
-
-      i = rows_;
+      // start over at the begin of the view to conserve memory
+      rows_ = 0;
 
-      // fetch a bunch more lines, if no more lines to fetch then break
-      fetch(rows_ + 1000);
+      // fetch a bunch more lines, if none are available yet then wait for the search thread to send more
+      if (!fetch(999))
+        channel_.wait();
 
-      while (i < rows_)
+      for (i = 0; i < rows_; ++i)
       {
         if (!print(view_[i]))
           return;
         view_[i].clear();
-        ++i;
       }
     }
   }
@@ -3758,98 +3506,33 @@ ssize_t Query::stdin_sender(int fd)
   return nwritten;
 }
 
-// true if view_[ref] has a valid filename/filepath identified by three \0 markers and differs from the given filename, then assigns filename
+// true if the row view_[ref] belongs to a file that differs from the given filename, then assigns filename
 bool Query::find_filename(int ref, std::string& filename, bool compare_dir, bool find_path, std::string *partname)
 {
-  // extract the new filename to compare with and assign to the old filename
-  std::string new_filename;
-  size_t start;
-  size_t pos;
-  if (!get_filename(ref, new_filename, start, pos))
-    return false;
+  const Record& record = records_[ref];
 
-  // if we need a pathname but we are at a marked group separator, then return
-  if (find_path && (flag_after_context > 0 || flag_before_context > 0) &&
-      flag_group_separator != NULL &&
-      new_filename.compare(flag_group_separator) == 0)
-    return false;
+  // the row does not belong to a file, -ABC: jump to the group separator unless we find_path only
+  if (record.pathname.empty())
+    return !find_path &&
+      !compare_dir &&
+      (flag_after_context > 0 || flag_before_context > 0) &&
+      flag_group_separator != NULL;
 
-  // if the new filename is an archive part name, then assign it to the partname when applicable
-  if (find_path && flag_decompress && new_filename.front() == '{' && new_filename.back() == '}')
+  // the pathname and the archive part of the row
+  if (find_path)
   {
-    if (partname == NULL)
-      return false;
-
-    // swap partname for filename sans braces
-    new_filename.erase(0, 1);
-    new_filename.pop_back();
-    partname->swap(new_filename);
+    filename.assign(record.pathname);
 
-    // try to find the filename in a header above
-    while (--ref >= 0)
-      if (get_filename(ref, filename, start, pos) && filename.front() != '{')
-        break;
-
-    if (ref < 0)
-      filename.clear();
+    if (partname != NULL)
+      partname->assign(record.partname);
 
     return true;
   }
 
-  // extract the archive partname, if any
-  if (partname != NULL)
-  {
-    // -z: get the archive partname when present
-    if (flag_decompress)
-    {
-      // skip ANSI escape codes when present
-      start = ++pos;
-      const std::string& line = view_[ref];
-      size_t end = line.size();
-      while (pos < end && (pos = skip_escapes(line, pos)) > start)
-        start = pos;
-
-      // extract the part from {part} or {path:part}
-      if (pos < end && line.at(pos) == '{')
-      {
-        start = ++pos;
-
-        while (pos < end && line.at(pos) != '}')
-          ++pos;
-
-        if (start < pos && pos < end)
-          partname->assign(line.substr(start, pos - start));
-      }
-    }
-  }
-
-  // --tree: the new filename is the basename, we should reconstruct the new pathname from the tree in view_[]
-  if (flag_tree && (flag_files_with_matches || flag_count))
-  {
-    size_t last_start = start;
-    std::string dir;
-
-    // while the top directory was not found (works since no colors are used for directory names)
-    while (start > 2 && --ref >= 0)
-    {
-      if (view_[ref].size() <= 1)
-        break;
-
-      if (!get_filename(ref, dir, start, pos))
-        continue;
-
-      // if line scanned represents a parent directory, then prepend the directory to the new filename
-      if (start < last_start && dir.back() == PATHSEPCHR)
-      {
-        new_filename.insert(0, dir);
-        last_start = start;
-      }
-    }
-  }
-
   if (compare_dir)
   {
     // the new filename must not be in the same directory as the old filename
+    const std::string& new_filename = record.pathname;
     size_t skip = 0;
 #ifdef OS_WIN
     if (filename.size() >= 3 && filename.at(1) == ':' && filename.at(2) == PATHSEPCHR)
@@ -3860,100 +3543,36 @@ bool Query::find_filename(int ref, std::string& filename, bool compare_dir, bool
 
     if (pos1 == pos2 && (pos1 == std::string::npos || new_filename.compare(0, pos1, filename, 0, pos2) == 0))
       return false; // the extracted filename is the same or is in the same directory as the old filename
-  }
-  else if ((flag_after_context > 0 || flag_before_context > 0) &&
-      flag_group_separator != NULL &&
-      new_filename.compare(flag_group_separator) == 0)
-  {
-    // -ABC: jump to the group-separator (default is '--') unless we find_path only then ignore group separators
-    return true;
-  }
-  else if (new_filename.compare(filename) == 0)
-  {
-    // the new filename is the same as the old filename
-    return false;
-  }
-
-  filename.swap(new_filename);
-
-  return true;
-}
-
-// get filename from the output, return position at last \0 marker or -1 when not found
-bool Query::get_filename(int ref, std::string& filename, size_t& start, size_t& pos)
-{
-  const std::string& line = view_[ref];
-  size_t end = line.size();
-
-  if (end < 4 || line.front() != '\0')
-    return false;
-
-  pos = 1;
 
-  while (pos < end && line.at(pos) != '\0')
-    ++pos;
+    filename.assign(new_filename);
 
-  if (++pos >= end)
-    return false;
+    return true;
+  }
 
-  start = pos;
+  // -z: archive parts of the same file are different files
+  std::string new_filename(record.pathname);
 
-  while (pos < end && line.at(pos) != '\0')
-    ++pos;
+  if (!record.partname.empty())
+    new_filename.append("{").append(record.partname).append("}");
 
-  if (pos == start || pos >= end)
+  // the new filename is the same as the old filename
+  if (new_filename.compare(filename) == 0)
     return false;
 
-  filename = line.substr(start, pos - start);
+  filename.swap(new_filename);
 
   return true;
 }
 
-// get line number from the output, assumes option -n is active
+// get the line number of the selected row or the row below it, 0 if none
 size_t Query::get_line_number()
 {
   int row = select_ >= 0 ? select_ : row_;
 
-  // look at the current line and the one below it
+  // look at the current row and the one below it, a group separator has no line number
   for (int i = row; i < rows_ && i <= row + 1; ++i)
-  {
-    const std::string& line = view_[i];
-    size_t pos = 0;
-    size_t end = line.size();
-
-    // skip over pathname or group separator when present
-    if (line.front() == '\0')
-    {
-      while (++pos < end && line.at(pos) != '\0')
-        continue;
-
-      while (++pos < end && line.at(pos) != '\0')
-        continue;
-
-      ++pos;
-    }
-
-    while (true)
-    {
-      // skip over ANSI escape sequence when present
-      pos = skip_escapes(line, pos);
-
-      // skip archive part
-      if (pos < end && line.at(pos) == '{')
-        while (pos < end && line.at(pos) != '}')
-          ++pos;
-
-      // at end?
-      if (pos >= end)
-        break;
-
-      // found the line number?
-      if (isdigit(line.at(pos)))
-        return static_cast<size_t>(strtoull(line.c_str() + pos, NULL, 10));
-
-      ++pos;
-    }
-  }
+    if (records_[i].lineno > 0)
+      return records_[i].lineno;
 
   return 0;
 }
@@ -3992,12 +3611,11 @@ std::string                Query::selected_file_;
 std::stack<Query::History> Query::history_;
 int                        Query::skip_                = 0;
 std::vector<std::string>   Query::view_;
+std::vector<Record>        Query::records_;
 std::vector<bool>          Query::selected_;
 bool                       Query::eof_                 = true;
-bool                       Query::append_              = false;
-size_t                     Query::buflen_              = 0;
 char                       Query::buffer_[QUERY_BUFFER_SIZE];
-int                        Query::search_pipe_[2];
+Channel                    Query::channel_;
 std::thread                Query::search_thread_;
 std::string                Query::stdin_buffer_;
 int                        Query::stdin_pipe_[2];
@@ -4011,15 +3629,6 @@ size_t                     Query::only_context_        = 20;
 size_t                     Query::fuzzy_               = 1;
 bool                       Query::dotall_              = false;
 
-#ifdef OS_WIN
-
-HANDLE                     Query::hPipe_;
-OVERLAPPED                 Query::overlapped_;
-bool                       Query::blocking_;
-bool                       Query::pending_;
-
-#endif
-
 Query::Flags Query::flags_[] = {
   { false, 'A', "after context" },
   { false, 'B', "before context" },
@@ -38,6 +38,7 @@
 #define QUERY_HPP
 
 #include "ugrep.hpp"
+#include "output.hpp"
 #include "screen.hpp"
 #include "vkey.hpp"
 
@@ -51,7 +52,7 @@
 #define QUERY_MAX_LEN 1024
 #endif
 
-// size of the chunks of data to buffer when received from the search thread's pipe
+// size of the chunks of data to buffer when reading standard input
 #ifndef QUERY_BUFFER_SIZE
 #define QUERY_BUFFER_SIZE 16384
 #endif
@@ -215,7 +216,7 @@ class Query {
 
   static bool fetch(int row);
 
-  static void execute(int fd);
+  static void execute();
 
   static void up();
 
@@ -269,8 +270,6 @@ class Query {
 
   static bool find_filename(int ref, std::string& filename, bool compare_dir = false, bool find_path = false, std::string *partname = NULL);
 
-  static bool get_filename(int ref, std::string& filename, size_t& start, size_t& pos);
-
   static size_t get_line_number();
 
   static Mode                     mode_;        // query TUI mode
@@ -307,12 +306,11 @@ class Query {
   static std::string              selected_file_;
   static std::stack<History>      history_;
   static std::vector<std::string> view_;        // search output text to display, incrementally fetched
+  static std::vector<Record>      records_;     // the records of the file, line and column of the rows in view_[]
   static std::vector<bool>        selected_;    // marked lines in view_[] selected in selection mode
   static bool                     eof_;         // end of results, no more results can be fetched
-  static bool                     append_;
-  static size_t                   buflen_;
   static char                     buffer_[QUERY_BUFFER_SIZE];
-  static int                      search_pipe_[2];
+  static Channel                  channel_;     // channel of rows of search results sent by the search thread
   static std::thread              search_thread_;
   static std::string              stdin_buffer_;
   static int                      stdin_pipe_[2];
@@ -326,15 +324,6 @@ class Query {
   static size_t                   fuzzy_;       // --fuzzy fuzzy distance
   static bool                     dotall_;      // --dotall flag
 
-#ifdef OS_WIN
-
-  static HANDLE                   hPipe_;
-  static OVERLAPPED               overlapped_;
-  static bool                     blocking_;
-  static bool                     pending_;
-
-#endif
-
   static Flags                    flags_[];
 
 };
@@ -54,13 +54,18 @@ void Stats::report(FILE *output)
     fprintf(output, " in %zu director%s", sd, (sd == 1 ? "y" : "ies"));
   if (!flag_query && flag_pager == NULL)
     fprintf(output, " in %.3g seconds", 0.001 * reflex::timer_elapsed(timer));
-  if (Static::threads > 1)
+  if (threads_last > 0)
+    fprintf(output, " with %zu threads", threads_max);
+  else if (Static::threads > 1)
     fprintf(output, " with %zu threads", Static::threads);
   fprintf(output, ": %zu matching (%.4g%%)", ff, 100.0 * ff / sf);
   if (fp > ff)
     fprintf(output, " + %zu in archives", fp - ff);
   fprintf(output, NEWLINESTR);
 
+  if (threads_up > 0 || threads_down > 0)
+    fprintf(output, "Adjusted the number of active threads %zu times (%zu up, %zu down) between %zu and %zu, ending with %zu" NEWLINESTR, threads_up + threads_down, threads_up, threads_down, threads_min, threads_max, threads_last);
+
   if (fm > 0 && !flag_quiet && !flag_files_with_matches && !flag_files_without_match)
   {
     if (flag_ungroup || (flag_count && flag_only_matching) || (!flag_count && flag_format != NULL))
@@ -186,4 +191,9 @@ std::atomic_size_t       Stats::fileno;
 std::atomic_size_t       Stats::partno;
 std::atomic_size_t       Stats::matchno;
 std::atomic_size_t       Stats::lineno;
+size_t                   Stats::threads_up   = 0;
+size_t                   Stats::threads_down = 0;
+size_t                   Stats::threads_min  = 0;
+size_t                   Stats::threads_max  = 0;
+size_t                   Stats::threads_last = 0;
 std::vector<std::string> Stats::ignore;
@@ -68,6 +68,11 @@ class Stats {
     partno = 0;
     lineno = 0;
     matchno = 0;
+    threads_up = 0;
+    threads_down = 0;
+    threads_min = 0;
+    threads_max = 0;
+    threads_last = 0;
     ignore.clear();
   }
 
@@ -107,6 +112,27 @@ class Stats {
     ++added;
   }
 
+  // score the number of active worker threads set by the master, initially and when adjusted at runtime
+  static void score_threads(size_t active)
+  {
+    if (threads_last == 0)
+    {
+      threads_min = active;
+      threads_max = active;
+    }
+    else if (active > threads_last)
+    {
+      ++threads_up;
+      threads_max = std::max(threads_max, active);
+    }
+    else if (active < threads_last)
+    {
+      ++threads_down;
+      threads_min = std::min(threads_min, active);
+    }
+    threads_last = active;
+  }
+
   // score matches
   static void score_matches(size_t matches, size_t lines)
   {
@@ -189,18 +215,23 @@ class Stats {
 
  protected:
 
-  static reflex::timer_type       timer;   // elapsed wall-clock time in milli seconds (ms)
-  static size_t                   files;   // number of files searched, excluding files in archives
-  static size_t                   dirs;    // number of directories searched
-  static size_t                   indexed; // number of files found to be indexed
-  static size_t                   skipped; // number of files found to be indexed that were skipped as not matching
-  static size_t                   changed; // number of files found to be indexed but changed (stale index file)
-  static size_t                   added;   // number of files found to be added (stale index file)
-  static std::atomic_size_t       fileno;  // number of matching files, excluding files in archives, atomic for GrepWorker::search() update
-  static std::atomic_size_t       partno;  // number of matching files, including files in archives, atomic for GrepWorker::search() update
-  static std::atomic_size_t       lineno;  // number of lines searched cummulatively
-  static std::atomic_size_t       matchno; // number of matches found cummulatively
-  static std::vector<std::string> ignore;  // the .gitignore files encountered in the recursive search with --ignore-files
+  static reflex::timer_type       timer;        // elapsed wall-clock time in milli seconds (ms)
+  static size_t                   files;        // number of files searched, excluding files in archives
+  static size_t                   dirs;         // number of directories searched
+  static size_t                   indexed;      // number of files found to be indexed
+  static size_t                   skipped;      // number of files found to be indexed that were skipped as not matching
+  static size_t                   changed;      // number of files found to be indexed but changed (stale index file)
+  static size_t                   added;        // number of files found to be added (stale index file)
+  static std::atomic_size_t       fileno;       // number of matching files, excluding files in archives, atomic for GrepWorker::search() update
+  static std::atomic_size_t       partno;       // number of matching files, including files in archives, atomic for GrepWorker::search() update
+  static std::atomic_size_t       lineno;       // number of lines searched cummulatively
+  static std::atomic_size_t       matchno;      // number of matches found cummulatively
+  static size_t                   threads_up;   // number of times a worker thread was activated by the master
+  static size_t                   threads_down; // number of times a worker thread was deactivated by the master
+  static size_t                   threads_min;  // min number of active worker threads
+  static size_t                   threads_max;  // max number of active worker threads
+  static size_t                   threads_last; // last number of active worker threads or zero when fixed
+  static std::vector<std::string> ignore;       // the .gitignore files encountered in the recursive search with --ignore-files
 
 };
 
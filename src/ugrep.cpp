@@ -72,6 +72,7 @@ After this, you may want to test ugrep and install it (optional):
 #include "glob.hpp"
 #include "mmap.hpp"
 #include "output.hpp"
+#include "pack.hpp"
 #include "query.hpp"
 #include "stats.hpp"
 #include <reflex/matcher.h>
@@ -129,8 +130,22 @@ After this, you may want to test ugrep and install it (optional):
 #include <dirent.h>
 #include <sys/select.h>
 #include <sys/stat.h>
+#include <sys/resource.h>
 #include <unistd.h>
 
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <poll.h>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <sys/sysmacros.h>
+#include <sys/inotify.h>
+#endif
+
 #endif
 
 // use PCRE2 for option -P
@@ -162,11 +177,26 @@ After this, you may want to test ugrep and install it (optional):
 # define MAX_JOBS 16U
 #endif
 
+// --max-memory: the minimum memory budget per thread, the number of threads is limited to fit the budget
+#ifndef MIN_MEMORY_PER_THREAD
+# define MIN_MEMORY_PER_THREAD 8388608
+#endif
+
+// -J not set: the period in ms to adjust the number of active worker threads, based on the time workers spent searching
+#ifndef ADAPT_JOBS_PERIOD
+# define ADAPT_JOBS_PERIOD 100
+#endif
+
 // limit the job queue size to wait to give the worker threads some slack
 #ifndef MAX_JOB_QUEUE_SIZE
 # define MAX_JOB_QUEUE_SIZE 8192
 #endif
 
+// --server and --connect: max size of a query with the arguments, working directory and environment forwarded to the server
+#ifndef MAX_SERVER_QUERY_SIZE
+# define MAX_SERVER_QUERY_SIZE 1048576
+#endif
+
 // a hard limit on the recursive search depth
 #ifndef MAX_DEPTH
 # define MAX_DEPTH 100
@@ -177,6 +207,26 @@ After this, you may want to test ugrep and install it (optional):
 # define MIN_STEAL 3U
 #endif
 
+// --device-jobs default for rotational disks, the max number of files searched at the same time on a disk to limit disk seeks
+#ifndef ROTATIONAL_JOBS
+# define ROTATIONAL_JOBS 2U
+#endif
+
+// --follow: the max time in ms to wait for the followed files to change before checking them again
+#ifndef FOLLOW_POLL
+# define FOLLOW_POLL 1000
+#endif
+
+// --follow and --checkpoint: the max length of an incomplete last line to search later when complete, a longer line is searched now
+#ifndef MAX_PARTIAL_LINE
+# define MAX_PARTIAL_LINE 65536
+#endif
+
+// --checkpoint: the number of bytes before the checkpoint of a file to hash, to detect a rewritten file
+#ifndef CHECKPOINT_TAIL
+# define CHECKPOINT_TAIL 4096
+#endif
+
 // use dirent d_type when available to improve performance
 #ifdef HAVE_STRUCT_DIRENT_D_TYPE
 # define DIRENT_TYPE_UNKNOWN DT_UNKNOWN
@@ -190,6 +240,31 @@ After this, you may want to test ugrep and install it (optional):
 # define DIRENT_TYPE_REG     1
 #endif
 
+// Linux: read directories in bulk with getdents64() into a DIRENT_BUFFER_SIZE buffer, unless WITHOUT_GETDENTS64 is defined
+#if defined(__linux__) && defined(SYS_getdents64) && defined(HAVE_STRUCT_DIRENT_D_TYPE) && !defined(WITHOUT_GETDENTS64)
+# define WITH_GETDENTS64
+# ifndef DIRENT_BUFFER_SIZE
+#  define DIRENT_BUFFER_SIZE 65536
+# endif
+#endif
+
+// Linux: stat directory entries with statx() requesting only the file information needed, unless WITHOUT_STATX is defined
+#if defined(__linux__) && defined(STATX_TYPE) && !defined(WITHOUT_STATX)
+# define WITH_STATX
+#endif
+
+// --follow and --checkpoint: decode --encoding input with a FILE* that reads the appended data, fopencookie() or funopen()
+#if defined(__linux__)
+# define WITH_FOPENCOOKIE
+#elif defined(__APPLE__) || defined(__FreeBSD__) || defined(__NetBSD__) || defined(__OpenBSD__) || defined(__DragonFly__)
+# define WITH_FUNOPEN
+#endif
+
+// Linux: --affinity=numa pins workers to the CPUs of the NUMA nodes, unless WITHOUT_AFFINITY is defined
+#if defined(__linux__) && defined(CPU_SET) && !defined(WITHOUT_AFFINITY)
+# define WITH_AFFINITY
+#endif
+
 // ANSI SGR substrings extracted from GREP_COLORS
 char color_sl[COLORLEN]; // selected line
 char color_cx[COLORLEN]; // context line
@@ -217,6 +292,48 @@ const char *color_error   = ""; // stderr error text
 const char *color_warning = ""; // stderr warning text
 const char *color_message = ""; // stderr error or warning message text
 
+// a storage device of the directories searched recursively, with a limit on the number of files searched at the same time
+struct Device {
+
+  Device()
+    :
+      limit(0),
+      busy(0),
+      rotational(false),
+      fsid(0),
+      has_fsid(false)
+  { }
+
+  // --device-jobs: wait until fewer than limit files are searched on this device, then take a turn
+  void acquire()
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (busy >= limit)
+      turn.wait(lock);
+
+    ++busy;
+  }
+
+  // --device-jobs: release a turn after searching a file on this device
+  void release()
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+
+    --busy;
+
+    turn.notify_one();
+  }
+
+  size_t                  limit;      // max number of files searched at the same time on this device, zero if unlimited
+  size_t                  busy;       // number of files searched on this device
+  bool                    rotational; // device is a rotational disk, search files in inode order to limit disk seeks
+  uint64_t                fsid;       // the file system id of this device, when has_fsid is true
+  bool                    has_fsid;   // the file system id was obtained with fstatvfs()
+  std::mutex              mutex;      // mutex to take turns
+  std::condition_variable turn;       // cv to wait for a turn
+};
+
 #ifndef OS_WIN
 
 // output file stat is available when stat() result is true
@@ -232,6 +349,236 @@ std::set<ino_t> visited;
 std::set<uint64_t> exclude_fs_ids, include_fs_ids;
 #endif
 
+// the devices of the directories searched recursively by device id, with the cached file system id and --device-jobs limit
+std::map<dev_t,Device> devices;
+
+// --follow and --checkpoint: a file followed as it grows, searching the data appended since the last search
+struct Follow {
+
+  Follow(const std::string& pathname)
+    :
+      pathname(pathname),
+      fd(-1),
+      inode(0),
+      offset(0),
+      lineno(1),
+      stream(NULL),
+      found(false),
+      matched(false)
+  { }
+
+  std::string   pathname; // the pathname of the file followed, reopened when the file is rotated
+  int           fd;       // the open file or -1 when not opened yet
+  ino_t         inode;    // the inode of the open file to detect file rotation
+  off_t         offset;   // the byte offset in the file of the next line to search
+  size_t        lineno;   // the line number of the next line to search
+  std::istream *stream;   // the stream of appended data to search
+  bool          found;    // a range of the file matched before, to count the file once
+  bool          matched;  // the last range searched matched
+};
+
+// --follow and --checkpoint: a stream buffer to read the byte range [offset,end) of a file with pread(), counting newlines
+class rangebuf : public std::streambuf {
+
+ public:
+
+  rangebuf(int fd, off_t offset, off_t end)
+    :
+      fd_(fd),
+      offset_(offset),
+      end_(end),
+      lines_(0),
+      ch_(traits_type::eof())
+  { }
+
+  // the number of newlines in the byte range, reads the rest of the range when not read yet
+  size_t lines()
+  {
+    char buf[65536];
+    while (xsgetn(buf, sizeof(buf)) > 0)
+      continue;
+    return lines_;
+  }
+
+ protected:
+
+  // std::streambuf::underflow()
+  int_type underflow() override
+  {
+    char ch;
+    if (ch_ == traits_type::eof() && read(&ch, 1) == 1)
+      ch_ = traits_type::to_int_type(ch);
+    return ch_;
+  }
+
+  // std::streambuf::uflow()
+  int_type uflow() override
+  {
+    int_type ch = underflow();
+    ch_ = traits_type::eof();
+    return ch;
+  }
+
+  // std::streambuf::showmanyc()
+  std::streamsize showmanyc() override
+  {
+    return offset_ >= end_ && ch_ == traits_type::eof() ? -1 : 0;
+  }
+
+  // std::streambuf::xsgetn(s, n)
+  std::streamsize xsgetn(char *s, std::streamsize n) override
+  {
+    std::streamsize k = 0;
+    if (n > 0 && ch_ != traits_type::eof())
+    {
+      s[k++] = traits_type::to_char_type(ch_);
+      ch_ = traits_type::eof();
+    }
+    while (k < n)
+    {
+      std::streamsize len = read(s + k, n - k);
+      if (len <= 0)
+        break;
+      k += len;
+    }
+    return k;
+  }
+
+  // read up to n bytes from the range into s, returns number of bytes read
+  std::streamsize read(char *s, std::streamsize n)
+  {
+    if (n > end_ - offset_)
+      n = static_cast<std::streamsize>(end_ - offset_);
+    if (n <= 0)
+      return 0;
+    ssize_t len = pread(fd_, s, static_cast<size_t>(n), offset_);
+    if (len <= 0)
+    {
+      // the file shrunk or a read error occurred, end the range
+      end_ = offset_;
+      return 0;
+    }
+    offset_ += len;
+    lines_ += std::count(s, s + len, '\n');
+    return len;
+  }
+
+  int      fd_;     // the file to read
+  off_t    offset_; // the byte offset of the next read
+  off_t    end_;    // the end of the range
+  size_t   lines_;  // the number of newlines read
+  int_type ch_;     // the peeked char or EOF when none
+
+};
+
+#if defined(WITH_FOPENCOOKIE)
+
+// --follow and --checkpoint: fopencookie() read function to read a stream buffer
+static ssize_t streambuf_read(void *cookie, char *buf, size_t size)
+{
+  return static_cast<ssize_t>(static_cast<std::streambuf*>(cookie)->sgetn(buf, static_cast<std::streamsize>(size)));
+}
+
+#elif defined(WITH_FUNOPEN)
+
+// --follow and --checkpoint: funopen() read function to read a stream buffer
+static int streambuf_read(void *cookie, char *buf, int size)
+{
+  return static_cast<int>(static_cast<std::streambuf*>(cookie)->sgetn(buf, static_cast<std::streamsize>(size)));
+}
+
+#endif
+
+// --follow and --checkpoint: open a FILE* to read a stream buffer, because reflex::Input decodes --encoding of FILE* input only, returns NULL when not supported
+static FILE *streambuf_open(std::streambuf *buf)
+{
+#if defined(WITH_FOPENCOOKIE)
+  cookie_io_functions_t functions = { streambuf_read, NULL, NULL, NULL };
+  return fopencookie(buf, "rb", functions);
+#elif defined(WITH_FUNOPEN)
+  return funopen(buf, streambuf_read, NULL, NULL, NULL);
+#else
+  (void)buf;
+  errno = ENOTSUP;
+  return NULL;
+#endif
+}
+
+// --follow and --checkpoint: true if the newline of the encoding is a single \n byte, to search the complete lines appended
+static bool single_byte_newline(reflex::Input::file_encoding_type encoding)
+{
+  switch (encoding)
+  {
+    case reflex::Input::file_encoding::utf16be:
+    case reflex::Input::file_encoding::utf16le:
+    case reflex::Input::file_encoding::utf32be:
+    case reflex::Input::file_encoding::utf32le:
+    case reflex::Input::file_encoding::ebcdic:
+      return false;
+    default:
+      return true;
+  }
+}
+
+// --checkpoint=FILE: the byte offsets and line numbers reached in the files searched, to search only the data appended in the next run
+struct Checkpoint {
+
+  // checkpoint file identifying magic record
+  static const char *MAGIC;
+
+  // the checkpoint of a file, with a hash of the CHECKPOINT_TAIL bytes before the offset to detect a rewritten file
+  struct Mark {
+    uint64_t dev;    // the device of the file
+    uint64_t inode;  // the inode of the file
+    uint64_t offset; // the byte offset reached
+    uint64_t lineno; // the line number reached
+    uint64_t hash;   // the hash of the bytes before the offset
+  };
+
+  Checkpoint()
+    :
+      changed(false)
+  { }
+
+  // load the checkpoint file
+  void open();
+
+  // save the checkpoint file when changed, dropping the checkpoints of files that no longer exist
+  void close();
+
+  // get the checkpoint of a file, returns false if none
+  bool find(const std::string& pathname, Mark& mark)
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    Marks::const_iterator i = marks.find(pathname);
+    if (i == marks.end())
+      return false;
+    mark = i->second;
+    return true;
+  }
+
+  // set the checkpoint of a file
+  void add(const std::string& pathname, const Mark& mark)
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    marks[pathname] = mark;
+    changed = true;
+  }
+
+  // FNV-1a hash of the CHECKPOINT_TAIL bytes before the offset in a file
+  static uint64_t hash(int fd, off_t offset);
+
+  typedef std::map<std::string,Mark> Marks;
+
+  bool       changed; // checkpoints were added
+  Marks      marks;   // the checkpoints by pathname
+  std::mutex mutex;   // mutex to access the checkpoints from workers
+
+};
+
+// the --checkpoint state shared by all workers
+Checkpoint checkpoint;
+
 #endif
 
 // ugrep command-line options
@@ -252,6 +599,7 @@ bool flag_files                    = false;
 bool flag_files_with_matches       = false;
 bool flag_files_without_match      = false;
 bool flag_fixed_strings            = false;
+bool flag_follow                   = false;
 bool flag_glob_ignore_case         = false;
 bool flag_grep                     = false;
 bool flag_hex                      = false;
@@ -310,6 +658,7 @@ Action flag_directories_action     = Action::UNSP;
 size_t flag_after_context          = 0;
 size_t flag_before_context         = 0;
 size_t flag_delay                  = DEFAULT_QUERY_DELAY;
+size_t flag_device_jobs            = 0;
 size_t flag_exclude_iglob_size     = 0;
 size_t flag_exclude_iglob_dir_size = 0;
 size_t flag_fuzzy                  = 0;
@@ -323,6 +672,7 @@ size_t flag_max_count              = 0;
 size_t flag_max_depth              = 0;
 size_t flag_max_files              = 0;
 size_t flag_max_line               = 0;
+size_t flag_max_memory             = 0;
 size_t flag_max_mmap               = DEFAULT_MAX_MMAP_SIZE;
 size_t flag_min_count              = 0;
 size_t flag_min_depth              = 0;
@@ -333,8 +683,10 @@ size_t flag_not_magic              = 0;
 size_t flag_tabs                   = DEFAULT_TABS;
 size_t flag_width                  = 0;
 size_t flag_zmax                   = 1;
+const char *flag_affinity          = NULL;
 const char *flag_apply_color       = NULL;
 const char *flag_binary_files      = "binary";
+const char *flag_checkpoint        = NULL;
 const char *flag_color             = DEFAULT_COLOR;
 const char *flag_colors            = NULL;
 const char *flag_config            = NULL;
@@ -358,6 +710,7 @@ const char *flag_separator         = NULL;
 const char *flag_separator_dash    = "-";
 const char *flag_separator_plus    = "+";
 const char *flag_separator_bar     = "|";
+const char *flag_snapshot          = NULL;
 const char *flag_sort              = NULL;
 const char *flag_stats             = NULL;
 const char *flag_tag               = NULL;
@@ -411,6 +764,7 @@ void trim_pathname_arg(const char *arg);
 bool is_output(ino_t inode);
 size_t strtonum(const char *string, const char *message);
 size_t strtopos(const char *string, const char *message);
+size_t strtosize(const char *string, const char *message);
 void strtopos2(const char *string, size_t& pos1, size_t& pos2, const char *message);
 size_t strtofuzzy(const char *string, const char *message);
 void import_globs(FILE *file, std::vector<std::string>& files, std::vector<std::string>& dirs, bool gitignore = false);
@@ -422,6 +776,12 @@ void is_directory(const char *pathname);
 void cannot_decompress(const char *pathname, const char *message);
 void open_pager();
 void close_pager();
+int run(int argc, const char **argv);
+
+#ifndef OS_WIN
+int connect_server(const char *socket_path, int argc, const char **argv);
+void serve(const char *socket_path);
+#endif
 
 #ifdef OS_WIN
 
@@ -1891,6 +2251,12 @@ struct Grep {
       return a.pathname < b.pathname;
     }
 
+    // compare two entries by inode number, if equal compare by pathname
+    static bool comp_by_inode(const Entry& a, const Entry& b)
+    {
+      return a.inode < b.inode || (a.inode == b.inode && a.pathname < b.pathname);
+    }
+
     // compare two entries by size or time (atime, mtime, or ctime), if equal compare by pathname
     static bool comp_by_info(const Entry& a, const Entry& b)
     {
@@ -1928,18 +2294,23 @@ struct Grep {
     // sentinel job NONE
     static const size_t NONE = UNDEFINED_SIZE;
 
+    // -Z and --sort=best: job COST to help the master compute edit distance costs
+    static const size_t COST = UNDEFINED_SIZE - 1;
+
     Job()
       :
         pathname(),
         cost(Entry::UNDEFINED_COST),
-        slot(NONE)
+        slot(NONE),
+        device(NULL)
     { }
 
-    Job(const char *pathname, uint16_t cost, size_t slot)
+    Job(const char *pathname, uint16_t cost, size_t slot, Device *device)
       :
         pathname(pathname != Static::LABEL_STANDARD_INPUT ? pathname : ""), // empty pathname means stdin
         cost(cost),
-        slot(slot)
+        slot(slot),
+        device(device)
     { }
 
     bool none()
@@ -1947,9 +2318,15 @@ struct Grep {
       return slot == NONE;
     }
 
+    bool costing()
+    {
+      return slot == COST;
+    }
+
     std::string pathname;
     uint16_t    cost;
     size_t      slot;
+    Device     *device; // --device-jobs: the device to take a turn on to search the file, or NULL
   };
 
 #ifdef WITH_LOCK_FREE_JOB_QUEUE
@@ -1972,11 +2349,11 @@ struct Grep {
     // add a sentinel NONE job to the queue
     void enqueue()
     {
-      enqueue("", Entry::UNDEFINED_COST, Job::NONE);
+      enqueue("", Entry::UNDEFINED_COST, Job::NONE, NULL);
     }
 
     // add a job to the queue
-    void enqueue(const char *pathname, uint16_t cost, size_t slot)
+    void enqueue(const char *pathname, uint16_t cost, size_t slot, Device *device)
     {
       Job *job = tail.load();
       Job *next = job + 1;
@@ -1993,13 +2370,14 @@ struct Grep {
       job->pathname.assign(pathname);
       job->cost = cost;
       job->slot = slot;
+      job->device = device;
       tail.store(next);
       ++todo;
       queue_data.notify_one();
     }
 
     // try to add a job to the queue if the queue is not too large
-    bool try_enqueue(const char *pathname, uint16_t cost, size_t slot)
+    bool try_enqueue(const char *pathname, uint16_t cost, size_t slot, Device *device)
     {
       Job *job = tail.load();
       Job *next = job + 1;
@@ -2012,6 +2390,7 @@ struct Grep {
       job->pathname.assign(pathname);
       job->cost = cost;
       job->slot = slot;
+      job->device = device;
       tail.store(next);
       ++todo;
       queue_data.notify_one();
@@ -2070,23 +2449,23 @@ struct Grep {
     }
 
     // add a job to the queue
-    void enqueue(const char *pathname, uint16_t cost, size_t slot)
+    void enqueue(const char *pathname, uint16_t cost, size_t slot, Device *device)
     {
       std::unique_lock<std::mutex> lock(queue_mutex);
 
-      emplace_back(pathname, cost, slot);
+      emplace_back(pathname, cost, slot, device);
       ++todo;
 
       queue_work.notify_one();
     }
 
     // try to add a job to the queue if the queue is not too large
-    bool try_enqueue(const char *pathname, uint16_t cost, size_t slot)
+    bool try_enqueue(const char *pathname, uint16_t cost, size_t slot, Device *device)
     {
       if (todo >= MAX_JOB_QUEUE_SIZE)
         return false;
 
-      enqueue(pathname, cost, slot);
+      enqueue(pathname, cost, slot, device);
 
       return true;
     }
@@ -2630,6 +3009,9 @@ struct Grep {
 
         if (flag_group_separator != NULL)
         {
+          // -Q: the group separator does not belong to a file
+          grep.out.mark();
+
           if (flag_query && !flag_text)
           {
             grep.out.chr('\0');
@@ -2881,6 +3263,9 @@ struct Grep {
         if (hex)
           grep.out.dump.done();
 
+        // -Q: the group separator does not belong to a file
+        grep.out.mark();
+
         if (flag_query && !flag_text)
         {
           grep.out.chr('\0');
@@ -3134,10 +3519,15 @@ struct Grep {
       out(file),
       matcher(matcher),
       matchers(matchers),
-      file_in(NULL)
+      file_in(NULL),
+      device(NULL)
 #ifndef OS_WIN
+    , follow(NULL)
     , stdin_handler(this)
 #endif
+#ifdef WITH_GETDENTS64
+    , dir_fd(AT_FDCWD)
+#endif
 #ifdef HAVE_LIBZ
 #ifdef WITH_DECOMPRESSION_THREAD
     , zthread(false, partname)
@@ -3189,12 +3579,40 @@ struct Grep {
   // search file or directory for pattern matches
   Type select(size_t level, const char *pathname, const char *basename, int type, ino_t& inode, uint64_t& info, bool is_argument = false);
 
+#ifndef OS_WIN
+  // stat() or lstat() a file or directory to select, returns zero on success
+  int stat_entry(const char *pathname, const char *basename, struct stat *buf, bool follow);
+#endif
+
   // recurse a directory
   virtual void recurse(size_t level, const char *pathname);
 
+  // recursively search a directory specified as a FILE argument or the working directory
+  void recurse_root(const char *pathname);
+
+#ifndef OS_WIN
+  // --follow: search the FILE arguments and the files in the DIR arguments, then search the data appended as the files grow
+  void follow_files();
+
+  // --follow: search the data appended to a followed file, reopen the file when rotated, when final search the last incomplete line
+  void follow_file(Follow& file, bool final = false);
+
+  // --follow and --checkpoint: search the byte range [file.offset,end) of a file, then advance the offset and line number to the end
+  void follow_range(Follow& file, off_t end, uint16_t cost);
+
+  // --checkpoint: search a file from its checkpoint, returns false when the file is not a regular file to search as usual
+  bool checkpoint_file(const char *pathname, uint16_t cost);
+#endif
+
   // -Z and --sort=best: perform a presearch to determine edit distance cost, return cost of pathname file, MAX_COST when no match is found
   uint16_t compute_cost(const char *pathname);
 
+  // -Z and --sort=best: presearch the entries to determine their edit distance costs, removes entries that cannot be opened
+  virtual void compute_costs(std::vector<Entry>& entries);
+
+  // -Z and --sort=best: remove entries that cannot be opened and, with --best-match, entries that do not match
+  void remove_costless(std::vector<Entry>& entries);
+
   // search a file or archive
   virtual void search(const char *pathname, uint16_t cost);
 
@@ -3357,6 +3775,29 @@ struct Grep {
   // open a file for (binary) reading and assign input, decompress the file when -z, --decompress specified, may throw bad_alloc
   bool open_file(const char *pathname, const char *find = NULL)
   {
+#ifndef OS_WIN
+    // --follow and --checkpoint: search the data appended to the file
+    if (follow != NULL)
+    {
+      if (flag_encoding_type == reflex::Input::file_encoding::plain)
+      {
+        input = follow->stream;
+        return true;
+      }
+
+      // --encoding: read the appended data with a FILE* to decode it
+      file_in = streambuf_open(follow->stream->rdbuf());
+      if (file_in == NULL)
+      {
+        warning("cannot read", pathname);
+        return false;
+      }
+
+      input = reflex::Input(file_in, flag_encoding_type);
+      return true;
+    }
+#endif
+
     if (pathname == Static::LABEL_STANDARD_INPUT)
     {
       if (Static::source == NULL)
@@ -3819,8 +4260,20 @@ struct Grep {
     if (flag_binary_without_match && init_is_binary())
       return false;
 
+    size_t lineno = 1;
+
+#ifndef OS_WIN
+    // --follow and --checkpoint: continue the line numbers and byte offsets of the file
+    if (follow != NULL)
+    {
+      lineno = follow->lineno;
+      matcher->lineno(lineno);
+      matcher->position(follow->offset);
+    }
+#endif
+
     // --range=NUM1[,NUM2]: start searching at line NUM1
-    for (size_t i = flag_min_line; i > 1; --i)
+    for (size_t i = flag_min_line; i > lineno; --i)
       if (!matcher->skip('\n'))
         break;
 
@@ -3859,9 +4312,14 @@ struct Grep {
   MMap                           mmap;          // mmap state
   reflex::Input                  input;         // input to the matcher
   FILE                          *file_in;       // the current input file
+  Device                        *device;        // --device-jobs: the device of the directory read by recurse() with a limit, or NULL
 #ifndef OS_WIN
+  Follow                        *follow;        // --follow and --checkpoint: the file with the appended data to search, or NULL
   StdInHandler                   stdin_handler; // a handler to handle nonblocking stdin from a TTY or a slow pipe
 #endif
+#ifdef WITH_GETDENTS64
+  int                            dir_fd;        // the directory being read by recurse() to select() its entries, or AT_FDCWD
+#endif
 #ifdef HAVE_LIBZ
 #ifdef WITH_DECOMPRESSION_THREAD
   Zthread                        zthread;
@@ -3875,13 +4333,120 @@ struct Grep {
 
 struct GrepWorker;
 
+// steady clock time in microseconds
+static uint64_t time_us()
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// CPU time used by this process in microseconds
+static uint64_t cpu_time_us()
+{
+#ifdef OS_WIN
+  FILETIME creation_time, exit_time, kernel_time, user_time;
+  if (!GetProcessTimes(GetCurrentProcess(), &creation_time, &exit_time, &kernel_time, &user_time))
+    return 0;
+  return ((static_cast<uint64_t>(kernel_time.dwHighDateTime) << 32 | kernel_time.dwLowDateTime) + (static_cast<uint64_t>(user_time.dwHighDateTime) << 32 | user_time.dwLowDateTime)) / 10;
+#else
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0)
+    return 0;
+  return 1000000 * static_cast<uint64_t>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) + usage.ru_utime.tv_usec + usage.ru_stime.tv_usec;
+#endif
+}
+
+#ifdef WITH_AFFINITY
+
+// --affinity=numa: read a Linux CPU or node list such as 0-3,8-11 from a sysfs file, returns false when the file cannot be read
+static bool read_cpulist(const char *path, std::vector<int>& list)
+{
+  FILE *file = fopen(path, "r");
+
+  if (file == NULL)
+    return false;
+
+  char buf[4096];
+  bool ok = fgets(buf, sizeof(buf), file) != NULL;
+
+  fclose(file);
+
+  if (!ok)
+    return false;
+
+  const char *s = buf;
+
+  while (isdigit(static_cast<unsigned char>(*s)))
+  {
+    char *rest;
+    int from = static_cast<int>(strtol(s, &rest, 10));
+    int to = from;
+
+    if (*rest == '-')
+      to = static_cast<int>(strtol(rest + 1, &rest, 10));
+
+    for (int i = from; i <= to; ++i)
+      list.push_back(i);
+
+    s = rest;
+    if (*s == ',')
+      ++s;
+  }
+
+  return true;
+}
+
+// --affinity=numa: the CPU sets of the NUMA nodes with CPUs, or none when there are fewer than two such nodes
+static std::vector<cpu_set_t> numa_nodes()
+{
+  std::vector<cpu_set_t> nodes;
+  std::vector<int> online;
+
+  if (!read_cpulist("/sys/devices/system/node/online", online))
+    return nodes;
+
+  for (int node : online)
+  {
+    char path[64];
+    std::vector<int> cpus;
+
+    snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", node);
+
+    if (!read_cpulist(path, cpus) || cpus.empty())
+      continue;
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+
+    for (int cpu : cpus)
+      if (cpu < CPU_SETSIZE)
+        CPU_SET(cpu, &set);
+
+    nodes.push_back(set);
+  }
+
+  // a single node has nothing to gain from pinning workers
+  if (nodes.size() < 2)
+    nodes.clear();
+
+  return nodes;
+}
+
+#endif
+
 // master submits jobs to workers and implements operations to support job stealing
 struct GrepMaster : public Grep {
 
   GrepMaster(FILE *file, reflex::AbstractMatcher *matcher, Static::Matchers *matchers)
     :
       Grep(file, matcher, matchers),
-      sync(flag_sort_key == Sort::NA ? Output::Sync::Mode::UNORDERED : Output::Sync::Mode::ORDERED)
+      active(0),
+      adapt_time(0),
+      adapt_busy(0),
+      adapt_cpu(0),
+      sync(flag_sort_key == Sort::NA ? Output::Sync::Mode::UNORDERED : Output::Sync::Mode::ORDERED),
+      cost_entries(NULL),
+      cost_next(0),
+      cost_active(0)
   {
     // master and workers synchronize their output
     out.sync_on(&sync);
@@ -3889,9 +4454,31 @@ struct GrepMaster : public Grep {
     // set global handle to be able to call cancel_ugrep()
     Static::set_grep_handle(this);
 
+#ifdef WITH_AFFINITY
+    // --affinity=numa: spread the workers over the NUMA nodes
+    if (flag_affinity != NULL)
+      nodes = numa_nodes();
+#endif
+
     start_workers();
 
     iworker = workers.begin();
+
+    // -J not set: activate the base number of workers, the other workers are activated when searching is I/O bound
+    iactive = workers.end();
+    active = Static::threads;
+    if (Static::base_threads > 0)
+    {
+      while (active > Static::base_threads)
+      {
+        --iactive;
+        --active;
+      }
+
+      adapt_time = time_us();
+      adapt_cpu = cpu_time_us();
+      Stats::score_threads(active);
+    }
   }
 
   virtual ~GrepMaster()
@@ -3938,6 +4525,12 @@ struct GrepMaster : public Grep {
     submit(pathname, cost);
   }
 
+  // -Z and --sort=best: presearch the entries concurrently with the workers to determine their edit distance costs
+  void compute_costs(std::vector<Entry>& entries) override;
+
+  // -Z and --sort=best: compute edit distance costs of the shared entries until none are left, called by the master and by workers
+  void compute_costs_shared(Grep *grep);
+
   // start worker threads
   void start_workers();
 
@@ -3950,19 +4543,46 @@ struct GrepMaster : public Grep {
   // job stealing on behalf of a worker from a co-worker with at least --min-steal jobs still to do
   bool steal(GrepWorker *worker);
 
-  std::list<GrepWorker>           workers; // workers running threads
-  std::list<GrepWorker>::iterator iworker; // the next worker to submit a job to
-  Output::Sync                    sync;    // sync output of workers
+  // -J not set: adjust the number of active workers every ADAPT_JOBS_PERIOD ms, based on the time workers spent searching and the CPU time used
+  void adapt();
+
+  // the next active worker, around we go
+  void next_worker(std::list<GrepWorker>::iterator& worker)
+  {
+    ++worker;
+    if (worker == iactive)
+      worker = workers.begin();
+  }
+
+  std::list<GrepWorker>           workers;      // workers running threads
+  std::list<GrepWorker>::iterator iworker;      // the next worker to submit a job to
+  std::list<GrepWorker>::iterator iactive;      // the end of the active workers to submit jobs to
+  size_t                          active;       // the number of active workers to submit jobs to
+  uint64_t                        adapt_time;   // -J not set: time in us of the last adjustment of the active workers
+  uint64_t                        adapt_busy;   // -J not set: total time in us workers spent searching at the last adjustment
+  uint64_t                        adapt_cpu;    // -J not set: CPU time in us used at the last adjustment
+  Output::Sync                    sync;         // sync output of workers
+  std::vector<Entry>             *cost_entries; // --sort=best: entries shared with workers to compute edit distance costs or NULL
+  std::atomic_size_t              cost_next;    // --sort=best: index of the next shared entry to compute
+  size_t                          cost_active;  // --sort=best: number of workers computing costs of the shared entries
+  std::mutex                      cost_mutex;   // --sort=best: mutex to share the entries
+  std::condition_variable         cost_done;    // --sort=best: cv to wait for the workers to finish computing costs
+#ifdef WITH_AFFINITY
+  std::vector<cpu_set_t>          nodes;        // --affinity=numa: the CPU sets of the NUMA nodes to pin workers to, empty if none
+#endif
 
 };
 
 // worker runs a thread to execute jobs submitted by the master
 struct GrepWorker : public Grep {
 
-  GrepWorker(FILE *file, GrepMaster *master)
+  GrepWorker(FILE *file, GrepMaster *master, size_t index)
     :
       Grep(file, master->matcher_clone(), master->matchers_clone()),
-      master(master)
+      master(master),
+      index(index),
+      busy_time(0),
+      busy_since(0)
   {
     // all workers synchronize their output on the master's sync object
     out.sync_on(&master->sync);
@@ -3984,6 +4604,28 @@ struct GrepWorker : public Grep {
   // worker thread execution
   void execute();
 
+#ifdef WITH_AFFINITY
+  // --affinity=numa: pin this worker to the CPUs of its NUMA node and clone the matchers again to allocate them on the node
+  void localize()
+  {
+    const cpu_set_t& cpus = master->nodes[index % master->nodes.size()];
+
+    if (sched_setaffinity(0, sizeof(cpus), &cpus) != 0)
+      return;
+
+    // memory is allocated on the node of the thread that first touches it, the matchers were cloned by the master
+    reflex::AbstractMatcher *local_matcher = matcher->clone();
+    delete matcher;
+    matcher = local_matcher;
+
+    if (matchers != NULL)
+      for (auto& i : *matchers)
+        for (auto& j : i)
+          if (j)
+            j.reset(j->clone());
+  }
+#endif
+
   // submit Job::NONE sentinel to this worker
   void submit_job()
   {
@@ -3991,15 +4633,21 @@ struct GrepWorker : public Grep {
   }
 
   // submit a job to this worker
-  void submit_job(const char *pathname, uint16_t cost, size_t slot)
+  void submit_job(const char *pathname, uint16_t cost, size_t slot, Device *device)
   {
-    jobs.enqueue(pathname, cost, slot);
+    jobs.enqueue(pathname, cost, slot, device);
+  }
+
+  // submit a Job::COST job to this worker to help compute edit distance costs
+  void submit_cost_job()
+  {
+    jobs.enqueue("", Entry::UNDEFINED_COST, Job::COST, NULL);
   }
 
   // submit a job to this worker
-  bool try_submit_job(const char *pathname, uint16_t cost, size_t slot)
+  bool try_submit_job(const char *pathname, uint16_t cost, size_t slot, Device *device)
   {
-    return jobs.try_enqueue(pathname, cost, slot);
+    return jobs.try_enqueue(pathname, cost, slot, device);
   }
 
   // receive a job for this worker, wait until one arrives
@@ -4014,9 +4662,21 @@ struct GrepWorker : public Grep {
     submit_job();
   }
 
+  // total time in us spent searching so far, including the current search
+  uint64_t busy(uint64_t now)
+  {
+    uint64_t since = busy_since.load(std::memory_order_relaxed);
+    uint64_t time = busy_time.load(std::memory_order_relaxed);
+
+    return since > 0 && since < now ? time + (now - since) : time;
+  }
+
   std::thread             thread;      // thread of this worker, spawns GrepWorker::execute()
   GrepMaster             *master;      // the master of this worker
+  size_t                  index;       // the index of this worker
   JobQueue                jobs;        // queue of pending jobs submitted to this worker
+  std::atomic<uint64_t>   busy_time;   // -J not set: total time in us spent searching completed jobs
+  std::atomic<uint64_t>   busy_since;  // -J not set: time in us when the current search started or zero when idle
 };
 
 // start worker threads
@@ -4028,7 +4688,7 @@ void GrepMaster::start_workers()
   try
   {
     for (num = 0; num < Static::threads; ++num)
-      workers.emplace(workers.end(), out.file, this);
+      workers.emplace(workers.end(), out.file, this, num);
   }
 
   // if sufficient resources are not available then reduce the number of threads to the number of active workers created
@@ -4060,12 +4720,12 @@ void GrepMaster::submit(const char *pathname, uint16_t cost)
   {
     size_t min_todo = iworker->jobs.todo;
 
-    // find a worker with the minimum number of jobs
+    // find an active worker with the minimum number of jobs
     if (min_todo > 0)
     {
       auto min_worker = iworker;
 
-      for (size_t num = 0; num < Static::threads; ++num)
+      for (size_t num = 0; num < active; ++num)
       {
         if (iworker->jobs.todo < min_todo)
         {
@@ -4073,16 +4733,14 @@ void GrepMaster::submit(const char *pathname, uint16_t cost)
           min_worker = iworker;
         }
 
-        ++iworker;
-        if (iworker == workers.end())
-          iworker = workers.begin();
+        next_worker(iworker);
       }
 
       iworker = min_worker;
     }
 
     // try to submit, if not successful then the queue is full
-    if (iworker->try_submit_job(pathname, cost, sync.next) || out.eof || out.cancelled())
+    if (iworker->try_submit_job(pathname, cost, sync.next, device) || out.eof || out.cancelled())
       break;
 
     // give the worker threads some slack to make progress, then try again
@@ -4092,9 +4750,142 @@ void GrepMaster::submit(const char *pathname, uint16_t cost)
   ++sync.next;
 
   // around we go
-  ++iworker;
-  if (iworker == workers.end())
-    iworker = workers.begin();
+  next_worker(iworker);
+
+  // -J not set: adjust the number of active workers
+  if (Static::base_threads > 0)
+    adapt();
+}
+
+// -J not set: adjust the number of active workers every ADAPT_JOBS_PERIOD ms, based on the time workers spent searching and the CPU time used
+void GrepMaster::adapt()
+{
+  uint64_t now = time_us();
+  uint64_t period = now - adapt_time;
+
+  if (period < 1000 * ADAPT_JOBS_PERIOD)
+    return;
+
+  // the time all workers spent searching and the CPU time used in this period
+  uint64_t busy = 0;
+  for (auto& worker : workers)
+    busy += worker.busy(now);
+  uint64_t cpu = cpu_time_us();
+  uint64_t busy_period = busy > adapt_busy ? busy - adapt_busy : 0;
+  uint64_t cpu_period = cpu > adapt_cpu ? cpu - adapt_cpu : 0;
+
+  adapt_time = now;
+  adapt_busy = busy;
+  adapt_cpu = cpu;
+
+  // the fraction of time the active workers were busy searching
+  double load = static_cast<double>(busy_period) / static_cast<double>(active * period);
+
+  // the fraction of the time searching that workers were blocked on I/O, i.e. not using the CPU
+  double blocked = busy_period > cpu_period ? 1.0 - static_cast<double>(cpu_period) / static_cast<double>(busy_period) : 0.0;
+
+  // the fraction of the CPU cores used, workers waiting for a core are not blocked on I/O
+  unsigned int cores = std::max(std::thread::hardware_concurrency(), 1U);
+  double cpu_load = static_cast<double>(cpu_period) / static_cast<double>(cores * period);
+
+  if (load >= 0.9)
+  {
+    // workers are busy: activate a worker when fewer than the base are active or when searching is I/O bound
+    if (active < Static::threads && (active < Static::base_threads || (blocked >= 0.25 && cpu_load < 0.9)))
+    {
+      ++iactive;
+      ++active;
+      Stats::score_threads(active);
+    }
+    // searching is CPU bound, deactivate a worker above the base
+    else if ((blocked < 0.1 || cpu_load >= 0.9) && active > Static::base_threads)
+    {
+      --iactive;
+      --active;
+      Stats::score_threads(active);
+    }
+  }
+  else if (load < 0.25 && active > 1)
+  {
+    // workers are starving, because the master's traversal is the bottleneck, deactivate a worker
+    --iactive;
+    --active;
+    Stats::score_threads(active);
+  }
+
+  // do not submit jobs to a worker that was deactivated, its pending jobs are still executed or stolen by co-workers
+  if (iworker == iactive)
+    iworker = workers.begin();
+}
+
+// -Z and --sort=best: presearch the entries concurrently with the workers to determine their edit distance costs, the
+// match positions are not kept for search(), because compute_cost() stops at the first exact match and search() must
+// format all matches with their lines and context, only the costs of non-matching files are reused by remove_costless()
+void GrepMaster::compute_costs(std::vector<Entry>& entries)
+{
+  // not worth sharing a single entry with the workers
+  if (entries.size() <= 1)
+  {
+    Grep::compute_costs(entries);
+    return;
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(cost_mutex);
+
+    cost_entries = &entries;
+    cost_next = 0;
+  }
+
+  // ask the workers to help out when they are done with their pending jobs
+  for (auto& worker : workers)
+    worker.submit_cost_job();
+
+  // the master computes costs too, using its own matcher
+  compute_costs_shared(this);
+
+  // all entries are taken, wait for the workers that are still computing costs
+  {
+    std::unique_lock<std::mutex> lock(cost_mutex);
+
+    while (cost_active > 0)
+      cost_done.wait(lock);
+
+    // late Job::COST jobs still queued have nothing left to do
+    cost_entries = NULL;
+  }
+
+  remove_costless(entries);
+}
+
+// -Z and --sort=best: compute edit distance costs of the shared entries until none are left, called by the master and by workers
+void GrepMaster::compute_costs_shared(Grep *grep)
+{
+  std::vector<Entry> *entries;
+
+  {
+    std::unique_lock<std::mutex> lock(cost_mutex);
+
+    entries = cost_entries;
+
+    if (entries == NULL)
+      return;
+
+    ++cost_active;
+  }
+
+  size_t index;
+
+  while ((index = cost_next++) < entries->size())
+    (*entries)[index].cost = grep->compute_cost((*entries)[index].pathname.c_str());
+
+  {
+    std::unique_lock<std::mutex> lock(cost_mutex);
+
+    --cost_active;
+  }
+
+  cost_done.notify_one();
 }
 
 #ifndef WITH_LOCK_FREE_JOB_QUEUE
@@ -4148,6 +4939,12 @@ void GrepWorker::execute()
 {
   Job job;
 
+#ifdef WITH_AFFINITY
+  // --affinity=numa: run on the CPUs of our NUMA node with node-local matchers
+  if (!master->nodes.empty())
+    localize();
+#endif
+
   while (!out.eof && !out.cancelled())
   {
     // wait for next job
@@ -4157,15 +4954,39 @@ void GrepWorker::execute()
     if (job.none())
       break;
 
+    // -Z and --sort=best: help the master to compute edit distance costs
+    if (job.costing())
+    {
+      master->compute_costs_shared(this);
+      continue;
+    }
+
+    // --device-jobs: wait for a turn to search the file on its device
+    if (job.device != NULL)
+      job.device->acquire();
+
     // start synchronizing output for this job slot in ORDERED mode (--sort)
     out.begin(job.slot);
 
+    // -J not set: measure the time spent searching to adjust the number of active workers
+    if (Static::base_threads > 0)
+      busy_since.store(time_us(), std::memory_order_relaxed);
+
     // search the file for this job, an empty pathname means stdin
     search(job.pathname.empty() ? Static::LABEL_STANDARD_INPUT : job.pathname.c_str(), job.cost);
 
+    if (Static::base_threads > 0)
+    {
+      busy_time.fetch_add(time_us() - busy_since.load(std::memory_order_relaxed), std::memory_order_relaxed);
+      busy_since.store(0, std::memory_order_relaxed);
+    }
+
     // end output in ORDERED mode (--sort) for this job slot
     out.end();
 
+    if (job.device != NULL)
+      job.device->release();
+
 #ifndef WITH_LOCK_FREE_JOB_QUEUE
     // if only one job is left to do or nothing to do, then try stealing another job from a co-worker
     if (jobs.todo <= 1)
@@ -4197,15 +5018,24 @@ std::vector<const char*> Static::arg_files;
 // number of concurrent threads for workers
 size_t Static::threads;
 
+// -J not set: the number of active workers to start with, adjusted at runtime between 1 and threads, or zero when fixed
+size_t Static::base_threads = 0;
+
 // number of warnings given
 std::atomic_size_t Static::warnings;
 
+// --max-memory: bytes of memory used by mmap windows, output buffers and deferred output
+std::atomic_size_t Static::memory;
+
 // redirectable source is standard input by default or a pipe
 FILE *Static::source = stdin;
 
 // redirectable output destination is standard output by default or a pipe
 FILE *Static::output = stdout;
 
+// -Q: output channel to the query TUI when output is NULL
+Channel *Static::channel = NULL;
+
 // full home directory path
 const char *Static::home_dir = NULL;
 
@@ -4408,8 +5238,42 @@ int main(int argc, const char **argv)
   signal(SIGINT, sigint);
   signal(SIGTERM, sigint);
 
+  // --connect=SOCKET as the first argument: forward the query to the ugrep server, search locally when the server is not running
+  if (argc > 1 && strncmp(argv[1], "--connect=", 10) == 0)
+  {
+    const char *socket_path = argv[1] + 10;
+
+    // remove the --connect=SOCKET argument
+    argv[1] = argv[0];
+    ++argv;
+    --argc;
+
+    int status = connect_server(socket_path, argc, argv);
+
+    if (status >= 0)
+      return status;
+  }
+
+  // --server=SOCKET as the first argument: run the ugrep server
+  if (argc > 1 && strncmp(argv[1], "--server=", 9) == 0)
+    serve(argv[1] + 9);
+
 #endif
 
+  int status = run(argc, argv);
+
+#ifdef OS_WIN
+
+  delete[] argv;
+
+#endif
+
+  return status;
+}
+
+// parse the command line options and arguments, then search, returns exit status
+int run(int argc, const char **argv)
+{
   try
   {
     init(argc, argv);
@@ -4448,15 +5312,417 @@ int main(int argc, const char **argv)
     }
   }
 
-#ifdef OS_WIN
+  return Static::warnings > 0 ? EXIT_ERROR : Stats::found_any_file() ? EXIT_OK : EXIT_FAIL;
+}
 
-  delete[] argv;
+#ifndef OS_WIN
+
+// --server and --connect: write all data to the socket, returns false on failure
+static bool write_all(int fd, const void *data, size_t size)
+{
+  const char *ptr = static_cast<const char*>(data);
+
+  while (size > 0)
+  {
+    ssize_t num = write(fd, ptr, size);
+
+    if (num < 0 && errno == EINTR)
+      continue;
+
+    if (num <= 0)
+      return false;
+
+    ptr += num;
+    size -= static_cast<size_t>(num);
+  }
+
+  return true;
+}
+
+// --server and --connect: read all data from the socket, returns false on failure or EOF
+static bool read_all(int fd, void *data, size_t size)
+{
+  char *ptr = static_cast<char*>(data);
+
+  while (size > 0)
+  {
+    ssize_t num = read(fd, ptr, size);
+
+    if (num < 0 && errno == EINTR)
+      continue;
+
+    if (num <= 0)
+      return false;
+
+    ptr += num;
+    size -= static_cast<size_t>(num);
+  }
+
+  return true;
+}
+
+// --connect: send the size of the query with our standard input, output and error descriptors
+static bool send_query_size(int fd, uint32_t size)
+{
+  int fds[3] = { STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO };
+  char control[CMSG_SPACE(sizeof(fds))];
+  struct iovec iov;
+  struct msghdr msg;
+
+  memset(control, 0, sizeof(control));
+  memset(&msg, 0, sizeof(msg));
+  iov.iov_base = &size;
+  iov.iov_len = sizeof(size);
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control;
+  msg.msg_controllen = sizeof(control);
+
+  struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+  cmsg->cmsg_level = SOL_SOCKET;
+  cmsg->cmsg_type = SCM_RIGHTS;
+  cmsg->cmsg_len = CMSG_LEN(sizeof(fds));
+  memcpy(CMSG_DATA(cmsg), fds, sizeof(fds));
+
+  return sendmsg(fd, &msg, 0) == static_cast<ssize_t>(sizeof(size));
+}
+
+// --server: receive the size of the query with the client's standard input, output and error descriptors
+static bool recv_query_size(int fd, uint32_t& size, int fds[3])
+{
+  char control[CMSG_SPACE(3 * sizeof(int))];
+  struct iovec iov;
+  struct msghdr msg;
+
+  memset(control, 0, sizeof(control));
+  memset(&msg, 0, sizeof(msg));
+  iov.iov_base = &size;
+  iov.iov_len = sizeof(size);
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control;
+  msg.msg_controllen = sizeof(control);
+
+  if (recvmsg(fd, &msg, 0) != static_cast<ssize_t>(sizeof(size)))
+    return false;
+
+  struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+
+  if (cmsg == NULL || cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS || cmsg->cmsg_len != CMSG_LEN(3 * sizeof(int)))
+    return false;
+
+  memcpy(fds, CMSG_DATA(cmsg), 3 * sizeof(int));
+
+  return true;
+}
+
+// --connect=SOCKET: forward the query to the ugrep server, returns the exit status or -1 when the server cannot be reached
+int connect_server(const char *socket_path, int argc, const char **argv)
+{
+  struct sockaddr_un addr;
+
+  if (strlen(socket_path) >= sizeof(addr.sun_path))
+    return -1;
+
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  strcpy(addr.sun_path, socket_path);
+
+  int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+
+  if (fd < 0)
+    return -1;
+
+  if (connect(fd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) != 0)
+  {
+    close(fd);
+    return -1;
+  }
+
+  // the query is the working directory, the number of arguments, the arguments and the environment, NUL-separated
+  std::string query;
+  char cwd[PATH_MAX];
+
+  if (getcwd(cwd, sizeof(cwd)) == NULL)
+  {
+    close(fd);
+    return -1;
+  }
+
+  query.append(cwd).push_back('\0');
+  query.append(std::to_string(argc)).push_back('\0');
+  for (int i = 0; i < argc; ++i)
+    query.append(argv[i]).push_back('\0');
+  for (char **env = environ; *env != NULL; ++env)
+    query.append(*env).push_back('\0');
 
+  if (query.size() > MAX_SERVER_QUERY_SIZE ||
+      !send_query_size(fd, static_cast<uint32_t>(query.size())) ||
+      !write_all(fd, query.data(), query.size()))
+  {
+    close(fd);
+    return -1;
+  }
+
+  // the server searches with our standard input, output and error, then returns the exit status
+  int32_t status;
+
+  if (!read_all(fd, &status, sizeof(status)))
+    status = EXIT_ERROR;
+
+  close(fd);
+
+  return status;
+}
+
+// --server: true if the client connected to the socket runs as the same user as the server
+static bool same_user(int conn)
+{
+#ifdef __linux__
+  struct ucred cred;
+  socklen_t len = sizeof(cred);
+
+  return getsockopt(conn, SOL_SOCKET, SO_PEERCRED, &cred, &len) == 0 && cred.uid == geteuid();
+#else
+  uid_t uid;
+  gid_t gid;
+
+  return getpeereid(conn, &uid, &gid) == 0 && uid == geteuid();
 #endif
+}
 
-  return Static::warnings > 0 ? EXIT_ERROR : Stats::found_any_file() ? EXIT_OK : EXIT_FAIL;
+// --server: self-pipe written by the SIGCHLD handler to wake up serve_query() when the search process terminates
+static int sigchld_pipe[2] = { -1, -1 };
+
+// --server: SIGCHLD handler
+static void sigchld(int)
+{
+  int saved_errno = errno;
+
+  // the pipe is non-blocking, a full pipe already wakes up serve_query()
+  ssize_t num = write(sigchld_pipe[1], "", 1);
+  (void)num;
+
+  errno = saved_errno;
+}
+
+// --server: serve a query received from a client, runs in a forked process that does not return
+static void serve_query(int conn)
+{
+  // only serve clients that run as the same user, because queries run commands, e.g. with --filter and --pager
+  if (!same_user(conn))
+    _exit(EXIT_ERROR);
+
+  // wake up when the search process we fork below terminates
+  if (pipe(sigchld_pipe) != 0 ||
+      fcntl(sigchld_pipe[0], F_SETFL, fcntl(sigchld_pipe[0], F_GETFL) | O_NONBLOCK) < 0 ||
+      fcntl(sigchld_pipe[1], F_SETFL, fcntl(sigchld_pipe[1], F_GETFL) | O_NONBLOCK) < 0)
+    _exit(EXIT_ERROR);
+
+  signal(SIGCHLD, sigchld);
+
+  uint32_t size;
+  int fds[3];
+
+  if (!recv_query_size(conn, size, fds))
+    _exit(EXIT_ERROR);
+
+  if (size > MAX_SERVER_QUERY_SIZE)
+    _exit(EXIT_ERROR);
+
+  std::string query(size, '\0');
+
+  if (!read_all(conn, &query[0], size) || query.empty() || query.back() != '\0')
+    _exit(EXIT_ERROR);
+
+  // split the query into the working directory, the arguments and the environment
+  std::vector<const char*> strings;
+  for (size_t pos = 0; pos < query.size(); pos = query.find('\0', pos) + 1)
+    strings.push_back(query.c_str() + pos);
+
+  size_t argc = strings.size() > 1 ? strtoul(strings[1], NULL, 10) : 0;
+
+  if (argc < 1 || argc + 2 > strings.size())
+    _exit(EXIT_ERROR);
+
+  std::vector<const char*> argv(strings.begin() + 2, strings.begin() + 2 + argc);
+  argv.push_back(NULL);
+
+  std::vector<char*> env;
+  for (size_t i = 2 + argc; i < strings.size(); ++i)
+    env.push_back(const_cast<char*>(strings[i]));
+  env.push_back(NULL);
+
+  pid_t pid = fork();
+
+  if (pid == 0)
+  {
+    // search as if the client ran ugrep with its standard input, output, error, working directory and environment
+    close(conn);
+    close(sigchld_pipe[0]);
+    close(sigchld_pipe[1]);
+    signal(SIGCHLD, SIG_DFL);
+
+    for (int i = 0; i < 3; ++i)
+    {
+      if (fds[i] != i)
+      {
+        dup2(fds[i], i);
+        close(fds[i]);
+      }
+    }
+
+    environ = env.data();
+
+    if (chdir(strings[0]) != 0)
+      error("cannot change directory to", strings[0]);
+
+    exit(run(static_cast<int>(argc), argv.data()));
+  }
+
+  for (int i = 0; i < 3; ++i)
+    close(fds[i]);
+
+  int32_t status = EXIT_ERROR;
+
+  if (pid > 0)
+  {
+    // watch the connection for the client to disconnect and the self-pipe for the search process to terminate
+    struct pollfd pfd[2];
+    pfd[0].fd = conn;
+#ifdef POLLRDHUP
+    pfd[0].events = POLLIN | POLLRDHUP;
+#else
+    pfd[0].events = POLLIN;
+#endif
+    pfd[1].fd = sigchld_pipe[0];
+    pfd[1].events = POLLIN;
+
+    while (true)
+    {
+      int wstatus;
+      pid_t ret = waitpid(pid, &wstatus, WNOHANG);
+
+      if (ret == pid)
+      {
+        if (WIFEXITED(wstatus))
+          status = WEXITSTATUS(wstatus);
+        else if (WIFSIGNALED(wstatus))
+          status = 128 + WTERMSIG(wstatus);
+        break;
+      }
+
+      if (ret < 0 && errno != EINTR)
+        break;
+
+      // block until the client disconnects or the search process terminates, a SIGCHLD after waitpid() is in the self-pipe
+      pfd[0].revents = 0;
+      pfd[1].revents = 0;
+
+      if (poll(pfd, 2, -1) < 0 && errno != EINTR)
+        break;
+
+      // interrupt the search when the client disconnects, then stop watching the connection
+      if (pfd[0].revents != 0)
+      {
+        kill(pid, SIGINT);
+        pfd[0].fd = -1;
+      }
+
+      // drain the self-pipe
+      if ((pfd[1].revents & POLLIN) != 0)
+      {
+        char drain[16];
+        while (read(sigchld_pipe[0], drain, sizeof(drain)) > 0)
+          continue;
+      }
+    }
+  }
+
+  write_all(conn, &status, sizeof(status));
+
+  _exit(EXIT_OK);
+}
+
+// --server=SOCKET: run the ugrep server listening on the socket, fork a process for each query received
+void serve(const char *socket_path)
+{
+  struct sockaddr_un addr;
+
+  if (strlen(socket_path) >= sizeof(addr.sun_path))
+  {
+    errno = ENAMETOOLONG;
+    error("cannot serve", socket_path);
+  }
+
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  strcpy(addr.sun_path, socket_path);
+
+  int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+
+  if (fd < 0)
+    error("cannot serve", socket_path);
+
+  // remove a stale socket left behind by a server that terminated, but refuse to serve when a server answers on the socket
+  struct stat buf;
+  if (lstat(socket_path, &buf) == 0 && S_ISSOCK(buf.st_mode))
+  {
+    if (connect(fd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) == 0)
+    {
+      errno = EADDRINUSE;
+      error("cannot serve", socket_path);
+    }
+
+    // a stale socket refuses connections, other errors leave the socket in place for bind() to fail
+    if (errno == ECONNREFUSED)
+      unlink(socket_path);
+
+    close(fd);
+
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+
+    if (fd < 0)
+      error("cannot serve", socket_path);
+  }
+
+  // the socket is accessible to the user only, because queries run commands, e.g. with --filter and --pager
+  mode_t mask = umask(077);
+  int ret = bind(fd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr));
+  umask(mask);
+
+  if (ret != 0 || listen(fd, SOMAXCONN) != 0)
+    error("cannot serve", socket_path);
+
+  // processes serving queries are reaped automatically
+  signal(SIGCHLD, SIG_IGN);
+
+  while (true)
+  {
+    int conn = accept(fd, NULL, NULL);
+
+    if (conn < 0)
+    {
+      if (errno == EINTR || errno == ECONNABORTED)
+        continue;
+
+      error("cannot serve", socket_path);
+    }
+
+    pid_t pid = fork();
+
+    if (pid == 0)
+    {
+      close(fd);
+      serve_query(conn);
+    }
+
+    close(conn);
+  }
 }
 
+#endif
+
 static void set_depth(const char *arg)
 {
   if (flag_max_depth > 0)
@@ -4796,7 +6062,9 @@ void options(std::list<std::pair<CNF::PATTERN,const char*>>& pattern_args, int a
                 break;
 
               case 'a':
-                if (strncmp(arg, "after-context=", 14) == 0)
+                if (strncmp(arg, "affinity=", 9) == 0)
+                  flag_affinity = arg + 9;
+                else if (strncmp(arg, "after-context=", 14) == 0)
                   flag_after_context = strtonum(arg + 14, "invalid argument --after-context=");
                 else if (strcmp(arg, "and") == 0)
                   option_and(pattern_args, i, argc, argv);
@@ -4810,10 +6078,10 @@ void options(std::list<std::pair<CNF::PATTERN,const char*>>& pattern_args, int a
                   flag_any_line = true;
                 else if (strcmp(arg, "ascii") == 0)
                   flag_binary = true;
-                else if (strcmp(arg, "after-context") == 0)
+                else if (strcmp(arg, "affinity") == 0 || strcmp(arg, "after-context") == 0)
                   usage("missing argument for --", arg);
                 else
-                  usage("invalid option --", arg, "--after-context, --and, --andnot, --any-line or --ascii");
+                  usage("invalid option --", arg, "--affinity, --after-context, --and, --andnot, --any-line or --ascii");
                 break;
 
               case 'b':
@@ -4840,7 +6108,9 @@ void options(std::list<std::pair<CNF::PATTERN,const char*>>& pattern_args, int a
                 break;
 
               case 'c':
-                if (strcmp(arg, "color") == 0 || strcmp(arg, "colour") == 0)
+                if (strncmp(arg, "checkpoint=", 11) == 0)
+                  flag_checkpoint = arg + 11;
+                else if (strcmp(arg, "color") == 0 || strcmp(arg, "colour") == 0)
                   flag_color = "auto";
                 else if (strncmp(arg, "color=", 6) == 0)
                   flag_color = arg + 6;
@@ -4856,6 +6126,8 @@ void options(std::list<std::pair<CNF::PATTERN,const char*>>& pattern_args, int a
                   ; // --config is pre-parsed before other options are parsed
                 else if (strcmp(arg, "confirm") == 0)
                   flag_confirm = true;
+                else if (strncmp(arg, "connect=", 8) == 0)
+                  usage("option --connect=SOCKET must be specified as the first argument");
                 else if (strncmp(arg, "context=", 8) == 0)
                   flag_after_context = flag_before_context = strtonum(arg + 8, "invalid argument --context=");
                 else if (strcmp(arg, "count") == 0)
@@ -4864,12 +6136,14 @@ void options(std::list<std::pair<CNF::PATTERN,const char*>>& pattern_args, int a
                   flag_cpp = true;
                 else if (strcmp(arg, "csv") == 0)
                   flag_csv = true;
-                else if (strcmp(arg, "colors") == 0 ||
+                else if (strcmp(arg, "checkpoint") == 0 ||
+                    strcmp(arg, "colors") == 0 ||
                     strcmp(arg, "colours") == 0 ||
+                    strcmp(arg, "connect") == 0 ||
                     strcmp(arg, "context") == 0)
                   usage("missing argument for --", arg);
                 else
-                  usage("invalid option --", arg, "--color, --colors, --column-number, --config, --confirm, --context, --count, --cpp or --csv");
+                  usage("invalid option --", arg, "--checkpoint, --color, --colors, --column-number, --config, --confirm, --connect, --context, --count, --cpp or --csv");
                 break;
 
               case 'd':
@@ -4885,6 +6159,8 @@ void options(std::list<std::pair<CNF::PATTERN,const char*>>& pattern_args, int a
                   flag_dereference_files = true;
                 else if (strcmp(arg, "dereference-recursive") == 0)
                   flag_directories = "dereference-recurse";
+                else if (strncmp(arg, "device-jobs=", 12) == 0)
+                  flag_device_jobs = strtonum(arg + 12, "invalid argument --device-jobs=");
                 else if (strncmp(arg, "devices=", 8) == 0)
                   flag_devices = arg + 8;
                 else if (strncmp(arg, "directories=", 12) == 0)
@@ -4892,11 +6168,12 @@ void options(std::list<std::pair<CNF::PATTERN,const char*>>& pattern_args, int a
                 else if (strcmp(arg, "dotall") == 0)
                   flag_dotall = true;
                 else if (strcmp(arg, "depth") == 0 ||
+                    strcmp(arg, "device-jobs") == 0 ||
                     strcmp(arg, "devices") == 0 ||
                     strcmp(arg, "directories") == 0)
                   usage("missing argument for --", arg);
                 else
-                  usage("invalid option --", arg, "--decompress, --delay, --depth, --dereference, --dereference-files, --dereference-recursive, --devices, --directories or --dotall");
+                  usage("invalid option --", arg, "--decompress, --delay, --depth, --dereference, --dereference-files, --dereference-recursive, --device-jobs, --devices, --directories or --dotall");
                 break;
 
               case 'e':
@@ -4941,6 +6218,8 @@ void options(std::list<std::pair<CNF::PATTERN,const char*>>& pattern_args, int a
                   flag_files_without_match = true;
                 else if (strcmp(arg, "fixed-strings") == 0)
                   flag_fixed_strings = true;
+                else if (strcmp(arg, "follow") == 0)
+                  flag_follow = true;
                 else if (strncmp(arg, "filter=", 7) == 0)
                   flag_filter.append(flag_filter.empty() ? "" : ",").append(arg + 7);
                 else if (strncmp(arg, "filter-magic-label=", 19) == 0)
@@ -4974,7 +6253,7 @@ void options(std::list<std::pair<CNF::PATTERN,const char*>>& pattern_args, int a
                     strcmp(arg, "format-open") == 0)
                   usage("missing argument for --", arg);
                 else
-                  usage("invalid option --", arg, "--file, --file-extension, --file-magic, --file-type, --files, --files-with-matches, --files-without-match, --fixed-strings, --filter, --filter-magic-label, --format, --format-begin, --format-close, --format-end, --format-open, --fuzzy or --free-space");
+                  usage("invalid option --", arg, "--file, --file-extension, --file-magic, --file-type, --files, --files-with-matches, --files-without-match, --fixed-strings, --follow, --filter, --filter-magic-label, --format, --format-begin, --format-close, --format-end, --format-open, --fuzzy or --free-space");
                 break;
 
               case 'g':
@@ -5088,6 +6367,8 @@ void options(std::list<std::pair<CNF::PATTERN,const char*>>& pattern_args, int a
                   flag_max_files = strtopos(arg + 10, "invalid argument --max-files=");
                 else if (strncmp(arg, "max-line=", 9) == 0)
                   flag_max_line = strtopos(arg + 9, "invalid argument --max-line=");
+                else if (strncmp(arg, "max-memory=", 11) == 0)
+                  flag_max_memory = strtosize(arg + 11, "invalid argument --max-memory=");
                 else if (strncmp(arg, "min-count=", 10) == 0)
                   flag_min_count = strtopos(arg + 10, "invalid argument --min-count=");
                 else if (strncmp(arg, "min-depth=", 10) == 0)
@@ -5106,12 +6387,13 @@ void options(std::list<std::pair<CNF::PATTERN,const char*>>& pattern_args, int a
                     strcmp(arg, "max-depth") == 0 ||
                     strcmp(arg, "max-files") == 0 ||
                     strcmp(arg, "max-line") == 0 ||
+                    strcmp(arg, "max-memory") == 0 ||
                     strcmp(arg, "min-count") == 0 ||
                     strcmp(arg, "min-depth") == 0 ||
                     strcmp(arg, "min-line") == 0)
                   usage("missing argument for --", arg);
                 else
-                  usage("invalid option --", arg, "--match, --max-count, --max-depth, --max-files, --max-line, --min-count, --min-depth, --min-line, --mmap or --messages");
+                  usage("invalid option --", arg, "--match, --max-count, --max-depth, --max-files, --max-line, --max-memory, --min-count, --min-depth, --min-line, --mmap or --messages");
                 break;
 
               case 'n':
@@ -5266,10 +6548,14 @@ void options(std::list<std::pair<CNF::PATTERN,const char*>>& pattern_args, int a
                   flag_separator = NULL;
                 else if (strncmp(arg, "separator=", 10) == 0)
                   flag_separator = arg + 10;
+                else if (strncmp(arg, "server=", 7) == 0)
+                  usage("option --server=SOCKET must be specified as the first argument");
                 else if (strcmp(arg, "silent") == 0)
                   flag_quiet = flag_no_messages = true;
                 else if (strcmp(arg, "smart-case") == 0)
                   flag_smart_case = true;
+                else if (strncmp(arg, "snapshot=", 9) == 0)
+                  flag_snapshot = arg + 9;
                 else if (strcmp(arg, "sort") == 0)
                   flag_sort = "name";
                 else if (strncmp(arg, "sort=", 5) == 0)
@@ -5280,8 +6566,10 @@ void options(std::list<std::pair<CNF::PATTERN,const char*>>& pattern_args, int a
                   flag_stats = "";
                 else if (strncmp(arg, "stats=", 6) == 0)
                   flag_stats = arg + 6;
+                else if (strcmp(arg, "server") == 0 || strcmp(arg, "snapshot") == 0)
+                  usage("missing argument for --", arg);
                 else
-                  usage("invalid option --", arg, "--save-config, --separator, --silent, --smart-case, --sort, --split or --stats");
+                  usage("invalid option --", arg, "--save-config, --separator, --server, --silent, --smart-case, --snapshot, --sort, --split or --stats");
                 break;
 
               case 't':
@@ -6004,6 +7292,14 @@ void init(int argc, const char **argv)
     exit(EXIT_ERROR);
   }
 
+  // --follow: searches files as they grow and does not terminate, which is not compatible with -Q
+  if (flag_follow && flag_query)
+    usage("options --follow and -Q (--query) are not compatible");
+
+  // --checkpoint: the checkpoints would be updated by each -Q search
+  if (flag_checkpoint != NULL && flag_query)
+    usage("options --checkpoint and -Q (--query) are not compatible");
+
   // -t list: list table of types and exit
   if (flag_file_type.size() == 1 && flag_file_type[0] == "list")
   {
@@ -6133,6 +7429,10 @@ void init(int argc, const char **argv)
     flag_encoding_type = encoding_table[i].encoding;
   }
 
+  // --affinity: check argument
+  if (flag_affinity != NULL && strcmp(flag_affinity, "numa") != 0)
+    usage("invalid argument --affinity=KEY, valid argument is 'numa'");
+
   // --binary-files: normalize by assigning flags
   if (strcmp(flag_binary_files, "without-match") == 0)
     flag_binary_without_match = true;
@@ -7775,8 +9075,57 @@ void ugrep()
   if (flag_heading && flag_with_filename)
     flag_break = true;
 
+  // --checkpoint: search files from their checkpoints
+  if (flag_checkpoint != NULL)
+  {
+#ifndef OS_WIN
+    if (flag_follow)
+      usage("options --checkpoint and --follow are not compatible");
+    if (flag_decompress)
+      usage("options --checkpoint and -z (--decompress) are not compatible");
+    if (!flag_filter.empty())
+      usage("options --checkpoint and --filter are not compatible");
+    if (!single_byte_newline(flag_encoding_type))
+      usage("options --checkpoint and --encoding with UTF-16, UTF-32 or EBCDIC are not compatible");
+
+    checkpoint.open();
+#else
+    usage("option --checkpoint is not yet available for Windows");
+#endif
+  }
+
+  // --follow: follow FILE arguments and the files in DIR arguments with one thread, only compatible with options that output matches
+  if (flag_follow)
+  {
+#ifndef OS_WIN
+    if (flag_stdin || Static::arg_files.empty())
+      usage("option --follow requires FILE arguments");
+    if (flag_directories_action == Action::RECURSE)
+      usage("options --follow and -r (--recursive) are not compatible");
+    if (flag_count)
+      usage("options --follow and -c (--count) are not compatible");
+    if (flag_quiet || flag_files_with_matches)
+      usage("options --follow and -q, -l or -L are not compatible");
+    if (flag_decompress)
+      usage("options --follow and -z (--decompress) are not compatible");
+    if (!flag_filter.empty())
+      usage("options --follow and --filter are not compatible");
+    if (!single_byte_newline(flag_encoding_type))
+      usage("options --follow and --encoding with UTF-16, UTF-32 or EBCDIC are not compatible");
+
+    flag_jobs = 1;
+#else
+    usage("option --follow is not yet available for Windows");
+#endif
+  }
+
+  // -J: when not set adjust the number of active workers at runtime, starting with the default number of workers, the
+  // number of jobs is local to keep flag_jobs unchanged when ugrep() is called again by -Q
+  bool adapt_jobs = (flag_jobs == 0);
+  size_t jobs = flag_jobs;
+
   // -J: when not set the default is the number of cores (or hardware threads), limited to MAX_JOBS
-  if (flag_jobs == 0)
+  if (jobs == 0)
   {
     unsigned int cores = std::thread::hardware_concurrency();
     unsigned int concurrency = cores > 2 ? cores : 2;
@@ -7787,18 +9136,41 @@ void ugrep()
 #else
     concurrency -= concurrency / 8;
 #endif
-    flag_jobs = std::min(concurrency, MAX_JOBS);
+    jobs = std::min(concurrency, MAX_JOBS);
   }
 
+  // -J not set: spawn up to twice the number of cores, limited to MAX_JOBS, workers above -J are activated when searching is I/O bound
+  size_t max_jobs = jobs;
+  if (adapt_jobs)
+    max_jobs = std::max(jobs, static_cast<size_t>(std::min(2 * std::thread::hardware_concurrency(), MAX_JOBS)));
+
   // --sort and --max-files: limit number of threads to --max-files to prevent unordered results, this is a special case
   if (flag_sort_key != Sort::NA && flag_max_files > 0)
-    flag_jobs = std::min(flag_jobs, flag_max_files);
+  {
+    jobs = std::min(jobs, flag_max_files);
+    max_jobs = std::min(max_jobs, flag_max_files);
+  }
+
+  // --max-memory: limit number of threads to the number that fit the memory budget
+  if (flag_max_memory > 0)
+  {
+    size_t fit_jobs = std::max(flag_max_memory / MIN_MEMORY_PER_THREAD, static_cast<size_t>(1));
+    jobs = std::min(jobs, fit_jobs);
+    max_jobs = std::min(max_jobs, fit_jobs);
+  }
 
   // set the number of threads to the number of files or when recursing to the value of -J, --jobs
   if (flag_all_threads || flag_directories_action == Action::RECURSE)
-    Static::threads = flag_jobs;
+    Static::threads = max_jobs;
   else
-    Static::threads = std::min(Static::arg_files.size() + flag_stdin, flag_jobs);
+    Static::threads = std::min(Static::arg_files.size() + flag_stdin, max_jobs);
+
+  // -J not set: the number of active workers to start with
+  Static::base_threads = adapt_jobs ? std::min(jobs, Static::threads) : 0;
+
+  // --max-memory: reduce the mmap region of each thread to use no more than half of the memory budget for all threads
+  if (flag_max_memory > 0)
+    flag_max_mmap = std::min(flag_max_mmap, flag_max_memory / (2 * Static::threads));
 
   // inverted character classes and \s do not match newlines, e.g. [^x] matches anything except x and \n
   reflex::convert_flag_type convert_flags = reflex::convert_flag::notnewline;
@@ -8080,8 +9452,29 @@ void ugrep()
   }
   else
   {
-    // construct the RE/flex DFA-based pattern matcher and start matching files
-    Static::reflex_pattern.assign(reflex::Matcher::convert(regex, convert_flags, &flag_multiline), (flag_index != NULL ? "hr" : "r"));
+    // construct the RE/flex DFA-based pattern matcher with up to -J threads before the search workers start
+    std::string reflex_options(flag_index != NULL ? "dhr" : "dr");
+    if (jobs > 1)
+      reflex_options.append(";j=").append(std::to_string(jobs));
+
+    const Pack *pack = NULL;
+
+#ifdef WITH_PACKS
+    // use the precompiled DFA of a bundled pattern file with the same regex, but not with --index that requires hashing
+    if (flag_index == NULL)
+      pack = find_pack(regex, convert_flags);
+#endif
+
+    if (pack != NULL)
+    {
+      flag_multiline = pack->multiline;
+      Static::reflex_pattern.assign(pack->code, pack->pred);
+    }
+    else
+    {
+      Static::reflex_pattern.assign(reflex::Matcher::convert(regex, convert_flags, &flag_multiline), reflex_options);
+    }
+
     Static::matchers.clear();
 
     if (flag_fuzzy > 0)
@@ -8187,6 +9580,12 @@ void ugrep()
     }
   }
 
+#ifndef OS_WIN
+  // --checkpoint: save the checkpoints of the files searched
+  if (flag_checkpoint != NULL)
+    checkpoint.close();
+#endif
+
   // --tree with -l or -c but not --format: finish tree display
   if (flag_tree && (flag_files_with_matches || flag_count) && flag_format == NULL)
   {
@@ -8200,8 +9599,8 @@ void ugrep()
   if (flag_format_end != NULL)
     Output(Static::output).format(flag_format_end, Stats::found_parts());
 
-  // --stats: display stats when we're done
-  if (flag_stats != NULL)
+  // --stats: display stats when we're done, but not in the -Q query TUI
+  if (flag_stats != NULL && Static::output != NULL)
   {
     Stats::report(Static::output);
 
@@ -8210,6 +9609,7 @@ void ugrep()
     if (strcmp(flag_stats, "vm") == 0)
     {
       size_t nodes = Static::reflex_pattern.nodes();
+      size_t minimized_nodes = Static::reflex_pattern.minimized_nodes();
       size_t edges = Static::reflex_pattern.edges();
       size_t words = Static::reflex_pattern.words();
       size_t hashes = Static::reflex_pattern.hashes();
@@ -8218,8 +9618,12 @@ void ugrep()
       size_t edges_time = static_cast<size_t>(Static::reflex_pattern.parse_time() + Static::reflex_pattern.edges_time());
       size_t words_time = static_cast<size_t>(Static::reflex_pattern.words_time());
       size_t hashing_time = static_cast<size_t>(Static::reflex_pattern.hashing_time());
+      size_t minimizing_time = static_cast<size_t>(Static::reflex_pattern.minimizing_time());
 
-      fprintf(Static::output, "VM: %zu nodes (%zums) %zu edges (%zums) %zu opcode words (%zums)", nodes, nodes_time, edges, edges_time, words, words_time);
+      fprintf(Static::output, "VM: %zu nodes (%zums)", nodes, nodes_time);
+      if (minimized_nodes > 0)
+        fprintf(Static::output, " minimized to %zu nodes (%zums)", minimized_nodes, minimizing_time);
+      fprintf(Static::output, " %zu edges (%zums) %zu opcode words (%zums)", edges, edges_time, words, words_time);
       if (hashes > 0)
         fprintf(Static::output, " %zu hash tables (%zums)", hashes, hashing_time);
       fprintf(Static::output, NEWLINESTR);
@@ -8261,93 +9665,897 @@ void Static::set_grep_handle(Grep *grep)
   Static::grep_handle = grep;
 }
 
-// reset the grep handle
-void Static::clear_grep_handle()
-{
-  std::unique_lock<std::mutex> lock(Static::grep_handle_mutex);
-  Static::grep_handle = NULL;
+// reset the grep handle
+void Static::clear_grep_handle()
+{
+  std::unique_lock<std::mutex> lock(Static::grep_handle_mutex);
+  Static::grep_handle = NULL;
+}
+
+// cancel the search
+void Static::cancel_ugrep()
+{
+  std::unique_lock<std::mutex> lock(Static::grep_handle_mutex);
+  if (Static::grep_handle != NULL)
+    Static::grep_handle->cancel();
+}
+
+#ifndef OS_WIN
+
+// --snapshot=FILE: the directories traversed and the files selected to search, to search the same files again without traversing directories when the directories did not change
+struct Snapshot {
+
+  // snapshot file identifying magic record
+  static const char *MAGIC;
+
+  // directories modified this many seconds before the traversal started may change without updating their modification time
+  static const time_t RACY = 2;
+
+  Snapshot()
+    :
+      valid(false),
+      recording(false),
+      reusable(false),
+      changed(false),
+      start(0)
+  { }
+
+  // load and validate the snapshot file, start recording when the snapshot cannot be reused
+  void open();
+
+  // save the snapshot file when changed and reusable
+  void close();
+
+  // the files of a recursive search of root directory pathname recorded in the valid snapshot, NULL if none
+  const std::vector<std::string> *replay(const char *pathname);
+
+  // record the recursive search of a root directory pathname
+  void add_root(const char *pathname);
+
+  // record a directory or an ignore file with its modification time to validate the snapshot
+  void add_dir(const char *pathname, const struct stat& buf, bool ignore = false);
+
+  // record a file selected to search
+  void add_file(const std::string& pathname)
+  {
+    if (recording)
+      roots[root].emplace_back(pathname);
+  }
+
+  // the selection constraints the snapshot depends on
+  static std::string key();
+
+  typedef std::map<std::string,std::vector<std::string>> Roots;
+
+  bool                     valid;     // snapshot was loaded and validated
+  bool                     recording; // record the traversal
+  bool                     reusable;  // all directories recorded are older than RACY seconds
+  bool                     changed;   // snapshot has new records to save
+  time_t                   start;     // time the traversal started
+  std::string              root;      // root directory of the recursive search being recorded
+  std::vector<std::string> dirs;      // "D" or "I" records of directories and ignore files with modification times
+  Roots                    roots;     // files selected to search per root directory
+
+};
+
+const char *Snapshot::MAGIC = "UG#SNAPSHOT\x01";
+
+// the --snapshot state of the recursive search by the main thread
+Snapshot snapshot;
+
+// the selection constraints the snapshot depends on
+std::string Snapshot::key()
+{
+  std::string key;
+  char buf[PATH_MAX];
+
+  if (getcwd(buf, sizeof(buf)) != NULL)
+    key.append(buf);
+  key.push_back('\n');
+  for (const auto& arg : Static::arg_files)
+    key.append("arg=").append(arg).push_back('\n');
+  for (const auto& glob : flag_all_include)
+    key.append("include=").append(glob).push_back('\n');
+  for (const auto& glob : flag_all_exclude)
+    key.append("exclude=").append(glob).push_back('\n');
+  for (const auto& glob : flag_all_include_dir)
+    key.append("include-dir=").append(glob).push_back('\n');
+  for (const auto& glob : flag_all_exclude_dir)
+    key.append("exclude-dir=").append(glob).push_back('\n');
+  for (const auto& fs : flag_include_fs)
+    key.append("include-fs=").append(fs).push_back('\n');
+  for (const auto& fs : flag_exclude_fs)
+    key.append("exclude-fs=").append(fs).push_back('\n');
+  for (const auto& ignore : flag_ignore_files)
+    key.append("ignore-files=").append(ignore).push_back('\n');
+
+  snprintf(buf, sizeof(buf), "%zu %zu %zu %zu %d%d%d%d%d %d %d %d\n",
+      flag_include_iglob_size,
+      flag_exclude_iglob_size,
+      flag_min_depth,
+      flag_max_depth,
+      flag_hidden,
+      flag_dereference,
+      flag_dereference_files,
+      flag_no_dereference,
+      flag_sort_rev,
+      static_cast<int>(flag_sort_key),
+      static_cast<int>(flag_devices_action),
+      static_cast<int>(flag_directories_action));
+  key.append(buf);
+
+  return key;
+}
+
+// load and validate the snapshot file, start recording when the snapshot cannot be reused
+void Snapshot::open()
+{
+  valid = false;
+  recording = false;
+  reusable = false;
+  changed = false;
+  dirs.clear();
+  roots.clear();
+
+  // snapshots record the selected files in the order searched, which cannot depend on file contents or on file info that may change
+  if (flag_index != NULL ||
+      !flag_file_magic.empty() ||
+      (flag_sort_key != Sort::NA && flag_sort_key != Sort::NAME && flag_sort_key != Sort::LIST))
+    return;
+
+  recording = true;
+  reusable = true;
+  start = time(NULL);
+
+  FILE *file = NULL;
+
+  if (fopenw_s(&file, flag_snapshot, "rb") != 0)
+    return;
+
+  // read the NUL-terminated records of the snapshot file
+  std::string record;
+  std::string check = key();
+  bool ok = false;
+  size_t num = 0;
+  int ch;
+
+  while ((ch = getc(file)) != EOF)
+  {
+    if (ch != '\0')
+    {
+      record.push_back(static_cast<char>(ch));
+      continue;
+    }
+
+    if (num == 0)
+    {
+      if (record != MAGIC)
+        break;
+    }
+    else if (num == 1)
+    {
+      // the selection constraints must be the same
+      if (record != check)
+        break;
+
+      ok = true;
+    }
+    else
+    {
+      switch (record.front())
+      {
+        case 'D':
+        case 'I':
+        {
+          // directories and ignore files must not have changed
+          char *rest = NULL;
+          uint64_t mtime = strtoull(record.c_str() + 1, &rest, 10);
+          struct stat buf;
+
+          if (rest == NULL || *rest != ' ' || stat(rest + 1, &buf) != 0 || Grep::Entry::modified_time(buf) != mtime)
+            ok = false;
+          else
+            dirs.emplace_back(record);
+          break;
+        }
+
+        case 'R':
+          root.assign(record, 1, std::string::npos);
+          roots[root];
+          break;
+
+        case 'F':
+          roots[root].emplace_back(record, 1, std::string::npos);
+          break;
+
+        default:
+          ok = false;
+      }
+
+      if (!ok)
+        break;
+    }
+
+    record.clear();
+    ++num;
+  }
+
+  fclose(file);
+
+  if (ok && record.empty())
+  {
+    // the snapshot is valid, record the recursive searches of root directories not in the snapshot
+    valid = true;
+
+    // score the directories and the ignore files as if traversed
+    for (const auto& dir : dirs)
+    {
+      if (dir.front() == 'D')
+        Stats::score_dir();
+      else
+        Stats::ignore_file(dir.substr(dir.find(' ') + 1));
+    }
+  }
+  else
+  {
+    dirs.clear();
+    roots.clear();
+  }
+}
+
+// save the snapshot file when changed and reusable
+void Snapshot::close()
+{
+  if (!recording || !changed || !reusable || flag_max_files > 0)
+    return;
+
+  // write a temporary file first, then rename it to replace the snapshot file
+  std::string temp(flag_snapshot);
+  temp.append(".tmp");
+
+  FILE *file = NULL;
+
+  if (fopenw_s(&file, temp.c_str(), "wb") != 0)
+  {
+    warning("cannot save snapshot", temp.c_str());
+    return;
+  }
+
+  bool ok = fwrite(MAGIC, strlen(MAGIC) + 1, 1, file) == 1;
+
+  std::string check = key();
+  ok = ok && fwrite(check.c_str(), check.size() + 1, 1, file) == 1;
+
+  for (const auto& dir : dirs)
+    ok = ok && fwrite(dir.c_str(), dir.size() + 1, 1, file) == 1;
+
+  for (const auto& root : roots)
+  {
+    ok = ok && putc('R', file) != EOF && fwrite(root.first.c_str(), root.first.size() + 1, 1, file) == 1;
+
+    for (const auto& pathname : root.second)
+      ok = ok && putc('F', file) != EOF && fwrite(pathname.c_str(), pathname.size() + 1, 1, file) == 1;
+  }
+
+  if (fclose(file) != 0)
+    ok = false;
+
+  if (!ok || rename(temp.c_str(), flag_snapshot) != 0)
+  {
+    warning("cannot save snapshot", flag_snapshot);
+    remove(temp.c_str());
+  }
+}
+
+// the files of a recursive search of root directory pathname recorded in the valid snapshot, NULL if none
+const std::vector<std::string> *Snapshot::replay(const char *pathname)
+{
+  if (!valid)
+    return NULL;
+
+  Roots::const_iterator files = roots.find(pathname);
+
+  if (files == roots.end())
+    return NULL;
+
+  return &files->second;
+}
+
+// record the recursive search of a root directory pathname
+void Snapshot::add_root(const char *pathname)
+{
+  if (!recording)
+    return;
+
+  root.assign(pathname);
+  roots[root].clear();
+  changed = true;
+}
+
+// record a directory or an ignore file with its modification time to validate the snapshot
+void Snapshot::add_dir(const char *pathname, const struct stat& buf, bool ignore)
+{
+  if (!recording)
+    return;
+
+  // a directory modified just before the traversal may change again without updating its modification time
+  if (buf.st_mtime + RACY >= start)
+    reusable = false;
+
+  dirs.emplace_back(ignore ? "I" : "D");
+  dirs.back().append(std::to_string(Grep::Entry::modified_time(buf))).append(" ").append(pathname);
+}
+
+const char *Checkpoint::MAGIC = "UG#CHECKPOINT\x01";
+
+// load the checkpoint file
+void Checkpoint::open()
+{
+  FILE *file = NULL;
+
+  if (fopenw_s(&file, flag_checkpoint, "rb") != 0)
+    return;
+
+  // read the NUL-terminated records of the checkpoint file, each with a dev, inode, offset, lineno, hash and pathname
+  std::string record;
+  bool ok = false;
+  size_t num = 0;
+  int ch;
+
+  while ((ch = getc(file)) != EOF)
+  {
+    if (ch != '\0')
+    {
+      record.push_back(static_cast<char>(ch));
+      continue;
+    }
+
+    if (num == 0)
+    {
+      if (record != MAGIC)
+        break;
+
+      ok = true;
+    }
+    else
+    {
+      Mark mark;
+      char *rest = const_cast<char*>(record.c_str());
+
+      mark.dev = strtoull(rest, &rest, 10);
+      mark.inode = strtoull(rest, &rest, 10);
+      mark.offset = strtoull(rest, &rest, 10);
+      mark.lineno = strtoull(rest, &rest, 10);
+      mark.hash = strtoull(rest, &rest, 10);
+
+      if (*rest != ' ')
+      {
+        ok = false;
+        break;
+      }
+
+      marks[rest + 1] = mark;
+    }
+
+    record.clear();
+    ++num;
+  }
+
+  fclose(file);
+
+  if (!ok || !record.empty())
+  {
+    errno = EINVAL;
+    warning("cannot use checkpoint", flag_checkpoint);
+    marks.clear();
+  }
+}
+
+// save the checkpoint file when changed, dropping the checkpoints of files that no longer exist
+void Checkpoint::close()
+{
+  if (!changed)
+    return;
+
+  // write a temporary file first, then rename it to replace the checkpoint file
+  std::string temp(flag_checkpoint);
+  temp.append(".tmp");
+
+  FILE *file = NULL;
+
+  if (fopenw_s(&file, temp.c_str(), "wb") != 0)
+  {
+    warning("cannot save checkpoint", temp.c_str());
+    return;
+  }
+
+  bool ok = fwrite(MAGIC, strlen(MAGIC) + 1, 1, file) == 1;
+
+  for (const auto& mark : marks)
+  {
+    struct stat buf;
+
+    if (stat(mark.first.c_str(), &buf) != 0)
+      continue;
+
+    std::string record;
+    record.append(std::to_string(mark.second.dev)).push_back(' ');
+    record.append(std::to_string(mark.second.inode)).push_back(' ');
+    record.append(std::to_string(mark.second.offset)).push_back(' ');
+    record.append(std::to_string(mark.second.lineno)).push_back(' ');
+    record.append(std::to_string(mark.second.hash)).push_back(' ');
+    record.append(mark.first);
+
+    ok = ok && fwrite(record.c_str(), record.size() + 1, 1, file) == 1;
+  }
+
+  if (fclose(file) != 0)
+    ok = false;
+
+  if (!ok || rename(temp.c_str(), flag_checkpoint) != 0)
+  {
+    warning("cannot save checkpoint", flag_checkpoint);
+    remove(temp.c_str());
+  }
+}
+
+// FNV-1a hash of the CHECKPOINT_TAIL bytes before the offset in a file
+uint64_t Checkpoint::hash(int fd, off_t offset)
+{
+  char buf[CHECKPOINT_TAIL];
+  off_t from = std::max(static_cast<off_t>(0), offset - static_cast<off_t>(CHECKPOINT_TAIL));
+  ssize_t len = from < offset ? pread(fd, buf, static_cast<size_t>(offset - from), from) : 0;
+  uint64_t h = 14695981039346656037ULL;
+
+  for (ssize_t i = 0; i < len; ++i)
+    h = (h ^ static_cast<unsigned char>(buf[i])) * 1099511628211ULL;
+
+  return h;
+}
+
+#endif
+
+// search the specified files or standard input for pattern matches
+void Grep::ugrep()
+{
+  // read each input file to find pattern matches
+  if (flag_stdin)
+  {
+    Stats::score_file();
+
+    // search standard input
+    search(Static::LABEL_STANDARD_INPUT, static_cast<uint16_t>(flag_fuzzy));
+  }
+
+#ifndef OS_WIN
+  // --follow: search the files and keep searching the data appended to the files
+  if (flag_follow)
+  {
+    follow_files();
+    return;
+  }
+
+  // --snapshot: load the snapshot to search the files selected before, when the directories did not change
+  if (flag_snapshot != NULL)
+    snapshot.open();
+#endif
+
+  if (Static::arg_files.empty())
+  {
+    if (flag_directories_action == Action::RECURSE)
+      recurse_root(".");
+  }
+  else
+  {
+#ifndef OS_WIN
+    std::pair<std::set<ino_t>::iterator,bool> vino;
+#endif
+
+    for (const auto pathname : Static::arg_files)
+    {
+      // stop after finding max-files matching files
+      if (flag_max_files > 0 && Stats::found_parts() >= flag_max_files)
+        break;
+
+      // stop when output is blocked or search cancelled
+      if (out.eof || out.cancelled())
+        break;
+
+      // search file or directory, get the basename from the file argument first
+      const char *basename = strrchr(pathname, PATHSEPCHR);
+      if (basename != NULL)
+        ++basename;
+      else
+        basename = pathname;
+
+      ino_t inode = 0;
+      uint64_t info;
+
+      // search file or recursively search directory based on selection criteria
+      switch (select(1, pathname, basename, DIRENT_TYPE_UNKNOWN, inode, info, true))
+      {
+        case Type::DIRECTORY:
+          if (flag_directories_action != Action::SKIP)
+          {
+#ifndef OS_WIN
+            if (flag_dereference)
+              vino = visited.insert(inode);
+#endif
+
+            recurse_root(pathname);
+
+#ifndef OS_WIN
+            if (flag_dereference)
+              visited.erase(vino.first);
+#endif
+          }
+          break;
+
+        case Type::OTHER:
+          search(pathname, Entry::UNDEFINED_COST);
+          break;
+
+        case Type::SKIP:
+          break;
+      }
+    }
+  }
+
+#ifndef OS_WIN
+  // --snapshot: save the snapshot when changed
+  if (flag_snapshot != NULL && !out.eof && !out.cancelled())
+    snapshot.close();
+#endif
+}
+
+#ifndef OS_WIN
+
+// --follow: search the FILE arguments and the files in the DIR arguments, then search the data appended as the files grow
+void Grep::follow_files()
+{
+  std::list<Follow> files;            // the files followed, a list to keep Follow pointers valid
+  std::set<std::string> followed;     // the pathnames of the files followed
+  std::vector<std::string> dirs;      // the DIR arguments to check for new files to follow
+  std::set<std::string> parents;      // the directories to watch for changes
+
+  for (const auto pathname : Static::arg_files)
+  {
+    const char *basename = strrchr(pathname, PATHSEPCHR);
+    if (basename != NULL)
+      ++basename;
+    else
+      basename = pathname;
+
+    ino_t inode = 0;
+    uint64_t info;
+
+    switch (select(1, pathname, basename, DIRENT_TYPE_UNKNOWN, inode, info, true))
+    {
+      case Type::DIRECTORY:
+        if (flag_directories_action != Action::SKIP)
+        {
+          dirs.emplace_back(pathname);
+          parents.insert(pathname);
+        }
+        break;
+
+      case Type::OTHER:
+        if (followed.insert(pathname).second)
+        {
+          files.emplace_back(pathname);
+          parents.insert(basename > pathname ? std::string(pathname, basename - pathname) : std::string("."));
+        }
+        break;
+
+      case Type::SKIP:
+        break;
+    }
+  }
+
+  int watch_fd = -1;
+
+#ifdef __linux__
+  // watch the directories of the files followed to detect appends, truncation, rotation and new files
+  watch_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (watch_fd >= 0)
+  {
+    for (const auto& parent : parents)
+    {
+      if (inotify_add_watch(watch_fd, parent.c_str(), IN_MODIFY | IN_CLOSE_WRITE | IN_CREATE | IN_MOVED_TO) < 0)
+      {
+        // cannot watch all directories, poll the files instead
+        close(watch_fd);
+        watch_fd = -1;
+        break;
+      }
+    }
+  }
+#endif
+
+  bool rescan = true;
+
+  while (!out.eof && !out.cancelled())
+  {
+    // follow the new files in the DIR arguments, new files are searched from the start
+    if (rescan)
+    {
+      for (const auto& dir : dirs)
+      {
+        DIR *dir_ptr = opendir(dir.c_str());
+        if (dir_ptr == NULL)
+          continue;
+
+        struct dirent *dirent;
+        while ((dirent = readdir(dir_ptr)) != NULL)
+        {
+          if (dirent->d_name[0] == '.' && (dirent->d_name[1] == '\0' || (dirent->d_name[1] == '.' && dirent->d_name[2] == '\0')))
+            continue;
+
+          std::string pathname(dir);
+          if (pathname.back() != PATHSEPCHR)
+            pathname.push_back(PATHSEPCHR);
+          pathname.append(dirent->d_name);
+
+          if (followed.find(pathname) != followed.end())
+            continue;
+
+          ino_t inode = 0;
+          uint64_t info;
+
+#ifdef HAVE_STRUCT_DIRENT_D_TYPE
+          int type = dirent->d_type;
+#else
+          int type = DIRENT_TYPE_UNKNOWN;
+#endif
+
+          if (select(2, pathname.c_str(), dirent->d_name, type, inode, info) == Type::OTHER)
+          {
+            followed.insert(pathname);
+
+            // a file rotated to a new name is still followed until the rotation is detected
+            struct stat buf;
+            bool rotated = false;
+            if (stat(pathname.c_str(), &buf) == 0)
+              for (const auto& file : files)
+                if (file.fd >= 0 && file.inode == buf.st_ino)
+                  rotated = true;
+
+            if (!rotated)
+              files.emplace_back(pathname);
+          }
+        }
+
+        closedir(dir_ptr);
+      }
+    }
+
+    for (auto& file : files)
+    {
+      if (out.eof || out.cancelled())
+        break;
+
+      follow_file(file);
+    }
+
+    out.flush();
+
+    rescan = watch_fd < 0;
+
+    if (watch_fd >= 0)
+    {
+#ifdef __linux__
+      // wait for changes to the watched directories, but wake up periodically to check if the output was closed
+      struct pollfd pfd = { watch_fd, POLLIN, 0 };
+      if (poll(&pfd, 1, FOLLOW_POLL) > 0)
+      {
+        // drain the events, new files in the DIR arguments require a rescan
+        alignas(struct inotify_event) char events[4096];
+        ssize_t len;
+        while ((len = read(watch_fd, events, sizeof(events))) > 0)
+        {
+          for (char *ptr = events; ptr < events + len; ptr += sizeof(struct inotify_event) + reinterpret_cast<struct inotify_event*>(ptr)->len)
+            if ((reinterpret_cast<struct inotify_event*>(ptr)->mask & (IN_CREATE | IN_MOVED_TO)) != 0)
+              rescan = true;
+        }
+      }
+#endif
+    }
+    else
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(FOLLOW_POLL));
+    }
+  }
+
+  if (watch_fd >= 0)
+    close(watch_fd);
+
+  for (auto& file : files)
+    if (file.fd >= 0)
+      close(file.fd);
+}
+
+// --follow and --checkpoint: the end of the last complete line in the byte range [offset,size) of a file, or size when the last line is too long
+static off_t complete_lines_end(int fd, off_t offset, off_t size)
+{
+  char buf[4096];
+  off_t end = size;
+
+  while (end > offset && size - end < MAX_PARTIAL_LINE)
+  {
+    off_t from = std::max(offset, end - static_cast<off_t>(sizeof(buf)));
+    ssize_t len = pread(fd, buf, static_cast<size_t>(end - from), from);
+    if (len <= 0)
+      break;
+
+    for (ssize_t i = len; i > 0; --i)
+      if (buf[i - 1] == '\n')
+        return from + i;
+
+    end = from;
+  }
+
+  return end > offset ? size : offset;
+}
+
+// --follow: search the data appended to a followed file, reopen the file when rotated, when final search the last incomplete line
+void Grep::follow_file(Follow& file, bool final)
+{
+  struct stat buf;
+
+  if (!final)
+  {
+    // open the file when not opened yet or reopen the file when rotated, after searching the rest of the rotated file
+    if (stat(file.pathname.c_str(), &buf) != 0 || (file.fd >= 0 && buf.st_ino == file.inode))
+    {
+      if (file.fd < 0)
+        return;
+    }
+    else
+    {
+      if (file.fd >= 0)
+      {
+        follow_file(file, true);
+        close(file.fd);
+      }
+
+      file.fd = open(file.pathname.c_str(), O_RDONLY | O_CLOEXEC);
+      if (file.fd < 0)
+      {
+        warning("cannot read", file.pathname.c_str());
+        return;
+      }
+
+      file.inode = buf.st_ino;
+      file.offset = 0;
+      file.lineno = 1;
+    }
+  }
+
+  if (fstat(file.fd, &buf) != 0)
+    return;
+
+  // the file was truncated, search the file from the start
+  if (buf.st_size < file.offset)
+  {
+    file.offset = 0;
+    file.lineno = 1;
+  }
+
+  // search complete lines, unless this is the final search of the file
+  follow_range(file, final ? buf.st_size : complete_lines_end(file.fd, file.offset, buf.st_size), Entry::UNDEFINED_COST);
 }
 
-// cancel the search
-void Static::cancel_ugrep()
+// --follow and --checkpoint: search the byte range [file.offset,end) of a file, then advance the offset and line number to the end
+void Grep::follow_range(Follow& file, off_t end, uint16_t cost)
 {
-  std::unique_lock<std::mutex> lock(Static::grep_handle_mutex);
-  if (Static::grep_handle != NULL)
-    Static::grep_handle->cancel();
+  if (end <= file.offset || out.eof || out.cancelled())
+    return;
+
+  rangebuf range(file.fd, file.offset, end);
+  std::istream stream(&range);
+
+  // --max-files: count a file once, undo the count of a range that matched before, the search counts the file again when this range matches
+  if (file.found)
+    Stats::undo_found_part();
+
+  file.stream = &stream;
+  follow = &file;
+  search(file.pathname.c_str(), cost);
+  follow = NULL;
+  file.stream = NULL;
+
+  if (file.matched)
+    file.found = true;
+  else if (file.found)
+    Stats::found_part();
+
+  file.offset = end;
+  file.lineno += range.lines();
 }
 
-// search the specified files or standard input for pattern matches
-void Grep::ugrep()
+// --checkpoint: search a file from its checkpoint, returns false when the file is not a regular file to search as usual
+bool Grep::checkpoint_file(const char *pathname, uint16_t cost)
 {
-  // read each input file to find pattern matches
-  if (flag_stdin)
-  {
-    Stats::score_file();
+  struct stat buf;
+  Follow file(pathname);
 
-    // search standard input
-    search(Static::LABEL_STANDARD_INPUT, static_cast<uint16_t>(flag_fuzzy));
-  }
+  file.fd = open(pathname, O_RDONLY | O_CLOEXEC);
+  if (file.fd < 0)
+    return false;
 
-  if (Static::arg_files.empty())
+  if (fstat(file.fd, &buf) != 0 || !S_ISREG(buf.st_mode))
   {
-    if (flag_directories_action == Action::RECURSE)
-      recurse(1, ".");
+    close(file.fd);
+    return false;
   }
-  else
+
+  // continue from the checkpoint when the file was not replaced, truncated or rewritten
+  Checkpoint::Mark mark;
+  if (checkpoint.find(file.pathname, mark) &&
+      mark.dev == static_cast<uint64_t>(buf.st_dev) &&
+      mark.inode == static_cast<uint64_t>(buf.st_ino) &&
+      mark.offset <= static_cast<uint64_t>(buf.st_size) &&
+      mark.hash == Checkpoint::hash(file.fd, static_cast<off_t>(mark.offset)))
   {
-#ifndef OS_WIN
-    std::pair<std::set<ino_t>::iterator,bool> vino;
-#endif
+    file.offset = static_cast<off_t>(mark.offset);
+    file.lineno = static_cast<size_t>(mark.lineno);
+  }
 
-    for (const auto pathname : Static::arg_files)
-    {
-      // stop after finding max-files matching files
-      if (flag_max_files > 0 && Stats::found_parts() >= flag_max_files)
-        break;
+  // search complete lines, the last incomplete line is searched by the next run when complete
+  follow_range(file, complete_lines_end(file.fd, file.offset, buf.st_size), cost);
 
-      // stop when output is blocked or search cancelled
-      if (out.eof || out.cancelled())
-        break;
+  // checkpoint the file when the search was not cancelled
+  if (!out.eof && !out.cancelled())
+  {
+    mark.dev = static_cast<uint64_t>(buf.st_dev);
+    mark.inode = static_cast<uint64_t>(buf.st_ino);
+    mark.offset = static_cast<uint64_t>(file.offset);
+    mark.lineno = static_cast<uint64_t>(file.lineno);
+    mark.hash = Checkpoint::hash(file.fd, file.offset);
+    checkpoint.add(file.pathname, mark);
+  }
 
-      // search file or directory, get the basename from the file argument first
-      const char *basename = strrchr(pathname, PATHSEPCHR);
-      if (basename != NULL)
-        ++basename;
-      else
-        basename = pathname;
+  close(file.fd);
 
-      ino_t inode = 0;
-      uint64_t info;
+  return true;
+}
 
-      // search file or recursively search directory based on selection criteria
-      switch (select(1, pathname, basename, DIRENT_TYPE_UNKNOWN, inode, info, true))
-      {
-        case Type::DIRECTORY:
-          if (flag_directories_action != Action::SKIP)
-          {
-#ifndef OS_WIN
-            if (flag_dereference)
-              vino = visited.insert(inode);
 #endif
 
-            recurse(1, pathname);
-
+// recursively search a directory specified as a FILE argument or the working directory
+void Grep::recurse_root(const char *pathname)
+{
 #ifndef OS_WIN
-            if (flag_dereference)
-              visited.erase(vino.first);
-#endif
-          }
-          break;
+  if (flag_snapshot != NULL)
+  {
+    // --snapshot: search the files selected before by the recursive search, without traversing directories
+    const std::vector<std::string> *files = snapshot.replay(pathname);
 
-        case Type::OTHER:
-          search(pathname, Entry::UNDEFINED_COST);
+    if (files != NULL)
+    {
+      for (const auto& file : *files)
+      {
+        // stop after finding max-files matching files
+        if (flag_max_files > 0 && Stats::found_parts() >= flag_max_files)
           break;
 
-        case Type::SKIP:
+        // stop when output is blocked or search cancelled
+        if (out.eof || out.cancelled())
           break;
+
+        Stats::score_file();
+
+        search(file.c_str(), Entry::UNDEFINED_COST);
       }
+
+      return;
     }
+
+    snapshot.add_root(pathname);
   }
+#endif
+
+  recurse(1, pathname);
 }
 
 // select file or directory to search for pattern matches, return SKIP, DIRECTORY or OTHER
@@ -8551,7 +10759,7 @@ Grep::Type Grep::select(size_t level, const char *pathname, const char *basename
   bool follow = flag_dereference || is_argument;
 
   // if dir entry is unknown and not following, then use lstat() to check if pathname is a symlink
-  if (type != DIRENT_TYPE_UNKNOWN || follow || lstat(pathname, &buf) == 0)
+  if (type != DIRENT_TYPE_UNKNOWN || follow || stat_entry(pathname, basename, &buf, false) == 0)
   {
     // is it a symlink? If dir entry unknown and following then set to symlink = true to call stat() below
     bool symlink = type != DIRENT_TYPE_UNKNOWN ? type == DIRENT_TYPE_LNK : follow ? true : S_ISLNK(buf.st_mode);
@@ -8561,7 +10769,7 @@ Grep::Type Grep::select(size_t level, const char *pathname, const char *basename
           ) &&
           (flag_sort_key == Sort::NA || flag_sort_key == Sort::NAME)            /* and we're not sorting or by name */
         ) ||
-        stat(pathname, &buf) == 0)
+        stat_entry(pathname, basename, &buf, true) == 0)
     {
       // check if directory
       if (type == DIRENT_TYPE_DIR || ((type == DIRENT_TYPE_UNKNOWN || type == DIRENT_TYPE_LNK) && S_ISDIR(buf.st_mode)))
@@ -8768,6 +10976,167 @@ Grep::Type Grep::select(size_t level, const char *pathname, const char *basename
   return Type::SKIP;
 }
 
+#ifndef OS_WIN
+
+// stat() or lstat() a file or directory to select, returns zero on success
+int Grep::stat_entry(const char *pathname, const char *basename, struct stat *buf, bool follow)
+{
+#ifdef WITH_STATX
+
+  // statx() only the file information we need, relative to the directory being read by recurse(), plus the link count and
+  // owner that are cheap to get, to fill in the stat struct like stat() except for the sizes of blocks
+  unsigned int mask = STATX_TYPE | STATX_MODE | STATX_INO | STATX_NLINK | STATX_UID | STATX_GID;
+  int flags = AT_NO_AUTOMOUNT | (follow ? 0 : AT_SYMLINK_NOFOLLOW);
+
+  switch (flag_sort_key)
+  {
+    case Sort::SIZE:
+      mask |= STATX_SIZE;
+      break;
+
+    case Sort::USED:
+      mask |= STATX_ATIME;
+      break;
+
+    case Sort::CHANGED:
+      mask |= STATX_MTIME;
+      break;
+
+    case Sort::CREATED:
+      mask |= STATX_CTIME;
+      break;
+
+    default:
+      // the file type and inode do not change, no need to synchronize with a network file server
+      flags |= AT_STATX_DONT_SYNC;
+  }
+
+  struct statx stx;
+
+#ifdef WITH_GETDENTS64
+  if (statx(dir_fd, dir_fd == AT_FDCWD ? pathname : basename, flags, mask, &stx) != 0)
+    return -1;
+#else
+  (void)basename;
+  if (statx(AT_FDCWD, pathname, flags, mask, &stx) != 0)
+    return -1;
+#endif
+
+  memset(buf, 0, sizeof(struct stat));
+  buf->st_dev = makedev(stx.stx_dev_major, stx.stx_dev_minor);
+  buf->st_mode = stx.stx_mode;
+  buf->st_ino = stx.stx_ino;
+  buf->st_nlink = stx.stx_nlink;
+  buf->st_uid = stx.stx_uid;
+  buf->st_gid = stx.stx_gid;
+  buf->st_size = stx.stx_size;
+  buf->st_atim.tv_sec = stx.stx_atime.tv_sec;
+  buf->st_atim.tv_nsec = stx.stx_atime.tv_nsec;
+  buf->st_mtim.tv_sec = stx.stx_mtime.tv_sec;
+  buf->st_mtim.tv_nsec = stx.stx_mtime.tv_nsec;
+  buf->st_ctim.tv_sec = stx.stx_ctime.tv_sec;
+  buf->st_ctim.tv_nsec = stx.stx_ctime.tv_nsec;
+
+  return 0;
+
+#else
+
+  (void)basename;
+  return follow ? stat(pathname, buf) : lstat(pathname, buf);
+
+#endif
+}
+
+#endif
+
+#ifdef WITH_GETDENTS64
+
+// Linux getdents64() directory entry
+struct linux_dirent64 {
+  uint64_t       d_ino;
+  int64_t        d_off;
+  unsigned short d_reclen;
+  unsigned char  d_type;
+  char           d_name[256];
+};
+
+// read the next directory entry from the buffer, refill the buffer with getdents64() when empty, returns NULL when done
+static struct linux_dirent64 *read_dirent(int fd, char *buffer, size_t& pos, size_t& len)
+{
+  if (pos >= len)
+  {
+    ssize_t num = syscall(SYS_getdents64, fd, buffer, DIRENT_BUFFER_SIZE);
+
+    if (num <= 0)
+      return NULL;
+
+    pos = 0;
+    len = static_cast<size_t>(num);
+  }
+
+  struct linux_dirent64 *dirent = reinterpret_cast<struct linux_dirent64*>(buffer + pos);
+  pos += dirent->d_reclen;
+
+  return dirent;
+}
+
+#endif
+
+#ifndef OS_WIN
+
+// the device of an open directory with its file system id and --device-jobs limit, looked up once per device and cached
+static Device *get_device(int fd)
+{
+  struct stat buf;
+
+  if (fstat(fd, &buf) != 0)
+    return NULL;
+
+  std::map<dev_t,Device>::iterator found = devices.find(buf.st_dev);
+
+  if (found != devices.end())
+    return &found->second;
+
+  Device& device = devices[buf.st_dev];
+
+#ifdef HAVE_STATVFS
+  struct statvfs vfs;
+
+  if (fstatvfs(fd, &vfs) == 0)
+  {
+    device.fsid = static_cast<uint64_t>(vfs.f_fsid);
+    device.has_fsid = true;
+  }
+#endif
+
+#ifdef __linux__
+  // Linux: check if the disk is rotational, a partition has no queue of its own but its parent disk has
+  char path[64];
+
+  snprintf(path, sizeof(path), "/sys/dev/block/%u:%u/queue/rotational", major(buf.st_dev), minor(buf.st_dev));
+
+  FILE *file = fopen(path, "r");
+
+  if (file == NULL)
+  {
+    snprintf(path, sizeof(path), "/sys/dev/block/%u:%u/../queue/rotational", major(buf.st_dev), minor(buf.st_dev));
+    file = fopen(path, "r");
+  }
+
+  if (file != NULL)
+  {
+    device.rotational = fgetc(file) == '1';
+    fclose(file);
+  }
+#endif
+
+  device.limit = flag_device_jobs > 0 ? flag_device_jobs : device.rotational ? ROTATIONAL_JOBS : 0;
+
+  return &device;
+}
+
+#endif
+
 // recurse over directory, searching for pattern matches in files and subdirectories
 void Grep::recurse(size_t level, const char *pathname)
 {
@@ -8775,6 +11144,9 @@ void Grep::recurse(size_t level, const char *pathname)
   if (out.eof || out.cancelled())
     return;
 
+  // search the files in inode order instead of directory order
+  bool seeky = false;
+
 #ifdef OS_WIN
 
   WIN32_FIND_DATAW ffd;
@@ -8798,32 +11170,66 @@ void Grep::recurse(size_t level, const char *pathname)
 
 #else
 
-#ifdef HAVE_STATVFS
+#ifdef WITH_GETDENTS64
+  int dir = open(pathname, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
 
-  if (!exclude_fs_ids.empty() || !include_fs_ids.empty())
+  if (dir < 0)
   {
-    struct statvfs buf;
+    warning("cannot open directory", pathname);
+    return;
+  }
 
-    if (statvfs(pathname, &buf) == 0)
-    {
-      uint64_t id = static_cast<uint64_t>(buf.f_fsid);
+  Device *dir_device = get_device(dir);
+#else
+  DIR *dir = opendir(pathname);
 
-      if (exclude_fs_ids.find(id) != exclude_fs_ids.end())
-        return;
+  if (dir == NULL)
+  {
+    warning("cannot open directory", pathname);
+    return;
+  }
 
-      if (!include_fs_ids.empty() && include_fs_ids.find(id) == include_fs_ids.end())
-        return;
+  Device *dir_device = get_device(dirfd(dir));
+#endif
+
+#ifdef HAVE_STATVFS
+
+  // --exclude-fs and --include-fs: check the file system id of the directory's device
+  if (dir_device != NULL && dir_device->has_fsid && (!exclude_fs_ids.empty() || !include_fs_ids.empty()))
+  {
+    uint64_t id = dir_device->fsid;
+
+    if (exclude_fs_ids.find(id) != exclude_fs_ids.end() ||
+        (!include_fs_ids.empty() && include_fs_ids.find(id) == include_fs_ids.end()))
+    {
+#ifdef WITH_GETDENTS64
+      close(dir);
+#else
+      closedir(dir);
+#endif
+      return;
     }
   }
 
 #endif
 
-  DIR *dir = opendir(pathname);
+  // --device-jobs: search the files on the device of this directory with its limit, unless sorted with --sort
+  device = dir_device != NULL && dir_device->limit > 0 && flag_sort_key == Sort::NA ? dir_device : NULL;
 
-  if (dir == NULL)
+  // search the files on a rotational disk in inode order to limit disk seeks
+  seeky = dir_device != NULL && dir_device->rotational && flag_sort_key == Sort::NA;
+
+  // --snapshot: record the directory's modification time to validate the snapshot
+  if (flag_snapshot != NULL && snapshot.recording)
   {
-    warning("cannot open directory", pathname);
-    return;
+    struct stat buf;
+
+#ifdef WITH_GETDENTS64
+    if (fstat(dir, &buf) == 0)
+#else
+    if (fstat(dirfd(dir), &buf) == 0)
+#endif
+      snapshot.add_dir(pathname, buf);
   }
 
   bool index_demand = Static::index_pattern != NULL;
@@ -8858,6 +11264,17 @@ void Grep::recurse(size_t level, const char *pathname)
           saved = true;
         }
 
+#ifndef OS_WIN
+        // --snapshot: record the ignore file's modification time to validate the snapshot
+        if (flag_snapshot != NULL && snapshot.recording)
+        {
+          struct stat buf;
+
+          if (fstat(fileno(file), &buf) == 0)
+            snapshot.add_dir(ignore_filename.c_str(), buf, true);
+        }
+#endif
+
         // push globs imported from the ignore file to the back of the vectors
         Stats::ignore_file(ignore_filename);
         import_globs(file, flag_all_exclude, flag_all_exclude_dir, true);
@@ -8946,10 +11363,24 @@ void Grep::recurse(size_t level, const char *pathname)
 
 #else
 
-  struct dirent *dirent = NULL;
   uint64_t list = 0;
 
+#ifdef WITH_GETDENTS64
+  // read directory entries in bulk, allocate a buffer, not on the stack, because we are in a deeply recursive function
+  char *dirent_buffer = new char[DIRENT_BUFFER_SIZE];
+  size_t dirent_pos = 0;
+  size_t dirent_len = 0;
+  struct linux_dirent64 *dirent = NULL;
+
+  // stat the entries relative to this directory
+  dir_fd = dir;
+
+  while ((dirent = read_dirent(dir, dirent_buffer, dirent_pos, dirent_len)) != NULL)
+#else
+  struct dirent *dirent = NULL;
+
   while ((dirent = readdir(dir)) != NULL)
+#endif
   {
     // search directory entries that aren't . or .. or hidden
     if (dirent->d_name[0] != '.' || (flag_hidden && dirent->d_name[1] != '\0' && dirent->d_name[1] != '.'))
@@ -9130,10 +11561,18 @@ void Grep::recurse(size_t level, const char *pathname)
           break;
 
         case Type::OTHER:
-          if (flag_sort_key == Sort::NA)
+          if (flag_sort_key == Sort::NA && !seeky)
+          {
+            // --snapshot: record the file selected to search
+            if (flag_snapshot != NULL)
+              snapshot.add_file(entry_pathname);
+
             search(entry_pathname.c_str(), Entry::UNDEFINED_COST);
+          }
           else
+          {
             file_entries.emplace_back(entry_pathname, inode, info);
+          }
           break;
 
         case Type::SKIP:
@@ -9150,31 +11589,29 @@ void Grep::recurse(size_t level, const char *pathname)
     }
   }
 
+#ifdef WITH_GETDENTS64
+  dir_fd = AT_FDCWD;
+  delete[] dirent_buffer;
+  close(dir);
+#else
   closedir(dir);
   dir = NULL;
+#endif
 
 #endif
 
   // -Z and --sort=best: presearch the selected files to determine edit distance cost
   if (flag_fuzzy > 0 && flag_sort_key == Sort::BEST)
+    compute_costs(file_entries);
+
+  // --sort: sort the selected non-directory entries and search them, or in inode order on a rotational disk
+  if (flag_sort_key != Sort::NA || seeky)
   {
-    auto entry = file_entries.begin();
-    while (entry != file_entries.end())
+    if (flag_sort_key == Sort::NA)
     {
-      entry->cost = compute_cost(entry->pathname.c_str());
-
-      // if a file cannot be opened, then remove it
-      if (entry->cost == Entry::UNDEFINED_COST)
-        entry = file_entries.erase(entry);
-      else
-        ++entry;
+      std::sort(file_entries.begin(), file_entries.end(), Entry::comp_by_inode);
     }
-  }
-
-  // --sort: sort the selected non-directory entries and search them
-  if (flag_sort_key != Sort::NA)
-  {
-    if (flag_sort_key == Sort::NAME)
+    else if (flag_sort_key == Sort::NAME)
     {
       if (flag_sort_rev)
         std::sort(file_entries.begin(), file_entries.end(), Entry::rev_comp_by_path);
@@ -9199,6 +11636,12 @@ void Grep::recurse(size_t level, const char *pathname)
     // search the select sorted non-directory entries
     for (const auto& entry : file_entries)
     {
+#ifndef OS_WIN
+      // --snapshot: record the file selected to search
+      if (flag_snapshot != NULL)
+        snapshot.add_file(entry.pathname);
+#endif
+
       search(entry.pathname.c_str(), entry.cost);
 
       // stop after finding max-files matching files
@@ -9211,6 +11654,9 @@ void Grep::recurse(size_t level, const char *pathname)
     }
   }
 
+  // --device-jobs: the files of this directory were submitted, the subdirectories may be on other devices
+  device = NULL;
+
   // --sort: sort the selected subdirectory entries
   if (flag_sort_key != Sort::NA)
   {
@@ -9340,11 +11786,39 @@ uint16_t Grep::compute_cost(const char *pathname)
   return cost;
 }
 
+// -Z and --sort=best: presearch the entries to determine their edit distance costs, removes entries that cannot be opened
+void Grep::compute_costs(std::vector<Entry>& entries)
+{
+  for (auto& entry : entries)
+    entry.cost = compute_cost(entry.pathname.c_str());
+
+  remove_costless(entries);
+}
+
+// -Z and --sort=best: remove entries that cannot be opened and entries that do not match when searching them has no output
+void Grep::remove_costless(std::vector<Entry>& entries)
+{
+  // reuse the presearch result to avoid submitting and opening non-matching files again: search() skips them with
+  // --best-match, otherwise search() finds no matches with the same -Z distance and outputs nothing unless -c, -L or -y
+  // report non-matching files and lines, and --stats counts the files searched
+  bool skip_unmatched = !flag_invert_match && matchers == NULL && (flag_best_match ?
+      !flag_quiet && !flag_files_with_matches :
+      !flag_count && !flag_files_without_match && !flag_any_line && flag_stats == NULL);
+
+  entries.erase(std::remove_if(entries.begin(), entries.end(), [skip_unmatched](const Entry& entry) { return entry.cost == Entry::UNDEFINED_COST || (skip_unmatched && entry.cost == Entry::MAX_COST); }), entries.end());
+}
+
 // search input and display pattern matches
 void Grep::search(const char *pathname, uint16_t cost)
 {
+#ifndef OS_WIN
+  // --checkpoint: search the data appended to the file since the checkpoint
+  if (flag_checkpoint != NULL && follow == NULL && pathname != Static::LABEL_STANDARD_INPUT && checkpoint_file(pathname, cost))
+    return;
+#endif
+
   // -Zbest (or --best-match): compute cost if not yet computed by --sort=best
-  if (flag_best_match && flag_fuzzy > 0 && !flag_quiet && !flag_files_with_matches && matchers == NULL && pathname != Static::LABEL_STANDARD_INPUT)
+  if (flag_best_match && flag_fuzzy > 0 && !flag_quiet && !flag_files_with_matches && matchers == NULL && pathname != Static::LABEL_STANDARD_INPUT && follow == NULL)
   {
     // -Z: matcher is a FuzzyMatcher for sure
     reflex::FuzzyMatcher *fuzzy_matcher = dynamic_cast<reflex::FuzzyMatcher*>(matcher);
@@ -12454,8 +14928,12 @@ exit_search:
     // close file or -z: loop over next extracted archive parts, when applicable
   } while (close_file(pathname));
 
-  // this file or archive has a match
-  if (matched)
+  // --follow: the range has a match
+  if (follow != NULL)
+    follow->matched = matched;
+
+  // this file or archive has a match, count a followed file once when multiple ranges match
+  if (matched && (follow == NULL || !follow->found))
     Stats::found_file();
 }
 
@@ -12799,6 +15277,35 @@ size_t strtopos(const char *string, const char *message)
   return size;
 }
 
+// convert unsigned decimal with optional K, M or G suffix to a positive size_t number of bytes, produce error when conversion fails or when the value is zero
+size_t strtosize(const char *string, const char *message)
+{
+  char *rest = NULL;
+  size_t size = static_cast<size_t>(strtoull(string, &rest, 10));
+  if (rest != NULL && rest > string)
+  {
+    switch (*rest)
+    {
+      case 'G':
+      case 'g':
+        size <<= 10;
+        // fall through
+      case 'M':
+      case 'm':
+        size <<= 10;
+        // fall through
+      case 'K':
+      case 'k':
+        size <<= 10;
+        ++rest;
+        break;
+    }
+  }
+  if (rest == NULL || *rest != '\0' || size == 0)
+    usage(message, string);
+  return size;
+}
+
 // convert one or two comma-separated unsigned decimals specifying a range to positive size_t, produce error when conversion fails or when the range is invalid
 void strtopos2(const char *string, size_t& min, size_t& max, const char *message)
 {
@@ -12916,6 +15423,11 @@ void help(std::ostream& out)
             the --binary-files=text option.  This option might output binary\n\
             garbage to the terminal, which can have problematic consequences if\n\
             the terminal driver interprets some of it as commands.\n\
+    --affinity=numa\n\
+            Spread the worker threads evenly over the NUMA nodes and run each\n\
+            thread on the CPUs of its node, to keep the memory used by a thread\n\
+            local to its node.  This option has no effect on systems with only\n\
+            one NUMA node and is only available on Linux.\n\
     --and [-e] PATTERN ... -e PATTERN\n\
             Specify additional patterns to match.  Patterns must be specified\n\
             with -e.  Each -e PATTERN following this option is considered an\n\
@@ -12987,7 +15499,20 @@ void help(std::ostream& out)
             If -v is specified, counts the number of non-matching lines.  If\n\
             -m1, (with a comma or --min-count=1) is specified, counts only\n\
             matching files without outputting zero matches.  If --tree is\n\
-            specified, outputs directories in a tree-like format.\n\
+            specified, outputs directories in a tree-like format.\n"
+#ifndef OS_WIN
+            "\
+    --checkpoint=FILE\n\
+            Save the byte offset and line number reached in each file searched\n\
+            to FILE.  When FILE exists, searches only the lines appended to the\n\
+            files since the previous search with FILE, continuing the line\n\
+            numbers and byte offsets.  A file that was replaced, truncated or\n\
+            rewritten is searched from the start.  An incomplete last line is\n\
+            searched by the next search when completed.  This option cannot be\n\
+            used with options --filter, --follow, -Q and -z, and with UTF-16,\n\
+            UTF-32 and EBCDIC encodings specified with option --encoding.\n"
+#endif
+            "\
     --color[=WHEN], --colour[=WHEN]\n\
             Mark up the matching text with the expression stored in the\n\
             GREP_COLOR or GREP_COLORS environment variable.  WHEN can be\n\
@@ -13014,6 +15539,12 @@ void help(std::ostream& out)
             followed by the remaining options specified on the command line.\n\
     --confirm\n\
             Confirm actions in -Q query TUI.  The default is confirm.\n\
+    --connect=SOCKET\n\
+            Send the search to the ugrep server listening on SOCKET, see option\n\
+            --server.  The server searches with the standard input, output and\n\
+            error, the working directory and the environment of this command.\n\
+            When the server is not running, searches without the server.  This\n\
+            option must be specified as the first argument.\n\
     --cpp\n\
             Output file matches in C++.  See also options --format and -u.\n\
     --csv\n\
@@ -13041,6 +15572,13 @@ void help(std::ostream& out)
             where -1 (--depth=1) searches the specified path without recursing\n\
             into subdirectories.  Note that -3 -5, -3-5, and -35 search 3 to 5\n\
             levels deep.  Enables -r if -R or -r is not specified.\n\
+    --device-jobs=NUM\n\
+            Search no more than NUM files at the same time on the same storage\n\
+            device when searching directories recursively.  By default, NUM is\n\
+            2 for rotational disks and unlimited for other devices.  Files on a\n\
+            rotational disk are searched in inode order to limit disk seeks.\n\
+            Rotational disks are detected on Linux.  This option has no effect\n\
+            with --sort.\n\
     --dotall\n\
             Dot `.' in regular expressions matches anything, including newline.\n\
             Note that `.*' matches all input and should not be used.\n\
@@ -13150,7 +15688,17 @@ void help(std::ostream& out)
             MAGIC regex pattern.  Only files that have no filename extension\n\
             are labeled, unless +LABEL is specified.  When LABEL matches an\n\
             extension specified in --filter=COMMANDS, the corresponding command\n\
-            is invoked.  This option may be repeated.\n"
+            is invoked.  This option may be repeated.\n\
+    --follow\n\
+            Search the FILE arguments and the files in the DIR arguments, then\n\
+            keep searching the lines appended to the files as they grow, like\n\
+            `tail -F'.  A file is reopened when rotated and searched from the\n\
+            start when truncated.  New files created in a DIR are followed, but\n\
+            DIR arguments are not recursed.  Line numbers and byte offsets\n\
+            continue with the appended lines.  Runs until interrupted.  This\n\
+            option cannot be used with options -c, --filter, -l, -L, -q, -Q, -r\n\
+            and -z, and with UTF-16, UTF-32 and EBCDIC encodings specified with\n\
+            option --encoding.\n"
 #endif
             "\
     --format=FORMAT\n\
@@ -13291,8 +15839,10 @@ void help(std::ostream& out)
     -J NUM, --jobs=NUM\n\
             Specifies the number of threads spawned to search files.  By\n\
             default an optimum number of threads is spawned to search files\n\
-            simultaneously.  -J1 disables threading: files are searched in the\n\
-            same order as specified.\n\
+            simultaneously, adjusting the number of active threads while\n\
+            searching.  -J1 disables threading: files are searched in the same\n\
+            order as specified.  The DFA of a large regex pattern is\n\
+            constructed with up to NUM threads.\n\
     -j, --smart-case\n\
             Perform case insensitive matching like option -i, unless a pattern\n\
             is specified with a literal ASCII upper case letter.\n\
@@ -13346,6 +15896,12 @@ void help(std::ostream& out)
             Restrict the number of files matched to NUM.  Note that --sort or\n\
             -J1 may be specified to produce replicable results.  If --sort is\n\
             specified, the number of threads spawned is limited to NUM.\n\
+    --max-memory=NUM\n\
+            Restrict the memory used by threads to buffer output and to memory\n\
+            map files to NUM bytes.  NUM may have a K, M or G suffix.  When the\n\
+            limit is reached, output is flushed instead of buffered and files\n\
+            are read instead of memory mapped.  The number of threads and the\n\
+            --mmap size per thread are reduced to fit NUM.\n\
     --mmap[=MAX]\n\
             Use memory maps to search files.  By default, memory maps are used\n\
             under certain conditions to improve performance.  When MAX is\n\
@@ -13468,6 +16024,20 @@ void help(std::ostream& out)
             number, byte offset and the matched line.  The default is a colon\n\
             (`:'), a plus (`+') for additional matches on the same line, and a\n\
             bar (`|') for multi-line pattern matches.\n\
+    --server=SOCKET\n\
+            Run a ugrep server listening on the UNIX domain SOCKET for searches\n\
+            sent with option --connect.  Each search runs in a process forked\n\
+            from the server, avoiding the startup cost of ugrep.  Patterns are\n\
+            compiled and worker threads are started by each search.  The SOCKET\n\
+            is accessible to the user only and searches are only accepted from\n\
+            the same user.  This option must be specified as the first argument.\n\
+    --snapshot=FILE\n\
+            Save a snapshot of the recursive search to FILE, listing the\n\
+            directories traversed and the files selected to search.  When FILE\n\
+            exists and the directories, the ignore files and the pathname\n\
+            selection options did not change, searches the files listed in FILE\n\
+            without traversing directories.  Not used with options --index, -M\n\
+            and --sort=KEY other than `name' and `list'.\n\
     --split\n\
             Split the -Q query TUI screen on startup.\n\
     --sort[=KEY]\n\
@@ -448,15 +448,44 @@ struct Static {
   // number of concurrent threads for workers
   static size_t threads;
 
+  // -J not set: the number of active workers to start with, adjusted at runtime between 1 and threads, or zero when fixed
+  static size_t base_threads;
+
   // number of warnings given
   static std::atomic_size_t warnings;
 
+  // --max-memory: bytes of memory used by mmap windows, output buffers and deferred output
+  static std::atomic_size_t memory;
+
+  // --max-memory: true if using size more bytes of memory exceeds the memory budget
+  static bool over_memory(size_t size)
+  {
+    return flag_max_memory > 0 && memory.load(std::memory_order_relaxed) + size > flag_max_memory;
+  }
+
+  // --max-memory: account for size bytes of memory used
+  static void use_memory(size_t size)
+  {
+    if (flag_max_memory > 0)
+      memory.fetch_add(size, std::memory_order_relaxed);
+  }
+
+  // --max-memory: account for size bytes of memory released
+  static void free_memory(size_t size)
+  {
+    if (flag_max_memory > 0)
+      memory.fetch_sub(size, std::memory_order_relaxed);
+  }
+
   // redirectable source is standard input by default or a pipe
   static FILE *source;
 
   // redirectable output destination is standard output by default or a pipe
   static FILE *output;
 
+  // -Q: output channel to the query TUI when output is NULL
+  static struct Channel *channel;
+
   // full home directory path or NULL to expand ~ in options with path arguments
   static const char *home_dir;
 
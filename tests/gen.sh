@@ -188,6 +188,11 @@ $UG --zmax=3 -z -c Hello archive3.tgz         > out/archive3.tgz.out
 $UG --zmax=2 -z -c -tShell Hello archive2.tgz > out/archive2-t.tgz.out
 $UG --zmax=3 -z -c -tShell Hello archive3.tgz > out/archive3-t.tgz.out
 
+for OPS in '-wnk' '-Fwnk' '-wcn' '-Fwon' ; do
+  printf 'print int sprint\nint_x int\nint\nprint_int\n' | $UG $OPS int > out/words_int$OPS.out
+  printf 'print int sprint\nint_x int\nint\nprint_int\n' | $UG $OPS -e in -e int -e print > out/words_in_int_print$OPS.out
+done
+
 for (( i = 0 ; i < 100000 ; i++ )) ; do
   echo "Lorem ipsum dolor sit amet, consectetur adipiscing elit.  Nunc hendrerit at metus sit amet aliquam."
 done | gzip -c > archive.gz
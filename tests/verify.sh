@@ -141,6 +141,12 @@ printf .
 $UG -Rl --ignore-files                   Hello dir1 | $DIFF out/dir--ignore-files.out || ERR "-Rl -ignore-files Hello Hello dir1"
 printf .
 $UG -Rl --filter='sh:head -n1'           Hello dir1 | $DIFF out/dir--filter.out       || ERR "-Rl --filter='sh:head -n1' Hello dir1"
+for JOBS in 1 2 ; do
+  printf .
+  $UG -rl --no-sort --device-jobs=$JOBS Hello dir1 | sort | diff -U1 - <(sort out/dir.out)   || ERR "-rl --no-sort --device-jobs=$JOBS Hello dir1"
+  printf .
+  $UG -Rl --no-sort --device-jobs=$JOBS Hello dir1 | sort | diff -U1 - <(sort out/dir-S.out) || ERR "-Rl --no-sort --device-jobs=$JOBS Hello dir1"
+done
 
 rm -rf dir1 dir2
 
@@ -424,6 +430,142 @@ for PAT in '\.' 'et' 'hendrerit' 'aliquam' 'sit amet aliquam' 'Nunc hendrerit at
 done
 fi
 
+for OPS in '-wnk' '-Fwnk' '-wcn' '-Fwon' ; do
+  printf .
+  printf 'print int sprint\nint_x int\nint\nprint_int\n' | $UG $OPS int | $DIFF out/words_int$OPS.out || ERR "$OPS int"
+  printf .
+  printf 'print int sprint\nint_x int\nint\nprint_int\n' | $UG $OPS -e in -e int -e print | $DIFF out/words_in_int_print$OPS.out || ERR "$OPS -e in -e int -e print"
+done
+
+# verify \b matches after a word character, not only at the start of a word
+printf 'a-x\n' > out/bounds.out
+for PAT in '\b-x' '\b.x' 'a\b-x' ; do
+  printf .
+  printf 'a-x\n' | $UG --no-color "$PAT" | $DIFF out/bounds.out || ERR "'$PAT' on 'a-x'"
+done
+printf '3: \n' > out/bounds.out
+printf .
+printf 'foo bar\n' | $UG --no-color -bo '\b\s' | $DIFF out/bounds.out || ERR "-bo '\\b\\s' on 'foo bar'"
+
+# verify DFA construction with 8 threads matches the serial construction, including anchors that trim followpos
+for PAT in '.*a.{10}(?:b\b)*' '\<a.{10}\>' '^.{0,4}e.{8}' '\Bt.{10}\b' ; do
+  printf .
+  $UG -J1 -co "$PAT" lorem.utf8.txt > out/jobs.out
+  $UG -J8 -co "$PAT" lorem.utf8.txt | $DIFF out/jobs.out || ERR "-J8 -co '$PAT' lorem.utf8.txt"
+done
+
+# verify --stats=vm reports the DFA states removed by minimization, which is skipped for DFAs with edges on few characters
+printf .
+printf 'VM: 22 nodes minimized to 11 nodes\n' > out/vm.out
+$UG --no-color --stats=vm -c '[^ ]*[a-z]{3}' lorem.utf8.txt | sed -n -e 's/ ([0-9]*ms)//g' -e 's/ nodes [0-9]* edges.*/ nodes/p' | $DIFF out/vm.out || ERR "--stats=vm -c '[^ ]*[a-z]{3}' lorem.utf8.txt"
+printf .
+printf 'VM: 4 nodes\n' > out/vm.out
+$UG --no-color --stats=vm -c '(a|b)*abb' lorem.utf8.txt | sed -n -e 's/ ([0-9]*ms)//g' -e 's/ nodes [0-9]* edges.*/ nodes/p' | $DIFF out/vm.out || ERR "--stats=vm -c '(a|b)*abb' lorem.utf8.txt"
+
+# verify --affinity=numa gives the same results and rejects other arguments
+printf .
+$UG -rn -e lorem -e '[a-z]+t\b' lorem.utf8.txt lorem.utf16.txt lorem.latin1.txt Hello.txt > out/affinity.out
+$UG --affinity=numa -rn -e lorem -e '[a-z]+t\b' lorem.utf8.txt lorem.utf16.txt lorem.latin1.txt Hello.txt | $DIFF out/affinity.out || ERR "--affinity=numa -rn -e lorem -e '[a-z]+t\b' lorem.utf8.txt lorem.utf16.txt lorem.latin1.txt Hello.txt"
+printf .
+$UG --affinity=none -rn lorem lorem.utf8.txt > /dev/null 2>&1 && ERR "--affinity=none -rn lorem lorem.utf8.txt"
+
+# verify --max-memory with a budget too small to buffer output or to memory map files gives the same results
+for OPS in '-n' '-c' '-on' '-n -A1' '--files -e lorem -e ipsum' ; do
+  $UG $OPS -e lorem -e '[a-z]+t\b' lorem.utf8.txt lorem.utf16.txt lorem.latin1.txt Hello.txt > out/memory.out
+  for MEM in 1K 16M ; do
+    printf .
+    $UG --max-memory=$MEM $OPS -e lorem -e '[a-z]+t\b' lorem.utf8.txt lorem.utf16.txt lorem.latin1.txt Hello.txt | $DIFF out/memory.out || ERR "--max-memory=$MEM $OPS -e lorem -e '[a-z]+t\b' lorem.utf8.txt lorem.utf16.txt lorem.latin1.txt Hello.txt"
+  done
+done
+
+# verify --snapshot records the files searched, replays them when the directories did not change, and records again when a directory changed
+printf .
+printf 'snapshot/a.txt:1:one\nsnapshot/sub/b.txt:1:one two\n' > out/snapshot.out
+printf 'snapshot/a.txt:1:one\nsnapshot/c.txt:1:one three\nsnapshot/sub/b.txt:1:one two\n' > out/snapshot2.out
+rm -rf snapshot out/snapshot.dat
+mkdir -p snapshot/sub
+printf 'one\n' > snapshot/a.txt
+printf 'one two\n' > snapshot/sub/b.txt
+touch -t 202001010000 snapshot snapshot/sub
+$UG --no-color -rn --snapshot=out/snapshot.dat one snapshot | $DIFF out/snapshot.out || ERR "--no-color -rn --snapshot=out/snapshot.dat one snapshot"
+printf .
+printf 'one three\n' > snapshot/c.txt
+touch -t 202001010000 snapshot
+$UG --no-color -rn --snapshot=out/snapshot.dat one snapshot | $DIFF out/snapshot.out || ERR "--no-color -rn --snapshot=out/snapshot.dat one snapshot replayed"
+printf .
+touch -t 202001020000 snapshot
+$UG --no-color -rn --snapshot=out/snapshot.dat one snapshot | $DIFF out/snapshot2.out || ERR "--no-color -rn --snapshot=out/snapshot.dat one snapshot changed"
+rm -rf snapshot out/snapshot.dat
+
+# verify --connect searches with a --server, and a second server refuses to take over the socket of a running server
+printf .
+rm -f out/server.sock
+$UGREP --server=out/server.sock &
+PID=$!
+for i in 1 2 3 4 5 6 7 8 9 10 ; do test -S out/server.sock && break ; sleep 0.1 ; done
+$UG -n lorem lorem.utf8.txt > out/server.out
+if ! $UGREP --connect=out/server.sock --color=always --sort $@ -n lorem lorem.utf8.txt | $DIFF out/server.out ; then
+  kill $PID
+  ERR "--connect=out/server.sock -n lorem lorem.utf8.txt"
+fi
+printf .
+$UGREP --server=out/server.sock 2> /dev/null &
+PID2=$!
+for i in 1 2 3 4 5 6 7 8 9 10 ; do kill -0 $PID2 2> /dev/null || break ; sleep 0.1 ; done
+if kill $PID2 2> /dev/null ; then
+  kill $PID
+  ERR "--server=out/server.sock with a running server"
+fi
+kill $PID
+wait $PID 2> /dev/null
+rm -f out/server.sock out/server.out
+
+# verify --follow with lines appended, including a partial line, while the file is searched, counted as one file by --max-files
+printf .
+printf '1:one\n2:two\n4:four\n6:zoo\n' > out/follow.out
+printf 'one\ntwo\n' > follow.txt
+$UG --no-color -n --follow --max-files=1 o follow.txt > follow.log &
+PID=$!
+# wait at most 5 seconds for the line to be output, instead of a fixed time for each search of the appended data
+function FOLLOW_WAIT() {
+  for i in 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17 18 19 20 21 22 23 24 25 26 27 28 29 30 31 32 33 34 35 36 37 38 39 40 41 42 43 44 45 46 47 48 49 50 ; do
+    $UGREP -qx "$1" follow.log && break
+    sleep 0.1
+  done
+}
+FOLLOW_WAIT '2:two'
+printf 'three\nfour\nfi' >> follow.txt
+FOLLOW_WAIT '4:four'
+printf 've\nzoo\n' >> follow.txt
+FOLLOW_WAIT '6:zoo'
+kill $PID
+wait $PID 2> /dev/null
+$DIFF out/follow.out < follow.log || ERR "-n --follow --max-files=1 o follow.txt"
+rm -f follow.txt follow.log
+
+# verify --checkpoint searches only the data appended since the last run, the partial last line when completed
+printf .
+printf '1:3:one\n' > out/checkpoint.out
+printf '3:4:three\n5:4:five\n' > out/checkpoint2.out
+printf '6:3:caf\303\251\n' > out/checkpoint3.out
+rm -f checkpoint.dat
+printf 'one\ntwo\nthr' > checkpoint.txt
+$UG --no-color -nk --checkpoint=checkpoint.dat e checkpoint.txt | $DIFF out/checkpoint.out || ERR "-nk --checkpoint=checkpoint.dat e checkpoint.txt"
+printf .
+$UG --no-color -nk --checkpoint=checkpoint.dat e checkpoint.txt | $DIFF /dev/null || ERR "-nk --checkpoint=checkpoint.dat e checkpoint.txt unchanged"
+printf .
+printf 'ee\nfour\nfive\n' >> checkpoint.txt
+$UG --no-color -nk --checkpoint=checkpoint.dat e checkpoint.txt | $DIFF out/checkpoint2.out || ERR "-nk --checkpoint=checkpoint.dat e checkpoint.txt appended"
+printf .
+printf 'caf\351\n' >> checkpoint.txt
+$UG --no-color -nk --checkpoint=checkpoint.dat --encoding=LATIN1 'f\xe9' checkpoint.txt | $DIFF out/checkpoint3.out || ERR "-nk --checkpoint=checkpoint.dat --encoding=LATIN1 'f\xe9' checkpoint.txt"
+rm -f checkpoint.txt checkpoint.dat
+
+# verify column numbers of matches after a long line is shifted out of the buffer
+printf .
+printf '300001:x\n600002+x\n' > out/column.out
+(head -c 300000 /dev/zero | tr '\0' a; printf x; head -c 300000 /dev/zero | tr '\0' a; printf 'x\n') | $UG --no-color -ok x | $DIFF out/column.out || ERR "-ok x on a long line"
+
 # optional: verify SIMD, PM-4, Bitap, and Bloom filter optimizations
 # a=
 # for (( i = 1; i <= 8; ++i )); do
@@ -438,7 +580,7 @@ fi
 #   done
 # done
 
-rm -f out/column.out
+rm -f out/column.out out/vm.out out/affinity.out out/bounds.out out/jobs.out out/memory.out out/snapshot.out out/snapshot2.out out/follow.out out/checkpoint.out out/checkpoint2.out out/checkpoint3.out
 
 echo
 echo "ALL TESTS PASSED"